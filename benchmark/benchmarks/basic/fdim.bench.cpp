@@ -7,6 +7,7 @@
 */
 
 #include "fdim.bench.hpp"
+#include "../../helpers/harness.hpp"
 
 // NOLINTBEGIN
 
@@ -22,6 +23,22 @@ BENCHMARK(BM_basic_fdim_rand_double_std)->RangeMultiplier(2)->Range(8, 8<<10)->C
 
 BENCHMARK(BM_basic_fdim_rand_double_ccmath)->RangeMultiplier(2)->Range(8, 8<<10)->Complexity();
 
+// Latency and throughput over the shared input distributions
+
+namespace cb = ccm::bench;
+
+template <typename T>
+static void register_fdim()
+{
+	cb::register_function<T>(
+		"basic_fdim",
+		[](T x, T y) { return std::fdim(x, y); },
+		[](T x, T y) { return ccm::fdim(x, y); },
+		cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)});
+}
+
+static const bool registered = (register_fdim<float>(), register_fdim<double>(), true);
+
 BENCHMARK_MAIN();
 
 // NOLINTEND
\ No newline at end of file
@@ -7,6 +7,7 @@
 */
 
 #include "fma.bench.hpp"
+#include "../../helpers/harness.hpp"
 
 // NOLINTBEGIN
 
@@ -22,6 +23,22 @@ BENCHMARK(BM_basic_fma_rand_double_std)->RangeMultiplier(2)->Range(8, 8<<10)->Co
 
 BENCHMARK(BM_basic_fma_rand_double_ccmath)->RangeMultiplier(2)->Range(8, 8<<10)->Complexity();
 
+// Latency and throughput over the shared input distributions
+
+namespace cb = ccm::bench;
+
+template <typename T>
+static void register_fma()
+{
+	cb::register_function<T>(
+		"basic_fma",
+		[](T x, T y, T z) { return std::fma(x, y, z); },
+		[](T x, T y, T z) { return ccm::fma(x, y, z); },
+		cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)});
+}
+
+static const bool registered = (register_fma<float>(), register_fma<double>(), true);
+
 BENCHMARK_MAIN();
 
 // NOLINTEND
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_remquo()
+{
+	cb::register_function<T>(
+		"basic_remquo",
+		[](T x, T y) {
+			int quo = 0;
+			const T rem = std::remquo(x, y, &quo);
+			return rem + static_cast<T>(quo);
+		},
+		[](T x, T y) {
+			int quo = 0;
+			const T rem = ccm::remquo(x, y, &quo);
+			return rem + static_cast<T>(quo);
+		},
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<T>{T(-1e2), T(1e2)});
+}
+
+static const bool registered = (register_remquo<float>(), register_remquo<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
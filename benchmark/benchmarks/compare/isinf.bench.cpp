@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_isinf()
+{
+	cb::register_function<T>(
+		"compare_isinf",
+		[](T x) { return std::isinf(x); },
+		[](T x) { return ccm::isinf(x); },
+		cb::range<T>({-1e30F, 1e30F}, {-1e300, 1e300}));
+}
+
+static const bool registered = (register_isinf<float>(), register_isinf<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
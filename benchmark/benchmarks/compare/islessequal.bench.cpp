@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_islessequal()
+{
+	cb::register_function<T>(
+		"compare_islessequal",
+		[](T x, T y) { return std::islessequal(x, y); },
+		[](T x, T y) { return ccm::islessequal(x, y); },
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<T>{T(-1e6), T(1e6)});
+}
+
+static const bool registered = (register_islessequal<float>(), register_islessequal<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
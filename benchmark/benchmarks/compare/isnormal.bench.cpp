@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_isnormal()
+{
+	cb::register_function<T>(
+		"compare_isnormal",
+		[](T x) { return std::isnormal(x); },
+		[](T x) { return ccm::isnormal(x); },
+		cb::range<T>({-1e30F, 1e30F}, {-1e300, 1e300}));
+}
+
+static const bool registered = (register_isnormal<float>(), register_isnormal<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_exp()
+{
+	cb::register_function<T>(
+		"expo_exp",
+		[](T x) { return std::exp(x); },
+		[](T x) { return ccm::exp(x); },
+		cb::range<T>({-87.0F, 88.0F}, {-708.0, 709.0}));
+}
+
+static const bool registered = (register_exp<float>(), register_exp<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_exp2()
+{
+	cb::register_function<T>(
+		"expo_exp2",
+		[](T x) { return std::exp2(x); },
+		[](T x) { return ccm::exp2(x); },
+		cb::range<T>({-126.0F, 127.0F}, {-1022.0, 1023.0}));
+}
+
+static const bool registered = (register_exp2<float>(), register_exp2<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_expm1()
+{
+	cb::register_function<T>(
+		"expo_expm1",
+		[](T x) { return std::expm1(x); },
+		[](T x) { return ccm::expm1(x); },
+		cb::Range<T>{T(-10.0), T(10.0)});
+}
+
+static const bool registered = (register_expm1<float>(), register_expm1<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
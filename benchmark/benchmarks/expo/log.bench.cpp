@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_log()
+{
+	cb::register_function<T>(
+		"expo_log",
+		[](T x) { return std::log(x); },
+		[](T x) { return ccm::log(x); },
+		cb::range<T>({0.0F, 1e30F}, {0.0, 1e300}));
+}
+
+static const bool registered = (register_log<float>(), register_log<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
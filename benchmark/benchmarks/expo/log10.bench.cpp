@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_log10()
+{
+	cb::register_function<T>(
+		"expo_log10",
+		[](T x) { return std::log10(x); },
+		[](T x) { return ccm::log10(x); },
+		cb::range<T>({0.0F, 1e30F}, {0.0, 1e300}));
+}
+
+static const bool registered = (register_log10<float>(), register_log10<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_log1p()
+{
+	cb::register_function<T>(
+		"expo_log1p",
+		[](T x) { return std::log1p(x); },
+		[](T x) { return ccm::log1p(x); },
+		cb::range<T>({-1.0F, 1e30F}, {-1.0, 1e300}));
+}
+
+static const bool registered = (register_log1p<float>(), register_log1p<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
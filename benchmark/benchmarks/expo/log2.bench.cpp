@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_log2()
+{
+	cb::register_function<T>(
+		"expo_log2",
+		[](T x) { return std::log2(x); },
+		[](T x) { return ccm::log2(x); },
+		cb::range<T>({0.0F, 1e30F}, {0.0, 1e300}));
+}
+
+static const bool registered = (register_log2<float>(), register_log2<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_copysign()
+{
+	cb::register_function<T>(
+		"fmanip_copysign",
+		[](T x, T y) { return std::copysign(x, y); },
+		[](T x, T y) { return ccm::copysign(x, y); },
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<T>{T(-1e6), T(1e6)});
+}
+
+static const bool registered = (register_copysign<float>(), register_copysign<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_frexp()
+{
+	cb::register_function<T>(
+		"fmanip_frexp",
+		[](T x) {
+			int exp = 0;
+			const T mant = std::frexp(x, &exp);
+			return mant + static_cast<T>(exp);
+		},
+		[](T x) {
+			int exp = 0;
+			const T mant = ccm::frexp(x, exp);
+			return mant + static_cast<T>(exp);
+		},
+		cb::range<T>({-1e30F, 1e30F}, {-1e300, 1e300}));
+}
+
+static const bool registered = (register_frexp<float>(), register_frexp<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_ldexp()
+{
+	cb::register_function<T>(
+		"fmanip_ldexp",
+		[](T x, int e) { return std::ldexp(x, e); },
+		[](T x, int e) { return ccm::ldexp(x, e); },
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<int>{-60, 60});
+}
+
+static const bool registered = (register_ldexp<float>(), register_ldexp<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_modf()
+{
+	cb::register_function<T>(
+		"fmanip_modf",
+		[](T x) {
+			T ipart{};
+			const T frac = std::modf(x, &ipart);
+			return frac + ipart;
+		},
+		[](T x) {
+			T ipart{};
+			const T frac = ccm::modf(x, &ipart);
+			return frac + ipart;
+		},
+		cb::Range<T>{T(-1e6), T(1e6)});
+}
+
+static const bool registered = (register_modf<float>(), register_modf<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_nexttoward()
+{
+	cb::register_function<T>(
+		"fmanip_nexttoward",
+		[](T x, T y) { return std::nexttoward(x, static_cast<long double>(y)); },
+		[](T x, T y) { return ccm::nexttoward(x, static_cast<long double>(y)); },
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<T>{T(-1e6), T(1e6)});
+}
+
+static const bool registered = (register_nexttoward<float>(), register_nexttoward<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
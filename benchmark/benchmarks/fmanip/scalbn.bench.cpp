@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_scalbn()
+{
+	cb::register_function<T>(
+		"fmanip_scalbn",
+		[](T x, int e) { return std::scalbn(x, e); },
+		[](T x, int e) { return ccm::scalbn(x, e); },
+		cb::Range<T>{T(-1e6), T(1e6)}, cb::Range<int>{-60, 60});
+}
+
+static const bool registered = (register_scalbn<float>(), register_scalbn<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
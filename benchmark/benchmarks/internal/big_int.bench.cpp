@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <ccmath/internal/types/big_int.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// NOLINTBEGIN
+
+/*
+ * BigInt multiplication and division against the algorithms they replaced:
+ *   mul_schoolbook - column by column product with multiword carries (multiword::multiply_with_carry)
+ *   mul_rows       - row by row product in the double-width word (multiword::multiply_rows)
+ *   mul_karatsuba  - Karatsuba's method down to multiword::karatsuba_threshold words, then mul_rows
+ *   div_bitwise    - one quotient bit per step, as BigInt::divide_unsigned did before algorithm D
+ *   div            - BigInt::div, a dividend of Bits bits by a divider of Bits / 2 bits
+ * Each benchmark works through a small pool of random operands, so the timings are not for one lucky value.
+ */
+
+namespace
+{
+	constexpr std::size_t pool_size = 64;
+
+	template <std::size_t Bits>
+	using UInt = ccm::types::UInt<Bits>;
+
+	template <std::size_t Bits>
+	std::vector<UInt<Bits>> random_pool(std::uint64_t seed, std::size_t words = UInt<Bits>::WORD_COUNT)
+	{
+		std::mt19937_64 rng(seed);
+		std::vector<UInt<Bits>> pool(pool_size);
+		for (auto & value : pool)
+		{
+			for (std::size_t i = 0; i < words; ++i) { value[i] = rng(); }
+		}
+		return pool;
+	}
+
+	// The division BigInt used before algorithm D.
+	template <std::size_t Bits>
+	UInt<Bits> divide_bitwise(const UInt<Bits> & dividend, const UInt<Bits> & divider, UInt<Bits> & remainder)
+	{
+		remainder = dividend;
+		UInt<Bits> quotient;
+		if (remainder >= divider)
+		{
+			UInt<Bits> subtractor = divider;
+			int cur_bit			  = ccm::types::multiword::countl_zero(subtractor.val) - ccm::types::multiword::countl_zero(remainder.val);
+			subtractor <<= static_cast<std::size_t>(cur_bit);
+			while (cur_bit >= 0 && remainder > UInt<Bits>())
+			{
+				if (remainder >= subtractor)
+				{
+					remainder -= subtractor;
+					quotient[static_cast<std::size_t>(cur_bit) / 64] |= std::uint64_t(1) << (cur_bit % 64);
+				}
+				--cur_bit;
+				subtractor >>= 1;
+			}
+		}
+		return quotient;
+	}
+} // namespace
+
+template <std::size_t Bits>
+static void BM_big_int_mul_schoolbook(benchmark::State & state)
+{
+	const auto lhs = random_pool<Bits>(1);
+	const auto rhs = random_pool<Bits>(2);
+	std::array<std::uint64_t, 2 * UInt<Bits>::WORD_COUNT> product{};
+	std::size_t i = 0;
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::types::multiword::multiply_with_carry(product, lhs[i].val, rhs[i].val);
+		benchmark::DoNotOptimize(product);
+		i = (i + 1) % pool_size;
+	}
+}
+
+template <std::size_t Bits>
+static void BM_big_int_mul_rows(benchmark::State & state)
+{
+	const auto lhs = random_pool<Bits>(1);
+	const auto rhs = random_pool<Bits>(2);
+	std::array<std::uint64_t, 2 * UInt<Bits>::WORD_COUNT> product{};
+	std::size_t i = 0;
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::types::multiword::multiply_rows(product, lhs[i].val, rhs[i].val);
+		benchmark::DoNotOptimize(product);
+		i = (i + 1) % pool_size;
+	}
+}
+
+template <std::size_t Bits>
+static void BM_big_int_mul_karatsuba(benchmark::State & state)
+{
+	const auto lhs = random_pool<Bits>(1);
+	const auto rhs = random_pool<Bits>(2);
+	std::array<std::uint64_t, 2 * UInt<Bits>::WORD_COUNT> product{};
+	std::size_t i = 0;
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::types::multiword::karatsuba(product, lhs[i].val, rhs[i].val);
+		benchmark::DoNotOptimize(product);
+		i = (i + 1) % pool_size;
+	}
+}
+
+template <std::size_t Bits>
+static void BM_big_int_div_bitwise(benchmark::State & state)
+{
+	const auto dividend = random_pool<Bits>(1);
+	const auto divider	= random_pool<Bits>(2, UInt<Bits>::WORD_COUNT / 2);
+	UInt<Bits> remainder;
+	std::size_t i = 0;
+	for ([[maybe_unused]] auto _ : state)
+	{
+		benchmark::DoNotOptimize(divide_bitwise(dividend[i], divider[i], remainder));
+		benchmark::DoNotOptimize(remainder);
+		i = (i + 1) % pool_size;
+	}
+}
+
+template <std::size_t Bits>
+static void BM_big_int_div(benchmark::State & state)
+{
+	const auto dividend = random_pool<Bits>(1);
+	const auto divider	= random_pool<Bits>(2, UInt<Bits>::WORD_COUNT / 2);
+	std::size_t i		= 0;
+	for ([[maybe_unused]] auto _ : state)
+	{
+		UInt<Bits> quotient = dividend[i];
+		benchmark::DoNotOptimize(quotient.div(divider[i]));
+		benchmark::DoNotOptimize(quotient);
+		i = (i + 1) % pool_size;
+	}
+}
+
+#define CCM_BM_BIG_INT_SIZES(name)                                                                                                                             \
+	BENCHMARK_TEMPLATE(name, 128);                                                                                                                             \
+	BENCHMARK_TEMPLATE(name, 256);                                                                                                                             \
+	BENCHMARK_TEMPLATE(name, 512);                                                                                                                             \
+	BENCHMARK_TEMPLATE(name, 1024);                                                                                                                            \
+	BENCHMARK_TEMPLATE(name, 2048);                                                                                                                            \
+	BENCHMARK_TEMPLATE(name, 4096)
+
+CCM_BM_BIG_INT_SIZES(BM_big_int_mul_schoolbook);
+CCM_BM_BIG_INT_SIZES(BM_big_int_mul_rows);
+CCM_BM_BIG_INT_SIZES(BM_big_int_mul_karatsuba);
+CCM_BM_BIG_INT_SIZES(BM_big_int_div_bitwise);
+CCM_BM_BIG_INT_SIZES(BM_big_int_div);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <ccmath/internal/types/dyadic_float.hpp>
+#include <ccmath/math/expo/impl/exp_correctly_rounded_impl.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+// NOLINTBEGIN
+
+/*
+ * DyadicFloat polynomial evaluation, degree 20 as in the slow path of exp:
+ *   horner_mul_add - Horner with quick_mul then quick_add, normalizing twice per term
+ *   horner_fma     - Horner with quick_fma, normalizing once per term (polyeval)
+ *   polyeval_batch - four points through the batch polyeval, time per point
+ * DyadicFloat<128> goes through the __uint128_t path, DyadicFloat<256> through BigInt.
+ */
+
+namespace
+{
+	constexpr std::size_t degree = 20;
+
+	template <std::size_t Bits>
+	std::array<ccm::types::DyadicFloat<Bits>, degree + 1> random_coeffs()
+	{
+		std::mt19937_64 rng(Bits);
+		std::uniform_real_distribution<double> dist(-1.0, 1.0);
+		std::array<ccm::types::DyadicFloat<Bits>, degree + 1> coeffs{};
+		for (auto & c : coeffs) { c = ccm::types::DyadicFloat<Bits>(dist(rng)); }
+		return coeffs;
+	}
+
+	template <std::size_t Bits>
+	std::array<ccm::types::DyadicFloat<Bits>, 4> random_points()
+	{
+		std::mt19937_64 rng(Bits + 1);
+		std::uniform_real_distribution<double> dist(-0.5, 0.5);
+		std::array<ccm::types::DyadicFloat<Bits>, 4> xs{};
+		for (auto & x : xs) { x = ccm::types::DyadicFloat<Bits>(dist(rng)); }
+		return xs;
+	}
+} // namespace
+
+template <std::size_t Bits>
+static void BM_dyadic_horner_mul_add(benchmark::State & state)
+{
+	const auto coeffs = random_coeffs<Bits>();
+	auto x			  = random_points<Bits>()[0];
+	for ([[maybe_unused]] auto _ : state)
+	{
+		benchmark::DoNotOptimize(x);
+		ccm::types::DyadicFloat<Bits> result = coeffs[degree];
+		for (std::size_t i = degree; i-- > 0;) { result = ccm::types::quick_add(ccm::types::quick_mul(result, x), coeffs[i]); }
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+template <std::size_t Bits>
+static void BM_dyadic_horner_fma(benchmark::State & state)
+{
+	const auto coeffs = random_coeffs<Bits>();
+	auto x			  = random_points<Bits>()[0];
+	for ([[maybe_unused]] auto _ : state)
+	{
+		benchmark::DoNotOptimize(x);
+		benchmark::DoNotOptimize(ccm::types::polyeval(x, coeffs));
+	}
+}
+
+template <std::size_t Bits>
+static void BM_dyadic_polyeval_batch(benchmark::State & state)
+{
+	const auto coeffs = random_coeffs<Bits>();
+	auto xs			  = random_points<Bits>();
+	for ([[maybe_unused]] auto _ : state)
+	{
+		benchmark::DoNotOptimize(xs);
+		benchmark::DoNotOptimize(ccm::types::polyeval(xs, coeffs));
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(xs.size()));
+}
+
+static void BM_dyadic_exp(benchmark::State & state)
+{
+	auto x = ccm::internal::impl::exp_dyadic_t(0.37);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		benchmark::DoNotOptimize(x);
+		benchmark::DoNotOptimize(ccm::internal::impl::exp_dyadic(x));
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_dyadic_horner_mul_add, 128);
+BENCHMARK_TEMPLATE(BM_dyadic_horner_mul_add, 256);
+BENCHMARK_TEMPLATE(BM_dyadic_horner_fma, 128);
+BENCHMARK_TEMPLATE(BM_dyadic_horner_fma, 256);
+BENCHMARK_TEMPLATE(BM_dyadic_polyeval_batch, 128);
+BENCHMARK_TEMPLATE(BM_dyadic_polyeval_batch, 256);
+BENCHMARK(BM_dyadic_exp);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
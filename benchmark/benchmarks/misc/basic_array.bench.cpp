@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/basic.hpp>
+#include <ccmath/math/basic/fdim.hpp>
+#include <ccmath/math/basic/max.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * fmax and fdim over 64Ki pairs of values:
+ *   std    - std::fmax / std::fdim one element at a time
+ *   scalar - ccm::fmax / ccm::fdim one element at a time, with their NaN branches
+ *   ccm    - ccm::ext::fmax / fdim on native_simd lanes
+ */
+
+namespace
+{
+	constexpr std::size_t basic_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> basic_input(std::uint_fast32_t seed)
+	{
+		cb::Randomizer randomizer(seed);
+		return randomizer.generate<T>(cb::Distribution::eUniform, basic_size, T(-100), T(100));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(basic_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_fmax_array_std(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < basic_size; ++i) { out[i] = std::fmax(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_fmax_array_scalar(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < basic_size; ++i) { out[i] = ccm::fmax(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_fmax_array_ccm(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::fmax(x.data(), y.data(), basic_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_fdim_array_std(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < basic_size; ++i) { out[i] = std::fdim(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_fdim_array_scalar(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < basic_size; ++i) { out[i] = ccm::fdim(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_fdim_array_ccm(benchmark::State & state)
+{
+	const auto x = basic_input<T>(11);
+	const auto y = basic_input<T>(13);
+	std::vector<T> out(basic_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::fdim(x.data(), y.data(), basic_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_fmax_array_std, float);
+BENCHMARK_TEMPLATE(BM_fmax_array_scalar, float);
+BENCHMARK_TEMPLATE(BM_fmax_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_fmax_array_std, double);
+BENCHMARK_TEMPLATE(BM_fmax_array_scalar, double);
+BENCHMARK_TEMPLATE(BM_fmax_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_fdim_array_std, float);
+BENCHMARK_TEMPLATE(BM_fdim_array_scalar, float);
+BENCHMARK_TEMPLATE(BM_fdim_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_fdim_array_std, double);
+BENCHMARK_TEMPLATE(BM_fdim_array_scalar, double);
+BENCHMARK_TEMPLATE(BM_fdim_array_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/compensated.hpp>
+#include <ccmath/internal/types/double_double.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Compensated reductions over 64Ki doubles:
+ *   plain  - the uncompensated loop, for reference
+ *   scalar - the same Sum2 / Dot2 error-free transformations one element at a time
+ *   simd   - ccm::ext::compensated_sum / compensated_dot on native_simd<double> lanes
+ */
+
+namespace
+{
+	constexpr std::size_t reduction_size = std::size_t{1} << 16;
+
+	std::vector<double> reduction_input(std::uint64_t seed)
+	{
+		cb::Randomizer randomizer(seed);
+		return randomizer.generate<double>(cb::Distribution::eUniform, reduction_size, -1.0, 1.0);
+	}
+
+	void set_bytes(benchmark::State & state, std::size_t arrays)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(reduction_size));
+		state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(arrays * reduction_size * sizeof(double)));
+	}
+} // namespace
+
+static void BM_sum_plain(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double sum = 0.0;
+		for (double v : x) { sum += v; }
+		benchmark::DoNotOptimize(sum);
+	}
+	set_bytes(state, 1);
+}
+
+static void BM_sum_compensated_scalar(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double hi = 0.0;
+		double lo = 0.0;
+		for (double v : x)
+		{
+			const auto s = ccm::type::two_sum(hi, v);
+			hi			 = s.hi;
+			lo += s.lo;
+		}
+		benchmark::DoNotOptimize(hi + lo);
+	}
+	set_bytes(state, 1);
+}
+
+static void BM_sum_compensated_simd(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::compensated_sum(x)); }
+	set_bytes(state, 1);
+}
+
+static void BM_dot_plain(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	const auto y = reduction_input(2);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double dot = 0.0;
+		for (std::size_t i = 0; i < x.size(); ++i) { dot += x[i] * y[i]; }
+		benchmark::DoNotOptimize(dot);
+	}
+	set_bytes(state, 2);
+}
+
+static void BM_dot_compensated_scalar(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	const auto y = reduction_input(2);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double hi = 0.0;
+		double lo = 0.0;
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			const auto p = ccm::type::exact_mult(x[i], y[i]);
+			const auto s = ccm::type::two_sum(hi, p.hi);
+			hi			 = s.hi;
+			lo += s.lo + p.lo;
+		}
+		benchmark::DoNotOptimize(hi + lo);
+	}
+	set_bytes(state, 2);
+}
+
+static void BM_dot_compensated_simd(benchmark::State & state)
+{
+	const auto x = reduction_input(1);
+	const auto y = reduction_input(2);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::compensated_dot(x, y)); }
+	set_bytes(state, 2);
+}
+
+BENCHMARK(BM_sum_plain);
+BENCHMARK(BM_sum_compensated_scalar);
+BENCHMARK(BM_sum_compensated_simd);
+BENCHMARK(BM_dot_plain);
+BENCHMARK(BM_dot_compensated_scalar);
+BENCHMARK(BM_dot_compensated_simd);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
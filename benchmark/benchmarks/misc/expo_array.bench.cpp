@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/expo.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * exp and log over 64Ki values:
+ *   std     - std::exp / std::log one element at a time
+ *   ccm     - ccm::ext::exp / log on native_simd lanes, every block on the lean path
+ *   sparse  - the same with a NaN every 1024 elements, so a few blocks take the masked path
+ * exp runs on [-80, 80] and log on (0, 1e6].
+ */
+
+namespace
+{
+	constexpr std::size_t expo_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> expo_input(T lo, T hi, bool sparse)
+	{
+		cb::Randomizer randomizer(17);
+		auto values = randomizer.generate<T>(cb::Distribution::eUniform, expo_size, lo, hi);
+		if (sparse)
+		{
+			for (std::size_t i = 0; i < expo_size; i += 1024) { values[i] = std::numeric_limits<T>::quiet_NaN(); }
+		}
+		return values;
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(expo_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_exp_array_std(benchmark::State & state)
+{
+	const auto x = expo_input<T>(T(-80), T(80), false);
+	std::vector<T> out(expo_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < expo_size; ++i) { out[i] = std::exp(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_exp_array_ccm(benchmark::State & state)
+{
+	const auto x = expo_input<T>(T(-80), T(80), state.range(0) != 0);
+	std::vector<T> out(expo_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::exp(x.data(), expo_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_log_array_std(benchmark::State & state)
+{
+	const auto x = expo_input<T>(T(1e-6), T(1e6), false);
+	std::vector<T> out(expo_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < expo_size; ++i) { out[i] = std::log(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_log_array_ccm(benchmark::State & state)
+{
+	const auto x = expo_input<T>(T(1e-6), T(1e6), state.range(0) != 0);
+	std::vector<T> out(expo_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::log(x.data(), expo_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_exp_array_std, float);
+BENCHMARK_TEMPLATE(BM_exp_array_ccm, float)->ArgName("sparse")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_exp_array_std, double);
+BENCHMARK_TEMPLATE(BM_exp_array_ccm, double)->ArgName("sparse")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_log_array_std, float);
+BENCHMARK_TEMPLATE(BM_log_array_ccm, float)->ArgName("sparse")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_log_array_std, double);
+BENCHMARK_TEMPLATE(BM_log_array_ccm, double)->ArgName("sparse")->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/fmanip.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Exponent manipulation over 64Ki values:
+ *   std - std::frexp / std::ldexp / std::ilogb one element at a time
+ *   ccm - ccm::ext::frexp / ldexp / ilogb on native_simd lanes
+ * The input is normal, so the ccm versions stay on the fast path that skips subnormal handling.
+ */
+
+namespace
+{
+	constexpr std::size_t fmanip_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> fmanip_input()
+	{
+		cb::Randomizer randomizer(7);
+		return randomizer.generate<T>(cb::Distribution::eUniform, fmanip_size, T(-1e30), T(1e30));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(fmanip_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_frexp_array_std(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<T> mantissa(fmanip_size);
+	std::vector<int> exp(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < fmanip_size; ++i) { mantissa[i] = std::frexp(x[i], &exp[i]); }
+		benchmark::DoNotOptimize(mantissa.data());
+		benchmark::DoNotOptimize(exp.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_frexp_array_ccm(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<T> mantissa(fmanip_size);
+	std::vector<int> exp(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::frexp(x.data(), fmanip_size, mantissa.data(), exp.data());
+		benchmark::DoNotOptimize(mantissa.data());
+		benchmark::DoNotOptimize(exp.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ldexp_array_std(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<T> out(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < fmanip_size; ++i) { out[i] = std::ldexp(x[i], -20); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ldexp_array_ccm(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<T> out(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::ldexp(x.data(), fmanip_size, -20, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ilogb_array_std(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<int> out(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < fmanip_size; ++i) { out[i] = std::ilogb(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ilogb_array_ccm(benchmark::State & state)
+{
+	const auto x = fmanip_input<T>();
+	std::vector<int> out(fmanip_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::ilogb(x.data(), fmanip_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_frexp_array_std, float);
+BENCHMARK_TEMPLATE(BM_frexp_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_frexp_array_std, double);
+BENCHMARK_TEMPLATE(BM_frexp_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_ldexp_array_std, float);
+BENCHMARK_TEMPLATE(BM_ldexp_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_ldexp_array_std, double);
+BENCHMARK_TEMPLATE(BM_ldexp_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_ilogb_array_std, float);
+BENCHMARK_TEMPLATE(BM_ilogb_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_ilogb_array_std, double);
+BENCHMARK_TEMPLATE(BM_ilogb_array_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
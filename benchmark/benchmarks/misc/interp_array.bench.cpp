@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/lerp.hpp>
+#include <ccmath/ext/smoothstep.hpp>
+#include <ccmath/math/misc/lerp.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Interpolating a keyframe channel of 64Ki values:
+ *   scalar - ccm::lerp / ccm::ext::smoothstep one element at a time
+ *   array  - the ccm::ext array forms on native_simd lanes
+ */
+
+namespace
+{
+	constexpr std::size_t interp_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> interp_input(std::uint32_t seed)
+	{
+		cb::Randomizer randomizer(seed);
+		return randomizer.generate<T>(cb::Distribution::eUniform, interp_size, T(-10), T(10));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(interp_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_lerp_array_scalar(benchmark::State & state)
+{
+	const auto a = interp_input<T>(3);
+	const auto b = interp_input<T>(4);
+	std::vector<T> out(interp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < interp_size; ++i) { out[i] = ccm::lerp(a[i], b[i], T(0.375)); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_lerp_array_ccm(benchmark::State & state)
+{
+	const auto a = interp_input<T>(3);
+	const auto b = interp_input<T>(4);
+	std::vector<T> out(interp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::lerp(a.data(), b.data(), T(0.375), interp_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_smoothstep_array_scalar(benchmark::State & state)
+{
+	const auto x = interp_input<T>(5);
+	std::vector<T> out(interp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < interp_size; ++i) { out[i] = ccm::ext::smoothstep(T(-5), T(5), x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_smoothstep_array_ccm(benchmark::State & state)
+{
+	const auto x = interp_input<T>(5);
+	std::vector<T> out(interp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::smoothstep(T(-5), T(5), x.data(), interp_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_lerp_array_scalar, float);
+BENCHMARK_TEMPLATE(BM_lerp_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_lerp_array_scalar, double);
+BENCHMARK_TEMPLATE(BM_lerp_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_smoothstep_array_scalar, float);
+BENCHMARK_TEMPLATE(BM_smoothstep_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_smoothstep_array_scalar, double);
+BENCHMARK_TEMPLATE(BM_smoothstep_array_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+// std::lerp is C++20. Without it the baseline is the textbook formula.
+#if defined(__cpp_lib_interpolate)
+	#define CCM_BM_LERP_BASELINE(x, y, z) std::lerp(x, y, z)
+#else
+	#define CCM_BM_LERP_BASELINE(x, y, z) ((x) + (z) * ((y) - (x)))
+#endif
+
+template <typename T>
+static void register_lerp()
+{
+	cb::register_function<T>(
+		"misc_lerp",
+		[](T x, T y, T z) { return CCM_BM_LERP_BASELINE(x, y, z); },
+		[](T x, T y, T z) { return ccm::lerp(x, y, z); },
+		cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(0.0), T(1.0)});
+}
+
+static const bool registered = (register_lerp<float>(), register_lerp<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
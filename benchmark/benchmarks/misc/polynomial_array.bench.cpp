@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/special.hpp>
+#include <ccmath/math/special/cyl_bessel_j.hpp>
+#include <ccmath/math/special/legendre.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Every degree up to 32 of 4Ki values, laid out degree-major as the ext forms store them:
+ *   std - std::legendre / std::hermite / std::sph_bessel / std::cyl_bessel_j once per degree and element
+ *   one - ccm::legendre_all once per element, each pass giving every degree
+ *   ccm - ccm::ext::legendre_all / hermite_all / sph_bessel_all / cyl_bessel_j_all, the recurrences on native_simd lanes
+ * legendre runs on [-1, 1], hermite on [-4, 4], sph_bessel on (0, 64] and cyl_bessel_j of the orders 1/3 to 32 + 1/3 on
+ * (0, 64], across the turning points. The std rows need the C++17 special math functions, which libc++ does not provide.
+ */
+
+namespace
+{
+	constexpr std::size_t poly_size	  = std::size_t{1} << 12;
+	constexpr unsigned poly_max_order = 32;
+	constexpr double cyl_order		  = 1.0 / 3.0;
+
+	std::vector<double> poly_input(double lo, double hi)
+	{
+		cb::Randomizer randomizer(11);
+		return randomizer.generate<double>(cb::Distribution::eUniform, poly_size, lo, hi);
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(poly_size * (poly_max_order + 1)));
+	}
+} // namespace
+
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+static void BM_legendre_all_std(benchmark::State & state)
+{
+	const auto x = poly_input(-1.0, 1.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (unsigned l = 0; l <= poly_max_order; ++l)
+		{
+			for (std::size_t i = 0; i < poly_size; ++i) { out[l * poly_size + i] = std::legendre(l, x[i]); }
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+#endif
+
+static void BM_legendre_all_one(benchmark::State & state)
+{
+	const auto x = poly_input(-1.0, 1.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < poly_size; ++i) { ccm::legendre_all(poly_max_order, x[i], out.data() + i * (poly_max_order + 1)); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+static void BM_legendre_all_ccm(benchmark::State & state)
+{
+	const auto x = poly_input(-1.0, 1.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::legendre_all(poly_max_order, x.data(), poly_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+static void BM_hermite_all_std(benchmark::State & state)
+{
+	const auto x = poly_input(-4.0, 4.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (unsigned n = 0; n <= poly_max_order; ++n)
+		{
+			for (std::size_t i = 0; i < poly_size; ++i) { out[n * poly_size + i] = std::hermite(n, x[i]); }
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+#endif
+
+static void BM_hermite_all_ccm(benchmark::State & state)
+{
+	const auto x = poly_input(-4.0, 4.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::hermite_all(poly_max_order, x.data(), poly_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+static void BM_sph_bessel_all_std(benchmark::State & state)
+{
+	const auto x = poly_input(0x1.0p-10, 64.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (unsigned n = 0; n <= poly_max_order; ++n)
+		{
+			for (std::size_t i = 0; i < poly_size; ++i) { out[n * poly_size + i] = std::sph_bessel(n, x[i]); }
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+#endif
+
+static void BM_sph_bessel_all_ccm(benchmark::State & state)
+{
+	const auto x = poly_input(0x1.0p-10, 64.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::sph_bessel_all(poly_max_order, x.data(), poly_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+static void BM_cyl_bessel_j_all_std(benchmark::State & state)
+{
+	const auto x = poly_input(0x1.0p-10, 64.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (unsigned n = 0; n <= poly_max_order; ++n)
+		{
+			for (std::size_t i = 0; i < poly_size; ++i) { out[n * poly_size + i] = std::cyl_bessel_j(cyl_order + n, x[i]); }
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+#endif
+
+static void BM_cyl_bessel_j_all_ccm(benchmark::State & state)
+{
+	const auto x = poly_input(0x1.0p-10, 64.0);
+	std::vector<double> out(poly_size * (poly_max_order + 1));
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::cyl_bessel_j_all(cyl_order, poly_max_order, x.data(), poly_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+BENCHMARK(BM_legendre_all_std);
+#endif
+BENCHMARK(BM_legendre_all_one);
+BENCHMARK(BM_legendre_all_ccm);
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+BENCHMARK(BM_hermite_all_std);
+#endif
+BENCHMARK(BM_hermite_all_ccm);
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+BENCHMARK(BM_sph_bessel_all_std);
+#endif
+BENCHMARK(BM_sph_bessel_all_ccm);
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+BENCHMARK(BM_cyl_bessel_j_all_std);
+#endif
+BENCHMARK(BM_cyl_bessel_j_all_ccm);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
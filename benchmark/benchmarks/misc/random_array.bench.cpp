@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/random.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// NOLINTBEGIN
+
+/*
+ * 4Ki random variates per iteration:
+ *   std - std::normal_distribution / exponential_distribution driven by std::mt19937
+ *   ccm - ccm::ext::normal / exponential driven by ccm::ext::philox4x32
+ *   inv - ccm::ext::normal_inv_cdf of uniforms drawn beforehand
+ */
+
+namespace
+{
+	constexpr std::size_t variate_count = std::size_t{1} << 12;
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(variate_count));
+	}
+} // namespace
+
+template <typename T>
+static void BM_normal_std(benchmark::State & state)
+{
+	std::mt19937 gen(11);
+	std::normal_distribution<T> dist;
+	std::vector<T> out(variate_count);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (auto & v : out) { v = dist(gen); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_normal_ccm(benchmark::State & state)
+{
+	ccm::ext::philox4x32 gen(11);
+	std::vector<T> out(variate_count);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::normal(gen, variate_count, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_normal_inv(benchmark::State & state)
+{
+	ccm::ext::philox4x32 gen(11);
+	std::vector<T> u(variate_count);
+	ccm::ext::uniform(gen, variate_count, u.data());
+	std::vector<T> out(variate_count);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::normal_inv_cdf(u.data(), variate_count, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_exponential_std(benchmark::State & state)
+{
+	std::mt19937 gen(11);
+	std::exponential_distribution<T> dist;
+	std::vector<T> out(variate_count);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (auto & v : out) { v = dist(gen); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_exponential_ccm(benchmark::State & state)
+{
+	ccm::ext::philox4x32 gen(11);
+	std::vector<T> out(variate_count);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::exponential(gen, variate_count, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_normal_std, float);
+BENCHMARK_TEMPLATE(BM_normal_ccm, float);
+BENCHMARK_TEMPLATE(BM_normal_inv, float);
+BENCHMARK_TEMPLATE(BM_normal_std, double);
+BENCHMARK_TEMPLATE(BM_normal_ccm, double);
+BENCHMARK_TEMPLATE(BM_normal_inv, double);
+BENCHMARK_TEMPLATE(BM_exponential_std, float);
+BENCHMARK_TEMPLATE(BM_exponential_ccm, float);
+BENCHMARK_TEMPLATE(BM_exponential_std, double);
+BENCHMARK_TEMPLATE(BM_exponential_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
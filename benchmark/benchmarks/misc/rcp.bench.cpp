@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/rcp.hpp>
+#include <ccmath/ext/rsqrt.hpp>
+
+#include <cmath>
+#include <string>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+// One value at a time: the std rows are 1 / x and 1 / std::sqrt(x), the ccm rows ccm::ext::rcp_approx and rsqrt_approx
+// with the number of Newton steps in the name.
+template <typename T, int Steps>
+static void register_rcp()
+{
+	const std::string steps = std::to_string(Steps);
+	cb::register_function<T>(
+		"misc_rcp_approx" + steps, [](T x) { return T(1) / x; }, [](T x) { return ccm::ext::rcp_approx<Steps>(x); },
+		cb::Range<T>{T(1e-3), T(1e3)});
+	cb::register_function<T>(
+		"misc_rsqrt_approx" + steps, [](T x) { return T(1) / std::sqrt(x); }, [](T x) { return ccm::ext::rsqrt_approx<Steps>(x); },
+		cb::Range<T>{T(1e-3), T(1e3)});
+}
+
+static const bool registered = (register_rcp<float, 0>(), register_rcp<float, 1>(), register_rcp<float, 2>(), register_rcp<double, 1>(),
+								register_rcp<double, 2>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
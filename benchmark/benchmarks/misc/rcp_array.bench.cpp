@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/rcp.hpp>
+#include <ccmath/ext/rsqrt.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Reciprocal and reciprocal square root over 64Ki values:
+ *   div - 1 / x and 1 / std::sqrt(x) one element at a time
+ *   ccm - ccm::ext::rcp_approx / rsqrt_approx on native_simd lanes, with the number of Newton steps as the argument
+ */
+
+namespace
+{
+	constexpr std::size_t rcp_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> rcp_input()
+	{
+		cb::Randomizer randomizer(7);
+		return randomizer.generate<T>(cb::Distribution::eUniform, rcp_size, T(1e-3), T(1e3));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(rcp_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_rcp_array_div(benchmark::State & state)
+{
+	const auto x = rcp_input<T>();
+	std::vector<T> out(rcp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < rcp_size; ++i) { out[i] = T(1) / x[i]; }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T, int Steps>
+static void BM_rcp_array_ccm(benchmark::State & state)
+{
+	const auto x = rcp_input<T>();
+	std::vector<T> out(rcp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::rcp_approx<Steps>(x.data(), rcp_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_rsqrt_array_div(benchmark::State & state)
+{
+	const auto x = rcp_input<T>();
+	std::vector<T> out(rcp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < rcp_size; ++i) { out[i] = T(1) / std::sqrt(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T, int Steps>
+static void BM_rsqrt_array_ccm(benchmark::State & state)
+{
+	const auto x = rcp_input<T>();
+	std::vector<T> out(rcp_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::rsqrt_approx<Steps>(x.data(), rcp_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_rcp_array_div, float);
+BENCHMARK_TEMPLATE(BM_rcp_array_ccm, float, 0);
+BENCHMARK_TEMPLATE(BM_rcp_array_ccm, float, 1);
+BENCHMARK_TEMPLATE(BM_rcp_array_ccm, float, 2);
+BENCHMARK_TEMPLATE(BM_rcp_array_div, double);
+BENCHMARK_TEMPLATE(BM_rcp_array_ccm, double, 1);
+BENCHMARK_TEMPLATE(BM_rcp_array_ccm, double, 2);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_div, float);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_ccm, float, 0);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_ccm, float, 1);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_ccm, float, 2);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_div, double);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_ccm, double, 1);
+BENCHMARK_TEMPLATE(BM_rsqrt_array_ccm, double, 2);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
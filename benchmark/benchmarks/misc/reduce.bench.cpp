@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/reduce.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * ccm::ext reductions over 64Ki elements, per summation mode, against the plain loop a user would write.
+ * Modes are numbered as in ccm::ext::summation: 0 naive, 1 pairwise, 2 Kahan, 3 Neumaier, 4 double-double.
+ */
+
+namespace
+{
+	constexpr std::size_t reduction_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> reduction_input(std::uint64_t seed)
+	{
+		cb::Randomizer randomizer(static_cast<std::uint_fast32_t>(seed));
+		return randomizer.generate<T>(cb::Distribution::eUniform, reduction_size, T(-1), T(1));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(reduction_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_reduce_sum_loop(benchmark::State & state)
+{
+	const auto x = reduction_input<T>(1);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		T sum = 0;
+		for (T v : x) { sum += v; }
+		benchmark::DoNotOptimize(sum);
+	}
+	set_items(state);
+}
+
+template <typename T, ccm::ext::summation Mode>
+static void BM_reduce_sum(benchmark::State & state)
+{
+	const auto x = reduction_input<T>(1);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::sum<Mode>(x)); }
+	set_items(state);
+}
+
+template <typename T>
+static void BM_reduce_dot_loop(benchmark::State & state)
+{
+	const auto x = reduction_input<T>(1);
+	const auto y = reduction_input<T>(2);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		T dot = 0;
+		for (std::size_t i = 0; i < x.size(); ++i) { dot += x[i] * y[i]; }
+		benchmark::DoNotOptimize(dot);
+	}
+	set_items(state);
+}
+
+template <typename T, ccm::ext::summation Mode>
+static void BM_reduce_dot(benchmark::State & state)
+{
+	const auto x = reduction_input<T>(1);
+	const auto y = reduction_input<T>(2);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::dot<Mode>(x, y)); }
+	set_items(state);
+}
+
+template <typename T>
+static void BM_reduce_hypot_n(benchmark::State & state)
+{
+	const auto x = reduction_input<T>(1);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::hypot_n(x)); }
+	set_items(state);
+}
+
+#define CCM_BM_REDUCE_MODES(name, type)                                                                                                                        \
+	BENCHMARK_TEMPLATE(name, type, ccm::ext::summation::eNaive);                                                                                               \
+	BENCHMARK_TEMPLATE(name, type, ccm::ext::summation::ePairwise);                                                                                            \
+	BENCHMARK_TEMPLATE(name, type, ccm::ext::summation::eKahan);                                                                                               \
+	BENCHMARK_TEMPLATE(name, type, ccm::ext::summation::eNeumaier);                                                                                            \
+	BENCHMARK_TEMPLATE(name, type, ccm::ext::summation::eDoubleDouble)
+
+BENCHMARK_TEMPLATE(BM_reduce_sum_loop, float);
+CCM_BM_REDUCE_MODES(BM_reduce_sum, float);
+BENCHMARK_TEMPLATE(BM_reduce_sum_loop, double);
+CCM_BM_REDUCE_MODES(BM_reduce_sum, double);
+BENCHMARK_TEMPLATE(BM_reduce_dot_loop, float);
+CCM_BM_REDUCE_MODES(BM_reduce_dot, float);
+BENCHMARK_TEMPLATE(BM_reduce_dot_loop, double);
+CCM_BM_REDUCE_MODES(BM_reduce_dot, double);
+BENCHMARK_TEMPLATE(BM_reduce_hypot_n, float);
+BENCHMARK_TEMPLATE(BM_reduce_hypot_n, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
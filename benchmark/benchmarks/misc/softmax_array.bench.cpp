@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/softmax.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * softmax and sigmoid over 4Ki logits in [-20, 20], the size of a vocabulary slice:
+ *   std - the usual hand written loops around std::exp
+ *   ccm - ccm::ext::softmax / sigmoid on native_simd lanes
+ */
+
+namespace
+{
+	constexpr std::size_t softmax_size = std::size_t{1} << 12;
+
+	template <typename T>
+	std::vector<T> softmax_input()
+	{
+		cb::Randomizer randomizer(19);
+		return randomizer.generate<T>(cb::Distribution::eUniform, softmax_size, T(-20), T(20));
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(softmax_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_softmax_std(benchmark::State & state)
+{
+	const auto x = softmax_input<T>();
+	std::vector<T> out(softmax_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		T largest = x[0];
+		for (std::size_t i = 1; i < softmax_size; ++i) { largest = std::fmax(largest, x[i]); }
+		T total = 0;
+		for (std::size_t i = 0; i < softmax_size; ++i)
+		{
+			out[i] = std::exp(x[i] - largest);
+			total += out[i];
+		}
+		for (std::size_t i = 0; i < softmax_size; ++i) { out[i] /= total; }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_softmax_ccm(benchmark::State & state)
+{
+	const auto x = softmax_input<T>();
+	std::vector<T> out(softmax_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::softmax(x.data(), softmax_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_sigmoid_std(benchmark::State & state)
+{
+	const auto x = softmax_input<T>();
+	std::vector<T> out(softmax_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < softmax_size; ++i) { out[i] = T(1) / (T(1) + std::exp(-x[i])); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_sigmoid_ccm(benchmark::State & state)
+{
+	const auto x = softmax_input<T>();
+	std::vector<T> out(softmax_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::sigmoid(x.data(), softmax_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_softmax_std, float);
+BENCHMARK_TEMPLATE(BM_softmax_ccm, float);
+BENCHMARK_TEMPLATE(BM_softmax_std, double);
+BENCHMARK_TEMPLATE(BM_softmax_ccm, double);
+BENCHMARK_TEMPLATE(BM_sigmoid_std, float);
+BENCHMARK_TEMPLATE(BM_sigmoid_ccm, float);
+BENCHMARK_TEMPLATE(BM_sigmoid_std, double);
+BENCHMARK_TEMPLATE(BM_sigmoid_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
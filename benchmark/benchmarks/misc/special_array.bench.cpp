@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ext/ndtri.hpp>
+#include <ccmath/ext/special.hpp>
+#include <ccmath/math/misc/erfinv.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+/*
+ * Error and gamma functions over 64Ki values:
+ *   std - std::erfc / std::lgamma one element at a time
+ *   ccm - ccm::ext::erfc / lgamma on native_simd lanes
+ * erfc runs on [-6, 6], the range of a normal CDF, and lgamma on (0, 100], the range of a log-likelihood.
+ *
+ * The standard library has no inverse error function, so erfinv and ndtri compare against the scalar ccm functions:
+ *   one - ccm::erfinv / ccm::ext::ndtri one element at a time
+ *   ccm - the array forms on native_simd lanes
+ * Both run on (0, 1), where a tenth of the ndtri arguments fall in the tails.
+ */
+
+namespace
+{
+	constexpr std::size_t special_size = std::size_t{1} << 16;
+
+	template <typename T>
+	std::vector<T> special_input(T lo, T hi)
+	{
+		cb::Randomizer randomizer(7);
+		return randomizer.generate<T>(cb::Distribution::eUniform, special_size, lo, hi);
+	}
+
+	void set_items(benchmark::State & state)
+	{
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(special_size));
+	}
+} // namespace
+
+template <typename T>
+static void BM_erfc_array_std(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(-6), T(6));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < special_size; ++i) { out[i] = std::erfc(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_erfc_array_ccm(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(-6), T(6));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::erfc(x.data(), special_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_lgamma_array_std(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0x1.0p-10), T(100));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < special_size; ++i) { out[i] = std::lgamma(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_lgamma_array_ccm(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0x1.0p-10), T(100));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::lgamma(x.data(), special_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_erfinv_array_one(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0), T(1));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < special_size; ++i) { out[i] = ccm::erfinv(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_erfinv_array_ccm(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0), T(1));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::erfinv(x.data(), special_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ndtri_array_one(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0), T(1));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < special_size; ++i) { out[i] = ccm::ext::ndtri(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+template <typename T>
+static void BM_ndtri_array_ccm(benchmark::State & state)
+{
+	const auto x = special_input<T>(T(0), T(1));
+	std::vector<T> out(special_size);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::ndtri(x.data(), special_size, out.data());
+		benchmark::DoNotOptimize(out.data());
+	}
+	set_items(state);
+}
+
+BENCHMARK_TEMPLATE(BM_erfc_array_std, float);
+BENCHMARK_TEMPLATE(BM_erfc_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_erfc_array_std, double);
+BENCHMARK_TEMPLATE(BM_erfc_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_lgamma_array_std, float);
+BENCHMARK_TEMPLATE(BM_lgamma_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_lgamma_array_std, double);
+BENCHMARK_TEMPLATE(BM_lgamma_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_erfinv_array_one, float);
+BENCHMARK_TEMPLATE(BM_erfinv_array_ccm, float);
+BENCHMARK_TEMPLATE(BM_erfinv_array_one, double);
+BENCHMARK_TEMPLATE(BM_erfinv_array_ccm, double);
+BENCHMARK_TEMPLATE(BM_ndtri_array_one, double);
+BENCHMARK_TEMPLATE(BM_ndtri_array_ccm, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <ccmath/ext/table.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+// A 256 entry table of exp over [-8, 0] against the real function, per interpolation mode.
+template <typename T>
+static void register_table()
+{
+	static constexpr auto table = ccm::ext::make_table<256>([](T x) { return ccm::exp(x); }, T(-8), T(0));
+
+	cb::register_function<T>(
+		"misc_table_exp_linear",
+		[](T x) { return std::exp(x); },
+		[](T x) { return ccm::ext::table_interp(table, x); },
+		cb::Range<T>{T(-8), T(0)});
+	cb::register_function<T>(
+		"misc_table_exp_cubic",
+		[](T x) { return std::exp(x); },
+		[](T x) { return ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(table, x); },
+		cb::Range<T>{T(-8), T(0)});
+}
+
+static void BM_table_exp_batch(benchmark::State & state)
+{
+	static constexpr auto table = ccm::ext::make_table<256>([](double x) { return ccm::exp(x); }, -8.0, 0.0);
+
+	cb::Randomizer randomizer;
+	const std::vector<double> x = randomizer.generate<double>(cb::Distribution::eUniform, cb::input_count, -8.0, 0.0);
+	std::vector<double> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::table_interp(table, x, out);
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(x.size()));
+}
+BENCHMARK(BM_table_exp_batch);
+
+static const bool registered = (register_table<float>(), register_table<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <ccmath/ext/expr.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_cbrt()
+{
+	cb::register_function<T>(
+		"power_cbrt",
+		[](T x) { return std::cbrt(x); },
+		[](T x) { return ccm::cbrt(x); },
+		cb::Range<T>{T(-1e3), T(1e3)});
+}
+
+// Whole array through ccm::ext::expr, which runs the vector cbrt on native_simd blocks.
+template <typename T>
+static void BM_power_cbrt_batch(benchmark::State & state)
+{
+	cb::Randomizer randomizer;
+	const auto x = randomizer.generate<T>(cb::Distribution::eUniform, cb::input_count, T(-1e3), T(1e3));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::expr::evaluate(ccm::ext::expr::cbrt(ccm::ext::expr::array_view{x}), out);
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(x.size()));
+}
+
+static const bool registered = (register_cbrt<float>(), register_cbrt<double>(), true);
+
+BENCHMARK_TEMPLATE(BM_power_cbrt_batch, float);
+BENCHMARK_TEMPLATE(BM_power_cbrt_batch, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <ccmath/ext/expr.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_hypot()
+{
+	cb::register_function<T>(
+		"power_hypot",
+		[](T x, T y) { return std::hypot(x, y); },
+		[](T x, T y) { return ccm::hypot(x, y); },
+		cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)});
+	cb::register_function<T>(
+		"power_hypot3",
+		[](T x, T y, T z) { return std::hypot(x, y, z); },
+		[](T x, T y, T z) { return ccm::hypot(x, y, z); },
+		cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)}, cb::Range<T>{T(-1e3), T(1e3)});
+}
+
+// Whole arrays through ccm::ext::expr, which runs the vector hypot on native_simd blocks.
+template <typename T>
+static void BM_power_hypot_batch(benchmark::State & state)
+{
+	cb::Randomizer randomizer;
+	const auto x = randomizer.generate<T>(cb::Distribution::eUniform, cb::input_count, T(-1e3), T(1e3));
+	const auto y = randomizer.generate<T>(cb::Distribution::eUniform, cb::input_count, T(-1e3), T(1e3));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::ext::expr::evaluate(ccm::ext::expr::hypot(ccm::ext::expr::array_view{x}, ccm::ext::expr::array_view{y}), out);
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(x.size()));
+}
+
+static const bool registered = (register_hypot<float>(), register_hypot<double>(), true);
+
+BENCHMARK_TEMPLATE(BM_power_hypot_batch, float);
+BENCHMARK_TEMPLATE(BM_power_hypot_batch, double);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/harness.hpp"
+
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace cb = ccm::bench;
+
+// NOLINTBEGIN
+
+template <typename T>
+static void register_pow()
+{
+	cb::register_function<T>(
+		"power_pow",
+		[](T x, T y) { return std::pow(x, y); },
+		[](T x, T y) { return ccm::pow(x, y); },
+		cb::Range<T>{T(0.0), T(1e2)}, cb::Range<T>{T(-1e1), T(1e1)});
+}
+
+static const bool registered = (register_pow<float>(), register_pow<double>(), true);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -7,6 +7,7 @@
  */
 
 #include "sqrt.bench.hpp"
+#include "../../helpers/harness.hpp"
 
 // NOLINTBEGIN
 
@@ -45,6 +46,22 @@ BENCHMARK(BM_power_sqrt_rand_double_ccm_rt)->RangeMultiplier(2)->Range(8, 8 << 1
 	#endif
 #endif
 
+// Latency and throughput over the shared input distributions
+
+namespace cb = ccm::bench;
+
+template <typename T>
+static void register_sqrt()
+{
+	cb::register_function<T>(
+		"power_sqrt",
+		[](T x) { return std::sqrt(x); },
+		[](T x) { return ccm::sqrt(x); },
+		cb::range<T>({0.0F, 1e30F}, {0.0, 1e300}));
+}
+
+static const bool registered = (register_sqrt<float>(), register_sqrt<double>(), true);
+
 BENCHMARK_MAIN();
 
 // NOLINTEND
\ No newline at end of file
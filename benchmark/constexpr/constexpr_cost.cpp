@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+// Builds a table of CCM_CT_BENCH_N results of CCM_CT_BENCH_KERNEL in a single constant evaluation.
+// Compiled once per kernel by the build and repeatedly by tools/constexpr_cost.py with varying N and step limits.
+
+#include "kernels.hpp"
+
+#include <array>
+#include <cstddef>
+
+#ifndef CCM_CT_BENCH_KERNEL
+	#error "Define CCM_CT_BENCH_KERNEL to the name of a kernel in kernels.hpp"
+#endif
+
+#ifndef CCM_CT_BENCH_N
+	#define CCM_CT_BENCH_N 64
+#endif
+
+namespace
+{
+	using kernel	 = ccm::bench::ct::CCM_CT_BENCH_KERNEL;
+	using value_type = typename kernel::value_type;
+
+	template <std::size_t N>
+	constexpr std::array<value_type, N> make_table()
+	{
+		std::array<value_type, N> table{};
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			const value_type t = (static_cast<value_type>(i) + static_cast<value_type>(0.5)) / static_cast<value_type>(N);
+			table[i]		   = kernel::call(kernel::min + (kernel::max - kernel::min) * t);
+		}
+		return table;
+	}
+
+	[[maybe_unused]] constexpr auto table = make_table<CCM_CT_BENCH_N>();
+} // namespace
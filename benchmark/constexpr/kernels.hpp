@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/pow_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
+#include "ccmath/math/expo/exp.hpp"
+#include "ccmath/math/expo/exp2.hpp"
+#include "ccmath/math/expo/log.hpp"
+#include "ccmath/math/expo/log2.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+/*
+ * Kernels measured by the constexpr cost benchmark.
+ *
+ * Each kernel is a struct with the value type, the input range and a call wrapper. constexpr_cost.cpp evaluates N
+ * calls spread evenly over [min, max] inside one constant expression, the same way a static lookup table is built.
+ * The CMake target and tools/constexpr_cost.py both read the kernel names from this file, so adding a struct here is
+ * all that is needed to track a new function. Keep one "struct name" per line.
+ *
+ * The generic kernels are called directly. The frontends are listed separately because on some compilers they forward
+ * to a builtin and then measure the compiler's constant folder instead of ccmath.
+ */
+
+namespace ccm::bench::ct
+{
+	struct sqrt_gen_float
+	{
+		using value_type = float;
+		static constexpr float min = 0.0F;
+		static constexpr float max = 1e6F;
+		static constexpr float call(float x) { return ccm::gen::sqrt_gen<float>(x); }
+	};
+
+	struct sqrt_gen_double
+	{
+		using value_type = double;
+		static constexpr double min = 0.0;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return ccm::gen::sqrt_gen<double>(x); }
+	};
+
+	struct exp_float_impl
+	{
+		using value_type = float;
+		static constexpr float min = -87.0F;
+		static constexpr float max = 88.0F;
+		static constexpr float call(float x) { return ccm::internal::impl::exp_float_impl(x); }
+	};
+
+	struct exp_double_impl
+	{
+		using value_type = double;
+		static constexpr double min = -708.0;
+		static constexpr double max = 709.0;
+		static constexpr double call(double x) { return ccm::internal::impl::exp_double_impl(x); }
+	};
+
+	struct exp_double_fast
+	{
+		using value_type = double;
+		static constexpr double min = -708.0;
+		static constexpr double max = 709.0;
+		static constexpr double call(double x) { return ccm::internal::impl::exp_double_impl<true>(x); }
+	};
+
+	struct exp_double_correctly_rounded
+	{
+		using value_type = double;
+		static constexpr double min = -708.0;
+		static constexpr double max = 709.0;
+		static constexpr double call(double x) { return ccm::internal::impl::exp_double_correctly_rounded_impl(x); }
+	};
+
+	struct exp2_float
+	{
+		using value_type = float;
+		static constexpr float min = -126.0F;
+		static constexpr float max = 127.0F;
+		static constexpr float call(float x) { return ccm::internal::exp2_float(x); }
+	};
+
+	struct exp2_double
+	{
+		using value_type = double;
+		static constexpr double min = -1022.0;
+		static constexpr double max = 1023.0;
+		static constexpr double call(double x) { return ccm::internal::exp2_double(x); }
+	};
+
+	struct log_float
+	{
+		using value_type = float;
+		static constexpr float min = 1e-3F;
+		static constexpr float max = 1e6F;
+		static constexpr float call(float x) { return ccm::internal::log_float(x); }
+	};
+
+	struct log_double
+	{
+		using value_type = double;
+		static constexpr double min = 1e-3;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return ccm::internal::log_double(x); }
+	};
+
+	struct log_double_correctly_rounded
+	{
+		using value_type = double;
+		static constexpr double min = 1e-3;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return x == 1.0 ? 0.0 : ccm::internal::impl::log_double_correctly_rounded_impl(x); }
+	};
+
+	struct log2_float
+	{
+		using value_type = float;
+		static constexpr float min = 1e-3F;
+		static constexpr float max = 1e6F;
+		static constexpr float call(float x) { return ccm::internal::log2_float(x); }
+	};
+
+	struct log2_double
+	{
+		using value_type = double;
+		static constexpr double min = 1e-3;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return ccm::internal::log2_double(x); }
+	};
+
+	// pow_gen is not implemented yet; tracked so the cost of the implementation shows up when it lands.
+	struct pow_gen_float
+	{
+		using value_type = float;
+		static constexpr float min = 0.5F;
+		static constexpr float max = 100.0F;
+		static constexpr float call(float x) { return ccm::gen::pow_gen<float>(x, 1.37F); }
+	};
+
+	struct pow_gen_double
+	{
+		using value_type = double;
+		static constexpr double min = 0.5;
+		static constexpr double max = 100.0;
+		static constexpr double call(double x) { return ccm::gen::pow_gen<double>(x, 1.37); }
+	};
+
+	struct exp_frontend_double
+	{
+		using value_type = double;
+		static constexpr double min = -708.0;
+		static constexpr double max = 709.0;
+		static constexpr double call(double x) { return ccm::exp(x); }
+	};
+
+	struct log_frontend_double
+	{
+		using value_type = double;
+		static constexpr double min = 1e-3;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return ccm::log(x); }
+	};
+
+	struct sqrt_frontend_double
+	{
+		using value_type = double;
+		static constexpr double min = 0.0;
+		static constexpr double max = 1e6;
+		static constexpr double call(double x) { return ccm::sqrt(x); }
+	};
+} // namespace ccm::bench::ct
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#pragma once
+
+#include "randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Shared harness for comparing a ccm function with its std counterpart.
+ *
+ * register_function registers, for one floating-point type, every combination of
+ *   implementation: std, ccm
+ *   distribution:   uniform, near_special, subnormal
+ *   measurement:    latency    - each call depends on the result of the previous one
+ *                   throughput - independent calls over an array
+ *
+ * Benchmarks are named <family>_<function>_<impl>/<type>/<distribution>/<measurement>, for example
+ * expo_exp_ccm/double/uniform/latency, so a subset can be picked with --benchmark_filter.
+ */
+
+namespace ccm::bench
+{
+	/// Closed input range of one argument.
+	template <typename T>
+	struct Range
+	{
+		T min;
+		T max;
+	};
+
+	/// Picks the range for T, for functions whose domain depends on the precision (e.g. the overflow bound of exp).
+	template <typename T>
+	constexpr Range<T> range(Range<float> for_float, Range<double> for_double)
+	{
+		if constexpr (std::is_same_v<T, float>) { return for_float; }
+		else { return for_double; }
+	}
+
+	/// Number of inputs per benchmark. Small enough to stay in L1 for float and double.
+	inline constexpr std::size_t input_count = 1024;
+
+	namespace detail
+	{
+		template <typename T>
+		constexpr const char * type_name()
+		{
+			if constexpr (std::is_same_v<T, float>) { return "float"; }
+			else { return "double"; }
+		}
+
+		inline const char * distribution_name(Distribution distribution)
+		{
+			switch (distribution)
+			{
+			case Distribution::eUniform: return "uniform";
+			case Distribution::eNearSpecial: return "near_special";
+			case Distribution::eSubnormal: return "subnormal";
+			}
+			return "";
+		}
+
+		// Folds any result into an integer so the next call can be made to depend on it.
+		template <typename R>
+		std::uint64_t to_bits(R result)
+		{
+			if constexpr (std::is_floating_point_v<R>)
+			{
+				static_assert(sizeof(R) <= sizeof(std::uint64_t));
+				std::uint64_t bits = 0;
+				std::memcpy(&bits, &result, sizeof(R));
+				return bits;
+			}
+			else { return static_cast<std::uint64_t>(result); }
+		}
+
+		template <typename F, typename Inputs, std::size_t... Is>
+		auto invoke(F & func, Inputs const & inputs, std::size_t first, std::size_t i, std::index_sequence<Is...> /* unused */)
+		{
+			// Only the first argument carries the dependency, the others are read at the plain index.
+			return func((Is == 0 ? std::get<Is>(inputs)[first] : std::get<Is>(inputs)[i])...);
+		}
+
+		template <typename F, typename Inputs>
+		void latency(benchmark::State & state, F func, Inputs const & inputs)
+		{
+			constexpr auto indices = std::make_index_sequence<std::tuple_size_v<Inputs>>{};
+			const std::size_t count = std::get<0>(inputs).size();
+
+			// mask is zero, but the compiler cannot know that, so every index depends on the previous result.
+			std::uint64_t mask = 0;
+			benchmark::DoNotOptimize(mask);
+
+			std::uint64_t carry = 0;
+			for ([[maybe_unused]] auto _ : state)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					const auto result = invoke(func, inputs, i + static_cast<std::size_t>(carry & mask), i, indices);
+					carry			  = to_bits(result);
+				}
+			}
+			benchmark::DoNotOptimize(carry);
+			state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+		}
+
+		template <typename F, typename Inputs>
+		void throughput(benchmark::State & state, F func, Inputs const & inputs)
+		{
+			constexpr auto indices = std::make_index_sequence<std::tuple_size_v<Inputs>>{};
+			const std::size_t count = std::get<0>(inputs).size();
+
+			// std::vector<bool> packs bits, which would add work to every store.
+			using result_type  = decltype(invoke(func, inputs, 0, 0, indices));
+			using storage_type = std::conditional_t<std::is_same_v<result_type, bool>, unsigned char, result_type>;
+			std::vector<storage_type> results(count);
+
+			for ([[maybe_unused]] auto _ : state)
+			{
+				for (std::size_t i = 0; i < count; ++i) { results[i] = static_cast<storage_type>(invoke(func, inputs, i, i, indices)); }
+				benchmark::DoNotOptimize(results.data());
+				benchmark::ClobberMemory();
+			}
+			state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+		}
+
+		template <typename F, typename Inputs>
+		void register_impl(std::string const & prefix, F func, Inputs const & inputs)
+		{
+			benchmark::RegisterBenchmark((prefix + "/latency").c_str(), [func, inputs](benchmark::State & state) { latency(state, func, inputs); });
+			benchmark::RegisterBenchmark((prefix + "/throughput").c_str(), [func, inputs](benchmark::State & state) { throughput(state, func, inputs); });
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Registers latency and throughput benchmarks of std_func and ccm_func over all input distributions.
+	 * @tparam T The floating-point type being benchmarked, used in the benchmark names.
+	 * @param name Family and function, e.g. "expo_exp".
+	 * @param std_func Callable wrapping the std function.
+	 * @param ccm_func Callable wrapping the ccm function.
+	 * @param ranges One Range per argument. Range<int> arguments are always drawn uniformly.
+	 */
+	template <typename T, typename StdF, typename CcmF, typename... Args>
+	void register_function(std::string const & name, StdF std_func, CcmF ccm_func, Range<Args>... ranges)
+	{
+		static_assert(sizeof...(Args) > 0, "register_function needs at least one argument range");
+
+		for (Distribution distribution : {Distribution::eUniform, Distribution::eNearSpecial, Distribution::eSubnormal})
+		{
+			// Both implementations see exactly the same inputs.
+			Randomizer randomizer;
+			const auto inputs = std::make_tuple(randomizer.generate<Args>(distribution, input_count, ranges.min, ranges.max)...);
+
+			const std::string suffix = std::string("/") + detail::type_name<T>() + "/" + detail::distribution_name(distribution);
+			detail::register_impl(name + "_std" + suffix, std_func, inputs);
+			detail::register_impl(name + "_ccm" + suffix, ccm_func, inputs);
+		}
+	}
+} // namespace ccm::bench
@@ -8,12 +8,23 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <random>
 #include <vector>
 
 namespace ccm::bench
 {
+	/// Shape of the inputs handed to a benchmarked function.
+	enum class Distribution
+	{
+		eUniform,	  ///< Uniform over the domain of the function.
+		eNearSpecial, ///< Exact special values and values a few ulp away from integers, half integers and the domain bounds.
+		eSubnormal,	  ///< Half subnormals, the rest uniform over the domain.
+	};
+
 	struct Randomizer
 	{
 	public:
@@ -40,7 +51,102 @@ namespace ccm::bench
 			return randomDouble;
 		}
 
+		/**
+		 * @brief Generates count values in [min, max] following the given distribution.
+		 *
+		 * Integral types are always drawn uniformly. Floating-point inputs outside [min, max] are never produced except
+		 * for the NaN and infinities of the near special distribution, which every function has to handle.
+		 */
+		template <typename T>
+		std::vector<T> generate(Distribution distribution, std::size_t count, T min, T max)
+		{
+			assert(count > 0 && min <= max);
+			std::vector<T> values;
+			values.reserve(count);
+
+			if constexpr (std::is_integral_v<T>)
+			{
+				std::uniform_int_distribution<T> dist(min, max);
+				for (std::size_t i = 0; i < count; ++i) { values.push_back(dist(m_gen)); }
+			}
+			else
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					switch (distribution)
+					{
+					case Distribution::eUniform: values.push_back(uniform(min, max)); break;
+					case Distribution::eNearSpecial: values.push_back(nearSpecial(min, max)); break;
+					case Distribution::eSubnormal: values.push_back(subnormalHeavy(min, max)); break;
+					}
+				}
+			}
+			return values;
+		}
+
 	private:
+		template <typename T>
+		T uniform(T min, T max)
+		{
+			// uniform_real_distribution requires max - min to be finite.
+			if (!std::isfinite(max - min)) { return std::uniform_int_distribution<int>(0, 1)(m_gen) == 0 ? uniform<T>(min / 2, 0) * 2 : uniform<T>(0, max / 2) * 2; }
+			return std::uniform_real_distribution<T>(min, max)(m_gen);
+		}
+
+		template <typename T>
+		T clamp(T x, T min, T max)
+		{
+			return x < min ? min : (x > max ? max : x);
+		}
+
+		template <typename T>
+		T nearSpecial(T min, T max)
+		{
+			const int kind = std::uniform_int_distribution<int>(0, 3)(m_gen);
+
+			// Exact special values.
+			if (kind == 0)
+			{
+				const std::array<T, 10> specials = {T(0),
+													-T(0),
+													T(1),
+													-T(1),
+													std::numeric_limits<T>::infinity(),
+													-std::numeric_limits<T>::infinity(),
+													std::numeric_limits<T>::quiet_NaN(),
+													std::numeric_limits<T>::min(),
+													std::numeric_limits<T>::denorm_min(),
+													std::numeric_limits<T>::max()};
+				return specials[std::uniform_int_distribution<std::size_t>(0, specials.size() - 1)(m_gen)];
+			}
+
+			// A few ulp around one of the domain bounds.
+			T base = std::uniform_int_distribution<int>(0, 1)(m_gen) == 0 ? min : max;
+
+			// A few ulp around an integer or a half integer in the domain.
+			if (kind != 1)
+			{
+				base = std::round(uniform(min, max));
+				if (kind == 3) { base += T(0.5); }
+			}
+
+			const int steps = std::uniform_int_distribution<int>(-4, 4)(m_gen);
+			for (int i = 0; i < steps; ++i) { base = std::nextafter(base, std::numeric_limits<T>::infinity()); }
+			for (int i = 0; i > steps; --i) { base = std::nextafter(base, -std::numeric_limits<T>::infinity()); }
+			return clamp(base, min, max);
+		}
+
+		template <typename T>
+		T subnormalHeavy(T min, T max)
+		{
+			if (std::uniform_int_distribution<int>(0, 1)(m_gen) == 0) { return uniform(min, max); }
+
+			const T subnormal = uniform(std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::min());
+			if (min >= T(0)) { return clamp(subnormal, min, max); }
+			if (max <= T(0)) { return clamp(-subnormal, min, max); }
+			return std::uniform_int_distribution<int>(0, 1)(m_gen) == 0 ? subnormal : -subnormal;
+		}
+
 		std::mt19937 m_gen;
 	};
-} // namespace ccm::bench
\ No newline at end of file
+} // namespace ccm::bench
@@ -0,0 +1,221 @@
+#!/usr/bin/env python
+"""Measures the cost of constant-evaluating ccmath kernels and tracks it against a baseline.
+
+Every kernel in benchmark/constexpr/kernels.hpp is compiled through constexpr_cost.cpp, which builds a table of
+N results in one constant expression. For each kernel the script reports
+
+  steps/call  the constexpr operation budget one call consumes. The smallest -fconstexpr-ops-limit (GCC) or
+              -fconstexpr-steps (Clang) that accepts the table is searched for at N and 2N calls; the difference
+              removes the cost of the header constants.
+  us/call     compiler time spent in constant evaluation, from -ftime-report (GCC) or -ftime-trace (Clang).
+  wall ms     wall time of -fsyntax-only at N calls minus the time with no calls.
+
+Step counts are deterministic for a given compiler version, so they are what --baseline compares against; the times
+are reported for context only.
+"""
+import argparse
+import json
+import logging
+import os
+import pathlib
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+logging.basicConfig(format="[%(levelname)s] %(message)s")
+
+ROOT = pathlib.Path(__file__).resolve().parents[2]
+SOURCE = ROOT / "benchmark" / "constexpr" / "constexpr_cost.cpp"
+KERNELS = ROOT / "benchmark" / "constexpr" / "kernels.hpp"
+
+# Upper bound of the step search; far above the cost of any kernel.
+MAX_LIMIT = 1 << 34
+
+# Largest table used to count steps, see measure().
+MAX_STEP_CALLS = 1 << 12
+
+
+def parse_args():
+    """Parse commandline arguments"""
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"), help="C++ compiler to measure")
+    parser.add_argument("-I", dest="include_dirs", action="append", default=[], help="include directory (repeatable)")
+    parser.add_argument("--kernels", nargs="*", help="kernels to measure (default: all of kernels.hpp)")
+    parser.add_argument("--calls", type=int, default=1024, help="calls per table when timing")
+    parser.add_argument("--step-calls", type=int, default=16, help="calls per table when counting steps")
+    parser.add_argument("--repeat", type=int, default=3, help="compilations per timing, the fastest is kept")
+    parser.add_argument("--baseline", type=pathlib.Path, help="baseline JSON to compare the step counts against")
+    parser.add_argument("--update-baseline", action="store_true", help="write the measured step counts to --baseline")
+    parser.add_argument("--tolerance", type=float, default=0.05, help="allowed relative increase of steps/call")
+    parser.add_argument("--markdown", type=pathlib.Path, help="also write the table to this file")
+    return parser.parse_args()
+
+
+def read_kernels():
+    """Return the kernel names declared in kernels.hpp"""
+    return re.findall(r"^\tstruct (\w+)$", KERNELS.read_text(), re.MULTILINE)
+
+
+class Compiler:
+    """Runs the compiler on constexpr_cost.cpp"""
+
+    def __init__(self, command, include_dirs):
+        self.command = command
+        self.include_dirs = [str(ROOT / "include")] + include_dirs
+        version = subprocess.run([command, "--version"], capture_output=True, text=True, check=True).stdout
+        self.is_clang = "clang" in version.lower()
+        self.id = ("clang" if self.is_clang else "gcc") + "-" + re.search(r"\d+\.\d+(\.\d+)?", version).group(0)
+        self.step_flag = "-fconstexpr-steps=" if self.is_clang else "-fconstexpr-ops-limit="
+
+    def run(self, kernel, calls, extra=()):
+        """Compile one table, return (succeeded, stderr, seconds)"""
+        command = [self.command, "-std=c++17", "-fsyntax-only", f"-DCCM_CT_BENCH_KERNEL={kernel}"]
+        command += [f"-DCCM_CT_BENCH_N={calls}"] + [f"-I{d}" for d in self.include_dirs] + list(extra) + [str(SOURCE)]
+        start = time.perf_counter()
+        result = subprocess.run(command, capture_output=True, text=True, check=False)
+        return result.returncode == 0, result.stderr, time.perf_counter() - start
+
+    def min_steps(self, kernel, calls):
+        """Smallest step limit that evaluates a table of the given size"""
+        ok, err, _ = self.run(kernel, calls, [f"{self.step_flag}{MAX_LIMIT}"])
+        if not ok:
+            raise RuntimeError(f"{kernel} does not compile:\n{err}")
+        # Gallop up to a bound first; most tables need far fewer steps than MAX_LIMIT.
+        low, high = 0, 1 << 10
+        while not self.run(kernel, calls, [f"{self.step_flag}{high}"])[0]:
+            low, high = high, min(high * 4, MAX_LIMIT)
+        while high - low > 1:
+            mid = (low + high) // 2
+            if self.run(kernel, calls, [f"{self.step_flag}{mid}"])[0]:
+                high = mid
+            else:
+                low = mid
+        return high
+
+    def eval_seconds(self, kernel, calls):
+        """Compiler time spent in constant evaluation, or None if the compiler does not report it"""
+        if not self.is_clang:
+            _, err, _ = self.run(kernel, calls, ["-ftime-report"])
+            match = re.search(r"constant expression evaluation\s*:\s*([\d.]+)", err)
+            return float(match.group(1)) if match else None
+
+        with tempfile.TemporaryDirectory() as tmp:
+            self.run(kernel, calls, ["-ftime-trace", "-ftime-trace-granularity=0", f"-ftime-trace={tmp}/"])
+            traces = list(pathlib.Path(tmp).glob("*.json"))
+            if not traces:
+                return None
+            events = json.loads(traces[0].read_text())["traceEvents"]
+        # Evaluate* events nest; only count time not already covered by an enclosing event.
+        spans = sorted((e["ts"], e["ts"] + e["dur"]) for e in events if e.get("name", "").startswith("Evaluate") and "dur" in e)
+        total, end = 0, 0
+        for begin, finish in spans:
+            if finish > end:
+                total += finish - max(begin, end)
+                end = finish
+        return total * 1e-6
+
+    def best_of(self, repeat, func):
+        """Fastest of several measurements"""
+        values = [v for v in (func() for _ in range(repeat)) if v is not None]
+        return min(values) if values else None
+
+
+def measure(compiler, kernel, args):
+    """Return the cost entry of one kernel"""
+    # The limit applies to each constant expression separately, so a short table can be hidden by an expensive
+    # header constant. Grow the table until it is the most expensive evaluation at both sizes, i.e. one doubling past
+    # the first size at which the limit starts to grow.
+    calls = args.step_calls
+    steps_n = compiler.min_steps(kernel, calls)
+    steps_2n, growing = steps_n, False
+    while calls < MAX_STEP_CALLS:
+        steps_2n = compiler.min_steps(kernel, 2 * calls)
+        if growing:
+            break
+        growing = steps_2n > steps_n
+        calls, steps_n = 2 * calls, steps_2n
+    steps = (steps_2n - steps_n) / calls
+
+    evaluation = compiler.best_of(args.repeat, lambda: compiler.eval_seconds(kernel, args.calls))
+    empty_evaluation = compiler.best_of(args.repeat, lambda: compiler.eval_seconds(kernel, 0))
+    wall = compiler.best_of(args.repeat, lambda: compiler.run(kernel, args.calls)[2])
+    empty = compiler.best_of(args.repeat, lambda: compiler.run(kernel, 0)[2])
+    if evaluation is not None and empty_evaluation is not None:
+        evaluation = max(evaluation - empty_evaluation, 0.0)
+    return {
+        "steps_per_call": round(steps, 1),
+        "eval_us_per_call": None if evaluation is None else round(evaluation / args.calls * 1e6, 1),
+        "wall_ms": round((wall - empty) * 1e3, 1),
+    }
+
+
+def format_table(compiler, results, args):
+    """Markdown table of the results"""
+    lines = [
+        f"Compiler: `{compiler.id}`, {args.calls} calls per table for the timings.",
+        "",
+        "| kernel | steps/call | eval us/call | wall ms |",
+        "|:--|--:|--:|--:|",
+    ]
+    for kernel, entry in results.items():
+        evaluation = "n/a" if entry["eval_us_per_call"] is None else f"{entry['eval_us_per_call']:.1f}"
+        lines.append(f"| {kernel} | {entry['steps_per_call']:.1f} | {evaluation} | {entry['wall_ms']:.1f} |")
+    return "\n".join(lines) + "\n"
+
+
+def compare(compiler, results, baseline, tolerance):
+    """Return the kernels whose step count regressed beyond the tolerance"""
+    reference = baseline.get(compiler.id)
+    if reference is None:
+        logging.warning("no baseline for %s, nothing to compare against", compiler.id)
+        return []
+    regressions = []
+    for kernel, entry in results.items():
+        if kernel not in reference:
+            continue
+        before, after = reference[kernel], entry["steps_per_call"]
+        if after > before * (1 + tolerance):
+            regressions.append(f"{kernel}: {before:.1f} -> {after:.1f} steps/call (+{(after / before - 1) * 100:.1f}%)")
+    return regressions
+
+
+def main():
+    """Entry point"""
+    args = parse_args()
+    compiler = Compiler(args.compiler, args.include_dirs)
+
+    kernels = args.kernels or read_kernels()
+    unknown = set(kernels) - set(read_kernels())
+    if unknown:
+        logging.error("unknown kernels: %s", ", ".join(sorted(unknown)))
+        return 2
+
+    results = {}
+    for kernel in kernels:
+        logging.info("measuring %s", kernel)
+        results[kernel] = measure(compiler, kernel, args)
+
+    table = format_table(compiler, results, args)
+    print(table)
+    if args.markdown:
+        args.markdown.write_text(table)
+
+    if args.baseline is None:
+        return 0
+
+    baseline = json.loads(args.baseline.read_text()) if args.baseline.exists() else {}
+    if args.update_baseline:
+        baseline.setdefault(compiler.id, {}).update({k: v["steps_per_call"] for k, v in results.items()})
+        args.baseline.write_text(json.dumps(baseline, indent=2, sort_keys=True) + "\n")
+        return 0
+
+    regressions = compare(compiler, results, baseline, args.tolerance)
+    for regression in regressions:
+        logging.error("%s", regression)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
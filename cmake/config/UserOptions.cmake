@@ -48,6 +48,13 @@ option(CCMATH_ENABLE_RUNTIME_SIMD
         "Enable SIMD optimization for runtime evaluation (does not affect compile-time)"
         ON)
 
+# CCMATH_BUILD_ISA_KERNELS:
+# Build the batch kernels once for every instruction set the compiler can target, whatever the baseline of the build,
+# as object libraries ready for runtime dispatch (see cmake/helpers/CcmAddIsaKernels.cmake).
+option(CCMATH_BUILD_ISA_KERNELS
+        "Build per-ISA object libraries of the ccmath batch kernels for runtime dispatch"
+        OFF)
+
 # CCMATH_DISABLE_SVML_USAGE:
 # Disable the use of SVML (Short Vector Math Library) if supported by the compiler.
 option(CCMATH_DISABLE_SVML_USAGE
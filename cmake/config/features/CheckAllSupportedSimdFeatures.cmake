@@ -5,11 +5,16 @@ endif ()
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckFMASupport.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckAVXSupport.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckAVX2Support.cmake)
+include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckAVX512Support.cmake)
+include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckAVX512FP16Support.cmake)
+include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckF16CSupport.cmake)
+include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckBMI2Support.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSSE2Support.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSSE3Support.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSSSE3Support.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSSE4Support.cmake)
 include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckNEONSupport.cmake)
+include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSVESupport.cmake)
 
 if (NOT CCMATH_DISABLE_SVML_USAGE)
   include(${CCMATH_SOURCE_DIR}/cmake/config/features/simd/CheckSVMLSupport.cmake)
@@ -0,0 +1,14 @@
+include(CheckCXXSourceCompiles)
+
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m512h one = _mm512_castsi512_ph(_mm512_set1_epi16(0x3C00));
+            __m512h avx512fp16_test = _mm512_add_ph(one, one);
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_AVX512FP16_SUPPORT)
+
+if (CCMATH_SIMD_HAS_AVX512FP16_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512FP16)
+endif ()
@@ -0,0 +1,53 @@
+include(CheckCXXSourceCompiles)
+
+# Check for AVX-512 Foundation support
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m512 avx512f_test = _mm512_add_ps(_mm512_set1_ps(1.0f), _mm512_set1_ps(2.0f));
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_AVX512F_SUPPORT)
+
+# Check for AVX-512 Vector Length support
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m256i avx512vl_test = _mm256_abs_epi64(_mm256_set1_epi64x(-1));
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_AVX512VL_SUPPORT)
+
+# Check for AVX-512 Doubleword and Quadword support
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m512d avx512dq_test = _mm512_cvtepi64_pd(_mm512_set1_epi64(1));
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_AVX512DQ_SUPPORT)
+
+# Check for AVX-512 Byte and Word support
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m512i avx512bw_test = _mm512_add_epi16(_mm512_set1_epi16(1), _mm512_set1_epi16(2));
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_AVX512BW_SUPPORT)
+
+if (CCMATH_SIMD_HAS_AVX512F_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512F)
+endif ()
+
+if (CCMATH_SIMD_HAS_AVX512VL_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512VL)
+endif ()
+
+if (CCMATH_SIMD_HAS_AVX512DQ_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512DQ)
+endif ()
+
+if (CCMATH_SIMD_HAS_AVX512BW_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_AVX512BW)
+endif ()
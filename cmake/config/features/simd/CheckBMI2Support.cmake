@@ -0,0 +1,13 @@
+include(CheckCXXSourceCompiles)
+
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            unsigned int bmi2_test = _pdep_u32(0x5u, 0xF0u);
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_BMI2_SUPPORT)
+
+if (CCMATH_SIMD_HAS_BMI2_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_BMI2)
+endif ()
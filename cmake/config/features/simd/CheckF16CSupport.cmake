@@ -0,0 +1,13 @@
+include(CheckCXXSourceCompiles)
+
+check_cxx_source_compiles("
+        #include <immintrin.h>
+        int main() {
+            __m128 f16c_test = _mm_cvtph_ps(_mm_cvtps_ph(_mm_set1_ps(1.0f), 0));
+            return 0;
+        }
+    " CCMATH_SIMD_HAS_F16C_SUPPORT)
+
+if (CCMATH_SIMD_HAS_F16C_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_F16C)
+endif ()
@@ -0,0 +1,13 @@
+include(CheckCXXSourceCompiles)
+
+check_cxx_source_compiles("
+        #include <arm_sve.h>
+        int main() {
+            svfloat32_t sve_test = svdup_n_f32(1.0f);
+            return static_cast<int>(svcntw());
+        }
+    " CCMATH_SIMD_HAS_SVE_SUPPORT)
+
+if (CCMATH_SIMD_HAS_SVE_SUPPORT)
+  add_compile_definitions(CCM_CONFIG_RT_SIMD_HAS_SVE)
+endif ()
@@ -0,0 +1,119 @@
+include(CheckCXXSourceCompiles)
+
+# Instruction set levels the batch kernels are built for, independently of the baseline of the build:
+#   sse2   - the x86-64 baseline
+#   avx2   - x86-64-v3: AVX2, FMA, F16C and BMI2
+#   avx512 - x86-64-v4: AVX-512 F, VL, DQ and BW on top of avx2. There is no AVX-512 simd ABI yet, so this level runs
+#            the 256-bit avx2 kernels, only compiled with the AVX-512 flags (EVEX encodings, 32 registers, masking).
+#   neon   - the AArch64 baseline
+#   sve    - AArch64 with SVE
+set(CCMATH_ISA_KERNEL_LEVELS sse2 avx2 avx512 neon sve)
+
+# Sets out_var to the list of compiler flags that enable the given level.
+function(ccm_get_isa_flags isa out_var)
+  if (MSVC)
+    set(flags_sse2 "")
+    set(flags_avx2 /arch:AVX2)
+    set(flags_avx512 /arch:AVX512)
+    set(flags_neon "")
+    set(flags_sve "")
+  else ()
+    set(flags_sse2 -msse2)
+    set(flags_avx2 -mavx2 -mfma -mf16c -mbmi2)
+    set(flags_avx512 ${flags_avx2} -mavx512f -mavx512vl -mavx512dq -mavx512bw)
+    set(flags_neon "")
+    set(flags_sve -march=armv8-a+sve)
+  endif ()
+  set(${out_var} ${flags_${isa}} PARENT_SCOPE)
+endfunction()
+
+# Sets out_var to TRUE if the compiler can build code for the given level with the flags of ccm_get_isa_flags.
+# The results are cached as CCMATH_ISA_CAN_TARGET_<ISA>.
+function(ccm_check_isa_target isa out_var)
+  set(source_sse2 "
+        #include <emmintrin.h>
+        int main() {
+            __m128d sse2_test = _mm_add_pd(_mm_set1_pd(1.0), _mm_set1_pd(2.0));
+            return 0;
+        }")
+  set(source_avx2 "
+        #include <immintrin.h>
+        int main() {
+            __m256 avx2_test = _mm256_fmadd_ps(_mm256_set1_ps(1.0f), _mm256_set1_ps(2.0f), _mm256_set1_ps(3.0f));
+            __m256i avx2_int_test = _mm256_add_epi32(_mm256_set1_epi32(1), _mm256_set1_epi32(2));
+            __m128 f16c_test = _mm_cvtph_ps(_mm_cvtps_ph(_mm_set1_ps(1.0f), 0));
+            unsigned int bmi2_test = _pdep_u32(0x5u, 0xF0u);
+            return 0;
+        }")
+  set(source_avx512 "
+        #include <immintrin.h>
+        int main() {
+            __m512 avx512f_test = _mm512_add_ps(_mm512_set1_ps(1.0f), _mm512_set1_ps(2.0f));
+            __m256i avx512vl_test = _mm256_abs_epi64(_mm256_set1_epi64x(-1));
+            __m512d avx512dq_test = _mm512_cvtepi64_pd(_mm512_set1_epi64(1));
+            __m512i avx512bw_test = _mm512_add_epi16(_mm512_set1_epi16(1), _mm512_set1_epi16(2));
+            return 0;
+        }")
+  set(source_neon "
+        #include <arm_neon.h>
+        int main() {
+            float64x2_t neon_test = vaddq_f64(vdupq_n_f64(1.0), vdupq_n_f64(2.0));
+            return 0;
+        }")
+  set(source_sve "
+        #include <arm_sve.h>
+        int main() {
+            svfloat32_t sve_test = svdup_n_f32(1.0f);
+            return static_cast<int>(svcntw());
+        }")
+
+  string(TOUPPER ${isa} isa_upper)
+  if (MSVC AND isa STREQUAL "sve")
+    set(CCMATH_ISA_CAN_TARGET_SVE FALSE CACHE INTERNAL "")
+  else ()
+    ccm_get_isa_flags(${isa} isa_flags)
+    list(JOIN isa_flags " " CMAKE_REQUIRED_FLAGS)
+    check_cxx_source_compiles("${source_${isa}}" CCMATH_ISA_CAN_TARGET_${isa_upper})
+  endif ()
+  set(${out_var} ${CCMATH_ISA_CAN_TARGET_${isa_upper}} PARENT_SCOPE)
+endfunction()
+
+# ccm_add_isa_kernels(<name> OUT_ISAS <var> SOURCES <sources>...)
+#
+# Adds one object library <name>-<isa> per level the compiler can target, built from the same sources with the flags
+# of that level and CCM_KERNEL_ISA=<isa> defined. The sources are expected to put everything they export in a
+# namespace named after CCM_KERNEL_ISA, so the objects of every level can be linked into the same binary and picked
+# from at runtime. <var> receives the levels that were added.
+function(ccm_add_isa_kernels name)
+  cmake_parse_arguments(PARSE_ARGV 1 arg "" "OUT_ISAS" "SOURCES")
+
+  set(isas)
+  foreach (isa IN LISTS CCMATH_ISA_KERNEL_LEVELS)
+    ccm_check_isa_target(${isa} can_target)
+    if (NOT can_target)
+      continue()
+    endif ()
+
+    ccm_get_isa_flags(${isa} isa_flags)
+    # The levels share the names of every inline function they instantiate, and only inlining all of it into the
+    # entries keeps one level from calling another's copy. MSVC cannot be made to do that, so it only gets the level
+    # of its own baseline, which needs no flags.
+    if (MSVC AND isa_flags)
+      continue()
+    endif ()
+
+    add_library(${name}-${isa} OBJECT ${arg_SOURCES})
+    target_compile_options(${name}-${isa} PRIVATE ${isa_flags})
+    # Without optimization GCC and Clang do not inline, and the objects would call each other's copies again.
+    # Contraction is off so every level rounds its products as the scalar code does, as the kernel tests expect.
+    if (NOT MSVC)
+      target_compile_options(${name}-${isa} PRIVATE -O2 -ffp-contract=off)
+    endif ()
+    target_compile_definitions(${name}-${isa} PRIVATE CCM_KERNEL_ISA=${isa})
+    target_link_libraries(${name}-${isa} PRIVATE ${PROJECT_NAME}::${PROJECT_NAME})
+    set_target_properties(${name}-${isa} PROPERTIES POSITION_INDEPENDENT_CODE ON)
+    list(APPEND isas ${isa})
+  endforeach ()
+
+  set(${arg_OUT_ISAS} ${isas} PARENT_SCOPE)
+endfunction()
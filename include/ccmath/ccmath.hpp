@@ -38,6 +38,10 @@
 #include "math/trig.hpp"
 
 /// Uncategorized func
+#include "ccmath/math/misc/erf.hpp"
+#include "ccmath/math/misc/erfc.hpp"
+#include "ccmath/math/misc/erfcinv.hpp"
+#include "ccmath/math/misc/erfinv.hpp"
 #include "ccmath/math/misc/gamma.hpp"
 #include "ccmath/math/misc/lerp.hpp"
 #include "ccmath/math/misc/lgamma.hpp"
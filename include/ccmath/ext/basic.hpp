@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/func/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Array forms of fabs, copysign, fmax, fmin, fdim and fma for float and double.
+ *
+ * The scalar functions branch on NaN, which keeps a loop over them from being vectorized. Here every block of
+ * native_simd<T>::size() elements goes through the branch-free intrin kernels: sign bit masks for fabs and copysign,
+ * the vector max and min with their NaN and signed zero lanes patched up for fmax and fmin, and a masked subtraction
+ * for fdim.
+ *
+ * Results are the same as the scalar ccm functions, element by element, down to the sign of zero. fmax(-0, +0) is
+ * +0 and fmin(-0, +0) is -0 in either order. fma is correctly rounded everywhere and a single instruction where
+ * intrin::has_fma_v holds. Nothing else multiplies, so this holds under any floating point contraction mode.
+ *
+ * Each function also takes an execution policy first, which splits the arrays with execution::for_each_block.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		/// Stores op applied to every block of x into out.
+		template <typename T, typename Op>
+		void basic_map(T const * x, std::size_t n, T * out, Op && op) noexcept
+		{
+			for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count) { store_block(op(load_block<T>(x + i, count)), out + i, count); });
+		}
+
+		/// Stores op applied to every pair of blocks of x and y into out.
+		template <typename T, typename Op>
+		void basic_map(T const * x, T const * y, std::size_t n, T * out, Op && op) noexcept
+		{
+			for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+								   { store_block(op(load_block<T>(x + i, count), load_block<T>(y + i, count)), out + i, count); });
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Absolute value of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::fabs. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fabs(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::basic_map(x, n, out, [](intrin::native_simd<T> const & v) { return intrin::fabs(v); });
+	}
+
+	/**
+	 * @brief Magnitude of every element of mag with the sign of the matching element of sgn.
+	 * @param mag Pointer to the first magnitude.
+	 * @param sgn Pointer to the first sign.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::copysign. May be the same array as mag or sgn.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void copysign(T const * mag, T const * sgn, std::size_t n, T * out) noexcept
+	{
+		detail::basic_map(mag, sgn, n, out, [](intrin::native_simd<T> const & a, intrin::native_simd<T> const & b) { return intrin::copysign(a, b); });
+	}
+
+	/**
+	 * @brief Larger of every pair of elements, NaN elements being ignored.
+	 * @param x Pointer to the first left-hand side.
+	 * @param y Pointer to the first right-hand side.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::fmax. May be the same array as x or y.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fmax(T const * x, T const * y, std::size_t n, T * out) noexcept
+	{
+		detail::basic_map(x, y, n, out, [](intrin::native_simd<T> const & a, intrin::native_simd<T> const & b) { return intrin::fmax(a, b); });
+	}
+
+	/**
+	 * @brief Larger of every element and the same value, NaN elements being ignored.
+	 * @param x Pointer to the first element.
+	 * @param y The value to compare every element with, for example 0 for a rectifier.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::fmax. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fmax(T const * x, T y, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> b(y);
+		detail::basic_map(x, n, out, [&](intrin::native_simd<T> const & a) { return intrin::fmax(a, b); });
+	}
+
+	/**
+	 * @brief Smaller of every pair of elements, NaN elements being ignored.
+	 * @param x Pointer to the first left-hand side.
+	 * @param y Pointer to the first right-hand side.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::fmin. May be the same array as x or y.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fmin(T const * x, T const * y, std::size_t n, T * out) noexcept
+	{
+		detail::basic_map(x, y, n, out, [](intrin::native_simd<T> const & a, intrin::native_simd<T> const & b) { return intrin::fmin(a, b); });
+	}
+
+	/**
+	 * @brief Smaller of every element and the same value, NaN elements being ignored.
+	 * @param x Pointer to the first element.
+	 * @param y The value to compare every element with.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::fmin. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fmin(T const * x, T y, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> b(y);
+		detail::basic_map(x, n, out, [&](intrin::native_simd<T> const & a) { return intrin::fmin(a, b); });
+	}
+
+	/**
+	 * @brief Positive difference of every pair of elements.
+	 * @param x Pointer to the first left-hand side.
+	 * @param y Pointer to the first right-hand side.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::fdim. May be the same array as x or y.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fdim(T const * x, T const * y, std::size_t n, T * out) noexcept
+	{
+		detail::basic_map(x, y, n, out, [](intrin::native_simd<T> const & a, intrin::native_simd<T> const & b) { return intrin::fdim(a, b); });
+	}
+
+	/**
+	 * @brief x * y + z for every triple of elements.
+	 * @param x Pointer to the first multiplicand.
+	 * @param y Pointer to the first multiplier.
+	 * @param z Pointer to the first addend.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::fma. May be the same array as x, y or z.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fma(T const * x, T const * y, T const * z, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   detail::store_block(intrin::fma(detail::load_block<T>(x + i, count), detail::load_block<T>(y + i, count),
+																		   detail::load_block<T>(z + i, count)),
+															   out + i, count);
+									   });
+	}
+
+	/// fabs of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fabs(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fabs(x + begin, end - begin, out + begin); });
+	}
+
+	/// copysign of every pair of elements, with the arrays split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void copysign(Policy && policy, T const * mag, T const * sgn, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { copysign(mag + begin, sgn + begin, end - begin, out + begin); });
+	}
+
+	/// fmax of every pair of elements, with the arrays split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fmax(Policy && policy, T const * x, T const * y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fmax(x + begin, y + begin, end - begin, out + begin); });
+	}
+
+	/// fmax of every element and y, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fmax(Policy && policy, T const * x, T y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fmax(x + begin, y, end - begin, out + begin); });
+	}
+
+	/// fmin of every pair of elements, with the arrays split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fmin(Policy && policy, T const * x, T const * y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fmin(x + begin, y + begin, end - begin, out + begin); });
+	}
+
+	/// fmin of every element and y, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fmin(Policy && policy, T const * x, T y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fmin(x + begin, y, end - begin, out + begin); });
+	}
+
+	/// fdim of every pair of elements, with the arrays split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fdim(Policy && policy, T const * x, T const * y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fdim(x + begin, y + begin, end - begin, out + begin); });
+	}
+
+	/// fma of every triple of elements, with the arrays split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_fmanip_type_v<T>, bool> = true>
+	void fma(Policy && policy, T const * x, T const * y, T const * z, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { fma(x + begin, y + begin, z + begin, end - begin, out + begin); });
+	}
+} // namespace ccm::ext
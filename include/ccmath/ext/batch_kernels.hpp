@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/*
+ * Tables of the array functions of ccmath/ext built for one instruction set each.
+ *
+ * With CCMATH_BUILD_ISA_KERNELS the ccmath::kernels library compiles src/kernels/batch.cpp once for every level the
+ * compiler can target (see cmake/helpers/CcmAddIsaKernels.cmake) and defines CCM_CONFIG_KERNELS_HAS_<ISA> for each
+ * of them. Only the tables of those levels exist. A caller checks what the CPU supports once and keeps the matching
+ * table, which lets a build with an x86-64-v2 baseline still run AVX2 kernels where it can. MSVC only builds the level
+ * of its baseline.
+ *
+ * The avx512 table is the avx2 code compiled with the AVX-512 flags: its lanes are 256 bits wide until there is an
+ * AVX-512 simd ABI, and it only gains the EVEX encodings, the 32 vector registers and the masked operations.
+ *
+ * Every entry takes the arguments of the ccm::ext function of the same name and gives the same results.
+ */
+
+namespace ccm::ext::kernels
+{
+	template <typename T>
+	struct batch_functions
+	{
+		using unary_fn	 = void (*)(T const * x, std::size_t n, T * out) noexcept;
+		using binary_fn	 = void (*)(T const * x, T const * y, std::size_t n, T * out) noexcept;
+		using ternary_fn = void (*)(T const * x, T const * y, T const * z, std::size_t n, T * out) noexcept;
+
+		unary_fn fabs;
+		binary_fn copysign;
+		binary_fn fmax;
+		binary_fn fmin;
+		binary_fn fdim;
+		ternary_fn fma;
+		unary_fn erf;
+		unary_fn erfc;
+		unary_fn tgamma;
+		unary_fn lgamma;
+	};
+
+	struct batch_table
+	{
+		batch_functions<float> f32;
+		batch_functions<double> f64;
+	};
+
+	namespace sse2
+	{
+		extern const batch_table table;
+	} // namespace sse2
+
+	namespace avx2
+	{
+		extern const batch_table table;
+	} // namespace avx2
+
+	/// The avx2 kernels built with the AVX-512 flags, see above.
+	namespace avx512
+	{
+		extern const batch_table table;
+	} // namespace avx512
+
+	namespace neon
+	{
+		extern const batch_table table;
+	} // namespace neon
+
+	namespace sve
+	{
+		extern const batch_table table;
+	} // namespace sve
+} // namespace ccm::ext::kernels
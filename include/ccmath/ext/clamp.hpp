@@ -13,6 +13,10 @@
 #include "ccmath/math/basic/min.hpp"
 #include "ccmath/math/basic/max.hpp"
 
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
@@ -46,4 +50,37 @@ namespace ccm::ext
     {
         return ccm::min(ccm::max(v, lo), hi);
     }
+
+	/**
+	 * @brief Clamps every lane between a minimum and maximum value.
+	 * @param v Value to clamp.
+	 * @param lo Minimum value.
+	 * @param hi Maximum value.
+	 * @return The clamped lanes, the same as the scalar clamp of each lane.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> clamp(intrin::simd<T, Abi> const & v, intrin::simd<T, Abi> const & lo = intrin::simd<T, Abi>(T(0)),
+							   intrin::simd<T, Abi> const & hi = intrin::simd<T, Abi>(T(1))) noexcept
+	{
+		// ccm::max and ccm::min as selects, a NaN operand gives the other one.
+		const intrin::simd<T, Abi> above = intrin::choose(lo < v || !(lo == lo), v, lo);
+		return intrin::choose(above < hi || !(hi == hi), above, hi);
+	}
+
+	/**
+	 * @brief Clamps every element between a minimum and maximum value.
+	 * @param v Pointer to the values to clamp.
+	 * @param lo Minimum value.
+	 * @param hi Maximum value.
+	 * @param n Number of elements.
+	 * @param out Receives n clamped values. May be the same array as v.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void clamp(T const * v, T lo, T hi, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> lower(lo);
+		const intrin::native_simd<T> upper(hi);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(clamp(detail::load_block<T>(v + i, count), lower, upper), out + i, count); });
+	}
 } // namespace ccm::ext
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/reduce.hpp"
+
+#include <cstddef>
+#include <utility>
+
+/*
+ * Compensated reductions over arrays of doubles.
+ *
+ * These are ccm::ext::sum and ccm::ext::dot with summation::eNeumaier, i.e. Ogita, Rump and Oishi's Sum2 and Dot2
+ * run on native_simd<double> lanes. The result is as accurate as if the reduction had been carried out in
+ * double-double and rounded once: the error is bounded by eps * |result| + (n * eps)^2 * sum |x_i|, where a plain
+ * loop only guarantees n * eps * sum |x_i|.
+ */
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Sums an array of doubles with compensation, as if in double-double precision.
+	 * @param data Pointer to the first element.
+	 * @param n Number of elements.
+	 * @return The sum, correctly rounded unless the input is extremely ill-conditioned.
+	 */
+	constexpr double compensated_sum(double const * data, std::size_t n) noexcept
+	{
+		return sum<summation::eNeumaier>(data, n);
+	}
+
+	/**
+	 * @brief Dot product of two arrays of doubles with compensation, as if in double-double precision.
+	 * @param x Pointer to the first element of the first array.
+	 * @param y Pointer to the first element of the second array.
+	 * @param n Number of elements in each array.
+	 * @return The dot product, correctly rounded unless the input is extremely ill-conditioned.
+	 */
+	constexpr double compensated_dot(double const * x, double const * y, std::size_t n) noexcept
+	{
+		return dot<summation::eNeumaier>(x, y, n);
+	}
+
+	/// Compensated sum of a contiguous container of doubles such as std::vector or std::array.
+	template <typename Container, typename = decltype(std::declval<Container const &>().data()),
+			  typename = decltype(std::declval<Container const &>().size())>
+	constexpr double compensated_sum(Container const & values) noexcept
+	{
+		return compensated_sum(values.data(), static_cast<std::size_t>(values.size()));
+	}
+
+	/// Compensated dot product of two contiguous containers of doubles. Only the common prefix is used.
+	template <typename Container, typename = decltype(std::declval<Container const &>().data()),
+			  typename = decltype(std::declval<Container const &>().size())>
+	constexpr double compensated_dot(Container const & x, Container const & y) noexcept
+	{
+		const auto n = static_cast<std::size_t>(x.size() < y.size() ? x.size() : y.size());
+		return compensated_dot(x.data(), y.data(), n);
+	}
+} // namespace ccm::ext
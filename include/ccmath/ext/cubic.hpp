@@ -36,4 +36,28 @@ namespace ccm::ext
 
 		return (a0 * t * t2) + (a1 * t2) + (a2 * t) + a3;
 	}
+
+	/**
+	 * @brief Catmull-Rom cubic interpolation between y1 and y2.
+	 *
+	 * Unlike cubic(), the curve reproduces polynomials up to degree two exactly, so the error of sampled smooth
+	 * functions falls with the cube of the sample spacing.
+	 * @tparam T Type of the input and output.
+	 * @param y0 The value before y1.
+	 * @param y1 The value at t = 0.
+	 * @param y2 The value at t = 1.
+	 * @param y3 The value after y2.
+	 * @param t The interpolation value.
+	 * @return The interpolated value.
+	 */
+	template<typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T catmull_rom(T y0, T y1, T y2, T y3, T t)
+	{
+		const T a0 = static_cast<T>(0.5) * (y3 - y0) + static_cast<T>(1.5) * (y1 - y2);
+		const T a1 = y0 - static_cast<T>(2.5) * y1 + static_cast<T>(2) * y2 - static_cast<T>(0.5) * y3;
+		const T a2 = static_cast<T>(0.5) * (y2 - y0);
+		const T a3 = y1;
+
+		return ((a0 * t + a1) * t + a2) * t + a3;
+	}
 } // namespace ccm::ext
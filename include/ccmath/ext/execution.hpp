@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Defining CCM_CONFIG_USE_STD_EXECUTION lets the std::execution policies be passed wherever a ccm policy is accepted.
+// This is opt-in as <execution> may pull in a parallel backend (e.g. TBB) that then has to be linked.
+#if defined(CCM_CONFIG_USE_STD_EXECUTION)
+	#include <execution>
+#endif
+
+/*
+ * Execution policies for the batch APIs.
+ *
+ * Parallel execution uses static chunking. The range is split into one contiguous block per thread and every block
+ * boundary falls on a cache line of the output, so no two threads ever write the same line. Contiguous blocks also
+ * keep each thread on the pages it touched first, which is what NUMA first-touch placement wants when the data was
+ * initialised with the same policy.
+ *
+ * The calling thread processes the first block itself and the remaining blocks run on short-lived std::threads, which
+ * are always joined before for_each_block returns or throws. Starting a thread costs in the order of tens of
+ * microseconds, so a block should hold at least that much work: the default min_block of 16Ki elements suits the
+ * special functions, while memory bound functions such as fabs need blocks many times larger to gain anything.
+ * If no thread can be started, the blocks that have none run on the calling thread instead.
+ * Using ccm::ext::execution::par requires linking against the platform thread library (Threads::Threads in CMake).
+ */
+
+namespace ccm::ext::execution
+{
+	/// Run the whole range on the calling thread.
+	struct sequenced_policy
+	{
+	};
+
+	/// Split the range into contiguous cache line aligned blocks and run them concurrently.
+	class parallel_policy
+	{
+	public:
+		/**
+		 * @param threads Maximum number of threads to use. Zero means std::thread::hardware_concurrency().
+		 * @param min_block Smallest number of elements worth handing to a thread. Smaller ranges use fewer threads, and
+		 * ranges below twice this size run on the calling thread alone.
+		 */
+		constexpr explicit parallel_policy(unsigned threads = 0, std::size_t min_block = 1U << 14U) noexcept
+			: m_threads(threads), m_min_block(min_block > 0 ? min_block : 1)
+		{
+		}
+
+		[[nodiscard]] unsigned concurrency() const noexcept
+		{
+			if (m_threads != 0) { return m_threads; }
+			const unsigned hw = std::thread::hardware_concurrency();
+			return hw != 0 ? hw : 1;
+		}
+
+		[[nodiscard]] constexpr std::size_t min_block() const noexcept { return m_min_block; }
+
+	private:
+		unsigned m_threads;
+		std::size_t m_min_block;
+	};
+
+	inline constexpr sequenced_policy seq{};
+	inline constexpr parallel_policy par{};
+
+#if defined(CCM_CONFIG_USE_STD_EXECUTION)
+	template <typename T>
+	struct is_execution_policy : std::is_execution_policy<T>
+	{
+	};
+#else
+	template <typename T>
+	struct is_execution_policy : std::false_type
+	{
+	};
+#endif
+
+	template <>
+	struct is_execution_policy<sequenced_policy> : std::true_type
+	{
+	};
+
+	template <>
+	struct is_execution_policy<parallel_policy> : std::true_type
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool is_execution_policy_v = is_execution_policy<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+	namespace detail
+	{
+		// Destructive interference size used for block boundaries.
+		// std::hardware_destructive_interference_size is avoided as GCC warns that its value is ABI sensitive.
+		inline constexpr std::size_t cache_line_size = 64;
+
+		inline parallel_policy to_native(parallel_policy const & policy) noexcept { return policy; }
+		inline sequenced_policy to_native(sequenced_policy const & policy) noexcept { return policy; }
+
+#if defined(CCM_CONFIG_USE_STD_EXECUTION)
+		inline sequenced_policy to_native(std::execution::sequenced_policy const & /* policy */) noexcept { return seq; }
+		inline parallel_policy to_native(std::execution::parallel_policy const & /* policy */) noexcept { return par; }
+		inline parallel_policy to_native(std::execution::parallel_unsequenced_policy const & /* policy */) noexcept { return par; }
+	#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+		inline sequenced_policy to_native(std::execution::unsequenced_policy const & /* policy */) noexcept { return seq; }
+	#endif
+#endif
+
+		/// Joins every thread it holds when it goes out of scope, also while an exception unwinds.
+		class joining_threads
+		{
+		public:
+			joining_threads() = default;
+			joining_threads(joining_threads const &)			 = delete;
+			joining_threads & operator=(joining_threads const &) = delete;
+
+			~joining_threads()
+			{
+				for (auto & thread : m_threads) { thread.join(); }
+			}
+
+			void reserve(std::size_t count) { m_threads.reserve(count); }
+
+			template <typename F>
+			void start(F && func)
+			{
+				m_threads.emplace_back(std::forward<F>(func));
+			}
+
+		private:
+			std::vector<std::thread> m_threads;
+		};
+
+		template <typename T, typename F>
+		void for_each_block(sequenced_policy const & /* policy */, T const * /* out */, std::size_t n, F && func)
+		{
+			if (n > 0) { func(std::size_t{0}, n); }
+		}
+
+		template <typename T, typename F>
+		void for_each_block(parallel_policy const & policy, T const * out, std::size_t n, F && func)
+		{
+			constexpr std::size_t line = cache_line_size / sizeof(T) > 0 ? cache_line_size / sizeof(T) : 1;
+
+			std::size_t threads = policy.concurrency();
+			if (n / policy.min_block() < threads) { threads = n / policy.min_block(); }
+			if (threads <= 1)
+			{
+				if (n > 0) { func(std::size_t{0}, n); }
+				return;
+			}
+
+			// Elements before the first cache line boundary of the output go to the first block.
+			const auto misalignment = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(out) % cache_line_size);
+			std::size_t head		= misalignment == 0 ? 0 : (cache_line_size - misalignment) / sizeof(T);
+			if (head > n) { head = n; }
+
+			// Every block is a whole number of cache lines, only the last one is short.
+			std::size_t block = (n - head + threads - 1) / threads;
+			block			  = (block + line - 1) / line * line;
+
+			// Outlives the workers, each of which only writes its own slot.
+			std::vector<std::exception_ptr> errors(threads);
+			{
+				joining_threads workers;
+				workers.reserve(threads - 1);
+
+				// Start of the blocks no thread could be started for.
+				std::size_t rest = n;
+				for (std::size_t t = 1; t < threads; ++t)
+				{
+					const std::size_t begin = head + t * block;
+					if (begin >= n) { break; }
+					const std::size_t end = begin + block < n ? begin + block : n;
+					try
+					{
+						workers.start(
+							[&func, &errors, t, begin, end]
+							{
+								try
+								{
+									func(begin, end);
+								}
+								catch (...)
+								{
+									errors[t] = std::current_exception();
+								}
+							});
+					}
+					catch (std::system_error const & /* error */)
+					{
+						rest = begin;
+						break;
+					}
+				}
+
+				func(std::size_t{0}, head + block < n ? head + block : n);
+				if (rest < n) { func(rest, n); }
+			}
+
+			for (auto const & error : errors)
+			{
+				if (error) { std::rethrow_exception(error); }
+			}
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Splits the index range [0, n) according to the policy and calls func(begin, end) once per block.
+	 *
+	 * Blocks are disjoint, contiguous and cover the range exactly once. With a parallel policy the blocks run
+	 * concurrently, so func must be safe to call from several threads for disjoint ranges. If func throws, every
+	 * block already started still runs to its end before the exception reaches the caller. When several blocks
+	 * throw, one of the exceptions is rethrown.
+	 *
+	 * @tparam Policy An execution policy.
+	 * @tparam T Element type of the output, used to align block boundaries to its cache lines.
+	 * @param policy The execution policy.
+	 * @param out Start of the output array.
+	 * @param n Number of elements.
+	 * @param func Callable invoked as func(std::size_t begin, std::size_t end).
+	 */
+	template <typename Policy, typename T, typename F, std::enable_if_t<is_execution_policy_v<Policy>, bool> = true>
+	void for_each_block(Policy && policy, T const * out, std::size_t n, F && func)
+	{
+		detail::for_each_block(detail::to_native(policy), out, n, std::forward<F>(func));
+	}
+} // namespace ccm::ext::execution
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Array forms of exp, exp2 and log for float and double.
+ *
+ * The scalar functions test every element for NaN, infinities, zeros, subnormals and overflow before the polynomial.
+ * The intrin kernels used here make one such test per block of native_simd<T>::size() elements: a block whose
+ * elements are all in the regular range takes a lean path with no selects, and only blocks with a special element pay
+ * for the masked path that patches those lanes. Data without special values never leaves the lean path.
+ *
+ * Results are the same in either path, but errno and the floating-point exceptions are left alone. Each function also
+ * takes an execution policy first, which splits the array with execution::for_each_block.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_expo_type_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		/// Stores op applied to every block of x into out.
+		template <typename T, typename Op>
+		void expo_map(T const * x, std::size_t n, T * out, Op && op) noexcept
+		{
+			for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count) { store_block(op(load_block<T>(x + i, count)), out + i, count); });
+		}
+	} // namespace detail
+
+	/**
+	 * @brief e raised to every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::exp. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_expo_type_v<T>, bool> = true>
+	void exp(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::expo_map(x, n, out, [](intrin::native_simd<T> const & v) { return intrin::exp(v); });
+	}
+
+	/**
+	 * @brief 2 raised to every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::exp2. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_expo_type_v<T>, bool> = true>
+	void exp2(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::expo_map(x, n, out, [](intrin::native_simd<T> const & v) { return intrin::exp2(v); });
+	}
+
+	/**
+	 * @brief Natural logarithm of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::log. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_expo_type_v<T>, bool> = true>
+	void log(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::expo_map(x, n, out, [](intrin::native_simd<T> const & v) { return intrin::log(v); });
+	}
+
+	/// exp of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_expo_type_v<T>, bool> = true>
+	void exp(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { exp(x + begin, end - begin, out + begin); });
+	}
+
+	/// exp2 of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_expo_type_v<T>, bool> = true>
+	void exp2(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { exp2(x + begin, end - begin, out + begin); });
+	}
+
+	/// log of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_expo_type_v<T>, bool> = true>
+	void log(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { log(x + begin, end - begin, out + begin); });
+	}
+} // namespace ccm::ext
@@ -0,0 +1,658 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cbrt.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/hypot.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/math/basic/fabs.hpp"
+#include "ccmath/math/basic/fma.hpp"
+#include "ccmath/math/basic/max.hpp"
+#include "ccmath/math/basic/min.hpp"
+#include "ccmath/math/expo/exp.hpp"
+#include "ccmath/math/expo/exp2.hpp"
+#include "ccmath/math/expo/expm1.hpp"
+#include "ccmath/math/expo/log.hpp"
+#include "ccmath/math/expo/log10.hpp"
+#include "ccmath/math/expo/log1p.hpp"
+#include "ccmath/math/expo/log2.hpp"
+#include "ccmath/math/power/cbrt.hpp"
+#include "ccmath/math/power/hypot.hpp"
+#include "ccmath/math/power/pow.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lazy element-wise expressions.
+ *
+ * Building an expression does no work. Arithmetic operators and the functions in this namespace only record the
+ * operation and keep their operands by value (views are a pointer and a size), so chains such as
+ *
+ *     ccm::ext::expr::array_view x{values};
+ *     ccm::ext::expr::evaluate(ccm::ext::expr::exp(-0.5 * x * x) * scale + bias, out);
+ *
+ * are evaluated in a single pass over the input with no temporary arrays. Each block of native_simd<T>::size()
+ * elements is loaded once, pushed through the whole expression in registers and stored once. The last partial block
+ * is padded, so every element goes through the same vector kernels. exp, exp2 and log use the intrin kernels of the
+ * ext array forms, which can be a bit off the scalar ccm:: functions that eval() applies to a single element.
+ */
+
+namespace ccm::ext::expr
+{
+	namespace detail
+	{
+		struct expression_tag
+		{
+		};
+
+		// The widest simd type available for T. Types without a vector ABI evaluate one lane at a time.
+		template <typename T>
+		using simd_t = std::conditional_t<std::is_same_v<T, float> || std::is_same_v<T, double>, intrin::native_simd<T>, intrin::simd<T, intrin::abi::scalar>>;
+
+		// Size reported by operands that broadcast to any length.
+		inline constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+	} // namespace detail
+
+	template <typename E>
+	inline constexpr bool is_expression_v = std::is_base_of_v<detail::expression_tag, E>;
+
+	/**
+	 * @brief Non-owning view of a contiguous array used as the leaf of an expression.
+	 * @tparam T Element type of the array.
+	 */
+	template <typename T>
+	class array_view : detail::expression_tag
+	{
+	public:
+		using value_type = T;
+
+		constexpr array_view() noexcept = default;
+		constexpr array_view(T const * data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+		template <std::size_t N>
+		constexpr array_view(T const (&data)[N]) noexcept : m_data(data), m_size(N) // NOLINT(google-explicit-constructor)
+		{
+		}
+
+		template <typename Container, typename = decltype(std::declval<Container const &>().data()),
+				  typename = decltype(std::declval<Container const &>().size())>
+		constexpr array_view(Container const & container) noexcept // NOLINT(google-explicit-constructor)
+			: m_data(container.data()), m_size(static_cast<std::size_t>(container.size()))
+		{
+		}
+
+		[[nodiscard]] constexpr T const * data() const noexcept { return m_data; }
+		[[nodiscard]] constexpr std::size_t size() const noexcept { return m_size; }
+		constexpr T const & operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+		[[nodiscard]] constexpr T eval(std::size_t i) const noexcept { return m_data[i]; }
+
+		/// Loads the block at i. Blocks of fewer than Simd::size() elements are padded with zeros.
+		template <typename Simd>
+		[[nodiscard]] Simd eval_simd(std::size_t i, std::size_t count = Simd::size()) const noexcept
+		{
+			if (count == Simd::size()) { return Simd(m_data + i, intrin::element_aligned_tag()); }
+			T buffer[Simd::size()]{};
+			for (std::size_t k = 0; k < count; ++k) { buffer[k] = m_data[i + k]; }
+			return Simd(buffer, intrin::element_aligned_tag());
+		}
+
+	private:
+		T const * m_data{nullptr};
+		std::size_t m_size{0};
+	};
+
+	template <typename Container>
+	array_view(Container const &) -> array_view<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<Container const &>().data())>>>;
+
+	/**
+	 * @brief Scalar operand broadcast to every element of an expression.
+	 * @tparam T Type of the scalar.
+	 */
+	template <typename T>
+	class broadcast : detail::expression_tag
+	{
+	public:
+		using value_type = T;
+
+		constexpr explicit broadcast(T value) noexcept : m_value(value) {}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept { return detail::unbounded; }
+
+		[[nodiscard]] constexpr T eval(std::size_t /* i */) const noexcept { return m_value; }
+
+		template <typename Simd>
+		[[nodiscard]] Simd eval_simd(std::size_t /* i */, std::size_t /* count */ = Simd::size()) const noexcept
+		{
+			return Simd(m_value);
+		}
+
+	private:
+		T m_value;
+	};
+
+	/**
+	 * @brief Node applying the callable Fn to the element-wise values of its operand expressions.
+	 * @tparam Fn Stateless callable with a scalar and a simd overload.
+	 * @tparam Es Operand expressions.
+	 */
+	template <typename Fn, typename... Es>
+	class function_expr : detail::expression_tag
+	{
+	public:
+		using value_type = std::common_type_t<typename Es::value_type...>;
+
+		constexpr explicit function_expr(Es const &... args) noexcept : m_args(args...) {}
+
+		[[nodiscard]] constexpr std::size_t size() const noexcept
+		{
+			return std::apply(
+				[](auto const &... e)
+				{
+					std::size_t result = detail::unbounded;
+					((result = e.size() < result ? e.size() : result), ...);
+					// Every sized operand has to agree on the length.
+					assert(((e.size() == detail::unbounded || e.size() == result) && ...));
+					return result;
+				},
+				m_args);
+		}
+
+		[[nodiscard]] constexpr value_type eval(std::size_t i) const noexcept
+		{
+			return std::apply([i](auto const &... e) { return Fn{}(e.eval(i)...); }, m_args);
+		}
+
+		template <typename Simd>
+		[[nodiscard]] Simd eval_simd(std::size_t i, std::size_t count = Simd::size()) const noexcept
+		{
+			return std::apply([i, count](auto const &... e) { return Fn{}(e.template eval_simd<Simd>(i, count)...); }, m_args);
+		}
+
+	private:
+		std::tuple<Es...> m_args;
+	};
+
+	/// Callables used by the expression nodes. Each one accepts either a scalar or an intrin::simd value.
+	namespace fn
+	{
+		struct plus
+		{
+			template <typename T>
+			constexpr T operator()(T const & a, T const & b) const noexcept
+			{
+				return a + b;
+			}
+		};
+
+		struct minus
+		{
+			template <typename T>
+			constexpr T operator()(T const & a, T const & b) const noexcept
+			{
+				return a - b;
+			}
+		};
+
+		struct multiplies
+		{
+			template <typename T>
+			constexpr T operator()(T const & a, T const & b) const noexcept
+			{
+				return a * b;
+			}
+		};
+
+		struct divides
+		{
+			template <typename T>
+			constexpr T operator()(T const & a, T const & b) const noexcept
+			{
+				return a / b;
+			}
+		};
+
+		struct negate
+		{
+			template <typename T>
+			constexpr T operator()(T const & a) const noexcept
+			{
+				return -a;
+			}
+		};
+
+		struct sqrt
+		{
+			template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+			constexpr T operator()(T a) const noexcept
+			{
+				return ccm::sqrt(a);
+			}
+
+			template <typename T, typename Abi>
+			intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a) const noexcept
+			{
+				return intrin::sqrt(a);
+			}
+
+			template <typename T, int N>
+			intrin::simd<T, intrin::abi::pack<N>> operator()(intrin::simd<T, intrin::abi::pack<N>> const & a) const noexcept
+			{
+				return intrin::lanewise([](T v) { return ccm::sqrt(v); }, a);
+			}
+		};
+
+		struct cbrt
+		{
+			template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+			constexpr T operator()(T a) const noexcept
+			{
+				return ccm::cbrt(a);
+			}
+
+			template <typename T, typename Abi>
+			intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a) const noexcept
+			{
+				return intrin::cbrt(a);
+			}
+		};
+
+		struct hypot
+		{
+			template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+			constexpr T operator()(T a, T b) const noexcept
+			{
+				return ccm::hypot(a, b);
+			}
+
+			template <typename T, typename Abi>
+			intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b) const noexcept
+			{
+				return intrin::hypot(a, b);
+			}
+		};
+
+		// Functions with a vector kernel for float and double lanes. Other types run on the scalar ABI and take ccm::name
+		// lane by lane, as the kernels only have float and double versions.
+#define CCM_EXPR_KERNEL_UNARY(name)                                                                                                                            \
+	struct name                                                                                                                                                \
+	{                                                                                                                                                          \
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>                                                                      \
+		constexpr T operator()(T a) const noexcept                                                                                                             \
+		{                                                                                                                                                      \
+			return ccm::name(a);                                                                                                                               \
+		}                                                                                                                                                      \
+                                                                                                                                                               \
+		template <typename T, typename Abi>                                                                                                                    \
+		intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a) const noexcept                                                                         \
+		{                                                                                                                                                      \
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) { return intrin::name(a); }                                                   \
+			else { return intrin::lanewise([](T v) { return ccm::name(v); }, a); }                                                                             \
+		}                                                                                                                                                      \
+	};
+
+		CCM_EXPR_KERNEL_UNARY(exp)
+		CCM_EXPR_KERNEL_UNARY(exp2)
+		CCM_EXPR_KERNEL_UNARY(log)
+		CCM_EXPR_KERNEL_UNARY(fabs)
+
+#undef CCM_EXPR_KERNEL_UNARY
+
+#define CCM_EXPR_KERNEL_BINARY(name)                                                                                                                           \
+	struct name                                                                                                                                                \
+	{                                                                                                                                                          \
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>                                                                      \
+		constexpr T operator()(T a, T b) const noexcept                                                                                                        \
+		{                                                                                                                                                      \
+			return ccm::name(a, b);                                                                                                                            \
+		}                                                                                                                                                      \
+                                                                                                                                                               \
+		template <typename T, typename Abi>                                                                                                                    \
+		intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b) const noexcept                                         \
+		{                                                                                                                                                      \
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) { return intrin::name(a, b); }                                                \
+			else { return intrin::lanewise([](T x, T y) { return ccm::name(x, y); }, a, b); }                                                                  \
+		}                                                                                                                                                      \
+	};
+
+		CCM_EXPR_KERNEL_BINARY(fmin)
+		CCM_EXPR_KERNEL_BINARY(fmax)
+
+#undef CCM_EXPR_KERNEL_BINARY
+
+		// Functions without a dedicated vector kernel are applied lane by lane.
+		// The surrounding arithmetic still runs on full vectors and the data is still only read once.
+#define CCM_EXPR_LANEWISE_UNARY(name)                                                                                                                          \
+	struct name                                                                                                                                                \
+	{                                                                                                                                                          \
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>                                                                     \
+		constexpr T operator()(T a) const noexcept                                                                                                             \
+		{                                                                                                                                                      \
+			return ccm::name(a);                                                                                                                               \
+		}                                                                                                                                                      \
+                                                                                                                                                               \
+		template <typename T, typename Abi>                                                                                                                    \
+		intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a) const noexcept                                                                        \
+		{                                                                                                                                                      \
+			return intrin::lanewise([](T v) { return ccm::name(v); }, a);                                                                                      \
+		}                                                                                                                                                      \
+	};
+
+		CCM_EXPR_LANEWISE_UNARY(expm1)
+		CCM_EXPR_LANEWISE_UNARY(log2)
+		CCM_EXPR_LANEWISE_UNARY(log10)
+		CCM_EXPR_LANEWISE_UNARY(log1p)
+
+#undef CCM_EXPR_LANEWISE_UNARY
+
+#define CCM_EXPR_LANEWISE_BINARY(name)                                                                                                                         \
+	struct name                                                                                                                                                \
+	{                                                                                                                                                          \
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>                                                                     \
+		constexpr T operator()(T a, T b) const noexcept                                                                                                        \
+		{                                                                                                                                                      \
+			return ccm::name(a, b);                                                                                                                            \
+		}                                                                                                                                                      \
+                                                                                                                                                               \
+		template <typename T, typename Abi>                                                                                                                    \
+		intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b) const noexcept                                        \
+		{                                                                                                                                                      \
+			return intrin::lanewise([](T x, T y) { return ccm::name(x, y); }, a, b);                                                                           \
+		}                                                                                                                                                      \
+	};
+
+		CCM_EXPR_LANEWISE_BINARY(pow)
+
+#undef CCM_EXPR_LANEWISE_BINARY
+
+		struct fma
+		{
+			template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+			constexpr T operator()(T a, T b, T c) const noexcept
+			{
+				return ccm::fma(a, b, c);
+			}
+
+			template <typename T, typename Abi>
+			intrin::simd<T, Abi> operator()(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b, intrin::simd<T, Abi> const & c) const noexcept
+			{
+				return intrin::lanewise([](T x, T y, T z) { return ccm::fma(x, y, z); }, a, b, c);
+			}
+		};
+	} // namespace fn
+
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_operand_v = is_expression_v<T> || std::is_arithmetic_v<T>;
+
+		template <typename... Ts>
+		inline constexpr bool has_expression_v = (is_expression_v<Ts> || ...);
+
+		template <typename... Ts>
+		inline constexpr bool are_operands_v = has_expression_v<Ts...> && (is_operand_v<Ts> && ...);
+
+		// The value type of the first expression operand decides the type scalars are broadcast as.
+		template <typename T, typename... Ts>
+		struct first_value_type_impl
+		{
+			using type = std::conditional_t<is_expression_v<T>, T, typename first_value_type_impl<Ts...>::type>;
+		};
+
+		template <typename T>
+		struct first_value_type_impl<T>
+		{
+			using type = T;
+		};
+
+		template <typename... Ts>
+		using value_type_of = typename first_value_type_impl<Ts...>::type::value_type;
+
+		template <typename V, typename T>
+		constexpr auto as_operand(T const & operand) noexcept
+		{
+			if constexpr (is_expression_v<T>) { return operand; }
+			else { return broadcast<V>(static_cast<V>(operand)); }
+		}
+
+		template <typename Fn, typename... Ts>
+		constexpr auto make_expr(Ts const &... operands) noexcept
+		{
+			using value_type = value_type_of<Ts...>;
+			return function_expr<Fn, decltype(as_operand<value_type>(operands))...>(as_operand<value_type>(operands)...);
+		}
+	} // namespace detail
+
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto operator+(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::plus>(lhs, rhs);
+	}
+
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto operator-(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::minus>(lhs, rhs);
+	}
+
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto operator*(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::multiplies>(lhs, rhs);
+	}
+
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto operator/(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::divides>(lhs, rhs);
+	}
+
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto operator-(E const & e) noexcept
+	{
+		return detail::make_expr<fn::negate>(e);
+	}
+
+	/// Lazy ccm::exp of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto exp(E const & e) noexcept
+	{
+		return detail::make_expr<fn::exp>(e);
+	}
+
+	/// Lazy ccm::exp2 of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto exp2(E const & e) noexcept
+	{
+		return detail::make_expr<fn::exp2>(e);
+	}
+
+	/// Lazy ccm::expm1 of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto expm1(E const & e) noexcept
+	{
+		return detail::make_expr<fn::expm1>(e);
+	}
+
+	/// Lazy ccm::log of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto log(E const & e) noexcept
+	{
+		return detail::make_expr<fn::log>(e);
+	}
+
+	/// Lazy ccm::log2 of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto log2(E const & e) noexcept
+	{
+		return detail::make_expr<fn::log2>(e);
+	}
+
+	/// Lazy ccm::log10 of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto log10(E const & e) noexcept
+	{
+		return detail::make_expr<fn::log10>(e);
+	}
+
+	/// Lazy ccm::log1p of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto log1p(E const & e) noexcept
+	{
+		return detail::make_expr<fn::log1p>(e);
+	}
+
+	/// Lazy ccm::sqrt of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto sqrt(E const & e) noexcept
+	{
+		return detail::make_expr<fn::sqrt>(e);
+	}
+
+	/// Lazy ccm::cbrt of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto cbrt(E const & e) noexcept
+	{
+		return detail::make_expr<fn::cbrt>(e);
+	}
+
+	/// Lazy ccm::fabs of every element.
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	constexpr auto fabs(E const & e) noexcept
+	{
+		return detail::make_expr<fn::fabs>(e);
+	}
+
+	/// Lazy ccm::pow of every pair of elements.
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto pow(L const & base, R const & exponent) noexcept
+	{
+		return detail::make_expr<fn::pow>(base, exponent);
+	}
+
+	/// Lazy ccm::hypot of every pair of elements.
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto hypot(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::hypot>(lhs, rhs);
+	}
+
+	/// Lazy ccm::fmin of every pair of elements.
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto fmin(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::fmin>(lhs, rhs);
+	}
+
+	/// Lazy ccm::fmax of every pair of elements.
+	template <typename L, typename R, std::enable_if_t<detail::are_operands_v<L, R>, bool> = true>
+	constexpr auto fmax(L const & lhs, R const & rhs) noexcept
+	{
+		return detail::make_expr<fn::fmax>(lhs, rhs);
+	}
+
+	/// Lazy ccm::fma of every triple of elements.
+	template <typename X, typename Y, typename Z, std::enable_if_t<detail::are_operands_v<X, Y, Z>, bool> = true>
+	constexpr auto fma(X const & x, Y const & y, Z const & z) noexcept
+	{
+		return detail::make_expr<fn::fma>(x, y, z);
+	}
+
+	namespace detail
+	{
+		template <typename E>
+		void evaluate_range(E const & e, typename E::value_type * out, std::size_t begin, std::size_t end) noexcept
+		{
+			using simd_type				= simd_t<typename E::value_type>;
+			constexpr std::size_t width = simd_type::size();
+
+			std::size_t i = begin;
+			for (; i + width <= end; i += width) { e.template eval_simd<simd_type>(i).copy_to(out + i, intrin::element_aligned_tag()); }
+			if (i < end)
+			{
+				typename E::value_type buffer[width];
+				e.template eval_simd<simd_type>(i, end - i).copy_to(buffer, intrin::element_aligned_tag());
+				for (std::size_t k = 0; i + k < end; ++k) { out[i + k] = buffer[k]; }
+			}
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Evaluates an expression into an output array in a single pass.
+	 *
+	 * The output may alias one of the arrays the expression reads from, since every element is only read before it is written.
+	 *
+	 * @tparam E Expression type.
+	 * @param e The expression to evaluate. At least one operand must be an array_view so the length is known.
+	 * @param out Destination with room for e.size() elements.
+	 */
+	template <typename E, std::enable_if_t<is_expression_v<E>, bool> = true>
+	void evaluate(E const & e, typename E::value_type * out) noexcept
+	{
+		assert(e.size() != detail::unbounded);
+		detail::evaluate_range(e, out, 0, e.size());
+	}
+
+	/**
+	 * @brief Evaluates an expression into a container in a single pass.
+	 * @param e The expression to evaluate.
+	 * @param out Destination container whose size must match the expression.
+	 */
+	template <typename E, typename Container, std::enable_if_t<is_expression_v<E> && !std::is_pointer_v<Container>, bool> = true>
+	void evaluate(E const & e, Container & out) noexcept
+	{
+		assert(static_cast<std::size_t>(out.size()) == e.size());
+		evaluate(e, out.data());
+	}
+
+	/**
+	 * @brief Evaluates an expression into an output array using an execution policy.
+	 *
+	 * With ccm::ext::execution::par the range is split into contiguous cache line aligned blocks that are evaluated
+	 * concurrently, each block still in a single fused pass.
+	 *
+	 * @param policy The execution policy.
+	 * @param e The expression to evaluate.
+	 * @param out Destination with room for e.size() elements.
+	 */
+	template <typename Policy, typename E, std::enable_if_t<execution::is_execution_policy_v<Policy> && is_expression_v<E>, bool> = true>
+	void evaluate(Policy && policy, E const & e, typename E::value_type * out)
+	{
+		assert(e.size() != detail::unbounded);
+		execution::for_each_block(std::forward<Policy>(policy), out, e.size(),
+								  [&e, out](std::size_t begin, std::size_t end) { detail::evaluate_range(e, out, begin, end); });
+	}
+
+	/**
+	 * @brief Evaluates an expression into a container using an execution policy.
+	 * @param policy The execution policy.
+	 * @param e The expression to evaluate.
+	 * @param out Destination container whose size must match the expression.
+	 */
+	template <typename Policy, typename E, typename Container,
+			  std::enable_if_t<execution::is_execution_policy_v<Policy> && is_expression_v<E> && !std::is_pointer_v<Container>, bool> = true>
+	void evaluate(Policy && policy, E const & e, Container & out)
+	{
+		assert(static_cast<std::size_t>(out.size()) == e.size());
+		evaluate(std::forward<Policy>(policy), e, out.data());
+	}
+} // namespace ccm::ext::expr
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/frexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/logb.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/*
+ * Array forms of frexp, ldexp, scalbn, ilogb and logb for float and double.
+ *
+ * Each block of native_simd<T>::size() elements is handled with integer operations on the exponent field, the last
+ * partial block is padded. Subnormal inputs only cost extra in blocks that contain one, and ldexp only takes its slow
+ * path in blocks where an exponent is outside the normal range.
+ *
+ * Results are the same as the scalar ccm functions, element by element, under any floating point contraction mode, but
+ * errno and the floating-point exceptions are left alone.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_fmanip_type_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		/// Calls block(offset, count) for every full native_simd block of [0, n), then once for the remainder if any.
+		template <typename T, typename Block>
+		void for_each_simd_block(std::size_t n, Block && block)
+		{
+			constexpr std::size_t width = intrin::native_simd<T>::size();
+
+			std::size_t i = 0;
+			for (; i + width <= n; i += width) { block(i, width); }
+			if (i < n) { block(i, n - i); }
+		}
+
+		template <typename T, typename U>
+		intrin::native_simd<T> load_block(U const * src, std::size_t count) noexcept
+		{
+			using simd_type				= intrin::native_simd<T>;
+			constexpr std::size_t width = simd_type::size();
+
+			if constexpr (std::is_same_v<T, U>)
+			{
+				if (count == width) { return simd_type(src, intrin::element_aligned_tag()); }
+			}
+			T buffer[width]{};
+			for (std::size_t i = 0; i < count; ++i) { buffer[i] = static_cast<T>(src[i]); }
+			return simd_type(buffer, intrin::element_aligned_tag());
+		}
+
+		template <typename T, typename U>
+		void store_block(intrin::native_simd<T> const & v, U * dst, std::size_t count) noexcept
+		{
+			constexpr std::size_t width = intrin::native_simd<T>::size();
+
+			if constexpr (std::is_same_v<T, U>)
+			{
+				if (count == width)
+				{
+					v.copy_to(dst, intrin::element_aligned_tag());
+					return;
+				}
+			}
+			T buffer[width];
+			v.copy_to(buffer, intrin::element_aligned_tag());
+			for (std::size_t i = 0; i < count; ++i) { dst[i] = static_cast<U>(buffer[i]); }
+		}
+
+		/// Stores lanes holding integral values, or the results of logb, as ints with ilogb's special values.
+		template <typename T>
+		void store_exponent_block(intrin::native_simd<T> e, int * dst, std::size_t count) noexcept
+		{
+			using simd_type				= intrin::native_simd<T>;
+			constexpr std::size_t width = simd_type::size();
+
+			const simd_type zero(T(0));
+			const simd_type inf(std::numeric_limits<T>::infinity());
+			T raw[width];
+			e.copy_to(raw, intrin::element_aligned_tag());
+
+			// NaN and -inf are mapped with selects and +inf is parked at zero, so the conversion loop below has no
+			// branches and can be vectorized.
+			e = intrin::choose(e == e, e, simd_type(static_cast<T>(FP_ILOGBNAN)));
+			e = intrin::choose(e == zero - inf, simd_type(static_cast<T>(FP_ILOGB0)), e);
+			e = intrin::choose(e == inf, zero, e);
+
+			T lanes[width];
+			e.copy_to(lanes, intrin::element_aligned_tag());
+			for (std::size_t i = 0; i < count; ++i) { dst[i] = raw[i] == std::numeric_limits<T>::infinity() ? INT_MAX : static_cast<int>(lanes[i]); }
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Splits every element into a mantissa in [0.5, 1) and a power of two.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param mantissa Receives n mantissas, see ccm::frexp. May be the same array as x.
+	 * @param exp Receives n powers of two.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void frexp(T const * x, std::size_t n, T * mantissa, int * exp) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   intrin::native_simd<T> e;
+										   detail::store_block(intrin::frexp(detail::load_block<T>(x + i, count), e), mantissa + i, count);
+										   detail::store_exponent_block(e, exp + i, count);
+									   });
+	}
+
+	/**
+	 * @brief Multiplies every element by 2 raised to the matching element of exp.
+	 * @param x Pointer to the first element.
+	 * @param exp Pointer to the first power of two.
+	 * @param n Number of elements in each array.
+	 * @param out Receives n results, see ccm::ldexp. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void ldexp(T const * x, int const * exp, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count) {
+										   detail::store_block(intrin::ldexp(detail::load_block<T>(x + i, count), detail::load_block<T>(exp + i, count)), out + i,
+															   count);
+									   });
+	}
+
+	/**
+	 * @brief Multiplies every element by 2 raised to the same power.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param exp The power of two.
+	 * @param out Receives n results, see ccm::ldexp. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void ldexp(T const * x, std::size_t n, int exp, T * out) noexcept
+	{
+		const intrin::native_simd<T> e(static_cast<T>(exp));
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(intrin::ldexp(detail::load_block<T>(x + i, count), e), out + i, count); });
+	}
+
+	/// Same as the array ldexp, FLT_RADIX being 2.
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void scalbn(T const * x, int const * exp, std::size_t n, T * out) noexcept
+	{
+		ext::ldexp(x, exp, n, out);
+	}
+
+	/// Same as the array ldexp, FLT_RADIX being 2.
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void scalbn(T const * x, std::size_t n, int exp, T * out) noexcept
+	{
+		ext::ldexp(x, n, exp, out);
+	}
+
+	/**
+	 * @brief Unbiased exponent of every element as a floating-point value.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::logb. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void logb(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(intrin::logb(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
+
+	/**
+	 * @brief Unbiased exponent of every element as an int.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::ilogb.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void ilogb(T const * x, std::size_t n, int * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_exponent_block(intrin::logb(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
+} // namespace ccm::ext
@@ -12,6 +12,11 @@
 
 #include "ccmath/math/nearest/floor.hpp"
 
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/func/floor.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
@@ -27,4 +32,27 @@ namespace ccm::ext
 	{
         return x - ccm::floor(x);
 	}
+
+	/**
+	 * @brief Returns the fractional part of every lane.
+	 * @param x Value to get the fractional part of.
+	 * @return The fractional parts, the same as the scalar fract of each lane.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fract(intrin::simd<T, Abi> const & x) noexcept
+	{
+		return x - intrin::floor(x);
+	}
+
+	/**
+	 * @brief Fractional part of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n fractional parts. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void fract(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count) { detail::store_block(fract(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
 } // namespace ccm::ext
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/generic/func/misc/lerp_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+/*
+ * Array forms of ccm::lerp for float and double, e.g. to interpolate a whole keyframe channel in one pass.
+ *
+ * Results are the same as ccm::lerp, element by element, under any floating point contraction mode. The two fused
+ * multiply-adds are single instructions where intrin::has_fma_v holds for native_simd, and are rounded one lane at a
+ * time elsewhere. ext::mix does not fuse and is the faster choice without FMA hardware.
+ */
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Linear interpolation between every pair of elements of a and b with the same parameter.
+	 * @param a Pointer to the values at t = 0.
+	 * @param b Pointer to the values at t = 1.
+	 * @param t Interpolation parameter.
+	 * @param n Number of elements.
+	 * @param out Receives n interpolated values. May be the same array as a or b.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void lerp(T const * a, T const * b, T t, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> weight(t);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(gen::lerp_gen(detail::load_block<T>(a + i, count), detail::load_block<T>(b + i, count), weight), out + i, count); });
+	}
+
+	/**
+	 * @brief Linear interpolation between every pair of elements of a and b with its own parameter.
+	 * @param a Pointer to the values at t = 0.
+	 * @param b Pointer to the values at t = 1.
+	 * @param t Pointer to the interpolation parameters.
+	 * @param n Number of elements.
+	 * @param out Receives n interpolated values. May be the same array as a, b or t.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void lerp(T const * a, T const * b, T const * t, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   detail::store_block(gen::lerp_gen(detail::load_block<T>(a + i, count), detail::load_block<T>(b + i, count),
+																			 detail::load_block<T>(t + i, count)),
+															   out + i, count);
+									   });
+	}
+} // namespace ccm::ext
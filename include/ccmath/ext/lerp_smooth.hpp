@@ -10,8 +10,14 @@
 
 #pragma once
 
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/math/expo/exp2.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace ccm::ext
 {
 	/**
@@ -31,4 +37,41 @@ namespace ccm::ext
 	    // ReSharper disable once CppRedundantParentheses
 	    return b + ((a - b) * ccm::exp2<T>(-t / h));
     }
+
+	/**
+	 * @brief Frame rate independent linear interpolation smoothing of every lane.
+	 * @param a Current value.
+	 * @param b Target value.
+	 * @param t Delta time, in seconds.
+	 * @param h Half-life, time until halfway, in seconds.
+	 * @return The smoothed lanes. 2^(-t / h) comes from intrin::exp2 and may differ from ccm::exp2 in the last bit.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> lerp_smooth(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b, intrin::simd<T, Abi> const & t,
+									 intrin::simd<T, Abi> const & h) noexcept
+	{
+		return b + ((a - b) * intrin::exp2(-t / h));
+	}
+
+	/**
+	 * @brief Smooths every element of a towards the element of b for the same time step.
+	 * @param a Pointer to the current values.
+	 * @param b Pointer to the target values.
+	 * @param t Delta time, in seconds.
+	 * @param h Half-life, time until halfway, in seconds.
+	 * @param n Number of elements.
+	 * @param out Receives n smoothed values, the same as the scalar lerp_smooth. May be the same array as a or b.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void lerp_smooth(T const * a, T const * b, T t, T h, std::size_t n, T * out) noexcept
+	{
+		// The decay is the same for every element, so it is computed once.
+		const intrin::native_simd<T> decay(ccm::exp2<T>(-t / h));
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   const intrin::native_simd<T> target = detail::load_block<T>(b + i, count);
+										   detail::store_block(target + ((detail::load_block<T>(a + i, count) - target) * decay), out + i, count);
+									   });
+	}
 } // namespace ccm::ext
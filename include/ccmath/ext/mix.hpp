@@ -10,6 +10,11 @@
 
 #pragma once
 
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
@@ -25,8 +30,8 @@ namespace ccm::ext
     template <typename T>
     constexpr T mix(T x, T y, T a) noexcept
 	{
-		// ReSharper disable once CppRedundantParentheses
-		return (x * (1 - a)) + (y * a);
+		// Each product is rounded on its own, so the compiler cannot fuse one of them into the sum.
+		return type::detail::rounded_product(x, T(1 - a)) + type::detail::rounded_product(y, a);
     }
 
 	/**
@@ -42,6 +47,56 @@ namespace ccm::ext
 	template <typename TStart, typename TEnd, typename TAplha>
 	constexpr std::common_type_t<TStart, TEnd, TAplha> mix(TStart x, TEnd y, TAplha a) noexcept
     {
-        return (x * (1 - a)) + (y * a);
+		using T = std::common_type_t<TStart, TEnd, TAplha>;
+		return mix(static_cast<T>(x), static_cast<T>(y), static_cast<T>(a));
     }
+
+	/**
+	 * @brief Performs a linear interpolation between x and y using a to weight between them, in every lane.
+	 * @param x Start of the range in which to interpolate.
+	 * @param y End of the range in which to interpolate.
+	 * @param a The value to use to interpolate between x and y.
+	 * @return The interpolated lanes, the same as the scalar mix of each lane.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> mix(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y, intrin::simd<T, Abi> const & a) noexcept
+	{
+		return type::detail::rounded_product(x, intrin::simd<T, Abi>(T(1)) - a) + type::detail::rounded_product(y, a);
+	}
+
+	/**
+	 * @brief Interpolates every pair of elements of x and y with the same weight.
+	 * @param x Pointer to the start values.
+	 * @param y Pointer to the end values.
+	 * @param a The value to use to interpolate between x and y.
+	 * @param n Number of elements.
+	 * @param out Receives n interpolated values. May be the same array as x or y.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void mix(T const * x, T const * y, T a, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> weight(a);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(mix(detail::load_block<T>(x + i, count), detail::load_block<T>(y + i, count), weight), out + i, count); });
+	}
+
+	/**
+	 * @brief Interpolates every pair of elements of x and y with its own weight.
+	 * @param x Pointer to the start values.
+	 * @param y Pointer to the end values.
+	 * @param a Pointer to the weights.
+	 * @param n Number of elements.
+	 * @param out Receives n interpolated values. May be the same array as x, y or a.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void mix(T const * x, T const * y, T const * a, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   detail::store_block(
+											   mix(detail::load_block<T>(x + i, count), detail::load_block<T>(y + i, count), detail::load_block<T>(a + i, count)),
+											   out + i, count);
+									   });
+	}
 } // namespace ccm::ext
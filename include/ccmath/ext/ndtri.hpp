@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/special.hpp"
+#include "ccmath/internal/math/generic/func/misc/ndtri_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/ndtri.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Quantile of the standard normal distribution, the inverse of its cumulative distribution function.
+	 * @tparam T Type of the input and output.
+	 * @param p Probability.
+	 * @return The x with Phi(x) = p. 0 gives -inf, 1 gives +inf, NaN is returned unmodified and arguments outside
+	 * [0, 1] give NaN.
+	 *
+	 * Wichura's AS 241, evaluated in double, within 7 ulp for double. Usable in constant expressions.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T ndtri(T p) noexcept
+	{
+		return gen::ndtri_gen<T>(p);
+	}
+
+	/**
+	 * @brief Standard normal quantile of every lane.
+	 * @param p Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> ndtri(intrin::simd<T, Abi> const & p)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::ndtri(p); }
+		else { return intrin::lanewise([](T p_lane) { return ext::ndtri(p_lane); }, p); }
+	}
+
+	/**
+	 * @brief Standard normal quantile of every element.
+	 * @param p Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, the same as the scalar ndtri. May be the same array as p.
+	 *
+	 * float elements are widened to double lanes, like the array erf.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void ndtri(T const * p, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(p, n, out, [](intrin::native_simd<double> const & v) { return intrin::ndtri(v); });
+	}
+} // namespace ccm::ext
@@ -10,9 +10,12 @@
 
 #pragma once
 
+#include "ccmath/ext/fmanip.hpp"
 #include "ccmath/ext/fract.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/math/basic/fabs.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
@@ -32,7 +35,39 @@ namespace ccm::ext
 			return T(0);
 		}
 
-		return ccm::abs((ccm::ext::fract((a - b) / (b * 2.0)) * b * 2.0) - b);
+		return ccm::abs((ccm::ext::fract((a - b) / (b * T(2))) * b * T(2)) - b);
 
 	}
+
+	/**
+	 * @brief Ping-pong every lane between 0 and a specified range.
+	 * @param a Value to ping-pong.
+	 * @param b Range to ping-pong within.
+	 * @return The ping-ponged lanes, the same as the scalar ping_pong of each lane.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> ping_pong(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b) noexcept
+	{
+		const intrin::simd<T, Abi> zero(T(0));
+		const intrin::simd<T, Abi> two(T(2));
+		const intrin::simd<T, Abi> r = (ccm::ext::fract((a - b) / (b * two)) * b * two) - b;
+
+		// |r| as a select, 0 - r gives +0 for both zeros like ccm::abs.
+		return intrin::choose(b == zero, zero, intrin::choose(zero < r, r, zero - r));
+	}
+
+	/**
+	 * @brief Ping-pong every element between 0 and the same range.
+	 * @param a Pointer to the values to ping-pong.
+	 * @param b Range to ping-pong within.
+	 * @param n Number of elements.
+	 * @param out Receives n ping-ponged values. May be the same array as a.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void ping_pong(T const * a, T b, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> range(b);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(ping_pong(detail::load_block<T>(a + i, count), range), out + i, count); });
+	}
 } // namespace ccm::ext
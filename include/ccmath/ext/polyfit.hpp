@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/helpers/cos_pi.hpp"
+#include "ccmath/internal/support/math_support.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Polynomial approximations fitted at compile time.
+ *
+ *     constexpr auto exp_neg = [](double x) { return ccm::exp(x); };
+ *     constexpr auto p = ccm::ext::minimax<7>(exp_neg, -10.0, 0.0, ccm::ext::fit_error::eRelative);
+ *     double y = p(x); // support::polyeval over the fitted coefficients
+ *
+ * minimax runs the Remez exchange algorithm and returns the polynomial of the given degree with the smallest maximum
+ * error over [lo, hi]. chebyshev_fit interpolates at the Chebyshev points instead, which is close to minimax, cheaper
+ * to compute and has no convergence to worry about. minimax_degree finds the smallest degree that meets an error
+ * target, so it can be passed straight back as the Degree of minimax.
+ *
+ * The polynomials are fitted in t = (x - center) * scale, which maps [lo, hi] to [-1, 1]; in x itself the monomial
+ * coefficients of a shifted range would cancel badly. The interpolation conditions are solved in double-double, so
+ * the coefficients are accurate to the precision of the function samples.
+ *
+ * A Remez iteration costs O(Degree^2) arithmetic in constant evaluation. With GCC's default -fconstexpr-ops-limit a
+ * degree 16 minimax fit takes about a sixth of the budget and minimax_degree<16> about two thirds; Clang counts
+ * -fconstexpr-steps differently and may need it raised for fits past degree 8 or so.
+ */
+
+namespace ccm::ext
+{
+	/// Error that a fit minimizes.
+	enum class fit_error : std::uint8_t
+	{
+		eAbsolute, ///< max |p(x) - f(x)|
+		eRelative, ///< max |p(x) - f(x)| / |f(x)|. f must not vanish on [lo, hi].
+	};
+
+	/**
+	 * @brief Polynomial of a given degree in t = (x - center) * scale.
+	 * @tparam T Type of the coefficients and of the argument.
+	 * @tparam Degree Degree of the polynomial.
+	 */
+	template <typename T, std::size_t Degree>
+	struct fitted_polynomial
+	{
+		using value_type = T;
+
+		/// Coefficients of t^0 .. t^Degree, in the order support::polyeval takes them.
+		std::array<T, Degree + 1> coefficients;
+		T center;
+		T scale;
+		/// Largest error seen when the fit was checked on a dense grid of [lo, hi], in the sense it was fitted for.
+		T max_error;
+
+		/// Evaluates the polynomial at x with Horner's scheme.
+		constexpr T operator()(T x) const noexcept { return evaluate(x, std::make_index_sequence<Degree + 1>{}); }
+
+	private:
+		template <std::size_t... Is>
+		constexpr T evaluate(T x, std::index_sequence<Is...> /* unused */) const noexcept
+		{
+			return support::polyeval((x - center) * scale, coefficients[Is]...);
+		}
+	};
+
+	namespace detail
+	{
+		using type::DoubleDouble;
+
+		constexpr DoubleDouble dd_add(DoubleDouble a, DoubleDouble b)
+		{
+			DoubleDouble s{};
+			support::two_sum(s.hi, s.lo, a.hi, b.hi);
+			s.lo += a.lo + b.lo;
+			return type::exact_add(s.hi, s.lo);
+		}
+
+		constexpr DoubleDouble dd_neg(DoubleDouble a) { return {-a.hi, -a.lo}; }
+
+		constexpr DoubleDouble dd_mul(DoubleDouble a, DoubleDouble b)
+		{
+			const DoubleDouble r = type::quick_mult(a, b);
+			return type::exact_add(r.hi, r.lo);
+		}
+
+		// Long division, one double of quotient per step.
+		constexpr DoubleDouble dd_div(DoubleDouble a, DoubleDouble b)
+		{
+			const double q1		 = a.hi / b.hi;
+			const DoubleDouble r = dd_add(a, dd_neg(dd_mul(b, {q1, 0.0})));
+			const double q2		 = r.hi / b.hi;
+			return type::exact_add(q1, q2);
+		}
+
+		constexpr double dd_abs(DoubleDouble a) { return a.hi < 0 ? -a.hi : a.hi; }
+
+		constexpr double fit_abs(double x) { return x < 0 ? -x : x; }
+
+		// Fixed capacity working state of a fit of degree at most MaxDegree.
+		template <std::size_t MaxDegree>
+		struct fit_state
+		{
+			// Points of the dense grid the error is checked on, per point of the reference.
+			static constexpr std::size_t grid_density = 8;
+			static constexpr std::size_t grid_capacity = grid_density * (MaxDegree + 2);
+
+			std::size_t degree = 0;
+			std::array<DoubleDouble, MaxDegree + 1> coefficients{};
+			double max_error = 0;
+		};
+
+		// func as a function of double, so the fit can work in double whatever T is.
+		template <typename T, typename F>
+		constexpr auto fit_function(F const & func)
+		{
+			return [&func](double x) { return static_cast<double>(func(static_cast<T>(x))); };
+		}
+
+		template <typename F>
+		constexpr double fit_sample(F const & func, double center, double half_width, double t)
+		{
+			return func(center + half_width * t);
+		}
+
+		// Evaluates the fit in double, the way the rounded coefficients will be used.
+		template <std::size_t MaxDegree>
+		constexpr double fit_eval(fit_state<MaxDegree> const & state, double t)
+		{
+			double acc = state.coefficients[state.degree].hi + state.coefficients[state.degree].lo;
+			for (std::size_t j = state.degree; j-- > 0;) { acc = support::multiply_add(acc, t, state.coefficients[j].hi + state.coefficients[j].lo); }
+			return acc;
+		}
+
+		constexpr double fit_weight(fit_error kind, double value) { return kind == fit_error::eRelative ? fit_abs(value) : 1.0; }
+
+		// Fills grid with the points -cos(pi k / (size - 1)) on [-1, 1], which cluster towards the ends like the error of a
+		// good fit. The cosines come from rotating by a fixed angle; the drift of a few ulp does not matter for a grid,
+		// and cos_pi for every point would dominate the cost of the whole fit in constant evaluation.
+		template <std::size_t Capacity>
+		constexpr void fit_grid(std::array<double, Capacity> & grid, std::size_t size)
+		{
+			const double step = 1.0 / static_cast<double>(size - 1);
+			const double cd	  = support::helpers::cos_pi(step);
+			const double sd	  = support::helpers::cos_pi(0.5 - step);
+
+			double c = 1.0;
+			double s = 0.0;
+			for (std::size_t k = 0; 2 * k < size; ++k)
+			{
+				grid[k]			   = -c;
+				grid[size - 1 - k] = c;
+
+				const double next_c = c * cd - s * sd;
+				s					= s * cd + c * sd;
+				c					= next_c;
+			}
+			if (size % 2 == 1) { grid[size / 2] = 0.0; }
+		}
+
+		template <std::size_t MaxDegree>
+		constexpr std::size_t fit_grid_size(std::size_t degree)
+		{
+			return fit_state<MaxDegree>::grid_density * (degree + 2);
+		}
+
+		// Replaces d[0..n) with the divided differences d[r_0], d[r_0, r_1], ..., d[r_0, ..., r_{n-1}], which are the
+		// coefficients of the Newton form of the interpolant through (r_i, d_i).
+		template <std::size_t Capacity>
+		constexpr void fit_divided_differences(std::array<DoubleDouble, Capacity> & d, std::array<double, Capacity> const & r, std::size_t n)
+		{
+			for (std::size_t k = 1; k < n; ++k)
+			{
+				for (std::size_t i = n - 1; i >= k; --i)
+				{
+					DoubleDouble gap{};
+					support::two_sum(gap.hi, gap.lo, r[i], -r[i - k]);
+					d[i] = dd_div(dd_add(d[i], dd_neg(d[i - 1])), gap);
+				}
+			}
+		}
+
+		// Largest weighted error of the fit over the dense grid.
+		template <std::size_t MaxDegree, typename F>
+		constexpr double fit_max_error(fit_state<MaxDegree> const & state, F const & func, double center, double half_width, fit_error kind)
+		{
+			// Twice as dense as the grid of the fit, so the check does not only look where the fit looked.
+			const std::size_t size = 2 * fit_grid_size<MaxDegree>(state.degree);
+			std::array<double, 2 * fit_state<MaxDegree>::grid_capacity> grid{};
+			fit_grid(grid, size);
+
+			double worst = 0;
+			for (std::size_t k = 0; k < size; ++k)
+			{
+				const double t = grid[k];
+				const double g = fit_sample(func, center, half_width, t);
+				const double e = fit_abs(fit_eval(state, t) - g) / fit_weight(kind, g);
+				if (e > worst) { worst = e; }
+			}
+			return worst;
+		}
+
+		// Interpolation at the degree + 1 Chebyshev points of the first kind, converted to monomials in t.
+		template <std::size_t MaxDegree, typename F>
+		constexpr fit_state<MaxDegree> chebyshev_fit(F const & func, double center, double half_width, std::size_t degree, fit_error kind)
+		{
+			const std::size_t n = degree + 1;
+
+			// Chebyshev series coefficients by the discrete cosine transform of the samples, with T_j(x_k) = cos(j theta_k)
+			// from the three-term recurrence.
+			std::array<DoubleDouble, MaxDegree + 1> series{};
+			for (std::size_t k = 0; k < n; ++k)
+			{
+				const double x		= support::helpers::cos_pi(static_cast<double>(2 * k + 1) / static_cast<double>(2 * n));
+				const double sample = fit_sample(func, center, half_width, x);
+
+				double t_previous = 1.0;
+				double t_current  = x;
+				for (std::size_t j = 0; j < n; ++j)
+				{
+					const double t_j = j == 0 ? 1.0 : t_current;
+					series[j]		 = dd_add(series[j], type::exact_mult(sample, t_j));
+					if (j > 0)
+					{
+						const double t_next = 2.0 * x * t_current - t_previous;
+						t_previous			= t_current;
+						t_current			= t_next;
+					}
+				}
+			}
+			for (std::size_t j = 0; j < n; ++j) { series[j] = dd_div(dd_mul(series[j], {j == 0 ? 1.0 : 2.0, 0.0}), {static_cast<double>(n), 0.0}); }
+
+			// Sum the series in the monomial basis with T_{j+1} = 2 t T_j - T_{j-1}.
+			fit_state<MaxDegree> state{};
+			state.degree = degree;
+			std::array<DoubleDouble, MaxDegree + 1> previous{};
+			std::array<DoubleDouble, MaxDegree + 1> current{};
+			current[0] = {1.0, 0.0};
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				for (std::size_t i = 0; i <= j; ++i) { state.coefficients[i] = dd_add(state.coefficients[i], dd_mul(series[j], current[i])); }
+
+				std::array<DoubleDouble, MaxDegree + 1> next{};
+				if (j + 1 < n)
+				{
+					for (std::size_t i = 0; i <= j; ++i) { next[i + 1] = dd_mul(current[i], {j == 0 ? 1.0 : 2.0, 0.0}); }
+					if (j > 0)
+					{
+						for (std::size_t i = 0; i < j; ++i) { next[i] = dd_add(next[i], dd_neg(previous[i])); }
+					}
+				}
+				previous = current;
+				current	 = next;
+			}
+
+			state.max_error = fit_max_error(state, func, center, half_width, kind);
+			return state;
+		}
+
+		// Remez exchange: level the error on a reference of degree + 2 points, then move the reference to the extrema of
+		// the error, until the extrema are level to within a part in a thousand.
+		template <std::size_t MaxDegree, typename F>
+		constexpr fit_state<MaxDegree> remez(F const & func, double center, double half_width, std::size_t degree, fit_error kind)
+		{
+			constexpr std::size_t capacity		= MaxDegree + 2;
+			constexpr std::size_t grid_capacity = fit_state<MaxDegree>::grid_capacity;
+			constexpr int max_iterations		= 16;
+
+			const std::size_t m			= degree + 2;
+			const std::size_t grid_size = fit_grid_size<MaxDegree>(degree);
+
+			// The extrema of the Chebyshev polynomial of degree m - 1 are a good first reference.
+			std::array<double, capacity> reference{};
+			for (std::size_t i = 0; i < m; ++i) { reference[i] = -support::helpers::cos_pi(static_cast<double>(i) / static_cast<double>(m - 1)); }
+
+			// The function only has to be sampled on the grid once.
+			std::array<double, grid_capacity> grid{};
+			std::array<double, grid_capacity> values{};
+			fit_grid(grid, grid_size);
+			for (std::size_t k = 0; k < grid_size; ++k) { values[k] = fit_sample(func, center, half_width, grid[k]); }
+
+			fit_state<MaxDegree> state{};
+			state.degree = degree;
+
+			// Rounding can make the last iterations worse rather than better, so keep the best fit seen.
+			fit_state<MaxDegree> best = state;
+			double best_largest		  = std::numeric_limits<double>::infinity();
+			// Every entry the exchange uses is overwritten on each iteration.
+			std::array<DoubleDouble, capacity> f_diff{};
+			std::array<DoubleDouble, capacity> s_diff{};
+			std::array<double, grid_capacity> error{};
+			std::array<std::size_t, grid_capacity> extrema{};
+			for (int iteration = 0; iteration < max_iterations; ++iteration)
+			{
+				// p(r_i) + (-1)^i E w(r_i) = f(r_i). The order m - 1 divided difference of p vanishes, which gives E
+				// from those of f and of the alternating weight; by linearity, the lower ones are the Newton coefficients
+				// of p. This is O(m^2) where a general solve of the system would be O(m^3).
+				for (std::size_t i = 0; i < m; ++i)
+				{
+					const double g = fit_sample(func, center, half_width, reference[i]);
+					const double w = fit_weight(kind, g);
+					f_diff[i]	   = {g, 0.0};
+					s_diff[i]	   = {i % 2 == 0 ? w : -w, 0.0};
+				}
+				fit_divided_differences(f_diff, reference, m);
+				fit_divided_differences(s_diff, reference, m);
+				const DoubleDouble level = dd_div(f_diff[m - 1], s_diff[m - 1]);
+
+				// Expand the Newton form with Horner's scheme, multiplying by (t - r_k) one node at a time.
+				state.coefficients = {};
+				for (std::size_t k = degree + 1; k-- > 0;)
+				{
+					for (std::size_t j = degree - k; j-- > 0;)
+					{
+						const DoubleDouble shifted = dd_mul(state.coefficients[j + 1], {-reference[k], 0.0});
+						state.coefficients[j + 1]	= dd_add(state.coefficients[j], shifted);
+					}
+					state.coefficients[0] = dd_mul(state.coefficients[0], {-reference[k], 0.0});
+					state.coefficients[0] = dd_add(state.coefficients[0], dd_add(f_diff[k], dd_neg(dd_mul(level, s_diff[k]))));
+				}
+
+				// Error on the grid, and the largest error of each run of one sign.
+				std::size_t count = 0;
+				for (std::size_t k = 0; k < grid_size; ++k)
+				{
+					error[k] = (fit_eval(state, grid[k]) - values[k]) / fit_weight(kind, values[k]);
+					if (error[k] == 0) { continue; }
+					if (count == 0 || (error[k] > 0) != (error[extrema[count - 1]] > 0)) { extrema[count++] = k; }
+					else if (fit_abs(error[k]) > fit_abs(error[extrema[count - 1]])) { extrema[count - 1] = k; }
+				}
+
+				// Fewer alternations than points means the function is matched to rounding already.
+				if (count < m)
+				{
+					best = state;
+					break;
+				}
+
+				// Too many: drop the smaller end until the alternation has exactly m points. The largest stays.
+				std::size_t first = 0;
+				while (count - first > m)
+				{
+					if (fit_abs(error[extrema[first]]) < fit_abs(error[extrema[count - 1]])) { ++first; }
+					else { --count; }
+				}
+
+				double smallest = fit_abs(error[extrema[first]]);
+				double largest	= 0;
+				for (std::size_t i = 0; i < m; ++i)
+				{
+					const std::size_t k = extrema[first + i];
+					double t			= grid[k];
+					double e			= fit_abs(error[k]);
+
+					// Move the point to the vertex of the parabola through the neighbouring grid points, if the error
+					// there is larger still.
+					if (k > 0 && k + 1 < grid_size)
+					{
+						const double x0	 = grid[k - 1] - t;
+						const double x2	 = grid[k + 1] - t;
+						const double e0	 = error[k - 1] - error[k];
+						const double e2	 = error[k + 1] - error[k];
+						const double den = x0 * e2 - x2 * e0;
+						const double vertex = den != 0 ? 0.5 * (x0 * x0 * e2 - x2 * x2 * e0) / den : 0;
+						if (vertex > x0 && vertex < x2 && vertex != 0 && (i == 0 || t + vertex > reference[i - 1]))
+						{
+							const double g		 = fit_sample(func, center, half_width, t + vertex);
+							const double refined = fit_abs(fit_eval(state, t + vertex) - g) / fit_weight(kind, g);
+							if (refined > e)
+							{
+								t += vertex;
+								e = refined;
+							}
+						}
+					}
+
+					reference[i] = t;
+					smallest	 = e < smallest ? e : smallest;
+					largest		 = e > largest ? e : largest;
+				}
+
+				// Stop once the extrema are level, or when rounding keeps them from getting any more level.
+				if (largest >= best_largest) { break; }
+				best		 = state;
+				best_largest = largest;
+				if (largest - smallest <= 1e-3 * largest) { break; }
+			}
+
+			best.max_error = fit_max_error(best, func, center, half_width, kind);
+			return best;
+		}
+
+		template <typename T, std::size_t Degree, std::size_t MaxDegree>
+		constexpr fitted_polynomial<T, Degree> fit_result(fit_state<MaxDegree> const & state, double center, double half_width)
+		{
+			fitted_polynomial<T, Degree> result{};
+			for (std::size_t j = 0; j <= Degree; ++j) { result.coefficients[j] = static_cast<T>(state.coefficients[j].hi + state.coefficients[j].lo); }
+			result.center	 = static_cast<T>(center);
+			result.scale	 = static_cast<T>(1.0 / half_width);
+			result.max_error = static_cast<T>(state.max_error);
+			return result;
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Fits the minimax polynomial of the given degree to func over [lo, hi].
+	 * @tparam Degree Degree of the polynomial.
+	 * @param func Callable taking and returning T. Must be constexpr callable when the fit is a constant.
+	 * @param lo Lower end of the range.
+	 * @param hi Upper end of the range, greater than lo.
+	 * @param kind Whether to minimize the absolute or the relative error.
+	 * @return The polynomial.
+	 */
+	template <std::size_t Degree, typename T, typename F, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr fitted_polynomial<T, Degree> minimax(F const & func, T lo, T hi, fit_error kind = fit_error::eAbsolute)
+	{
+		const auto sample		= detail::fit_function<T>(func);
+		const double center		= 0.5 * (static_cast<double>(lo) + static_cast<double>(hi));
+		const double half_width = 0.5 * (static_cast<double>(hi) - static_cast<double>(lo));
+		return detail::fit_result<T, Degree>(detail::remez<Degree>(sample, center, half_width, Degree, kind), center, half_width);
+	}
+
+	/**
+	 * @brief Fits the polynomial of the given degree that interpolates func at the Chebyshev points of [lo, hi].
+	 * @tparam Degree Degree of the polynomial.
+	 * @param func Callable taking and returning T. Must be constexpr callable when the fit is a constant.
+	 * @param lo Lower end of the range.
+	 * @param hi Upper end of the range, greater than lo.
+	 * @param kind The error reported in max_error. The fit itself does not depend on it.
+	 * @return The polynomial.
+	 */
+	template <std::size_t Degree, typename T, typename F, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr fitted_polynomial<T, Degree> chebyshev_fit(F const & func, T lo, T hi, fit_error kind = fit_error::eAbsolute)
+	{
+		const auto sample		= detail::fit_function<T>(func);
+		const double center		= 0.5 * (static_cast<double>(lo) + static_cast<double>(hi));
+		const double half_width = 0.5 * (static_cast<double>(hi) - static_cast<double>(lo));
+		return detail::fit_result<T, Degree>(detail::chebyshev_fit<Degree>(sample, center, half_width, Degree, kind), center, half_width);
+	}
+
+	/**
+	 * @brief Smallest degree whose minimax polynomial approximates func over [lo, hi] within tolerance.
+	 * @tparam MaxDegree Largest degree to try.
+	 * @param func Callable taking and returning T. Must be constexpr callable when the result is a constant.
+	 * @param lo Lower end of the range.
+	 * @param hi Upper end of the range, greater than lo.
+	 * @param tolerance The error to reach.
+	 * @param kind Whether the tolerance is on the absolute or the relative error.
+	 * @return The degree, or MaxDegree + 1 if no degree up to MaxDegree is accurate enough.
+	 */
+	template <std::size_t MaxDegree, typename T, typename F, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr std::size_t minimax_degree(F const & func, T lo, T hi, T tolerance, fit_error kind = fit_error::eAbsolute)
+	{
+		const auto sample		= detail::fit_function<T>(func);
+		const double center		= 0.5 * (static_cast<double>(lo) + static_cast<double>(hi));
+		const double half_width = 0.5 * (static_cast<double>(hi) - static_cast<double>(lo));
+		const auto meets		= [&](auto const & state) { return state.max_error <= static_cast<double>(tolerance); };
+
+		// Chebyshev interpolation is within a small factor of minimax and far cheaper, so a bisection over it bounds
+		// the degree from above; the Remez fits then only have to walk down from there. It ignores the weight of a
+		// relative fit, so for a function that varies a lot the walk may have to start at MaxDegree.
+		std::size_t low	   = 0;
+		std::size_t degree = MaxDegree + 1;
+		while (low < degree)
+		{
+			const std::size_t middle = low + (degree - low) / 2;
+			if (meets(detail::chebyshev_fit<MaxDegree>(sample, center, half_width, middle, kind))) { degree = middle; }
+			else { low = middle + 1; }
+		}
+		if (degree > MaxDegree && !meets(detail::remez<MaxDegree>(sample, center, half_width, MaxDegree, kind))) { return MaxDegree + 1; }
+		if (degree > MaxDegree) { degree = MaxDegree; }
+
+		while (degree > 0 && meets(detail::remez<MaxDegree>(sample, center, half_width, degree - 1, kind))) { --degree; }
+		return degree;
+	}
+} // namespace ccm::ext
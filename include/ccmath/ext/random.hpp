@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/ext/ndtri.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sincospi.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Random variates for float and double arrays.
+ *
+ * philox4x32 is the counter-based generator of Salmon et al. (Random123): block n of a stream is ten rounds of a keyed
+ * bijection applied to n, so blocks are independent of one another. Bulk generation runs eight counters side by side
+ * in plain 32-bit arrays, which the compiler turns into vector multiplies, and any position of a stream can be reached
+ * in constant time.
+ *
+ * The transforms take uniforms in (0, 1], which is what the generator-fed functions draw, so log never sees 0:
+ *
+ *   box_muller                - two normal variates per pair of uniforms, sqrt(-2 log u1) times cos and sin of 2 pi u2
+ *   exponential_from_uniform  - -log(u) / lambda
+ *   normal_inv_cdf            - the normal quantile of u, the array ndtri
+ *
+ * normal, lognormal and exponential draw their uniforms a chunk of a few hundred values at a time into a buffer that
+ * stays in L1, transform it on native_simd lanes and store the variates, so the raw bits never go back to memory.
+ * normal draws a whole number of SIMD blocks of uniform pairs per chunk, so for an n that is not a multiple of twice
+ * the native width it consumes a few uniforms more than it returns.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_random_type_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		struct philox_constants
+		{
+			static constexpr std::uint32_t M0 = 0xD2511F53U;
+			static constexpr std::uint32_t M1 = 0xCD9E8D57U;
+			// Key increments, the golden ratio and sqrt(3) - 1 in 32-bit fixed point.
+			static constexpr std::uint32_t W0 = 0x9E3779B9U;
+			static constexpr std::uint32_t W1 = 0xBB67AE85U;
+			static constexpr int rounds		  = 10;
+			// Counters generated side by side in bulk.
+			static constexpr std::size_t lanes = 8;
+		};
+
+		constexpr std::uint32_t low_word(std::uint64_t v) noexcept
+		{
+			return static_cast<std::uint32_t>(v);
+		}
+
+		constexpr std::uint32_t high_word(std::uint64_t v) noexcept
+		{
+			return static_cast<std::uint32_t>(v >> 32U);
+		}
+
+		constexpr void philox_round(std::uint32_t & x0, std::uint32_t & x1, std::uint32_t & x2, std::uint32_t & x3, std::uint32_t k0,
+									std::uint32_t k1) noexcept
+		{
+			const std::uint64_t p0 = std::uint64_t{philox_constants::M0} * x0;
+			const std::uint64_t p1 = std::uint64_t{philox_constants::M1} * x2;
+			const std::uint32_t y0 = high_word(p1) ^ x1 ^ k0;
+			const std::uint32_t y2 = high_word(p0) ^ x3 ^ k1;
+			x0					   = y0;
+			x1					   = low_word(p1);
+			x2					   = y2;
+			x3					   = low_word(p0);
+		}
+
+		/// Converts random words to uniforms in (0, 1]: 24 bits per float, 53 bits from two words per double.
+		template <typename T>
+		void uniform_from_words(std::uint32_t const * words, std::size_t n, T * out) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				for (std::size_t i = 0; i < n; ++i) { out[i] = static_cast<float>((words[i] >> 8U) + 1U) * 0x1.0p-24F; }
+			}
+			else
+			{
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					const std::uint64_t bits = (std::uint64_t{words[2 * i]} << 21U) ^ (words[2 * i + 1] >> 11U);
+					out[i]					 = static_cast<double>(bits + 1U) * 0x1.0p-53;
+				}
+			}
+		}
+
+		template <typename T>
+		inline constexpr std::size_t words_per_uniform = std::is_same_v<T, float> ? 1 : 2;
+
+		// Values per chunk of the generator-fed functions, a multiple of twice every native_simd width.
+		inline constexpr std::size_t variate_chunk = 256;
+	} // namespace detail
+
+	/**
+	 * @brief Philox4x32-10 counter-based random number generator.
+	 *
+	 * Satisfies UniformRandomBitGenerator, so it also feeds the std distributions. The seed is the key and the stream
+	 * fills the upper half of the counter, so generators with different streams never overlap.
+	 */
+	class philox4x32
+	{
+	public:
+		using result_type = std::uint32_t;
+
+		static constexpr result_type min() noexcept { return 0; }
+		static constexpr result_type max() noexcept { return 0xFFFFFFFFU; }
+
+		constexpr explicit philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept
+			: m_key{detail::low_word(seed), detail::high_word(seed)}, m_stream{detail::low_word(stream), detail::high_word(stream)}
+		{
+		}
+
+		/// The four words of block counter of this stream, whatever the current position.
+		[[nodiscard]] constexpr std::array<result_type, 4> block(std::uint64_t counter) const noexcept
+		{
+			std::uint32_t x0 = detail::low_word(counter);
+			std::uint32_t x1 = detail::high_word(counter);
+			std::uint32_t x2 = m_stream[0];
+			std::uint32_t x3 = m_stream[1];
+			std::uint32_t k0 = m_key[0];
+			std::uint32_t k1 = m_key[1];
+			for (int round = 0; round < detail::philox_constants::rounds; ++round)
+			{
+				detail::philox_round(x0, x1, x2, x3, k0, k1);
+				k0 += detail::philox_constants::W0;
+				k1 += detail::philox_constants::W1;
+			}
+			return {x0, x1, x2, x3};
+		}
+
+		constexpr result_type operator()() noexcept
+		{
+			if (m_index == 4)
+			{
+				m_buffer = block(m_counter++);
+				m_index	 = 0;
+			}
+			return m_buffer[m_index++];
+		}
+
+		/// Same as n calls to operator(), with whole blocks generated several at a time.
+		void generate(result_type * out, std::size_t n) noexcept
+		{
+			for (; n > 0 && m_index < 4; --n) { *out++ = m_buffer[m_index++]; }
+
+			constexpr std::size_t lanes = detail::philox_constants::lanes;
+			for (; n >= 4 * lanes; n -= 4 * lanes, out += 4 * lanes, m_counter += lanes)
+			{
+				std::uint32_t x0[lanes];
+				std::uint32_t x1[lanes];
+				std::uint32_t x2[lanes];
+				std::uint32_t x3[lanes];
+				for (std::size_t l = 0; l < lanes; ++l)
+				{
+					x0[l] = detail::low_word(m_counter + l);
+					x1[l] = detail::high_word(m_counter + l);
+					x2[l] = m_stream[0];
+					x3[l] = m_stream[1];
+				}
+				std::uint32_t k0 = m_key[0];
+				std::uint32_t k1 = m_key[1];
+				for (int round = 0; round < detail::philox_constants::rounds; ++round)
+				{
+					for (std::size_t l = 0; l < lanes; ++l) { detail::philox_round(x0[l], x1[l], x2[l], x3[l], k0, k1); }
+					k0 += detail::philox_constants::W0;
+					k1 += detail::philox_constants::W1;
+				}
+				for (std::size_t l = 0; l < lanes; ++l)
+				{
+					out[4 * l]	   = x0[l];
+					out[4 * l + 1] = x1[l];
+					out[4 * l + 2] = x2[l];
+					out[4 * l + 3] = x3[l];
+				}
+			}
+
+			for (; n > 0; --n) { *out++ = (*this)(); }
+		}
+
+		/// Moves to the start of block counter, in constant time.
+		constexpr void seek(std::uint64_t counter) noexcept
+		{
+			m_counter = counter;
+			m_index	  = 4;
+		}
+
+		/// Same as z calls to operator(), in constant time.
+		constexpr void discard(unsigned long long z) noexcept
+		{
+			for (; z > 0 && m_index < 4; --z) { ++m_index; }
+			m_counter += z / 4;
+			if (z % 4 != 0)
+			{
+				m_buffer = block(m_counter++);
+				m_index	 = static_cast<unsigned>(z % 4);
+			}
+		}
+
+	private:
+		std::uint32_t m_key[2];
+		std::uint32_t m_stream[2];
+		std::uint64_t m_counter{0};
+		std::array<result_type, 4> m_buffer{};
+		unsigned m_index{4};
+	};
+
+	/**
+	 * @brief Normal variates from pairs of uniforms, by the Box-Muller transform.
+	 * @param u1 Pointer to the first radius uniform, in (0, 1].
+	 * @param u2 Pointer to the first angle uniform.
+	 * @param n Number of elements in each array.
+	 * @param z0 Receives sqrt(-2 log u1) * cos(2 pi u2). May be the same array as u1 or u2.
+	 * @param z1 Receives sqrt(-2 log u1) * sin(2 pi u2). May be the same array as u1 or u2, but not z0.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void box_muller(T const * u1, T const * u2, std::size_t n, T * z0, T * z1) noexcept
+	{
+		detail::for_each_simd_block<T>(n,
+									   [&](std::size_t i, std::size_t count)
+									   {
+										   using simd_t	  = intrin::native_simd<T>;
+										   const simd_t r = intrin::sqrt(intrin::log(detail::load_block<T>(u1 + i, count)) * T(-2));
+										   const simd_t a = detail::load_block<T>(u2 + i, count);
+										   simd_t s;
+										   simd_t c;
+										   intrin::sincospi(a + a, s, c);
+										   detail::store_block(r * c, z0 + i, count);
+										   detail::store_block(r * s, z1 + i, count);
+									   });
+	}
+
+	/**
+	 * @brief Exponential variates from uniforms, by inversion.
+	 * @param u Pointer to the first uniform, in (0, 1].
+	 * @param n Number of elements.
+	 * @param out Receives -log(u) / lambda. May be the same array as u.
+	 * @param lambda Rate of the distribution.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void exponential_from_uniform(T const * u, std::size_t n, T * out, T lambda = T(1)) noexcept
+	{
+		const intrin::native_simd<T> rate(lambda);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(-intrin::log(detail::load_block<T>(u + i, count)) / rate, out + i, count); });
+	}
+
+	/**
+	 * @brief Standard normal quantile of every uniform, by inversion.
+	 * @param u Pointer to the first uniform.
+	 * @param n Number of elements.
+	 * @param out Receives the x with Phi(x) = u, -inf for 0 and +inf for 1. May be the same array as u.
+	 *
+	 * The same as the array ndtri.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void normal_inv_cdf(T const * u, std::size_t n, T * out) noexcept
+	{
+		ext::ndtri(u, n, out);
+	}
+
+	/**
+	 * @brief Uniform variates in (0, 1].
+	 * @param gen The generator, advanced by the words used.
+	 * @param n Number of elements.
+	 * @param out Receives the variates.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void uniform(philox4x32 & gen, std::size_t n, T * out) noexcept
+	{
+		constexpr std::size_t chunk = detail::variate_chunk;
+		std::uint32_t words[chunk * detail::words_per_uniform<T>];
+		for (std::size_t i = 0; i < n; i += chunk)
+		{
+			const std::size_t count = n - i < chunk ? n - i : chunk;
+			gen.generate(words, count * detail::words_per_uniform<T>);
+			detail::uniform_from_words(words, count, out + i);
+		}
+	}
+
+	/**
+	 * @brief Normal variates by the Box-Muller transform.
+	 * @param gen The generator. Every chunk of values draws a whole number of SIMD blocks of uniforms.
+	 * @param n Number of elements.
+	 * @param out Receives the variates.
+	 * @param mean Mean of the distribution.
+	 * @param stddev Standard deviation of the distribution.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void normal(philox4x32 & gen, std::size_t n, T * out, T mean = T(0), T stddev = T(1)) noexcept
+	{
+		constexpr std::size_t chunk = detail::variate_chunk;
+		constexpr std::size_t pair	= 2 * intrin::native_simd<T>::size();
+
+		T u[chunk];
+		T z[chunk];
+		for (std::size_t i = 0; i < n; i += chunk)
+		{
+			const std::size_t count = n - i < chunk ? n - i : chunk;
+			const std::size_t m		= (count + pair - 1) / pair * pair;
+			uniform(gen, m, u);
+
+			T * dst = m == count ? out + i : z;
+			box_muller(u, u + m / 2, m / 2, dst, dst + m / 2);
+			detail::for_each_simd_block<T>(count, [&](std::size_t k, std::size_t c)
+										   { detail::store_block(detail::load_block<T>(dst + k, c) * stddev + mean, out + i + k, c); });
+		}
+	}
+
+	/**
+	 * @brief Log-normal variates, exp of normal variates.
+	 * @param gen The generator, see normal.
+	 * @param n Number of elements.
+	 * @param out Receives the variates.
+	 * @param m Mean of the underlying normal distribution.
+	 * @param s Standard deviation of the underlying normal distribution.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void lognormal(philox4x32 & gen, std::size_t n, T * out, T m = T(0), T s = T(1)) noexcept
+	{
+		normal(gen, n, out, m, s);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(intrin::exp(detail::load_block<T>(out + i, count)), out + i, count); });
+	}
+
+	/**
+	 * @brief Exponential variates by inversion.
+	 * @param gen The generator, advanced by the words used.
+	 * @param n Number of elements.
+	 * @param out Receives the variates.
+	 * @param lambda Rate of the distribution.
+	 */
+	template <typename T, std::enable_if_t<detail::is_random_type_v<T>, bool> = true>
+	void exponential(philox4x32 & gen, std::size_t n, T * out, T lambda = T(1)) noexcept
+	{
+		constexpr std::size_t chunk = detail::variate_chunk;
+		for (std::size_t i = 0; i < n; i += chunk)
+		{
+			const std::size_t count = n - i < chunk ? n - i : chunk;
+			uniform(gen, count, out + i);
+			exponential_from_uniform(out + i, count, out + i, lambda);
+		}
+	}
+} // namespace ccm::ext
@@ -10,19 +10,63 @@
 
 #pragma once
 
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/generic/func/power/rcp_gen.hpp"
+#include "ccmath/internal/math/runtime/func/power/rcp_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/func/rcp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
 {
 	/**
-	 * @brief Calculates a fast, approximate, reciprocal.
+	 * @brief Calculates the reciprocal.
 	 * @tparam T Type of the input and output.
 	 * @param x Value to get the reciprocal of.
-	 * @return The reciprocal of the input.
+	 * @return 1 / x, correctly rounded. rcp_approx trades accuracy for speed.
 	 */
 	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
 	constexpr T rcp(T x) noexcept
 	{
 		return static_cast<T>(1) / x;
 	}
+
+	/**
+	 * @brief Calculates a fast, approximate, reciprocal.
+	 * @tparam Steps Number of Newton-Raphson steps after the estimate: 0, 1 or 2.
+	 * @tparam T Type of the input and output, float or double.
+	 * @param x Value to get the reciprocal of.
+	 * @return The reciprocal of the input, with a relative error below 1.5 * 2^-12 for 0 steps, 2^-21 for 1 step and
+	 * 2^-22 (float) or 2^-43 (double) for 2 steps. ±0 gives ±inf and ±inf gives ±0.
+	 *
+	 * At run time the estimate comes from rcpss, rcp14 or vrecpe and each step is one Newton step. Targets without an
+	 * estimate, and double on x86 before AVX-512, divide exactly instead. Constant expressions start from a bit trick seed instead, refined to the bound of 0 steps, so compile time results
+	 * can differ from run time ones in the last bits.
+	 */
+	template <int Steps = 1, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rcp_approx(T x) noexcept
+	{
+		if (support::is_constant_evaluated()) { return gen::rcp_gen<Steps>(x); }
+		return rt::rcp_rt<Steps>(x);
+	}
+
+	/**
+	 * @brief Approximate reciprocal of every element.
+	 * @tparam Steps Number of Newton-Raphson steps after the estimate: 0, 1 or 2.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, within the bounds of the scalar rcp_approx. May be the same array as x.
+	 *
+	 * The estimate comes from rcpps or vrecpe where the target has them, so results can differ from the scalar rcp_approx
+	 * in the last bits. x86 has no double estimate before AVX-512, so double elements are divided there.
+	 */
+	template <int Steps = 1, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	void rcp_approx(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(intrin::rcp<Steps>(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
 } // namespace ccm::ext
@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/compare/isfinite.hpp"
+#include "ccmath/math/compare/isinf.hpp"
+#include "ccmath/math/fmanip/frexp.hpp"
+#include "ccmath/math/fmanip/ldexp.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Reductions over contiguous arrays of float or double.
+ *
+ * sum, dot, norm2 and hypot_n take the summation algorithm as a template argument:
+ *
+ *     const double total = ccm::ext::sum<ccm::ext::summation::eNeumaier>(values);
+ *
+ * Every mode runs on native_simd<T> lanes with four independent accumulators, so consecutive additions or FMAs do
+ * not wait for one another, and the lanes are only combined at the end. The compensated modes carry a second
+ * lane per accumulator with the rounding errors seen so far.
+ *
+ * In constant evaluation the same algorithms run one element at a time, so the last bits of a naive or pairwise
+ * result can differ from the runtime one.
+ *
+ * Each reduction also takes an execution policy first. Every block of execution::for_each_block is then reduced on
+ * its own and the partial results are added in the order of the blocks, which again changes the last bits of a naive
+ * or pairwise result. The compensated modes keep their accuracy.
+ */
+
+namespace ccm::ext
+{
+	/// Summation algorithm used by the reductions.
+	enum class summation : std::uint8_t
+	{
+		/// One running sum per lane. Error grows with n * eps.
+		eNaive,
+		/// Naive sums of blocks of a few hundred elements, added pairwise. Error grows with log2(n) * eps at the cost of eNaive.
+		ePairwise,
+		/// Kahan's compensated summation. For dot products the products themselves are rounded.
+		eKahan,
+		/// Neumaier's improvement of Kahan (TwoSum based, Ogita, Rump and Oishi's Sum2 and Dot2). Dot products also keep
+		/// the rounding error of every product. As accurate as summing in twice the working precision.
+		eNeumaier,
+		/// A double-T accumulator renormalized after every step. Its error bound grows with n * eps^2 rather than
+		/// eNeumaier's (n * eps)^2, which only matters for very long or very ill-conditioned inputs.
+		eDoubleDouble,
+	};
+
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_reducible_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		template <typename Lane, typename T>
+		constexpr Lane reduce_load(T const * ptr)
+		{
+			if constexpr (std::is_same_v<Lane, T>) { return *ptr; }
+			else { return Lane(ptr, intrin::element_aligned_tag()); }
+		}
+
+		template <summation Mode, typename Lane>
+		struct reduce_accumulator
+		{
+			using lane_type = Lane;
+
+			Lane sum{};
+			Lane err{};
+
+			constexpr void add(Lane v)
+			{
+				if constexpr (Mode == summation::eNaive || Mode == summation::ePairwise) { sum = sum + v; }
+				else if constexpr (Mode == summation::eKahan)
+				{
+					const Lane y = v - err;
+					const Lane t = sum + y;
+					err			 = (t - sum) - y;
+					sum			 = t;
+				}
+				else if constexpr (Mode == summation::eNeumaier)
+				{
+					const type::BasicDoubleDouble<Lane> s = type::two_sum(sum, v);
+					sum									  = s.hi;
+					err									  = err + s.lo;
+				}
+				else
+				{
+					const type::BasicDoubleDouble<Lane> s = type::two_sum(sum, v);
+					renormalize(s.hi, err + s.lo);
+				}
+			}
+
+			constexpr void add_product(Lane a, Lane b)
+			{
+				if constexpr (Mode == summation::eNaive || Mode == summation::ePairwise)
+				{
+					if constexpr (type::detail::has_fused_multiply_add_v<Lane>) { sum = type::detail::lane_multiply_add(a, b, sum); }
+					else { sum = a * b + sum; }
+				}
+				else if constexpr (Mode == summation::eKahan) { add(a * b); }
+				else if constexpr (Mode == summation::eNeumaier)
+				{
+					const type::BasicDoubleDouble<Lane> p = type::exact_mult(a, b);
+					const type::BasicDoubleDouble<Lane> s = type::two_sum(sum, p.hi);
+					sum									  = s.hi;
+					err									  = err + (s.lo + p.lo);
+				}
+				else
+				{
+					const type::BasicDoubleDouble<Lane> p = type::exact_mult(a, b);
+					const type::BasicDoubleDouble<Lane> s = type::two_sum(sum, p.hi);
+					renormalize(s.hi, err + (s.lo + p.lo));
+				}
+			}
+
+			// The accumulated value is sum + low().
+			[[nodiscard]] constexpr Lane low() const
+			{
+				if constexpr (Mode == summation::eKahan) { return -err; }
+				else { return err; }
+			}
+
+			// Only meaningful for scalar lanes.
+			[[nodiscard]] constexpr Lane result() const
+			{
+				if constexpr (Mode == summation::eNaive || Mode == summation::ePairwise) { return sum; }
+				else
+				{
+					// The error term of an infinite or NaN sum is meaningless, return the sum as a plain loop would.
+					if (!ccm::isfinite(sum)) { return sum; }
+					return sum + low();
+				}
+			}
+
+		private:
+			constexpr void renormalize(Lane hi, Lane lo)
+			{
+				const type::BasicDoubleDouble<Lane> r = type::exact_add(hi, lo);
+				// Once hi is infinite or NaN, lo is NaN. Keep hi so the plain result still comes out of result().
+				const auto finite = (hi - hi) == Lane{};
+				sum				  = intrin::choose(finite, r.hi, hi);
+				err				  = intrin::choose(finite, r.lo, Lane{});
+			}
+		};
+
+		// Folds every lane of a vector accumulator into a scalar one.
+		template <summation Mode, typename T, typename Simd>
+		void fold_lanes(reduce_accumulator<Mode, T> & total, reduce_accumulator<Mode, Simd> const & acc)
+		{
+			std::array<T, Simd::size()> hi{};
+			std::array<T, Simd::size()> lo{};
+			acc.sum.copy_to(hi.data(), intrin::element_aligned_tag());
+			acc.low().copy_to(lo.data(), intrin::element_aligned_tag());
+			for (std::size_t i = 0; i < hi.size(); ++i)
+			{
+				total.add(hi[i]);
+				// The error lane of an infinite sum is NaN and must not replace it.
+				if constexpr (Mode != summation::eNaive && Mode != summation::ePairwise)
+				{
+					if (ccm::isfinite(hi[i])) { total.add(lo[i]); }
+				}
+			}
+		}
+
+		template <typename T>
+		struct sum_source
+		{
+			T const * x;
+
+			template <typename Acc>
+			constexpr void operator()(Acc & acc, std::size_t i) const
+			{
+				acc.add(reduce_load<typename Acc::lane_type>(x + i));
+			}
+		};
+
+		template <typename T>
+		struct dot_source
+		{
+			T const * x;
+			T const * y;
+
+			template <typename Acc>
+			constexpr void operator()(Acc & acc, std::size_t i) const
+			{
+				using Lane = typename Acc::lane_type;
+				acc.add_product(reduce_load<Lane>(x + i), reduce_load<Lane>(y + i));
+			}
+		};
+
+		// Squares of x * scale, with scale a power of two.
+		template <typename T>
+		struct scaled_square_source
+		{
+			T const * x;
+			T scale;
+
+			template <typename Acc>
+			constexpr void operator()(Acc & acc, std::size_t i) const
+			{
+				using Lane	 = typename Acc::lane_type;
+				const Lane v = reduce_load<Lane>(x + i) * Lane(scale);
+				acc.add_product(v, v);
+			}
+		};
+
+		inline constexpr std::size_t reduce_accumulators = 4;
+
+		template <summation Mode, typename T, typename Source>
+		reduce_accumulator<Mode, T> reduce_blocks(Source const & source, std::size_t first, std::size_t last)
+		{
+			using simd_t			   = intrin::native_simd<T>;
+			constexpr std::size_t step = simd_t::size();
+
+			std::array<reduce_accumulator<Mode, simd_t>, reduce_accumulators> acc{};
+			std::size_t i = first;
+			for (; i + reduce_accumulators * step <= last; i += reduce_accumulators * step)
+			{
+				for (std::size_t k = 0; k < reduce_accumulators; ++k) { source(acc[k], i + k * step); }
+			}
+			for (; i + step <= last; i += step) { source(acc[0], i); }
+
+			reduce_accumulator<Mode, T> total{};
+			for (auto const & a : acc) { fold_lanes(total, a); }
+			for (; i < last; ++i) { source(total, i); }
+			return total;
+		}
+
+		// Blocks this size or smaller are summed naively. Splits keep both halves a whole number of accumulator rounds.
+		inline constexpr std::size_t pairwise_block = 256;
+
+		template <typename T, typename Source>
+		T reduce_pairwise(Source const & source, std::size_t first, std::size_t last)
+		{
+			const std::size_t n = last - first;
+			if (n <= pairwise_block) { return reduce_blocks<summation::eNaive, T>(source, first, last).result(); }
+
+			constexpr std::size_t round = reduce_accumulators * intrin::native_simd<T>::size();
+			const std::size_t middle	= first + (n / 2 + round - 1) / round * round;
+			return reduce_pairwise<T>(source, first, middle) + reduce_pairwise<T>(source, middle, last);
+		}
+
+		template <summation Mode, typename T, typename Source>
+		constexpr T reduce(Source const & source, std::size_t n)
+		{
+			if (ccm::support::is_constant_evaluated())
+			{
+				reduce_accumulator<Mode, T> total{};
+				for (std::size_t i = 0; i < n; ++i) { source(total, i); }
+				return total.result();
+			}
+
+			if constexpr (Mode == summation::ePairwise) { return reduce_pairwise<T>(source, 0, n); }
+			else { return reduce_blocks<Mode, T>(source, 0, n).result(); }
+		}
+
+		// Largest magnitude in x, ignoring NaNs. Zero for an empty array.
+		template <typename T>
+		constexpr T max_magnitude(T const * x, std::size_t n)
+		{
+			T largest = 0;
+			std::size_t i = 0;
+			if (!ccm::support::is_constant_evaluated())
+			{
+				using simd_t			   = intrin::native_simd<T>;
+				constexpr std::size_t step = simd_t::size();
+				const simd_t zero(T(0));
+
+				// Independent maxima, as for the sums: each one only waits on every fourth load.
+				std::array<simd_t, reduce_accumulators> lanes_max{zero, zero, zero, zero};
+				const std::size_t vector_end = n - n % (reduce_accumulators * step);
+				for (; i < vector_end; i += reduce_accumulators * step)
+				{
+					for (std::size_t k = 0; k < reduce_accumulators; ++k)
+					{
+						const simd_t v		   = simd_t(x + i + k * step, intrin::element_aligned_tag());
+						const simd_t magnitude = intrin::choose(v < zero, -v, v);
+						lanes_max[k]		   = intrin::choose(lanes_max[k] < magnitude, magnitude, lanes_max[k]);
+					}
+				}
+				std::array<T, simd_t::size()> lanes{};
+				for (simd_t const & m : lanes_max)
+				{
+					m.copy_to(lanes.data(), intrin::element_aligned_tag());
+					for (T v : lanes) { largest = largest < v ? v : largest; }
+				}
+			}
+			for (; i < n; ++i)
+			{
+				const T magnitude = x[i] < 0 ? -x[i] : x[i];
+				largest			  = largest < magnitude ? magnitude : largest;
+			}
+			return largest;
+		}
+
+		// Reduces every block of the policy on its own and adds the partial results in the order of the blocks.
+		template <summation Mode, typename T, typename Policy, typename Source>
+		T reduce(Policy const & policy, Source const & source, T const * data, std::size_t n)
+		{
+			std::mutex mutex;
+			std::vector<std::pair<std::size_t, reduce_accumulator<Mode, T>>> parts;
+			execution::for_each_block(policy, data, n,
+									  [&](std::size_t begin, std::size_t end)
+									  {
+										  reduce_accumulator<Mode, T> part{};
+										  if constexpr (Mode == summation::ePairwise) { part.sum = reduce_pairwise<T>(source, begin, end); }
+										  else { part = reduce_blocks<Mode, T>(source, begin, end); }
+										  const std::lock_guard<std::mutex> lock(mutex);
+										  parts.emplace_back(begin, part);
+									  });
+			std::sort(parts.begin(), parts.end(), [](auto const & a, auto const & b) { return a.first < b.first; });
+
+			reduce_accumulator<Mode, T> total{};
+			for (auto const & part : parts)
+			{
+				total.add(part.second.sum);
+				// As in fold_lanes, the error term of an infinite partial sum is NaN and must not replace it.
+				if constexpr (Mode != summation::eNaive && Mode != summation::ePairwise)
+				{
+					if (ccm::isfinite(part.second.sum)) { total.add(part.second.low()); }
+				}
+			}
+			return total.result();
+		}
+
+		template <typename T, typename Policy>
+		T max_magnitude(Policy const & policy, T const * x, std::size_t n)
+		{
+			std::mutex mutex;
+			T largest = 0;
+			execution::for_each_block(policy, x, n,
+									  [&](std::size_t begin, std::size_t end)
+									  {
+										  const T part = max_magnitude(x + begin, end - begin);
+										  const std::lock_guard<std::mutex> lock(mutex);
+										  largest = largest < part ? part : largest;
+									  });
+			return largest;
+		}
+
+		// hypot_n from the largest magnitude of its elements and reduce_squares(scale), the sum of the squares of the
+		// elements times scale, a power of two.
+		template <typename T, typename ReduceSquares>
+		constexpr T hypot_scaled(T largest, ReduceSquares && reduce_squares)
+		{
+			if (ccm::isinf(largest)) { return largest; }
+
+			int exponent = 0;
+			if (largest > 0) { static_cast<void>(ccm::frexp(largest, exponent)); }
+			// 2^-exponent must stay finite for subnormal inputs; the largest element then scales to below one.
+			const int scale_exponent = -exponent < std::numeric_limits<T>::max_exponent - 1 ? -exponent : std::numeric_limits<T>::max_exponent - 1;
+			const T scale			 = ccm::ldexp(T(1), scale_exponent);
+
+			const T scaled_norm = ccm::sqrt(reduce_squares(scale));
+			return ccm::ldexp(scaled_norm, -scale_exponent);
+		}
+
+		template <typename Container>
+		using container_value_t = std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<Container const &>().data())>>;
+	} // namespace detail
+
+	/**
+	 * @brief Sum of the elements of an array.
+	 * @tparam Mode Summation algorithm.
+	 * @param data Pointer to the first element.
+	 * @param n Number of elements.
+	 */
+	template <summation Mode = summation::ePairwise, typename T, std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T sum(T const * data, std::size_t n) noexcept
+	{
+		return detail::reduce<Mode, T>(detail::sum_source<T>{data}, n);
+	}
+
+	/**
+	 * @brief Dot product of two arrays.
+	 * @tparam Mode Summation algorithm. eNaive and ePairwise accumulate with FMA where the ABI has one.
+	 * @param x Pointer to the first element of the first array.
+	 * @param y Pointer to the first element of the second array.
+	 * @param n Number of elements in each array.
+	 */
+	template <summation Mode = summation::ePairwise, typename T, std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T dot(T const * x, T const * y, std::size_t n) noexcept
+	{
+		return detail::reduce<Mode, T>(detail::dot_source<T>{x, y}, n);
+	}
+
+	/**
+	 * @brief Euclidean norm of an array, the square root of its dot product with itself.
+	 *
+	 * The squares are not scaled, so the result overflows once the sum of squares does. Use hypot_n when the
+	 * elements can exceed the square root of the largest finite value, or are small enough for their squares to
+	 * underflow.
+	 */
+	template <summation Mode = summation::ePairwise, typename T, std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T norm2(T const * x, std::size_t n) noexcept
+	{
+		return ccm::sqrt(dot<Mode>(x, x, n));
+	}
+
+	/**
+	 * @brief Euclidean norm of an array without intermediate overflow or underflow.
+	 *
+	 * A first pass finds the largest magnitude and the second sums the squares scaled by a power of two that brings
+	 * it close to one, so the scaling is exact. As with std::hypot, any infinite element gives +inf even if another
+	 * element is NaN.
+	 */
+	template <summation Mode = summation::ePairwise, typename T, std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T hypot_n(T const * x, std::size_t n) noexcept
+	{
+		return detail::hypot_scaled(detail::max_magnitude(x, n),
+									[x, n](T scale) { return detail::reduce<Mode, T>(detail::scaled_square_source<T>{x, scale}, n); });
+	}
+
+	/// sum with the array split by policy.
+	template <summation Mode = summation::ePairwise, typename Policy, typename T,
+			  std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_reducible_v<T>, bool> = true>
+	T sum(Policy && policy, T const * data, std::size_t n)
+	{
+		return detail::reduce<Mode>(policy, detail::sum_source<T>{data}, data, n);
+	}
+
+	/// dot with the arrays split by policy.
+	template <summation Mode = summation::ePairwise, typename Policy, typename T,
+			  std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_reducible_v<T>, bool> = true>
+	T dot(Policy && policy, T const * x, T const * y, std::size_t n)
+	{
+		return detail::reduce<Mode>(policy, detail::dot_source<T>{x, y}, x, n);
+	}
+
+	/// norm2 with the array split by policy.
+	template <summation Mode = summation::ePairwise, typename Policy, typename T,
+			  std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_reducible_v<T>, bool> = true>
+	T norm2(Policy && policy, T const * x, std::size_t n)
+	{
+		return ccm::sqrt(dot<Mode>(policy, x, x, n));
+	}
+
+	/// hypot_n with the array split by policy, in both passes.
+	template <summation Mode = summation::ePairwise, typename Policy, typename T,
+			  std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_reducible_v<T>, bool> = true>
+	T hypot_n(Policy && policy, T const * x, std::size_t n)
+	{
+		return detail::hypot_scaled(detail::max_magnitude(policy, x, n),
+									[&policy, x, n](T scale) { return detail::reduce<Mode>(policy, detail::scaled_square_source<T>{x, scale}, x, n); });
+	}
+
+	/// sum of a contiguous container such as std::vector or std::array.
+	template <summation Mode = summation::ePairwise, typename Container, typename T = detail::container_value_t<Container>,
+			  std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T sum(Container const & values) noexcept
+	{
+		return sum<Mode>(values.data(), static_cast<std::size_t>(values.size()));
+	}
+
+	/// dot of two contiguous containers. Only the common prefix is used.
+	template <summation Mode = summation::ePairwise, typename Container, typename T = detail::container_value_t<Container>,
+			  std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T dot(Container const & x, Container const & y) noexcept
+	{
+		const auto n = static_cast<std::size_t>(x.size() < y.size() ? x.size() : y.size());
+		return dot<Mode>(x.data(), y.data(), n);
+	}
+
+	/// norm2 of a contiguous container.
+	template <summation Mode = summation::ePairwise, typename Container, typename T = detail::container_value_t<Container>,
+			  std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T norm2(Container const & values) noexcept
+	{
+		return norm2<Mode>(values.data(), static_cast<std::size_t>(values.size()));
+	}
+
+	/// hypot_n of a contiguous container.
+	template <summation Mode = summation::ePairwise, typename Container, typename T = detail::container_value_t<Container>,
+			  std::enable_if_t<detail::is_reducible_v<T>, bool> = true>
+	constexpr T hypot_n(Container const & values) noexcept
+	{
+		return hypot_n<Mode>(values.data(), static_cast<std::size_t>(values.size()));
+	}
+} // namespace ccm::ext
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/func/power/rsqrt_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/func/rsqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Calculates a fast, approximate, reciprocal square root.
+	 * @tparam Steps Number of Newton-Raphson steps after the estimate: 0, 1 or 2.
+	 * @tparam T Type of the input and output, float or double.
+	 * @param x Value to get the reciprocal square root of.
+	 * @return 1 / sqrt(x), with a relative error below 1.5 * 2^-12 for 0 steps, 2^-21 for 1 step and 2^-22 (float) or
+	 * 2^-42 (double) for 2 steps. ±0 gives ±inf, +inf gives 0 and negative numbers give NaN.
+	 *
+	 * At run time the estimate comes from rsqrtss, rsqrt14 or vrsqrte and each step is one Newton step. x86 before
+	 * AVX-512 estimates double arguments as floats, and targets without an estimate take the exact 1 / sqrt(x).
+	 * Constant expressions start from a bit trick seed instead, refined to the bound of 0 steps, so compile time results
+	 * can differ from run time ones in the last bits.
+	 */
+	template <int Steps = 1, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rsqrt_approx(T x) noexcept
+	{
+		if (support::is_constant_evaluated()) { return gen::rsqrt_gen<Steps>(x); }
+		return rt::rsqrt_rt<Steps>(x);
+	}
+
+	/**
+	 * @brief Approximate reciprocal square root of every element.
+	 * @tparam Steps Number of Newton-Raphson steps after the estimate: 0, 1 or 2.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, within the bounds of the scalar rsqrt_approx. May be the same array as x.
+	 *
+	 * The estimate comes from rsqrtps or vrsqrte where the target has them, so float results can differ from the scalar
+	 * rsqrt_approx in the last bits.
+	 */
+	template <int Steps = 1, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	void rsqrt_approx(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(intrin::rsqrt<Steps>(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
+} // namespace ccm::ext
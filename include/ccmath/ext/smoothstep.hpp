@@ -11,7 +11,10 @@
 #pragma once
 
 #include "ccmath/ext/clamp.hpp"
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::ext
@@ -32,4 +35,35 @@ namespace ccm::ext
         // Evaluate polynomial
         return x * x * (static_cast<T>(3) - static_cast<T>(2) * x);
     }
+
+	/**
+	 * @brief Smooth hermite interpolation of every lane.
+	 * @param edge0 Lower edge.
+	 * @param edge1 Upper edge.
+	 * @param x Value to interpolate.
+	 * @return The interpolated lanes, the same as the scalar smoothstep of each lane.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> smoothstep(intrin::simd<T, Abi> const & edge0, intrin::simd<T, Abi> const & edge1, intrin::simd<T, Abi> const & x) noexcept
+	{
+		const intrin::simd<T, Abi> t = ccm::ext::clamp((x - edge0) / (edge1 - edge0));
+		return t * t * (intrin::simd<T, Abi>(T(3)) - intrin::simd<T, Abi>(T(2)) * t);
+	}
+
+	/**
+	 * @brief Smooth hermite interpolation of every element between the same edges.
+	 * @param edge0 Lower edge.
+	 * @param edge1 Upper edge.
+	 * @param x Pointer to the values to interpolate.
+	 * @param n Number of elements.
+	 * @param out Receives n interpolated values. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_fmanip_type_v<T>, bool> = true>
+	void smoothstep(T edge0, T edge1, T const * x, std::size_t n, T * out) noexcept
+	{
+		const intrin::native_simd<T> lower(edge0);
+		const intrin::native_simd<T> upper(edge1);
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(smoothstep(lower, upper, detail::load_block<T>(x + i, count)), out + i, count); });
+	}
 } // namespace ccm::ext
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/ext/reduce.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/math/compare/isfinite.hpp"
+#include "ccmath/math/compare/isnan.hpp"
+#include "ccmath/math/expo/log.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/*
+ * Softmax, log-sum-exp and the logistic function for float and double.
+ *
+ * softmax and logsumexp subtract the largest element before exponentiating, so nothing overflows and at least one
+ * term of the sum is 1. They read the input twice: a max-reduce pass with four independent vector maxima, as
+ * hypot_n does, then one pass that computes exp(x - max), adds it to a vector accumulator and, for softmax, stores
+ * it. softmax then scales its output by the reciprocal of the sum.
+ *
+ * An infinite largest element is handled on its own, as the limit of the elements equal to it growing together.
+ * logsumexp gives +inf for an input holding +inf and -inf for an input that is all -inf or empty. softmax shares 1
+ * evenly between the +inf elements and gives 0 to the others, and gives 1 / n to every element of an all -inf input.
+ * A NaN element makes every result NaN.
+ *
+ * sigmoid and log_sigmoid only exponentiate -|x|, which cannot overflow, and log_sigmoid takes log1p of it so that
+ * large arguments keep their tiny results instead of rounding to 0.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_softmax_type_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		// Largest element of x, ignoring NaNs. -inf for an empty array.
+		template <typename T>
+		T max_element_value(T const * x, std::size_t n) noexcept
+		{
+			using simd_t			   = intrin::native_simd<T>;
+			constexpr std::size_t step = simd_t::size();
+			const simd_t lowest(-std::numeric_limits<T>::infinity());
+
+			std::array<simd_t, reduce_accumulators> lanes_max{lowest, lowest, lowest, lowest};
+			std::size_t i				 = 0;
+			const std::size_t vector_end = n - n % (reduce_accumulators * step);
+			for (; i < vector_end; i += reduce_accumulators * step)
+			{
+				for (std::size_t k = 0; k < reduce_accumulators; ++k)
+				{
+					const simd_t v = simd_t(x + i + k * step, intrin::element_aligned_tag());
+					lanes_max[k]   = intrin::choose(lanes_max[k] < v, v, lanes_max[k]);
+				}
+			}
+
+			T largest = -std::numeric_limits<T>::infinity();
+			std::array<T, step> lanes{};
+			for (simd_t const & m : lanes_max)
+			{
+				m.copy_to(lanes.data(), intrin::element_aligned_tag());
+				for (T v : lanes) { largest = largest < v ? v : largest; }
+			}
+			for (; i < n; ++i) { largest = largest < x[i] ? x[i] : largest; }
+			return largest;
+		}
+
+		// Number of elements equal to v, or 0 if any element is NaN.
+		template <typename T>
+		std::size_t count_equal_unless_nan(T const * x, std::size_t n, T v) noexcept
+		{
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				if (ccm::isnan(x[i])) { return 0; }
+				if (x[i] == v) { ++count; }
+			}
+			return count;
+		}
+
+		// Sum of exp(x - shift) over x, also stored in out unless it is null. The last partial block is padded with -inf,
+		// whose exponential adds nothing.
+		template <typename T>
+		T exp_sum(T const * x, std::size_t n, T shift, T * out) noexcept
+		{
+			using simd_t				= intrin::native_simd<T>;
+			constexpr std::size_t width = simd_t::size();
+
+			const simd_t s(shift);
+			simd_t acc(T(0));
+			for_each_simd_block<T>(n,
+								   [&](std::size_t i, std::size_t count)
+								   {
+									   simd_t v;
+									   if (count == width) { v = simd_t(x + i, intrin::element_aligned_tag()); }
+									   else
+									   {
+										   T buffer[width];
+										   for (std::size_t k = 0; k < width; ++k) { buffer[k] = k < count ? x[i + k] : -std::numeric_limits<T>::infinity(); }
+										   v = simd_t(buffer, intrin::element_aligned_tag());
+									   }
+									   const simd_t e = intrin::exp(v - s);
+									   acc			  = acc + e;
+									   if (out != nullptr) { store_block(e, out + i, count); }
+								   });
+
+			std::array<T, width> lanes{};
+			acc.copy_to(lanes.data(), intrin::element_aligned_tag());
+			T total = 0;
+			for (T v : lanes) { total += v; }
+			return total;
+		}
+
+		// log(1 + u) for lanes u in [0, 1]. 1 + u is rounded, and the rounding error, which is exact, corrects the log.
+		template <typename T, typename Abi>
+		intrin::simd<T, Abi> log1p_unit(intrin::simd<T, Abi> const & u) noexcept
+		{
+			const intrin::simd<T, Abi> w  = u + T(1);
+			const intrin::simd<T, Abi> lo = u - (w - T(1));
+			return intrin::log(w) + lo / w;
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Logistic function 1 / (1 + e^-x) of every lane.
+	 *
+	 * Computed from e = exp(-|x|) as 1 / (1 + e) for positive lanes and e / (1 + e) for negative ones, so neither
+	 * half of the range overflows or loses its small results.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> sigmoid(intrin::simd<T, Abi> const & x) noexcept
+	{
+		const intrin::simd<T, Abi> zero(T(0));
+		const intrin::simd<T, Abi> e = intrin::exp(zero - intrin::fabs(x));
+		const intrin::simd<T, Abi> r = intrin::simd<T, Abi>(T(1)) / (e + T(1));
+		return intrin::choose(x < zero, e * r, r);
+	}
+
+	/**
+	 * @brief Logarithm of the logistic function, -log(1 + e^-x), of every lane.
+	 *
+	 * Computed as min(x, 0) - log1p(exp(-|x|)). Large negative lanes give x itself and large positive ones -e^-x.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> log_sigmoid(intrin::simd<T, Abi> const & x) noexcept
+	{
+		const intrin::simd<T, Abi> zero(T(0));
+		const intrin::simd<T, Abi> e = intrin::exp(zero - intrin::fabs(x));
+		return intrin::choose(x < zero, x, zero) - detail::log1p_unit(e);
+	}
+
+	/**
+	 * @brief Logistic function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results in [0, 1]. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	void sigmoid(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(ext::sigmoid(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
+
+	/**
+	 * @brief Logarithm of the logistic function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, all of them at most 0. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	void log_sigmoid(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(ext::log_sigmoid(detail::load_block<T>(x + i, count)), out + i, count); });
+	}
+
+	/**
+	 * @brief log(sum(exp(x))) over an array, without overflow.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @return The result, -inf for an empty array.
+	 */
+	template <typename T, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	T logsumexp(T const * x, std::size_t n) noexcept
+	{
+		const T largest = detail::max_element_value(x, n);
+		if (!ccm::isfinite(largest))
+		{
+			// An empty array has nothing to be NaN.
+			const bool nan = n > 0 && detail::count_equal_unless_nan(x, n, largest) == 0;
+			return nan ? std::numeric_limits<T>::quiet_NaN() : largest;
+		}
+		return largest + ccm::log(detail::exp_sum(x, n, largest, static_cast<T *>(nullptr)));
+	}
+
+	/**
+	 * @brief exp(x) divided by the sum of exp over the array, for every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results in [0, 1] that add up to 1, see the top of the file for infinite elements. May be
+	 * the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	void softmax(T const * x, std::size_t n, T * out) noexcept
+	{
+		const T largest = detail::max_element_value(x, n);
+		if (!ccm::isfinite(largest))
+		{
+			// The elements equal to the infinite maximum share 1, and a NaN anywhere makes count 0 and everything NaN.
+			const std::size_t count = detail::count_equal_unless_nan(x, n, largest);
+			const T share			= count > 0 ? T(1) / static_cast<T>(count) : std::numeric_limits<T>::quiet_NaN();
+			for (std::size_t i = 0; i < n; ++i) { out[i] = x[i] == largest || count == 0 ? share : T(0); }
+			return;
+		}
+
+		const intrin::native_simd<T> scale(T(1) / detail::exp_sum(x, n, largest, out));
+		detail::for_each_simd_block<T>(n, [&](std::size_t i, std::size_t count)
+									   { detail::store_block(detail::load_block<T>(out + i, count) * scale, out + i, count); });
+	}
+
+	/// logsumexp of a contiguous container such as std::vector or std::array.
+	template <typename Container, typename T = detail::container_value_t<Container>, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	T logsumexp(Container const & values) noexcept
+	{
+		return logsumexp(values.data(), static_cast<std::size_t>(values.size()));
+	}
+
+	/// softmax of a contiguous container, in place.
+	template <typename Container, typename T = detail::container_value_t<Container>, std::enable_if_t<detail::is_softmax_type_v<T>, bool> = true>
+	void softmax(Container & values) noexcept
+	{
+		softmax(values.data(), static_cast<std::size_t>(values.size()), values.data());
+	}
+} // namespace ccm::ext
@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/ext/fmanip.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cyl_bessel.hpp"
+#include "ccmath/internal/math/runtime/simd/func/erf.hpp"
+#include "ccmath/internal/math/runtime/simd/func/erfinv.hpp"
+#include "ccmath/internal/math/runtime/simd/func/gamma.hpp"
+#include "ccmath/internal/math/runtime/simd/func/hermite.hpp"
+#include "ccmath/internal/math/runtime/simd/func/laguerre.hpp"
+#include "ccmath/internal/math/runtime/simd/func/legendre.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sph_bessel.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Array forms of erf, erfc, erfinv, erfcinv, tgamma and lgamma, of the Legendre, Laguerre and Hermite families and of the
+ * spherical and cylindrical Bessel functions, for float and double.
+ *
+ * The scalar functions compute in double, so both element types run on native_simd<double> blocks here. float
+ * elements are widened on load and rounded on store. Each range of the piecewise approximations is only evaluated in
+ * blocks that have an element in it, so sorted or clustered inputs are cheaper than scattered ones.
+ *
+ * The orthogonal polynomial families and the spherical Bessel functions come in two array forms: one degree for every
+ * element, and every degree up to a maximum for every element at once, from a single pass of the recurrence. The
+ * latter stores degree-major, the values of degree l at out + l * count, so each degree is a contiguous array like
+ * the input. The recurrences run on native_simd<double> blocks, one block of elements per pass. For j_n each element
+ * takes the upward recurrence or Miller's downward one depending on its argument, and a block holding both runs both.
+ * The cylindrical Bessel functions take the orders nu to nu + n_max of a real order nu in the same layout, and a block
+ * runs the continued fractions and series until all of its elements have converged.
+ *
+ * Results are the same as the scalar ccm functions, element by element, when both are built with -ffp-contract=off,
+ * but errno and the floating-point exceptions are left alone. Where the compiler fuses products into sums on its own,
+ * it does not fuse the polynomials and recurrences of the two alike, and they can differ in the last bits.
+ *
+ * The forms of a single function or degree also take an execution policy first, which splits the array with
+ * execution::for_each_block. The forms for every degree store degree-major and take none.
+ */
+
+namespace ccm::ext
+{
+	namespace detail
+	{
+		template <typename T>
+		inline constexpr bool is_special_type_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		/// Stores op applied to every block of x, widened to double lanes, into out.
+		template <typename T, typename Op>
+		void special_map(T const * x, std::size_t n, T * out, Op && op) noexcept
+		{
+			for_each_simd_block<double>(n, [&](std::size_t i, std::size_t count)
+										{ store_block(op(load_block<double>(x + i, count)), out + i, count); });
+		}
+
+		/// Calls recurrence(block, store) for every block of x, widened to double lanes, with store(l, v) putting v at out + l * n.
+		template <typename T, typename Recurrence>
+		void special_all_map(T const * x, std::size_t n, T * out, Recurrence && recurrence) noexcept
+		{
+			for_each_simd_block<double>(n,
+										[&](std::size_t i, std::size_t count)
+										{
+											recurrence(load_block<double>(x + i, count), [&](unsigned l, intrin::native_simd<double> const & v)
+													   { store_block(v, out + static_cast<std::size_t>(l) * n + i, count); });
+										});
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Error function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::erf. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void erf(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(x, n, out, [](intrin::native_simd<double> const & v) { return intrin::erf(v); });
+	}
+
+	/**
+	 * @brief Complementary error function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::erfc. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void erfc(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(x, n, out, [](intrin::native_simd<double> const & v) { return intrin::erfc(v); });
+	}
+
+	/**
+	 * @brief Inverse error function of every element.
+	 * @param y Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::erfinv. May be the same array as y.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void erfinv(T const * y, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(y, n, out, [](intrin::native_simd<double> const & v) { return intrin::erfinv(v); });
+	}
+
+	/**
+	 * @brief Inverse complementary error function of every element.
+	 * @param z Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::erfcinv. May be the same array as z.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void erfcinv(T const * z, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(z, n, out, [](intrin::native_simd<double> const & v) { return intrin::erfcinv(v); });
+	}
+
+	/**
+	 * @brief Gamma function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::tgamma. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void tgamma(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(x, n, out, [](intrin::native_simd<double> const & v) { return intrin::tgamma(v); });
+	}
+
+	/**
+	 * @brief Logarithm of the absolute value of the gamma function of every element.
+	 * @param x Pointer to the first element.
+	 * @param n Number of elements.
+	 * @param out Receives n results, see ccm::lgamma. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void lgamma(T const * x, std::size_t n, T * out) noexcept
+	{
+		detail::special_map(x, n, out, [](intrin::native_simd<double> const & v) { return intrin::lgamma(v); });
+	}
+
+	/**
+	 * @brief Legendre polynomial of degree n of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::legendre. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void legendre(unsigned n, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n](intrin::native_simd<double> const & v) { return intrin::legendre(n, v); });
+	}
+
+	/**
+	 * @brief Legendre polynomials of every degree up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, P_l of element i at out[l * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void legendre_all(unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [n_max](intrin::native_simd<double> const & v, auto && store) { intrin::detail::legendre(n_max, v, store); });
+	}
+
+	/**
+	 * @brief Associated Legendre function of degree n and order m of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::assoc_legendre. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void assoc_legendre(unsigned n, unsigned m, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n, m](intrin::native_simd<double> const & v) { return intrin::assoc_legendre(n, m, v); });
+	}
+
+	/**
+	 * @brief Associated Legendre functions of order m and every degree up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, P_l^m of element i at out[l * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void assoc_legendre_all(unsigned n_max, unsigned m, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out,
+								[n_max, m](intrin::native_simd<double> const & v, auto && store) { intrin::detail::assoc_legendre(n_max, m, v, store); });
+	}
+
+	/**
+	 * @brief Spherical harmonic Y_l^m(theta, 0) of every element.
+	 * @param theta Pointer to the first polar angle.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::sph_legendre. May be the same array as theta.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_legendre(unsigned l, unsigned m, T const * theta, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(theta, count, out, [l, m](intrin::native_simd<double> const & v) { return intrin::sph_legendre(l, m, v); });
+	}
+
+	/**
+	 * @brief Spherical harmonics of order m and every degree up to l_max of every element.
+	 * @param theta Pointer to the first polar angle.
+	 * @param count Number of elements.
+	 * @param out Receives (l_max + 1) * count results, Y_l^m of element i at out[l * count + i]. Must not overlap theta.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_legendre_all(unsigned l_max, unsigned m, T const * theta, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(theta, count, out,
+								[l_max, m](intrin::native_simd<double> const & v, auto && store) { intrin::detail::sph_legendre(l_max, m, v, store); });
+	}
+
+	/**
+	 * @brief Laguerre polynomial of degree n of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::laguerre. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void laguerre(unsigned n, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n](intrin::native_simd<double> const & v) { return intrin::laguerre(n, v); });
+	}
+
+	/**
+	 * @brief Laguerre polynomials of every degree up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, L_k of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void laguerre_all(unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out,
+								[n_max](intrin::native_simd<double> const & v, auto && store) { intrin::detail::assoc_laguerre(n_max, 0, v, store); });
+	}
+
+	/**
+	 * @brief Associated Laguerre polynomial of degree n and order m of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::assoc_laguerre. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void assoc_laguerre(unsigned n, unsigned m, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n, m](intrin::native_simd<double> const & v) { return intrin::assoc_laguerre(n, m, v); });
+	}
+
+	/**
+	 * @brief Associated Laguerre polynomials of order m and every degree up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, L_k^m of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void assoc_laguerre_all(unsigned n_max, unsigned m, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out,
+								[n_max, m](intrin::native_simd<double> const & v, auto && store) { intrin::detail::assoc_laguerre(n_max, m, v, store); });
+	}
+
+	/**
+	 * @brief Physicists' Hermite polynomial of degree n of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::hermite. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void hermite(unsigned n, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n](intrin::native_simd<double> const & v) { return intrin::hermite(n, v); });
+	}
+
+	/**
+	 * @brief Physicists' Hermite polynomials of every degree up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, H_k of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void hermite_all(unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [n_max](intrin::native_simd<double> const & v, auto && store) { intrin::detail::hermite(n_max, v, store); });
+	}
+
+	/**
+	 * @brief Spherical Bessel function of the first kind of order n of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::sph_bessel. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_bessel(unsigned n, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n](intrin::native_simd<double> const & v) { return intrin::sph_bessel(n, v); });
+	}
+
+	/**
+	 * @brief Spherical Bessel functions of the first kind of every order up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, j_k of element i at out[k * count + i] as ccm::sph_bessel_all
+	 * gives them. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_bessel_all(unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::for_each_simd_block<double>(count,
+											[&](std::size_t i, std::size_t block)
+											{
+												intrin::detail::sph_bessel<true>(n_max, detail::load_block<double>(x + i, block),
+																				 [&](unsigned k, intrin::native_simd<double> const & v, auto const & mask)
+																				 {
+																					 T * dst = out + static_cast<std::size_t>(k) * count + i;
+																					 if (all_of(mask)) { detail::store_block(v, dst, block); }
+																					 else { detail::store_block(choose(mask, v, detail::load_block<double>(dst, block)), dst, block); }
+																				 });
+											});
+	}
+
+	/**
+	 * @brief Spherical Bessel function of the second kind of order n of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::sph_neumann. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_neumann(unsigned n, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [n](intrin::native_simd<double> const & v) { return intrin::sph_neumann(n, v); });
+	}
+
+	/**
+	 * @brief Spherical Bessel functions of the second kind of every order up to n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, y_k of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void sph_neumann_all(unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [n_max](intrin::native_simd<double> const & v, auto && store) { intrin::detail::sph_neumann(n_max, v, store); });
+	}
+
+	/**
+	 * @brief Cylindrical Bessel function of the first kind of order nu of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::cyl_bessel_j. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_j(T nu, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [nu](intrin::native_simd<double> const & v) { return intrin::cyl_bessel_j(static_cast<double>(nu), v); });
+	}
+
+	/**
+	 * @brief Cylindrical Bessel functions of the first kind of the orders nu to nu + n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, J_{nu + k} of element i at out[k * count + i] as
+	 * ccm::cyl_bessel_j_all gives them. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_j_all(T nu, unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [nu, n_max](intrin::native_simd<double> const & v, auto && store)
+								{ gen::internal::cyl_bessel_j_impl(static_cast<double>(nu), n_max, v, store); });
+	}
+
+	/**
+	 * @brief Cylindrical Bessel function of the second kind of order nu of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::cyl_neumann. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_neumann(T nu, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [nu](intrin::native_simd<double> const & v) { return intrin::cyl_neumann(static_cast<double>(nu), v); });
+	}
+
+	/**
+	 * @brief Cylindrical Bessel functions of the second kind of the orders nu to nu + n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, Y_{nu + k} of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_neumann_all(T nu, unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [nu, n_max](intrin::native_simd<double> const & v, auto && store)
+								{ gen::internal::cyl_neumann_impl(static_cast<double>(nu), n_max, v, store); });
+	}
+
+	/**
+	 * @brief Modified cylindrical Bessel function of the first kind of order nu of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::cyl_bessel_i. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_i(T nu, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [nu](intrin::native_simd<double> const & v) { return intrin::cyl_bessel_i(static_cast<double>(nu), v); });
+	}
+
+	/**
+	 * @brief Modified cylindrical Bessel functions of the first kind of the orders nu to nu + n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, I_{nu + k} of element i at out[k * count + i] as
+	 * ccm::cyl_bessel_i_all gives them. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_i_all(T nu, unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [nu, n_max](intrin::native_simd<double> const & v, auto && store)
+								{ gen::internal::cyl_bessel_i_impl(static_cast<double>(nu), n_max, v, store); });
+	}
+
+	/**
+	 * @brief Modified cylindrical Bessel function of the second kind of order nu of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives count results, see ccm::cyl_bessel_k. May be the same array as x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_k(T nu, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_map(x, count, out, [nu](intrin::native_simd<double> const & v) { return intrin::cyl_bessel_k(static_cast<double>(nu), v); });
+	}
+
+	/**
+	 * @brief Modified cylindrical Bessel functions of the second kind of the orders nu to nu + n_max of every element.
+	 * @param x Pointer to the first element.
+	 * @param count Number of elements.
+	 * @param out Receives (n_max + 1) * count results, K_{nu + k} of element i at out[k * count + i]. Must not overlap x.
+	 */
+	template <typename T, std::enable_if_t<detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_k_all(T nu, unsigned n_max, T const * x, std::size_t count, T * out) noexcept
+	{
+		detail::special_all_map(x, count, out, [nu, n_max](intrin::native_simd<double> const & v, auto && store)
+								{ gen::internal::cyl_bessel_k_impl(static_cast<double>(nu), n_max, v, store); });
+	}
+
+	/// erf of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void erf(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { erf(x + begin, end - begin, out + begin); });
+	}
+
+	/// erfc of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void erfc(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { erfc(x + begin, end - begin, out + begin); });
+	}
+
+	/// erfinv of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void erfinv(Policy && policy, T const * y, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { erfinv(y + begin, end - begin, out + begin); });
+	}
+
+	/// erfcinv of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void erfcinv(Policy && policy, T const * z, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { erfcinv(z + begin, end - begin, out + begin); });
+	}
+
+	/// tgamma of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void tgamma(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { tgamma(x + begin, end - begin, out + begin); });
+	}
+
+	/// lgamma of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void lgamma(Policy && policy, T const * x, std::size_t n, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, n,
+								  [=](std::size_t begin, std::size_t end) { lgamma(x + begin, end - begin, out + begin); });
+	}
+
+	/// legendre of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void legendre(Policy && policy, unsigned n, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { legendre(n, x + begin, end - begin, out + begin); });
+	}
+
+	/// assoc_legendre of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void assoc_legendre(Policy && policy, unsigned n, unsigned m, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { assoc_legendre(n, m, x + begin, end - begin, out + begin); });
+	}
+
+	/// sph_legendre of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void sph_legendre(Policy && policy, unsigned l, unsigned m, T const * theta, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { sph_legendre(l, m, theta + begin, end - begin, out + begin); });
+	}
+
+	/// laguerre of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void laguerre(Policy && policy, unsigned n, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { laguerre(n, x + begin, end - begin, out + begin); });
+	}
+
+	/// assoc_laguerre of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void assoc_laguerre(Policy && policy, unsigned n, unsigned m, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { assoc_laguerre(n, m, x + begin, end - begin, out + begin); });
+	}
+
+	/// hermite of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void hermite(Policy && policy, unsigned n, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { hermite(n, x + begin, end - begin, out + begin); });
+	}
+
+	/// sph_bessel of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void sph_bessel(Policy && policy, unsigned n, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { sph_bessel(n, x + begin, end - begin, out + begin); });
+	}
+
+	/// sph_neumann of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void sph_neumann(Policy && policy, unsigned n, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { sph_neumann(n, x + begin, end - begin, out + begin); });
+	}
+
+	/// cyl_bessel_j of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_j(Policy && policy, T nu, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { cyl_bessel_j(nu, x + begin, end - begin, out + begin); });
+	}
+
+	/// cyl_neumann of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void cyl_neumann(Policy && policy, T nu, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { cyl_neumann(nu, x + begin, end - begin, out + begin); });
+	}
+
+	/// cyl_bessel_i of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_i(Policy && policy, T nu, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { cyl_bessel_i(nu, x + begin, end - begin, out + begin); });
+	}
+
+	/// cyl_bessel_k of every element, with the array split by policy.
+	template <typename Policy, typename T, std::enable_if_t<execution::is_execution_policy_v<Policy> && detail::is_special_type_v<T>, bool> = true>
+	void cyl_bessel_k(Policy && policy, T nu, T const * x, std::size_t count, T * out)
+	{
+		execution::for_each_block(std::forward<Policy>(policy), out, count,
+								  [=](std::size_t begin, std::size_t end) { cyl_bessel_k(nu, x + begin, end - begin, out + begin); });
+	}
+} // namespace ccm::ext
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/ext/cubic.hpp"
+#include "ccmath/ext/mix.hpp"
+#include "ccmath/internal/support/helpers/cos_pi.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lookup tables built at compile time.
+ *
+ *     constexpr auto exp_table = ccm::ext::make_table<256>([](double x) { return ccm::exp(x); }, -4.0, 0.0);
+ *     double y = ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(exp_table, -1.25);
+ *
+ * A uniform table stores samples at N evenly spaced points and is read with linear or Catmull-Rom cubic interpolation
+ * between the two neighbouring samples. A Chebyshev table stores samples at the N Chebyshev-Lobatto points of
+ * [lo, hi] and is read with the barycentric formula, which evaluates the degree N - 1 polynomial through all samples.
+ * It needs far fewer samples for smooth functions, but each lookup is O(N), so it suits small N.
+ *
+ * Inputs outside [lo, hi] are clamped to the range, and NaN inputs give NaN.
+ */
+
+namespace ccm::ext
+{
+	/// Placement of the samples of a lookup_table.
+	enum class table_grid : std::uint8_t
+	{
+		eUniform,
+		eChebyshev,
+	};
+
+	/// How table_interp reads a uniform lookup_table. Chebyshev tables always use their polynomial interpolant.
+	enum class table_interpolation : std::uint8_t
+	{
+		eLinear,
+		eCubic,
+	};
+
+	namespace detail
+	{
+		// Grid dependent part of a lookup_table.
+		template <typename T, std::size_t N, table_grid Grid>
+		struct table_grid_data
+		{
+			/// (N - 1) / (hi - lo), the number of samples per unit of input.
+			T scale;
+		};
+
+		template <typename T, std::size_t N>
+		struct table_grid_data<T, N, table_grid::eChebyshev>
+		{
+			/// Position of each sample, increasing from lo to hi.
+			std::array<T, N> nodes;
+		};
+
+		// The widest simd type available for T. Types without a vector ABI are processed one lane at a time.
+		template <typename T>
+		using table_simd_t = std::conditional_t<std::is_same_v<T, float> || std::is_same_v<T, double>, intrin::native_simd<T>, intrin::simd<T, intrin::abi::scalar>>;
+	} // namespace detail
+
+	/**
+	 * @brief Samples of a function over [lo, hi], produced by make_table and read by table_interp.
+	 * @tparam T Floating-point type of the samples.
+	 * @tparam N Number of samples, at least two.
+	 * @tparam Grid Placement of the samples.
+	 */
+	template <typename T, std::size_t N, table_grid Grid = table_grid::eUniform>
+	struct lookup_table : detail::table_grid_data<T, N, Grid>
+	{
+		static_assert(std::is_floating_point_v<T>, "ccm::ext::lookup_table requires a floating-point type.");
+		static_assert(N >= 2, "ccm::ext::lookup_table needs at least two samples.");
+
+		using value_type = T;
+
+		static constexpr table_grid grid = Grid;
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+		T lo;
+		T hi;
+		std::array<T, N> values;
+	};
+
+	/**
+	 * @brief Evaluates func at N points of [lo, hi] into a lookup_table.
+	 * @tparam N Number of samples.
+	 * @tparam Grid Placement of the samples.
+	 * @param func Callable taking and returning T. Must be constexpr callable when the table is a constant.
+	 * @param lo Lower end of the range.
+	 * @param hi Upper end of the range, greater than lo.
+	 * @return The table.
+	 */
+	template <std::size_t N, table_grid Grid = table_grid::eUniform, typename T, typename F, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr lookup_table<T, N, Grid> make_table(F func, T lo, T hi)
+	{
+		lookup_table<T, N, Grid> table{};
+		table.lo = lo;
+		table.hi = hi;
+
+		const T span = hi - lo;
+		if constexpr (Grid == table_grid::eUniform) { table.scale = static_cast<T>(N - 1) / span; }
+
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			T x{};
+			if constexpr (Grid == table_grid::eUniform) { x = lo + span * (static_cast<T>(i) / static_cast<T>(N - 1)); }
+			else
+			{
+				const double c = support::helpers::cos_pi(static_cast<double>(i) / static_cast<double>(N - 1));
+				x			   = lo + span * static_cast<T>(0.5 * (1.0 - c));
+			}
+
+			// The endpoints are sampled exactly, whatever the rounding of the grid.
+			if (i == 0) { x = lo; }
+			if (i == N - 1) { x = hi; }
+			if constexpr (Grid == table_grid::eChebyshev) { table.nodes[i] = x; }
+
+			table.values[i] = static_cast<T>(func(x));
+		}
+		return table;
+	}
+
+	/**
+	 * @brief Evaluates the function Func at N points of [lo, hi] into a lookup_table.
+	 * @tparam Func Pointer to a function taking and returning T, e.g. &ccm::expf.
+	 * @tparam N Number of samples.
+	 * @tparam Grid Placement of the samples.
+	 * @param lo Lower end of the range.
+	 * @param hi Upper end of the range, greater than lo.
+	 * @return The table.
+	 */
+	template <auto Func, std::size_t N, table_grid Grid = table_grid::eUniform, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr lookup_table<T, N, Grid> make_table(T lo, T hi)
+	{
+		return make_table<N, Grid>(Func, lo, hi);
+	}
+
+	namespace detail
+	{
+		// Splits a position in a uniform table of N samples into the sample index i in [0, N - 2] and the offset t in
+		// [0, 1]. A NaN position gives a NaN t, so the interpolation propagates it.
+		template <std::size_t N, typename T>
+		constexpr void table_locate(T position, std::size_t & i, T & t) noexcept
+		{
+			if (position != position) // NOLINT(misc-redundant-expression)
+			{
+				i = 0;
+				t = position;
+				return;
+			}
+
+			if (!(position > static_cast<T>(0))) { position = static_cast<T>(0); }
+			if (position > static_cast<T>(N - 1)) { position = static_cast<T>(N - 1); }
+
+			i = static_cast<std::size_t>(position);
+			if (i > N - 2) { i = N - 2; }
+			t = position - static_cast<T>(i);
+		}
+
+		// The samples around index i. Past the ends of the table the samples are extrapolated with the parabola through
+		// the last three, which keeps the cubic error of the interior; a straight line would make the end intervals
+		// the least accurate by far.
+		template <typename T, std::size_t N>
+		constexpr std::array<T, 4> table_neighbours(lookup_table<T, N, table_grid::eUniform> const & table, std::size_t i) noexcept
+		{
+			const auto & v = table.values;
+			if constexpr (N == 2) { return {static_cast<T>(2) * v[0] - v[1], v[0], v[1], static_cast<T>(2) * v[1] - v[0]}; }
+			else
+			{
+				const T y0 = i > 0 ? v[i - 1] : static_cast<T>(3) * (v[0] - v[1]) + v[2];
+				const T y3 = i + 2 < N ? v[i + 2] : static_cast<T>(3) * (v[N - 1] - v[N - 2]) + v[N - 3];
+				return {y0, v[i], v[i + 1], y3};
+			}
+		}
+
+		// Barycentric weight of sample j of a Chebyshev-Lobatto grid.
+		template <typename T, std::size_t N>
+		constexpr T chebyshev_weight(std::size_t j) noexcept
+		{
+			const T sign = (j % 2 == 0) ? static_cast<T>(1) : static_cast<T>(-1);
+			return (j == 0 || j == N - 1) ? sign * static_cast<T>(0.5) : sign;
+		}
+
+		// The sample of the Chebyshev node closest to x. Used when x is so close to a node that the barycentric terms
+		// overflow, where the interpolant equals that sample to working precision.
+		template <typename T, std::size_t N>
+		constexpr T chebyshev_nearest_value(lookup_table<T, N, table_grid::eChebyshev> const & table, T x) noexcept
+		{
+			std::size_t nearest = 0;
+			T distance			= x > table.nodes[0] ? x - table.nodes[0] : table.nodes[0] - x;
+			for (std::size_t j = 1; j < N; ++j)
+			{
+				const T d = x > table.nodes[j] ? x - table.nodes[j] : table.nodes[j] - x;
+				if (d < distance)
+				{
+					nearest	 = j;
+					distance = d;
+				}
+			}
+			return table.values[nearest];
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Reads a lookup_table at x.
+	 * @tparam Interp Interpolation between the samples of a uniform table. Ignored for Chebyshev tables.
+	 * @param table The table.
+	 * @param x The input. Values outside [lo, hi] are clamped.
+	 * @return The interpolated value, or NaN if x is NaN.
+	 */
+	template <table_interpolation Interp = table_interpolation::eLinear, typename T, std::size_t N, table_grid Grid>
+	constexpr T table_interp(lookup_table<T, N, Grid> const & table, T x) noexcept
+	{
+		if constexpr (Grid == table_grid::eUniform)
+		{
+			std::size_t i = 0;
+			T t{};
+			detail::table_locate<N>((x - table.lo) * table.scale, i, t);
+
+			if constexpr (Interp == table_interpolation::eLinear) { return ext::mix(table.values[i], table.values[i + 1], t); }
+			else
+			{
+				const std::array<T, 4> y = detail::table_neighbours(table, i);
+				return ext::catmull_rom(y[0], y[1], y[2], y[3], t);
+			}
+		}
+		else
+		{
+			if (x != x) { return x; } // NOLINT(misc-redundant-expression)
+			if (x < table.lo) { x = table.lo; }
+			if (x > table.hi) { x = table.hi; }
+
+			T numerator{};
+			T denominator{};
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				const T d = x - table.nodes[j];
+				const T w = detail::chebyshev_weight<T, N>(j);
+
+				// x is the node, or close enough for w / d to overflow. |w| is at most 1.
+				const T limit = (w < static_cast<T>(0) ? -w : w) * std::numeric_limits<T>::min();
+				if (d < limit && -d < limit) { return table.values[j]; }
+
+				const T q = w / d;
+				numerator += q * table.values[j];
+				denominator += q;
+			}
+
+			// Only a subnormal distance to a node makes the sums overflow, where the nearest sample is the result.
+			const T result = numerator / denominator;
+			if (result - result != static_cast<T>(0)) { return detail::chebyshev_nearest_value(table, x); }
+			return result;
+		}
+	}
+
+	/**
+	 * @brief Reads a lookup_table at count inputs.
+	 *
+	 * Chebyshev tables evaluate the barycentric sums for native_simd<T>::size() inputs at a time. Uniform tables are
+	 * bound by the two or four loads per input, for which there is no portable gather, and run the scalar lookup in a
+	 * plain loop; staging the lanes through memory for the vector arithmetic was measured to be twice as slow.
+	 * @tparam Interp Interpolation between the samples of a uniform table. Ignored for Chebyshev tables.
+	 * @param table The table.
+	 * @param x The inputs.
+	 * @param out Destination with room for count values. May alias x.
+	 * @param count Number of inputs.
+	 */
+	template <table_interpolation Interp = table_interpolation::eLinear, typename T, std::size_t N, table_grid Grid>
+	void table_interp(lookup_table<T, N, Grid> const & table, T const * x, T * out, std::size_t count) noexcept
+	{
+		std::size_t i = 0;
+		if constexpr (Grid == table_grid::eChebyshev)
+		{
+			using simd_type				= detail::table_simd_t<T>;
+			constexpr std::size_t width = simd_type::size();
+			constexpr auto tag			= intrin::element_aligned_tag();
+
+			for (; i + width <= count; i += width)
+			{
+				std::array<T, width> lanes{};
+				for (std::size_t lane = 0; lane < width; ++lane)
+				{
+					T v = x[i + lane];
+					if (v < table.lo) { v = table.lo; }
+					if (v > table.hi) { v = table.hi; }
+					lanes[lane] = v;
+				}
+
+				const simd_type xv(lanes.data(), tag);
+				simd_type numerator(static_cast<T>(0));
+				simd_type denominator(static_cast<T>(0));
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					const simd_type q = simd_type(detail::chebyshev_weight<T, N>(j)) / (xv - simd_type(table.nodes[j]));
+					numerator		  = numerator + q * simd_type(table.values[j]);
+					denominator		  = denominator + q;
+				}
+
+				std::array<T, width> result{};
+				(numerator / denominator).copy_to(result.data(), tag);
+				for (std::size_t lane = 0; lane < width; ++lane)
+				{
+					// A lane at or next to a sample divided by zero or overflowed; NaN inputs also end up here and stay NaN.
+					if (result[lane] - result[lane] != static_cast<T>(0)) { result[lane] = table_interp<Interp>(table, x[i + lane]); }
+				}
+				for (std::size_t lane = 0; lane < width; ++lane) { out[i + lane] = result[lane]; }
+			}
+		}
+
+		for (; i < count; ++i) { out[i] = table_interp<Interp>(table, x[i]); }
+	}
+
+	/**
+	 * @brief Reads a lookup_table at every element of a contiguous container.
+	 * @tparam Interp Interpolation between the samples of a uniform table. Ignored for Chebyshev tables.
+	 * @param table The table.
+	 * @param x The inputs.
+	 * @param out Destination of the same size as x.
+	 */
+	template <table_interpolation Interp = table_interpolation::eLinear, typename T, std::size_t N, table_grid Grid, typename In, typename Out,
+			  typename = decltype(std::declval<In const &>().data()), typename = decltype(std::declval<Out &>().data())>
+	void table_interp(lookup_table<T, N, Grid> const & table, In const & x, Out & out) noexcept
+	{
+		table_interp<Interp>(table, x.data(), out.data(), static_cast<std::size_t>(x.size()));
+	}
+} // namespace ccm::ext
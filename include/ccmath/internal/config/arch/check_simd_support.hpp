@@ -19,9 +19,15 @@
  * 			- SSE4.2
  * 			- AVX
  * 			- AVX2
+ * 			- AVX-512 F, VL, DQ, BW and FP16
+ * 			- FMA, F16C and BMI2
  *
  * 		ARM:
  * 			- NEON
+ * 			- SVE
+ *
+ * There are no AVX-512 or SVE simd ABIs yet. Their macros record what the target supports, native_simd stays on AVX2
+ * and NEON (or vector_size for SVE) until the ABIs exist.
  */
 
 #pragma once
@@ -92,6 +98,46 @@
 		#define CCMATH_HAS_SIMD_AVX2 1
 	#endif
 
+// AVX-512 Foundation (AVX-512F)
+	#if defined(__AVX512F__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512F)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512F 1
+	#endif
+
+// AVX-512 Vector Length (AVX-512VL)
+	#if defined(__AVX512VL__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512VL)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512VL 1
+	#endif
+
+// AVX-512 Doubleword and Quadword (AVX-512DQ)
+	#if defined(__AVX512DQ__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512DQ)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512DQ 1
+	#endif
+
+// AVX-512 Byte and Word (AVX-512BW)
+	#if defined(__AVX512BW__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512BW)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512BW 1
+	#endif
+
+// AVX-512 Half Precision (AVX-512FP16)
+	#if defined(__AVX512FP16__) || defined(CCM_CONFIG_RT_SIMD_HAS_AVX512FP16)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_AVX512FP16 1
+	#endif
+
 // FMA (Fused Multiply-Add) Extensions
 	#if defined(__FMA__) || defined(CCM_CONFIG_RT_SIMD_HAS_FMA)
 		#ifndef CCMATH_HAS_SIMD
@@ -100,6 +146,22 @@
 		#define CCMATH_HAS_SIMD_FMA 1
 	#endif
 
+// 16-bit Floating-Point Conversion (F16C)
+	#if defined(__F16C__) || defined(CCM_CONFIG_RT_SIMD_HAS_F16C)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_F16C 1
+	#endif
+
+// Bit Manipulation Instruction Set 2 (BMI2)
+	#if defined(__BMI2__) || defined(CCM_CONFIG_RT_SIMD_HAS_BMI2)
+		#ifndef CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
+		#endif
+		#define CCMATH_HAS_SIMD_BMI2 1
+	#endif
+
 // Intel Short Vector Math Library (SVML)
 // As far as I am aware, there is no reliable way to detect SVML support at compile-time.
 	#if defined(CCM_CONFIG_RT_SIMD_HAS_SVML)
@@ -120,12 +182,10 @@
 
 
 // ARM Scalable Vector Extension (SVE)
-/* TODO: At some point add proper SVE support.
-	#if defined(__ARM_FEATURE_SVE)
+	#if defined(__ARM_FEATURE_SVE) || defined(CCM_CONFIG_RT_SIMD_HAS_SVE)
 		#ifndef CCMATH_HAS_SIMD
-			#define CCMATH_HAS_SIMD
+			#define CCMATH_HAS_SIMD 1
 		#endif
 		#define CCMATH_HAS_SIMD_SVE 1
 	#endif
- */
 #endif // CCM_CONFIG_USE_RT_SIMD
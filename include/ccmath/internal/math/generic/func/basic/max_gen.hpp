@@ -42,6 +42,9 @@ namespace ccm
 			if (CCM_UNLIKELY(x_is_nan)) { return y; }
 
 			if (CCM_UNLIKELY(y_is_nan)) { return x; }
+
+			// +0 is the larger zero, whatever the order of the arguments.
+			if (x == y) { return x_bits.is_neg() ? y : x; }
 		}
 
 		return (x > y) ? x : y;
@@ -39,6 +39,9 @@ namespace ccm
 
 			if (CCM_UNLIKELY(x_is_nan)) { return y; }
 			if (CCM_UNLIKELY(y_is_nan)) { return x; }
+
+			// -0 is the smaller zero, whatever the order of the arguments.
+			if (x == y) { return x_bits.is_neg() ? x : y; }
 		}
 
 		return (x < y) ? x : y;
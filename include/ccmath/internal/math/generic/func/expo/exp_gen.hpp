@@ -10,34 +10,176 @@
 
 #pragma once
 
-#include "ccmath/internal/support/floating_point_traits.hpp"
-#include "ccmath/internal/support/fp/bit_mask_traits.hpp"
-#include "ccmath/internal/support/fp/directional_rounding_utils.hpp"
+#include "ccmath/internal/math/runtime/simd/func/ldexp.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
-#include "ccmath/internal/support/unreachable.hpp"
-#include "ccmath/internal/types/big_int.hpp"
-#include "ccmath/math/basic/fabs.hpp"
-#include "ccmath/math/compare/isnan.hpp"
-#include "ccmath/math/power/sqrt.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/internal/types/sign.hpp"
 
-#include <limits>
+#include <type_traits>
+
+/*
+ * Exponential of a double-double argument after fdlibm's exp, for the vector lanes and the special functions.
+ *
+ * x is reduced to r = x - k * ln2 with |r| <= ln2 / 2, using a two part ln2 so that the high part of the product is
+ * exact. exp(r) comes from fdlibm's rational form 1 + 2r / (R(r^2) - r), where R is a polynomial of degree 5 (2 for
+ * float), and the result is scaled by 2^k. The result is within 1 ulp.
+ *
+ * internal::exp_reduce also takes a low part of its argument, so callers that hold x as a double-double value, such as
+ * exp(-x^2) in erfc or exp(lgamma) in tgamma, lose no accuracy to rounding x first. It is plain arithmetic on a lane
+ * type and runs unchanged on intrin::simd lanes, which the table driven kernels of ccm::exp cannot. A plain scalar exp
+ * is ccm::exp.
+ */
 
 namespace ccm::gen
 {
-   namespace internal::impl
-   {
-
-	   template <typename T>
-	   constexpr std::enable_if_t<std::is_floating_point_v<T>, T> exp_impl(T x, T y) noexcept
-	   {
-
-		   return 0;
-	   }
-   } // namespace internal::impl
-
-   template <typename T>
-   constexpr std::enable_if_t<std::is_floating_point_v<T>, T> exp_gen(T base, T exp) noexcept
-   {
-	   return internal::impl::exp_impl(base, exp);
-   }
+	namespace internal
+	{
+		template <typename T>
+		struct exp_constants;
+
+		template <>
+		struct exp_constants<float>
+		{
+			static constexpr float inv_ln2 = 0x1.715476p+0F;
+			// ln2_hi has 16 significant bits, so k * ln2_hi is exact for every k that does not overflow.
+			static constexpr float ln2_hi = 0x1.62e4p-1F;
+			static constexpr float ln2_lo = 0x1.7f7d1cp-20F;
+			// ln2 rounded to float and the rest, for products with ln2 to twice the precision.
+			static constexpr float ln2 = 0x1.62e43p-1F;
+			static constexpr float ln2_tail = -0x1.05c61p-29F;
+			// Adding and subtracting 1.5 * 2^23 rounds to an integer.
+			static constexpr float shift = 0x1.8p+23F;
+
+			static constexpr float P1 = 1.6666625440e-1F;
+			static constexpr float P2 = -2.7667332906e-3F;
+
+			// exp overflows above max_arg and is below half the smallest subnormal under min_arg.
+			static constexpr float max_arg = 0x1.62e42ep+6F;
+			static constexpr float min_arg = -0x1.9fe368p+6F;
+			// Clamping arguments to [clamp_lo, clamp_hi] keeps k small enough for ldexp and still rounds to 0 or inf.
+			static constexpr float clamp_lo = -104.0F;
+			static constexpr float clamp_hi = 89.0F;
+		};
+
+		template <>
+		struct exp_constants<double>
+		{
+			static constexpr double inv_ln2 = 0x1.71547652b82fep+0;
+			// ln2_hi has 32 significant bits, so k * ln2_hi is exact for every k that does not overflow.
+			static constexpr double ln2_hi = 0x1.62e42feep-1;
+			static constexpr double ln2_lo = 0x1.a39ef35793c76p-33;
+			// ln2 rounded to double and the rest, for products with ln2 to twice the precision.
+			static constexpr double ln2 = 0x1.62e42fefa39efp-1;
+			static constexpr double ln2_tail = 0x1.abc9e3b39803fp-56;
+			// Adding and subtracting 1.5 * 2^52 rounds to an integer.
+			static constexpr double shift = 0x1.8p+52;
+
+			static constexpr double P1 = 1.66666666666666019037e-01;
+			static constexpr double P2 = -2.77777777770155933842e-03;
+			static constexpr double P3 = 6.61375632143793436117e-05;
+			static constexpr double P4 = -1.65339022054652515390e-06;
+			static constexpr double P5 = 4.13813679705723846039e-08;
+
+			static constexpr double max_arg	 = 0x1.62e42fefa39efp+9;
+			static constexpr double min_arg	 = -0x1.74910d52d3052p+9;
+			static constexpr double clamp_lo = -746.0;
+			static constexpr double clamp_hi = 710.0;
+		};
+
+		/// The polynomial R(z) / z of fdlibm's exp, for z = r^2.
+		template <typename Lane>
+		constexpr Lane exp_poly(Lane z) noexcept
+		{
+			using constants = exp_constants<type::detail::lane_value_t<Lane>>;
+
+			if constexpr (std::is_same_v<type::detail::lane_value_t<Lane>, float>) { return constants::P1 + z * constants::P2; }
+			else { return constants::P1 + z * (constants::P2 + z * (constants::P3 + z * (constants::P4 + z * constants::P5))); }
+		}
+
+		/**
+		 * @brief exp(hi + lo) / 2^k - 1, with k = round((hi + lo) / ln2) stored as an integral value of the lane type.
+		 * @tparam Lane float, double or an intrin::simd of either.
+		 * @param hi Argument, within the clamp range of exp_constants.
+		 * @param lo Low part of the argument, much smaller than ulp(hi). Zero for a plain exp.
+		 * @return A value in [sqrt(1/2) - 1, sqrt(2) - 1]. Callers that multiply the result by some y save a rounding
+		 * by computing y + y * m instead of y * (1 + m).
+		 */
+		template <typename Lane>
+		constexpr Lane exp_reduce_m1(Lane hi, Lane lo, Lane & k) noexcept
+		{
+			using T			= type::detail::lane_value_t<Lane>;
+			using constants = exp_constants<T>;
+
+			k				= (hi * constants::inv_ln2 + constants::shift) - constants::shift;
+			const Lane r_hi = hi - k * constants::ln2_hi;
+			const Lane r_lo = k * constants::ln2_lo - lo;
+			const Lane r	= r_hi - r_lo;
+			const Lane z	= r * r;
+			const Lane c	= r - z * exp_poly(z);
+			return r_hi - (r_lo - (r * c) / (T(2) - c));
+		}
+
+		/// exp(hi + lo) / 2^k, see exp_reduce_m1.
+		template <typename Lane>
+		constexpr Lane exp_reduce(Lane hi, Lane lo, Lane & k) noexcept
+		{
+			using T = type::detail::lane_value_t<Lane>;
+
+			return T(1) + exp_reduce_m1(hi, lo, k);
+		}
+
+		/**
+		 * @brief y * 2^k for an integral k, rounded once.
+		 *
+		 * Same steps as intrin::ldexp: k is brought into the normal exponent range by at most two exact scalings first.
+		 */
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		constexpr T exp_scale(T y, T k) noexcept
+		{
+			using FPBits_t	   = support::fp::FPBits<T>;
+			constexpr int emax = FPBits_t::exponent_bias;
+			constexpr int emin = 1 - FPBits_t::exponent_bias;
+			constexpr int down = emin + FPBits_t::fraction_length + 1;
+
+			auto pow2 = [](int n) { return FPBits_t::create_value(types::Sign::POS, static_cast<typename FPBits_t::storage_type>(n + emax), 0).get_val(); };
+
+			int n = static_cast<int>(k);
+			for (int step = 0; step < 2; ++step)
+			{
+				if (n > emax)
+				{
+					y *= pow2(emax);
+					n -= emax;
+				}
+				else if (n < emin)
+				{
+					y *= pow2(down);
+					n -= down;
+				}
+			}
+			if (n > emax) { n = emax; }
+			if (n < emin) { n = emin; }
+			return y * pow2(n);
+		}
+
+		/// Same as exp_scale, on vector lanes.
+		template <typename T, typename Abi>
+		intrin::simd<T, Abi> exp_scale(intrin::simd<T, Abi> const & y, intrin::simd<T, Abi> const & k) noexcept
+		{
+			return intrin::ldexp(y, k);
+		}
+
+		/// exp(hi + lo) for a double-double argument. Arguments outside the clamp range give inf or 0.
+		template <typename T>
+		constexpr T exp_dd(T hi, T lo) noexcept
+		{
+			using constants = exp_constants<T>;
+
+			if (hi > constants::clamp_hi) { hi = constants::clamp_hi; }
+			if (hi < constants::clamp_lo) { hi = constants::clamp_lo; }
+			T k		  = 0;
+			const T y = exp_reduce(hi, lo, k);
+			return exp_scale(y, k);
+		}
+	} // namespace internal
 } // namespace ccm::gen
@@ -10,56 +10,136 @@
 
 #pragma once
 
-#include "ccmath/internal/support/floating_point_traits.hpp"
-#include "ccmath/internal/support/fp/bit_mask_traits.hpp"
-#include "ccmath/internal/support/fp/directional_rounding_utils.hpp"
+#include "ccmath/internal/math/generic/func/fmanip/frexp_gen.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
-#include "ccmath/internal/support/unreachable.hpp"
-#include "ccmath/internal/types/big_int.hpp"
-#include "ccmath/math/basic/fabs.hpp"
-#include "ccmath/math/compare/isnan.hpp"
-#include "ccmath/math/power/sqrt.hpp"
+#include "ccmath/internal/types/double_double.hpp"
 
-#include <limits>
+#include <type_traits>
 
-// TODO: Do something with this.
+/*
+ * Natural logarithm as a double-double value after fdlibm's log, for the vector lanes and the special functions.
+ *
+ * x is split into 2^k * m with m in [sqrt(1/2), sqrt(2)), and log(m) = log(1 + f) is evaluated as
+ * f - f^2 / 2 + s * (f^2 / 2 + R(s^2)) with s = f / (2 + f) and R a polynomial of degree 7 (4 for float).
+ *
+ * internal::log_reduced keeps the result as a double-double value: f^2 / 2, the subtraction and the addition of
+ * k * ln2 are carried out exactly, which leaves about 59 correct bits for double. The gamma functions need that much to
+ * subtract logarithms of nearly equal size, and the vector log adds the two parts. It is plain arithmetic on a lane type
+ * and runs unchanged on intrin::simd lanes, which the table driven kernels of ccm::log cannot. A plain scalar log is
+ * ccm::log.
+ */
 
 namespace ccm::gen
 {
-	namespace internal::impl
+	namespace internal
 	{
-		constexpr float log_impl([[maybe_unused]] float num) noexcept
-		{
-			//constexpr double ln2 = 0x1.62e42fefa39efp-1;
-			//using FPBits_t = typename support::fp::FPBits<float>;
-
-			//FPBits_t num_bits(num);
-
-			//std::uint32_t num_bits_storage = num_bits.uintval();
-
-			//int m = -FPBits_t::exponent_bias;
-
+		template <typename T>
+		struct log_constants;
 
-
-			return 0;
+		template <>
+		struct log_constants<float>
+		{
+			static constexpr float ln2_hi	 = 0x1.62e3p-1F;
+			static constexpr float ln2_lo	 = 0x1.2fefa2p-17F;
+			static constexpr float sqrt_half = 0x1.6a09e6p-1F;
+
+			static constexpr float Lg1 = 0xaaaaaa.0p-24F;
+			static constexpr float Lg2 = 0xccce13.0p-25F;
+			static constexpr float Lg3 = 0x91e9ee.0p-25F;
+			static constexpr float Lg4 = 0xf89e26.0p-26F;
+		};
+
+		template <>
+		struct log_constants<double>
+		{
+			static constexpr double ln2_hi	  = 6.93147180369123816490e-01;
+			static constexpr double ln2_lo	  = 1.90821492927058770002e-10;
+			static constexpr double sqrt_half = 0x1.6a09e667f3bcdp-1;
+
+			static constexpr double Lg1 = 6.666666666666735130e-01;
+			static constexpr double Lg2 = 3.999999999940941908e-01;
+			static constexpr double Lg3 = 2.857142874366239149e-01;
+			static constexpr double Lg4 = 2.222219843214978396e-01;
+			static constexpr double Lg5 = 1.818357216161805012e-01;
+			static constexpr double Lg6 = 1.531383769920937332e-01;
+			static constexpr double Lg7 = 1.479819860511658591e-01;
+		};
+
+		/// The polynomial R(z) of fdlibm's log, for z = s^2.
+		template <typename Lane>
+		constexpr Lane log_poly(Lane z) noexcept
+		{
+			using constants = log_constants<type::detail::lane_value_t<Lane>>;
+
+			const Lane w = z * z;
+			if constexpr (std::is_same_v<type::detail::lane_value_t<Lane>, float>)
+			{
+				return z * (constants::Lg1 + w * constants::Lg3) + w * (constants::Lg2 + w * constants::Lg4);
+			}
+			else
+			{
+				const Lane t1 = w * (constants::Lg2 + w * (constants::Lg4 + w * constants::Lg6));
+				const Lane t2 = z * (constants::Lg1 + w * (constants::Lg3 + w * (constants::Lg5 + w * constants::Lg7)));
+				return t2 + t1;
+			}
 		}
 
-		constexpr double log_impl([[maybe_unused]] double num) noexcept
+		/**
+		 * @brief log(1 + f) + k * ln2 as a double-double value.
+		 * @tparam Lane float, double or an intrin::simd of either.
+		 * @param f m - 1 for an m in [sqrt(1/2), sqrt(2)).
+		 * @param k An integral value of the lane type.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> log_reduced(Lane f, Lane k) noexcept
 		{
-			return 0;
+			using T			= type::detail::lane_value_t<Lane>;
+			using constants = log_constants<T>;
+
+			const Lane s = f / (T(2) + f);
+			const Lane R = log_poly(s * s);
+
+			// f^2 / 2 is exact as a pair, and f - hfsq needs no comparison because |f| > f^2 / 2.
+			const auto ff	= type::exact_mult(f, f);
+			const Lane hfsq = T(0.5) * ff.hi;
+			const auto t	= type::exact_add(f, -hfsq);
+			const auto u	= type::two_sum(k * constants::ln2_hi, t.hi);
+			const Lane lo	= ((t.lo - T(0.5) * ff.lo) + s * (hfsq + R)) + (k * constants::ln2_lo + u.lo);
+			return type::exact_add(u.hi, lo);
 		}
 
-		constexpr long double log_impl([[maybe_unused]] long double num) noexcept
+		/// Splits a positive finite x into m - 1 with m in [sqrt(1/2), sqrt(2)) and the power of two k.
+		template <typename T>
+		constexpr T log_split(T x, T & k) noexcept
 		{
-			return 0;
+			using FPBits_t = support::fp::FPBits<T>;
+
+			int e = 0;
+			if (FPBits_t(x).is_subnormal())
+			{
+				x *= subnormal_scale<T>();
+				e -= FPBits_t::fraction_length + 1;
+			}
+			FPBits_t bits(x);
+			e += bits.get_exponent() + 1;
+			bits.set_biased_exponent(FPBits_t::exponent_bias - 1);
+			T m = bits.get_val();
+			if (m < log_constants<T>::sqrt_half)
+			{
+				m += m;
+				--e;
+			}
+			k = static_cast<T>(e);
+			return m - T(1);
 		}
 
-
-	} // namespace internal::impl
-
-	template <typename T>
-	constexpr std::enable_if_t<std::is_floating_point_v<T>, T> log_gen(T base, T exp) noexcept
-	{
-		return internal::impl::log_impl(base, exp);
-	}
+		/// log(x) as a double-double value for a positive finite x.
+		template <typename T>
+		constexpr type::BasicDoubleDouble<T> log_dd(T x) noexcept
+		{
+			T k		  = 0;
+			const T f = log_split(x, k);
+			return log_reduced(f, k);
+		}
+	} // namespace internal
 } // namespace ccm::gen
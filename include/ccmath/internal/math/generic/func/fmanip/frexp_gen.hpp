@@ -12,21 +12,50 @@
 
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 
-// TODO: Finish implementing.
+#include <type_traits>
 
-namespace ccm
+namespace ccm::gen
 {
-	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
-constexpr T frexp(T x, int &exp) {
-		support::fp::FPBits<T> bits(x);
-		if (bits.is_inf_or_nan()) {
-			return x;
-}
-		if (bits.is_zero()) {
+	namespace internal
+	{
+		/// 2^(fraction_length + 1), which takes every subnormal T to a normal number.
+		template <typename T>
+		constexpr T subnormal_scale() noexcept
+		{
+			T scale = 1;
+			for (int i = 0; i <= support::fp::FPBits<T>::fraction_length; ++i) { scale *= 2; }
+			return scale;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Splits x into a mantissa in [0.5, 1) and a power of two, reading the exponent field directly.
+	 * @param x Floating-point value.
+	 * @param exp Receives the power of two. Zero for ±0, ±inf and NaN.
+	 * @return The mantissa with the sign of x, or x itself for ±0, ±inf and NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T frexp_gen(T x, int & exp) noexcept
+	{
+		using FPBits_t = support::fp::FPBits<T>;
+
+		FPBits_t bits(x);
+		if (bits.is_inf_or_nan() || bits.is_zero())
+		{
 			exp = 0;
 			return x;
 		}
 
-	}
+		int offset = 0;
+		if (bits.is_subnormal())
+		{
+			constexpr T scale = internal::subnormal_scale<T>();
+			bits			  = FPBits_t(x * scale);
+			offset			  = FPBits_t::fraction_length + 1;
+		}
 
-} // namespace ccm
+		exp = bits.get_exponent() + 1 - offset;
+		bits.set_biased_exponent(FPBits_t::exponent_bias - 1);
+		return bits.get_val();
+	}
+} // namespace ccm::gen
@@ -10,7 +10,50 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/fmanip/frexp_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <climits>
+#include <cmath>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/// Unbiased exponent of a finite nonzero x, as if x were normalized.
+		template <typename T>
+		constexpr int unbiased_exponent(T x) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<T>;
+
+			const FPBits_t bits(x);
+			if (bits.is_subnormal())
+			{
+				constexpr T scale = subnormal_scale<T>();
+				return FPBits_t(x * scale).get_exponent() - (FPBits_t::fraction_length + 1);
+			}
+			return bits.get_exponent();
+		}
+	} // namespace internal
 
-} // namespace ccm
+	/**
+	 * @brief Unbiased exponent of x as an int.
+	 * @return FP_ILOGB0 for ±0, FP_ILOGBNAN for NaN and INT_MAX for ±inf, each reported as a domain error.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr int ilogb_gen(T x) noexcept
+	{
+		const support::fp::FPBits<T> bits(x);
+		if (CCM_UNLIKELY(bits.is_zero() || bits.is_inf_or_nan()))
+		{
+			support::fenv::set_errno_if_required(EDOM);
+			support::fenv::raise_except_if_required(FE_INVALID);
+			if (bits.is_zero()) { return FP_ILOGB0; }
+			return bits.is_nan() ? FP_ILOGBNAN : INT_MAX;
+		}
+		return internal::unbiased_exponent(x);
+	}
+} // namespace ccm::gen
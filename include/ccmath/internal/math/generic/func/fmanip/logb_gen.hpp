@@ -10,7 +10,33 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/fmanip/ilogb_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/sign.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Unbiased exponent of x as a floating-point value.
+	 * @return -inf for ±0 (a pole error), +inf for ±inf and NaN for NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T logb_gen(T x) noexcept
+	{
+		using FPBits_t = support::fp::FPBits<T>;
 
-} // namespace ccm
+		const FPBits_t bits(x);
+		if (CCM_UNLIKELY(bits.is_zero()))
+		{
+			support::fenv::set_errno_if_required(ERANGE);
+			support::fenv::raise_except_if_required(FE_DIVBYZERO);
+			return FPBits_t::inf(types::Sign::NEG).get_val();
+		}
+		if (CCM_UNLIKELY(bits.is_inf_or_nan())) { return bits.is_nan() ? x : FPBits_t::inf().get_val(); }
+		return static_cast<T>(internal::unbiased_exponent(x));
+	}
+} // namespace ccm::gen
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <type_traits>
+
+/*
+ * Error function and complementary error function.
+ *
+ * For |x| < 0.84375, erf(x) = x + x * P(x^2) with P of degree 10, and erfc(x) = 1 - erf(x) for |x| < 0.5. Further out
+ * erfc(x) = exp(-x^2) * F(t) / (1 + 2x) with t = (x - 3.75) / (x + 3.75) and F of degree 20, fitted on [0.5, 28].
+ * F only varies between 1.13 and 1.26 there, so it is stored as 1.125 plus a correction. The quotient gets one
+ * correction step, and x^2 goes into exp as a double-double value, so only a handful of roundings reach the result.
+ * erf(x) = 1 - erfc(x) for |x| >= 0.84375 and erfc(-x) = 2 - erfc(x). erf is within 1 ulp and erfc within 2.5 ulp.
+ *
+ * Everything is computed in double. float and long double arguments are converted. The kernels are plain arithmetic
+ * on a lane type, so the vector erf and erfc run the same steps on intrin::simd<double> lanes and give the same results.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		struct erf_constants
+		{
+			// erf_small is used below small_limit, and erfc = 1 - erf_small below erfc_small_limit.
+			static constexpr double small_limit		 = 0.84375;
+			static constexpr double erfc_small_limit = 0.5;
+			// erf(x) rounds to ±1 and erfc(-x) to 2 from one_limit on, erfc(x) rounds to 0 above erfc_max.
+			static constexpr double one_limit = 6.0;
+			static constexpr double erfc_max  = 0x1.b39dc41e48bfcp+4;
+
+			// erf(x) / x - 1 in x^2 on [0, 0.84375^2], highest degree first.
+			static constexpr double small[] = {
+				0x1.708feb8d6dc51p-27, -0x1.517729425b5acp-23, 0x1.b847241337b55p-20, -0x1.f4b40c5d47a5cp-17,
+				0x1.f9a1b946d0901p-14, -0x1.c02da8e51a74cp-11, 0x1.565bccd877f16p-8,  -0x1.b82ce31156813p-6,
+				0x1.ce2f21a03f41cp-4,  -0x1.812746b0379a7p-2,  0x1.06eba8214db68p-3,
+			};
+
+			static constexpr double tail_shift = 3.75;
+			static constexpr double tail_base  = 1.125;
+			// (1 + 2x) * exp(x^2) * erfc(x) - tail_base in t = (x - tail_shift) / (x + tail_shift), highest degree first.
+			static constexpr double tail[] = {
+				0x1.b20f18df07352p-26,	0x1.d0284eab55b8dp-27,	-0x1.04338cdc96c7cp-22, -0x1.845ba71ae5d74p-25, 0x1.d3266fe7a1570p-20,
+				-0x1.079e14f447adep-20, -0x1.7fd6ca24d693ep-17, 0x1.779b8abf36806p-16,	0x1.b140d26725c9bp-15,	-0x1.303feb6ffe25ep-12,
+				0x1.33fb37c765daap-12,	0x1.cc3a119143c51p-10,	-0x1.3f603c43ff52dp-7,	0x1.d0b00377f41cbp-6,	-0x1.e0d0fa6dc47b9p-5,
+				0x1.7a14188aafa10p-4,	-0x1.bda9309a29541p-4,	0x1.510169d095e90p-4,	0x1.d5f294815a01bp-9,	-0x1.1f367683f899dp-3,
+				0x1.ccda0b5d5dc28p-4,
+			};
+		};
+
+		/**
+		 * @brief erf(x) for |x| < erf_constants::small_limit.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane erf_small(Lane x) noexcept
+		{
+			return x + x * support::polyeval_array(x * x, erf_constants::small);
+		}
+
+		/**
+		 * @brief erfc(x) for x in [erf_constants::erfc_small_limit, 28].
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane erfc_tail(Lane x) noexcept
+		{
+			using constants = erf_constants;
+
+			const Lane t = (x - constants::tail_shift) / (x + constants::tail_shift);
+			const auto n = type::exact_add(Lane(constants::tail_base), support::polyeval_array(t, constants::tail));
+			const auto d = type::exact_add(x + x, Lane(1.0));
+
+			// n / d, with the remainder of the first quotient folded back in.
+			const Lane q0 = n.hi / d.hi;
+			const auto p  = type::exact_mult(q0, d.hi);
+			const Lane q  = q0 + ((((n.hi - p.hi) - p.lo) + n.lo) - q0 * d.lo) / d.hi;
+
+			// exp(-x^2) = 2^k * (1 + m).
+			const auto xx = type::exact_mult(x, x);
+			Lane k		  = Lane(0.0);
+			const Lane m  = exp_reduce_m1(-xx.hi, -xx.lo, k);
+			return exp_scale(q + q * m, k);
+		}
+
+		constexpr double erf_impl(double x) noexcept
+		{
+			using constants = erf_constants;
+
+			if (x != x) { return x; }
+			const double ax = x < 0 ? -x : x;
+			if (ax < constants::small_limit) { return erf_small(x); }
+			if (ax >= constants::one_limit) { return x < 0 ? -1.0 : 1.0; }
+
+			const double r = 1.0 - erfc_tail(ax);
+			return x < 0 ? -r : r;
+		}
+
+		constexpr double erfc_impl(double x) noexcept
+		{
+			using constants = erf_constants;
+
+			if (x != x) { return x; }
+			if (x <= -constants::one_limit) { return 2.0; }
+			const double ax = x < 0 ? -x : x;
+			if (ax < constants::erfc_small_limit) { return 1.0 - erf_small(x); }
+			if (x < 0) { return 2.0 - erfc_tail(ax); }
+			if (CCM_UNLIKELY(x > constants::erfc_max))
+			{
+				if (x != support::fp::FPBits<double>::inf().get_val())
+				{
+					support::fenv::set_errno_if_required(ERANGE);
+					support::fenv::raise_except_if_required(FE_UNDERFLOW);
+				}
+				return 0.0;
+			}
+			return erfc_tail(x);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Error function of x, within 1 ulp.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T erf_gen(T x) noexcept
+	{
+		return static_cast<T>(internal::erf_impl(static_cast<double>(x)));
+	}
+
+	/**
+	 * @brief Complementary error function of x, 1 - erf(x) without the cancellation, within 2.5 ulp.
+	 * @return +0 when the result underflows, reported as a range error.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T erfc_gen(T x) noexcept
+	{
+		return static_cast<T>(internal::erfc_impl(static_cast<double>(x)));
+	}
+} // namespace ccm::gen
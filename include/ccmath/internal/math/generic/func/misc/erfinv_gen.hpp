@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/generic/func/misc/ndtri_gen.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+/*
+ * Inverse error function and inverse complementary error function.
+ *
+ * erfinv(y) = ndtri((1 + y) / 2) / sqrt(2) and erfcinv(z) = erfinv(1 - z), evaluated with the AS 241 ratios of
+ * ndtri_gen.hpp without forming (1 + y) / 2. The central ratio gets q = y / 2 directly, so small arguments keep all
+ * their bits, and the tails take the log of 1 - |y|, z or 2 - z, which are exact where they are used, minus log 2.
+ * The relative error stays below 1e-15, within 7 ulp.
+ *
+ * Everything is computed in double, and the vector erfinv and erfcinv run the same steps on intrin::simd<double> lanes.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		struct erfinv_constants
+		{
+			// The central ratio is used for |y| <= central_limit, and for |1 - z| <= central_limit in erfcinv.
+			static constexpr double central_limit = 2 * ndtri_constants::central_limit;
+
+			static constexpr double sqrt1_2		 = 0x1.6a09e667f3bcdp-1;
+			static constexpr double half_sqrt1_2 = 0x1.6a09e667f3bcdp-2;
+			static constexpr double ln2			 = 0x1.62e42fefa39efp-1;
+		};
+
+		/// erfinv(d) for |d| <= erfinv_constants::central_limit.
+		template <typename Lane>
+		constexpr Lane erfinv_central(Lane d) noexcept
+		{
+			return d * (ndtri_slope(d * 0.5) * erfinv_constants::half_sqrt1_2);
+		}
+
+		/// Magnitude of erfinv(d) for |d| > erfinv_constants::central_limit, from tail = 1 - |d|.
+		constexpr double erfinv_tail(double tail) noexcept
+		{
+			const auto l = log_dd(tail);
+			return ndtri_tail(erfinv_constants::ln2 - (l.hi + l.lo)) * erfinv_constants::sqrt1_2;
+		}
+
+		constexpr double erfinv_impl(double y) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
+
+			if (y != y) { return y; }
+			const double ay = y < 0 ? -y : y;
+			if (!(ay <= 1.0)) { return FPBits_t::quiet_nan().get_val(); }
+			if (ay == 1.0) { return y * FPBits_t::inf().get_val(); }
+			if (ay <= erfinv_constants::central_limit) { return erfinv_central(y); }
+
+			// 1 - |y| is exact for |y| >= 0.5.
+			const double v = erfinv_tail(1.0 - ay);
+			return y < 0 ? -v : v;
+		}
+
+		constexpr double erfcinv_impl(double z) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
+
+			if (z != z) { return z; }
+			if (!(z >= 0.0 && z <= 2.0)) { return FPBits_t::quiet_nan().get_val(); }
+			if (z == 0.0) { return FPBits_t::inf().get_val(); }
+			if (z == 2.0) { return -FPBits_t::inf().get_val(); }
+
+			const double d = 1.0 - z;
+			if ((d < 0 ? -d : d) <= erfinv_constants::central_limit) { return erfinv_central(d); }
+
+			// 1 - |d| is z itself on the right, and 2 - z, which is exact, on the left.
+			const double v = erfinv_tail(d < 0 ? 2.0 - z : z);
+			return d < 0 ? -v : v;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Inverse error function: the x with erf(x) = y.
+	 * @return ±inf for y = ±1 and NaN outside [-1, 1].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T erfinv_gen(T y) noexcept
+	{
+		return static_cast<T>(internal::erfinv_impl(static_cast<double>(y)));
+	}
+
+	/**
+	 * @brief Inverse complementary error function: the x with erfc(x) = z.
+	 * @return +inf for z = 0, -inf for z = 2 and NaN outside [0, 2].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T erfcinv_gen(T z) noexcept
+	{
+		return static_cast<T>(internal::erfcinv_impl(static_cast<double>(z)));
+	}
+} // namespace ccm::gen
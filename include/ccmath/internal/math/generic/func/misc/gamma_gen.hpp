@@ -0,0 +1,822 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fenv/fenv_support.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <type_traits>
+
+/*
+ * Gamma function and its logarithm.
+ *
+ * For 0 < y < 10, lgamma(y) is shifted into [1, 3) with lgamma(y + 1) = lgamma(y) + log(y), keeping the product of
+ * the shifts as a double-double value, and evaluated there with the rational forms of Boost.Math's lgamma_small_imp.
+ * From 10 on Stirling's series is used, with the correction term fitted as a polynomial in 1/y^2. lgamma is carried as
+ * a double-double value throughout, and tgamma(y) = exp(lgamma(y)) below 10. Above 10 that would lose too much to the
+ * size of lgamma, so tgamma(y) = sqrt(2pi / e) * (y / e)^(y - 1/2) * exp(S(y)) instead, with the integral part of the
+ * power taken by repeated double-double squaring. Negative arguments use the reflection formula with sin(pi * x)
+ * computed as a double-double value from the distance of x to the nearest integer. tgamma reflects a double-double
+ * tgamma(-x) kept apart from its power of 2, so the product does not overflow and the result is rounded once, subnormal
+ * or not. Close to the zeros of lgamma between -16.5 and -2 the reflection subtracts two nearly equal logarithms, and
+ * lgamma is taken from a series around the closest zero instead.
+ *
+ * For positive arguments tgamma is within 1.6 ulp and lgamma within 2 ulp. For negative ones tgamma is within 2 ulp
+ * and lgamma within 3 ulp.
+ *
+ * Everything is computed in double. float and long double arguments are converted. The kernels are plain arithmetic
+ * on a lane type, so the vector tgamma and lgamma run the same steps on intrin::simd<double> lanes.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		struct gamma_constants
+		{
+			// Below tiny_limit, tgamma(x) rounds to 1/x and lgamma(x) to -log|x|.
+			static constexpr double tiny_limit = 0x1.0p-56;
+			// Stirling's series is used from stirling_limit on.
+			static constexpr double stirling_limit = 10.0;
+			// Every double from integral_limit on is an integer.
+			static constexpr double integral_limit		 = 0x1.0p52;
+			static constexpr double below_integral_limit = 0x1.fffffffffffffp+51;
+			// Largest arguments whose tgamma and lgamma do not overflow.
+			static constexpr double tgamma_max = 0x1.573fae561f647p+7;
+			static constexpr double lgamma_max = 0x1.754d9278b51a7p+1014;
+			// Negative arguments down to -reflect_limit reflect tgamma with a scaled tgamma(-x). Beyond it every result
+			// rounds to 0, even next to the poles, and is reached through lgamma.
+			static constexpr double reflect_limit = 190.0;
+
+			static constexpr double pi_hi			= 0x1.921fb54442d18p+1;
+			static constexpr double pi_lo			= 0x1.1a62633145c07p-53;
+			static constexpr double log_pi_hi		= 0x1.250d048e7a1bdp+0;
+			static constexpr double log_pi_lo		= 0x1.7abf2ad8d5088p-57;
+			static constexpr double half_log_2pi_hi = 0x1.d67f1c864beb5p-1;
+			static constexpr double half_log_2pi_lo = -0x1.65b5a1b7ff5dfp-55;
+			static constexpr double inv_e_hi		= 0x1.78b56362cef38p-2;
+			static constexpr double inv_e_lo		= -0x1.ca8a4270fadf5p-57;
+			static constexpr double sqrt_2pi_e_hi	= 0x1.8535745aa7957p+0;
+			static constexpr double sqrt_2pi_e_lo	= -0x1.aa191844fc311p-54;
+
+			// y * S(y) in 1/y^2 on [10, inf), where S(y) is the remainder of Stirling's series. Highest degree first.
+			static constexpr double stirling[] = {
+				-0x1.c84007120f1dbp-10, 0x1.b84da6b7b609ep-11, -0x1.38122c1da5be1p-11,
+				0x1.a01a00d4c8353p-11,	-0x1.6c16c16c0ba33p-9, 0x1.5555555555555p-4,
+			};
+
+			// -pi^3 / 6 to twice the precision, the r^3 coefficient of sin(pi * r).
+			static constexpr double sinpi3_hi = -0x1.4abbce625be53p+2;
+			static constexpr double sinpi3_lo = 0x1.05511c68476a8p-52;
+			// (sin(pi * r) - pi * r + pi^3 * r^3 / 6) / r^5 in r^2 on [0, 1/2], highest degree first.
+			static constexpr double sinpi[] = {
+				-0x1.8117ccaa15750p-26, 0x1.aace8c243d7eep-21, -0x1.6fad87db7bc20p-16, 0x1.e8f43472490a4p-12,
+				-0x1.e3074fde28fd0p-8,	0x1.50783487ee486p-4,  -0x1.32d2cce62bd85p-1,  0x1.466bc6775aae2p+1,
+			};
+
+			// lgamma(z) = r * (near_one_y + P(z - 1) / Q(z - 1)) with r = (z - 1) * (z - 2), on [1, 1.5].
+			static constexpr double near_one_y	 = 0.52815341949462890625;
+			static constexpr double near_one_p[] = {
+				-0.100346687696279557415e-2, -0.240149820648571559892e-1, -0.158413586390692192217e0, -0.406567124211938417342e0,
+				-0.414983358359495381969e0,	 -0.969117530159521214579e-1, 0.490622454069039543534e-1,
+			};
+			static constexpr double near_one_q[] = {
+				0.195768102601107189171e-2, 0.577039722690451849648e-1, 0.507137738614363510846e0, 0.191415588274426679201e1,
+				0.348739585360723852576e1,	0.302349829846463038743e1,	1.0,
+			};
+
+			// lgamma(z) = r * (near_two_y + P(2 - z) / Q(2 - z)) with r = (z - 1) * (z - 2), on (1.5, 2).
+			static constexpr double near_two_y	 = 0.452017307281494140625;
+			static constexpr double near_two_p[] = {
+				0.431171342679297331241e-3, -0.850535976868336437746e-2, 0.542809694055053558157e-1,
+				-0.142440390738631274135e0, 0.144216267757192309184e0,	 -0.292329721830270012337e-1,
+			};
+			static constexpr double near_two_q[] = {
+				-0.827193521891290553639e-6, -0.100666795539143372762e-2, 0.25582797155975869989e-1, -0.220095151814995745555e0,
+				0.846973248876495016101e0,	 -0.150169356054485044494e1,  1.0,
+			};
+
+			// lgamma(z) = r * (two_three_y + P(z - 2) / Q(z - 2)) with r = (z - 2) * (z + 1), on [2, 3).
+			static constexpr double two_three_y	  = 0.158963680267333984375;
+			static constexpr double two_three_p[] = {
+				-0.324588649825948492091e-4, -0.541009869215204396339e-3, -0.259453563205438108893e-3, 0.172491608709613993966e-1,
+				0.494103151567532234274e-1,	 0.25126649619989678683e-1,	  -0.180355685678449379109e-1,
+			};
+			static constexpr double two_three_q[] = {
+				-0.223352763208617092964e-6, 0.224936291922115757597e-3, 0.82130967464889339326e-2, 0.988504251128010129477e-1,
+				0.541391432071720958364e0,	 0.148019669424231326694e1,	 0.196202987197795200688e1, 1.0,
+			};
+		};
+
+		/**
+		 * @brief Expansion of lgamma around one of its zeros x0 below -2.
+		 *
+		 * With x0 between the poles -k - 1 and -k, e = x0 + k and d = x - x0, lgamma(x) = slope * d + d^2 * P(d) -
+		 * log((x + k) / e) - log((x + k + 1) / (e + 1)), where slope and P are the Taylor series of lgamma(x) + log|x + k| +
+		 * log|x + k + 1| at x0. Both poles are in the logarithms, which leaves a series that converges over a distance of
+		 * at least 1 and is taken to degree 20 on |d| <= radius.
+		 */
+		struct lgamma_zero
+		{
+			double offset_hi;
+			double offset_lo;
+			double radius;
+			double slope;
+			// Coefficients of d^20 down to d^2, padded with zeros in front.
+			double poly[19];
+		};
+
+		struct lgamma_zero_constants
+		{
+			// The zeros from the top down. Below -16.5 they are within an ulp of the poles, and the reflection is accurate
+			// at the doubles around them.
+			static constexpr double lower_limit	 = -16.5;
+			static constexpr double upper_limit	 = -2.0;
+			static constexpr int count			 = 29;
+			static constexpr lgamma_zero zeros[] = {
+				// x0 = -2.4570247382208006
+				{-0x1.d3fe4b007c361p-2, 0x1.541360cea0e6p-56, 0x1.c23p-3, 0x1.2b537bebae5d9p+0,
+				 {0x1.294b54399f302p-15, 0x1.cb1c510a408d2p-16, 0x1.68ebdbe302741p-14, 0x1.ff2247e979de8p-15, 0x1.bcd2903d4ebe1p-13, 0x1.1cdaf3157804ap-13,
+				  0x1.174c8eefb6732p-11, 0x1.3dee85eec11f9p-12, 0x1.675de0d43dab8p-10, 0x1.6381c05a4837ap-11, 0x1.de2e5790de80bp-9, 0x1.8ea5e9457c438p-10,
+				  0x1.4ec698ddcdedcp-7, 0x1.c002b2f6ea6fcp-9, 0x1.000fd4a3d4e8ep-5, 0x1.e5539f871d0bbp-8, 0x1.d7f8892714c1bp-4, 0x1.ba07015be1693p-10,
+				  0x1.8981c383c7cffp-1}},
+				// x0 = -2.7476826467274127
+				{-0x1.7ed04286f6403p-1, -0x1.7995a4b4641ecp-56, 0x1.88p-3, 0x1.6c42c3083b9d2p-1,
+				 {0x1.239d29a0511f7p-11, -0x1.7f3ea9b524dep-11, 0x1.fcc65e42db558p-11, -0x1.4f51fdac6468ap-10, 0x1.c1e784ae4c208p-10, -0x1.290c6baf2e6bap-9,
+				  0x1.951bc2d018a0ap-9, -0x1.0b1f0e1c3a623p-8, 0x1.762163b1df981p-8, -0x1.e9577b1db3194p-8, 0x1.66d94129178cbp-7, -0x1.caca317a28712p-7,
+				  0x1.6dfc0742c9cc4p-6, -0x1.bc3ec431fb837p-6, 0x1.a0febc4127b5ep-5, -0x1.c7b2559839b8ep-5, 0x1.2b9fc98b1810ep-3, -0x1.223705dbf2eefp-3,
+				  0x1.a773d8ad51e1ep-1}},
+				// x0 = -3.14358088834998
+				{-0x1.260dbc9e59af8p-3, 0x1.1d065994b09ap-58, 0x1.921eep-3, 0x1.fc1d4bd1fc33fp+0,
+				 {0x1.bfe3a0e9a1ad9p-9, 0x1.0d88df6109355p-8, 0x1.45724f9e4a176p-8, 0x1.89e70c0497ef1p-8, 0x1.def4a906082e9p-8, 0x1.23cd0f886b731p-7,
+				  0x1.66372ccdc11dbp-7, 0x1.b7e79cb509fdcp-7, 0x1.11e2fbaa038c4p-6, 0x1.5328a38e2152fp-6, 0x1.b089cb302006bp-6, 0x1.0d8a46ea66a84p-5,
+				  0x1.67ff850bedb12p-5, 0x1.bf4601e2093fep-5, 0x1.4b2f401c3e0cap-4, 0x1.8ca5ebffe4831p-4, 0x1.7ffc538fe0611p-3, 0x1.7e188c07cabap-3,
+				  0x1.cac0e625d6478p-1}},
+				// x0 = -3.955294284858598
+				{-0x1.e91c551f0bf94p-1, -0x1.70d4561291237p-56, 0x1.5fdb04p-3, 0x1.317b9674dd3b2p-1,
+				 {0x1.559891306c3b2p-6, -0x1.77a57a1ecdbafp-6, 0x1.9e40556125a9ap-6, -0x1.ca36b4c57f4e5p-6, 0x1.fca82e8ae4dfcp-6, -0x1.1b61ada52b5cap-5,
+				  0x1.3d48fa7b207eep-5, -0x1.64d62cd9047bp-5, 0x1.94417e2854992p-5, -0x1.cc2432203a1f8p-5, 0x1.09556d0630f1dp-4, -0x1.32a804ac28fc3p-4,
+				  0x1.6d1701a512a89p-4, -0x1.ad5670b8f2e14p-4, 0x1.1278c80e00984p-3, -0x1.4635e43e3c342p-3, 0x1.004ca1626be07p-2, -0x1.2c4e90fe44f74p-2,
+				  0x1.fbcba61e28035p-1}},
+				// x0 = -4.039361839740537
+				{-0x1.4273c2ccac062p-5, 0x1.e307a790f3f8p-59, 0x1.4p-3, 0x1.368bb8d93208ap+1,
+				 {0.0, 0.0, 0x1.c64f783d27273p-6, 0x1.f3f4ae32c2fefp-6, 0x1.141349230f44fp-5, 0x1.320b188d3885dp-5,
+				  0x1.54e570cba9e3cp-5, 0x1.7d722b1321f6cp-5, 0x1.ade3d6913fbe9p-5, 0x1.e6e0ad79e08bep-5, 0x1.173f2aa551911p-4, 0x1.4133fd19d4559p-4,
+				  0x1.7c2f7e74e0e6cp-4, 0x1.bd3e7e911b754p-4, 0x1.1aa723346a456p-3, 0x1.4ea931558997ap-3, 0x1.04c396dc60364p-2, 0x1.212cd6597582ap-2,
+				  0x1.ff354860de4abp-1}},
+				// x0 = -4.991544640560048
+				{-0x1.fbabbd37757e7p-1, 0x1.7797aadfc4b3cp-55, 0x1.cp-5, 0x1.729fa3e695501p-1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0x1.34b2f530b4c97p-4, -0x1.53686df118b0bp-4, 0x1.7957088589fc8p-4, -0x1.a5d43aa80538ap-4,
+				  0x1.e2d360f06afffp-4, -0x1.13afb8f770f54p-3, 0x1.505934aba95fep-3, -0x1.883919629241bp-3, 0x1.212baa255f74ep-2, -0x1.5101cbfee7dc1p-2,
+				  0x1.0bb9af9e90836p+0}},
+				// x0 = -5.0082181683225935
+				{-0x1.0d4afe16db219p-7, -0x1.498adcb2a728p-61, 0x1.0p-6, 0x1.582c673af19e6p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.e3ba26808090cp-4, 0x1.14243fd51cfa5p-3, 0x1.50ce8822798eap-3, 0x1.887bf1cd73599p-3, 0x1.2168632778696p-2, 0x1.4616d4a07d6bep-2,
+				  0x1.0bdab32e0a162p+0}},
+				// x0 = -5.998607480080875
+				{-0x1.ff497ac8fa06bp-1, 0x1.15894e9a167p-59, 0x1.8p-10, 0x1.c063410bc5b51p-1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, -0x1.96b7a69eeffd9p-3, 0x1.286bde29b47ddp-2, -0x1.57b1b44b0fe81p-2,
+				  0x1.1116eb0c49695p+0}},
+				// x0 = -6.001385294453155
+				{-0x1.6b25897c8ced8p-10, -0x1.f0b65b458ep-66, 0x1.8p-10, 0x1.6f567bfcb1afap+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0x1.969ebb3ac9f72p-3, 0x1.286dd93156e24p-2, 0x1.4fabc5ea11df3p-2,
+				  0x1.111987fdf030cp+0}},
+				// x0 = -6.999801507890638
+				{-0x1.ffe5fbb5c378p-1, 0x1.853b29347b806p-57, 0x1.8p-12, 0x1.041d2203cd6c2p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0x1.29beee8a4b16dp-2, -0x1.581e199ddf6p-2,
+				  0x1.1402a574d4fc2p+0}},
+				// x0 = -7.000198333407325
+				{-0x1.9fef6ff0f5be9p-13, 0x1.be919233cp-67, 0x1.4p-13, 0x1.81f2864fc885ep+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0x1.29befb40d2fd9p-2, 0x1.521389579dff8p-2,
+				  0x1.1402e309222efp+0}},
+				// x0 = -7.999975197095821
+				{-0x1.fffcbfc0ace78p-1, -0x1.e54f415a91586p-55, 0x1.8p-15, 0x1.24049c69a39ebp+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, -0x1.57a8676dcf534p-2,
+				  0x1.160e20f174e99p+0}},
+				// x0 = -8.000024800270682
+				{-0x1.a01459fc9f60dp-16, 0x1.30c4f8c4cp-70, 0x1.4p-16, 0x1.91fec64bba58p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0x1.52f3204eac24ap-2,
+				  0x1.160e26ba0efc5p+0}},
+				// x0 = -8.999997244250977
+				{-0x1.ffffa3884bd02p-1, 0x1.bcd8b545b6cp-63, 0x1.4p-20, 0x1.407340927fc41p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.17a4207dce4b8p+0}},
+				// x0 = -9.000002755714823
+				{-0x1.71dda3ec36b6cp-19, -0x1.0ffb70d4p-74, 0x1.cp-19, 0x1.a0393b47a2b84p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0x1.5371b7b65e039p-2,
+				  0x1.17a42100bc72ap+0}},
+				// x0 = -9.99999972442663
+				{-0x1.fffff6c0d7bfcp-1, 0x1.97cea8c42d7dp-55, 0x1.0p-21, 0x1.5a0c7f4fed3bp+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.18ebf86a8a0dap+0}},
+				// x0 = -10.000000275573013
+				{-0x1.27e4eee649ed1p-22, -0x1.d95e154p-76, 0x1.cp-23, 0x1.ad0635825cfdp+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.18ebf87540825p+0}},
+				// x0 = -10.99999997494789
+				{-0x1.ffffff28cdd3ep-1, -0x1.b36dacd2adbdp-56, 0x1.0p-25, 0x1.7152478bb928ap+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.19facbfa36731p+0}},
+				// x0 = -11.000000025052106
+				{-0x1.ae6454c576597p-26, 0x1.90015cp-80, 0x1.cp-25, 0x1.b8a922d8d3b03p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0x1.19facbfb06575p+0}},
+				// x0 = -11.999999997912324
+				{-0x1.ffffffee11271p-1, 0x1.8f0437ca67858p-57, 0x1.0p-30, 0x1.86a79c07d6475p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -12.000000002087676
+				{-0x1.1eed8ee62acf8p-29, -0x1.e04a2p-85, 0x1.0p-30, 0x1.c353cdf01a754p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -12.99999999983941
+				{-0x1.fffffffe9edbap-1, 0x1.3d00d0b4007p-57, 0x1.4p-34, 0x1.9a58d7093e144p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -13.00000000016059
+				{-0x1.612461380cd08p-33, 0x1.1723p-87, 0x1.8p-33, 0x1.cd2c6b8317c9dp+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -13.99999999998853
+				{-0x1.ffffffffe6c69p-1, 0x1.2a30f3dae0fbp-55, 0x1.8p-39, 0x1.aca1fb9a1bfb5p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -14.00000000001147
+				{-0x1.93974a8bd29cfp-37, 0x1.09dp-91, 0x1.4p-37, 0x1.d650fdccf1faep+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -14.999999999999236
+				{-0x1.fffffffffe518p-1, -0x1.8319813bcc1p-58, 0x1.4p-41, 0x1.bdb30cab12e8ap+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -15.000000000000764
+				{-0x1.ae7f3e7337a1dp-41, 0x1.fp-95, 0x1.4p-41, 0x1.ded9865587955p+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -15.999999999999952
+				{-0x1.ffffffffffe52p-1, 0x1.fcf9ccef05768p-55, 0x1.0p-44, 0x1.cdb30cab11279p+0,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+				// x0 = -16.000000000000046
+				{-0x1.ae7f3e733b428p-45, -0x1.2p-99, 0x1.4p-46, 0x1.e6d986558875dp+1,
+				 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+				  0.0}},
+			};
+		};
+
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		constexpr type::BasicDoubleDouble<T> gamma_log(T x) noexcept
+		{
+			return log_dd(x);
+		}
+
+		template <typename T, typename Abi>
+		type::BasicDoubleDouble<intrin::simd<T, Abi>> gamma_log(intrin::simd<T, Abi> const & x) noexcept
+		{
+			return intrin::detail::log_dd(x);
+		}
+
+		/// Picks a or b lane by lane. mask is a bool for scalar lanes.
+		template <typename Mask, typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> gamma_choose(Mask mask, type::BasicDoubleDouble<Lane> const & a,
+															 type::BasicDoubleDouble<Lane> const & b) noexcept
+		{
+			return {intrin::choose(mask, a.hi, b.hi), intrin::choose(mask, a.lo, b.lo)};
+		}
+
+		/**
+		 * @brief Product of two double-double values.
+		 *
+		 * Unlike type::quick_mult this adds the cross terms with plain multiplies, which are as accurate here and do not
+		 * fall back to a library fma on targets without one.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> gamma_mult(type::BasicDoubleDouble<Lane> const & a, type::BasicDoubleDouble<Lane> const & b) noexcept
+		{
+			const auto p = type::exact_mult(a.hi, b.hi);
+			return type::exact_add(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+		}
+
+		/// log of a positive double-double value.
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> gamma_log(type::BasicDoubleDouble<Lane> const & x) noexcept
+		{
+			const auto l = gamma_log(x.hi);
+			return type::exact_add(l.hi, l.lo + x.lo / x.hi);
+		}
+
+		/**
+		 * @brief sin(pi * y) as a double-double value for 0 <= y < gamma_constants::integral_limit, exactly 0 at the
+		 * integers.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> gamma_sinpi(Lane y) noexcept
+		{
+			using constants		  = gamma_constants;
+			constexpr double half = 0.5;
+
+			// Adding and subtracting 2^52 rounds to the nearest integer n, and r = y - n is exact.
+			const Lane n = (y + constants::integral_limit) - constants::integral_limit;
+			const Lane r = y - n;
+
+			// pi * r and -pi^3 / 6 * r^3 are kept as pairs, so only the r^5 term is rounded, to below 2^-56 of the result.
+			const auto r2	= type::exact_mult(r, r);
+			auto r3			= type::exact_mult(r2.hi, r);
+			r3.lo			= r3.lo + r2.lo * r;
+			const auto rpi	= type::exact_mult(r, Lane(constants::pi_hi));
+			const auto t3	= gamma_mult(r3, type::BasicDoubleDouble<Lane>{Lane(constants::sinpi3_hi), Lane(constants::sinpi3_lo)});
+			const Lane r5	= r3.hi * r2.hi * support::polyeval_array(r2.hi, constants::sinpi);
+			const auto u	= type::two_sum(rpi.hi, t3.hi);
+			const auto v		= type::exact_add(u.hi, (u.lo + (rpi.lo + r * constants::pi_lo)) + (t3.lo + r5));
+
+			// sin(pi * y) = (-1)^n * sin(pi * r).
+			const Lane h   = n * half;
+			const auto odd = !(h == (h + constants::integral_limit) - constants::integral_limit);
+			return gamma_choose(odd, type::BasicDoubleDouble<Lane>{-v.hi, -v.lo}, v);
+		}
+
+		/**
+		 * @brief a * b * (y + R), the form of each rational piece below.
+		 *
+		 * These pieces vanish at 1 and 2, where a is small. a * b and its product with the constant y are kept exact, so
+		 * that close to the zeros only R carries a rounding error.
+		 */
+		template <typename Lane>
+		constexpr Lane lgamma_rational(Lane a, Lane b, double y, Lane R) noexcept
+		{
+			const auto r = type::exact_mult(a, b);
+			const auto m = type::exact_mult(r.hi, Lane(y));
+			return m.hi + (m.lo + (r.lo * y + r.hi * R));
+		}
+
+		/// lgamma(z) for z in [1, 1.5], with zm1 = z - 1 and zm2 = z - 2.
+		template <typename Lane>
+		constexpr Lane lgamma_near_one(Lane zm1, Lane zm2) noexcept
+		{
+			using constants = gamma_constants;
+
+			const Lane R = support::polyeval_array(zm1, constants::near_one_p) / support::polyeval_array(zm1, constants::near_one_q);
+			return lgamma_rational(zm1, zm2, constants::near_one_y, R);
+		}
+
+		/// lgamma(z) for z in (1.5, 2), with zm1 = z - 1 and zm2 = z - 2.
+		template <typename Lane>
+		constexpr Lane lgamma_near_two(Lane zm1, Lane zm2) noexcept
+		{
+			using constants = gamma_constants;
+
+			const Lane w = -zm2;
+			const Lane R = support::polyeval_array(w, constants::near_two_p) / support::polyeval_array(w, constants::near_two_q);
+			return lgamma_rational(zm2, zm1, constants::near_two_y, R);
+		}
+
+		/// lgamma(z) for z in [2, 3), with zm2 = z - 2.
+		template <typename Lane>
+		constexpr Lane lgamma_two_three(Lane z, Lane zm2) noexcept
+		{
+			using constants = gamma_constants;
+
+			const Lane R = support::polyeval_array(zm2, constants::two_three_p) / support::polyeval_array(zm2, constants::two_three_q);
+			return lgamma_rational(zm2, z + 1.0, constants::two_three_y, R);
+		}
+
+		/**
+		 * @brief Moves z from [3, 10) down into [2, 3) and returns the product of the values it was moved through.
+		 *
+		 * lgamma(z) before the call is lgamma(z) after it plus the log of the returned value, which is at most 9! / 2.
+		 * Lanes below 3 are left alone and get a product of 1.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> lgamma_shift_down(Lane & z) noexcept
+		{
+			type::BasicDoubleDouble<Lane> p{Lane(1.0), Lane(0.0)};
+			for (int step = 0; step < 7; ++step)
+			{
+				const auto more = !(z < Lane(3.0));
+				const Lane zm1	= z - 1.0;
+				auto q			= type::exact_mult(p.hi, zm1);
+				q.lo			= q.lo + p.lo * zm1;
+				p				= gamma_choose(more, q, p);
+				z				= intrin::choose(more, zm1, z);
+			}
+			return p;
+		}
+
+		/// The remainder S(y) of Stirling's series, for y >= gamma_constants::stirling_limit.
+		template <typename Lane>
+		constexpr Lane gamma_stirling_series(Lane y) noexcept
+		{
+			const Lane inv = 1.0 / y;
+			return inv * support::polyeval_array(inv * inv, gamma_constants::stirling);
+		}
+
+		/**
+		 * @brief lgamma(y) as a double-double value for y in [gamma_constants::stirling_limit, gamma_constants::lgamma_max].
+		 *
+		 * (y - 1/2) * log(y) - y is formed as y * (log(y) - 1) - log(y) / 2, which does not overflow before the result does.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> lgamma_stirling(Lane y) noexcept
+		{
+			using constants		   = gamma_constants;
+			constexpr double big   = 0x1.0p512;
+			constexpr double scale = 0x1.0p-512;
+
+			const auto L  = gamma_log(y);
+			const auto lm = type::two_sum(L.hi, Lane(-1.0));
+
+			// The products are split at a scaled y, which keeps Dekker's splitting clear of overflow. Scaling is exact.
+			const auto large = !(y < Lane(big));
+			const Lane ys	 = intrin::choose(large, y * scale, y);
+			auto t			 = type::exact_mult(ys, lm.hi);
+			t.lo			 = t.lo + ys * (lm.lo + L.lo);
+			t.hi			 = intrin::choose(large, t.hi * big, t.hi);
+			t.lo			 = intrin::choose(large, t.lo * big, t.lo);
+
+			const auto u  = type::exact_add(t.hi, -0.5 * L.hi);
+			const auto v  = type::two_sum(u.hi, Lane(constants::half_log_2pi_hi));
+			const Lane lo = ((u.lo + t.lo) + v.lo) + ((constants::half_log_2pi_lo - 0.5 * L.lo) + gamma_stirling_series(y));
+			return type::exact_add(v.hi, lo);
+		}
+
+		/**
+		 * @brief tgamma(y) / 2^e as a double-double value for y in [gamma_constants::stirling_limit,
+		 * gamma_constants::reflect_limit], with e an integral value of the lane type.
+		 *
+		 * With a = y / e and y - 1/2 = n + rho for an integer n and |rho| <= 1/2, tgamma(y) = sqrt(2pi / e) * a^n *
+		 * exp(rho * log(a) + S(y)). a^n is taken by binary powering on double-double values, n being below 2^8. The
+		 * powering runs on a / 64, which stays close to 1 and keeps Dekker's splitting clear of overflow, and 2^(6n) goes
+		 * into e.
+		 */
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> tgamma_stirling_scaled(Lane y, Lane & e) noexcept
+		{
+			using constants			   = gamma_constants;
+			constexpr double pow_shift = 6.0;
+			constexpr double pow_scale = 0x1.0p-6;
+
+			auto a = type::exact_mult(y, Lane(constants::inv_e_hi * pow_scale));
+			a	   = type::exact_add(a.hi, a.lo + y * (constants::inv_e_lo * pow_scale));
+
+			const Lane h   = y - 0.5;
+			const Lane n   = (h + constants::integral_limit) - constants::integral_limit;
+			const Lane rho = h - n;
+
+			// exp(rho * log(a) + S(y)) = 2^k * (1 + m).
+			const auto la = gamma_log(type::BasicDoubleDouble<Lane>{a.hi * (1.0 / pow_scale), a.lo * (1.0 / pow_scale)});
+			const auto pr = type::exact_mult(rho, la.hi);
+			const auto w  = type::two_sum(pr.hi, gamma_stirling_series(y));
+			Lane k		  = Lane(0.0);
+			const Lane m  = exp_reduce_m1(w.hi, (w.lo + pr.lo) + rho * la.lo, k);
+
+			// (a / 64)^n, from the highest bit of n down.
+			type::BasicDoubleDouble<Lane> p{Lane(1.0), Lane(0.0)};
+			Lane rest = n;
+			for (int bit = 7; bit >= 0; --bit)
+			{
+				const double b = static_cast<double>(1 << bit);
+				p			   = gamma_mult(p, p);
+				const auto set = !(rest < Lane(b));
+				rest		   = intrin::choose(set, rest - b, rest);
+				p			   = gamma_choose(set, gamma_mult(p, a), p);
+			}
+
+			const auto c = gamma_mult(p, type::BasicDoubleDouble<Lane>{Lane(constants::sqrt_2pi_e_hi), Lane(constants::sqrt_2pi_e_lo)});
+			e			 = k + pow_shift * n;
+			return type::exact_add(c.hi, c.lo + c.hi * m);
+		}
+
+		/// tgamma(y) for y in [gamma_constants::stirling_limit, gamma_constants::tgamma_max].
+		template <typename Lane>
+		constexpr Lane tgamma_stirling(Lane y) noexcept
+		{
+			Lane e		 = Lane(0.0);
+			const auto g = tgamma_stirling_scaled(y, e);
+			return exp_scale(g.hi + g.lo, e);
+		}
+
+		/// lgamma(y) as a double-double value for y in (0, gamma_constants::lgamma_max].
+		constexpr type::DoubleDouble lgamma_positive(double y) noexcept
+		{
+			if (y >= gamma_constants::stirling_limit) { return lgamma_stirling(y); }
+
+			double z   = y;
+			double zm1 = y - 1.0;
+			double zm2 = y - 2.0;
+			type::DoubleDouble extra{0.0, 0.0};
+			if (y < 1.0)
+			{
+				// lgamma(y) = lgamma(y + 1) - log(y), and the pieces below take z - 1 and z - 2 unrounded.
+				const auto l = log_dd(y);
+				extra		 = {-l.hi, -l.lo};
+				zm2			 = zm1;
+				zm1			 = y;
+				z			 = y + 1.0;
+			}
+			else if (y >= 3.0)
+			{
+				extra = gamma_log(lgamma_shift_down(z));
+				zm2	  = z - 2.0;
+			}
+
+			double v = 0.0;
+			if (z >= 2.0) { v = lgamma_two_three(z, zm2); }
+			else if (z <= 1.5) { v = lgamma_near_one(zm1, zm2); }
+			else { v = lgamma_near_two(zm1, zm2); }
+
+			const auto s = type::two_sum(extra.hi, v);
+			return type::exact_add(s.hi, s.lo + extra.lo);
+		}
+
+		/// tgamma(y) / 2^e as a double-double value, for y in [gamma_constants::tiny_limit, gamma_constants::reflect_limit].
+		constexpr type::DoubleDouble tgamma_positive_scaled(double y, double & e) noexcept
+		{
+			if (y >= gamma_constants::stirling_limit) { return tgamma_stirling_scaled(y, e); }
+			const auto l = lgamma_positive(y);
+			return type::exact_add(1.0, exp_reduce_m1(l.hi, l.lo, e));
+		}
+
+		/// tgamma(y) for y in [gamma_constants::tiny_limit, gamma_constants::tgamma_max].
+		constexpr double tgamma_positive(double y) noexcept
+		{
+			double e	 = 0.0;
+			const auto g = tgamma_positive_scaled(y, e);
+			return exp_scale(g.hi + g.lo, e);
+		}
+
+		/// log(pi) - log(y * |sin(pi * y)|) - lgamma(y), the reflected lgamma for -y, given s = sin(pi * y) != 0.
+		template <typename Lane>
+		constexpr type::BasicDoubleDouble<Lane> lgamma_reflect(Lane y, type::BasicDoubleDouble<Lane> const & s,
+															   type::BasicDoubleDouble<Lane> const & l) noexcept
+		{
+			using constants = gamma_constants;
+
+			const auto neg = s.hi < Lane(0.0);
+			const auto ys  = gamma_mult(type::BasicDoubleDouble<Lane>{y, Lane(0.0)}, s);
+			const auto ls  = gamma_log(type::BasicDoubleDouble<Lane>{intrin::choose(neg, -ys.hi, ys.hi), intrin::choose(neg, -ys.lo, ys.lo)});
+			const auto d  = type::two_sum(Lane(constants::log_pi_hi), -ls.hi);
+			const auto e  = type::two_sum(d.hi, -l.hi);
+			return type::exact_add(e.hi, (e.lo + d.lo) + ((constants::log_pi_lo - ls.lo) - l.lo));
+		}
+
+		/// a / b for a double-double value b, with the remainder of the first quotient folded back in.
+		constexpr type::DoubleDouble lgamma_quotient(double a, type::DoubleDouble const & b) noexcept
+		{
+			const double q = a / b.hi;
+			const auto p   = type::exact_mult(q, b.hi);
+			return type::exact_add(q, (((a - p.hi) - p.lo) - q * b.lo) / b.hi);
+		}
+
+		/**
+		 * @brief lgamma(x) from the expansion around the closest zero, for x within its radius.
+		 *
+		 * The reflection subtracts nearly equal logarithms there and only keeps the absolute error.
+		 * @return false if x is not next to a zero, with r left alone.
+		 */
+		constexpr bool lgamma_near_zero(double x, double & r) noexcept
+		{
+			using constants = gamma_constants;
+
+			if (!(lgamma_zero_constants::lower_limit < x && x < lgamma_zero_constants::upper_limit)) { return false; }
+
+			// x + m is exact, m being the nearest integer to -x, and so are x + k and x + k + 1 for the poles -k - 1 < x < -k.
+			const double m	 = (constants::integral_limit - x) - constants::integral_limit;
+			const double eps = x + m;
+			if (eps == 0.0) { return false; }
+			const double k	= eps > 0.0 ? m - 1.0 : m;
+			const double xk = eps > 0.0 ? eps - 1.0 : eps;
+
+			// The zeros between -k - 1 and -k are at 2 * (k - 2) and the next index, the lower one missing for k = 16.
+			const auto & zeros = lgamma_zero_constants::zeros;
+			int index		   = 2 * (static_cast<int>(k) - 2);
+			if (index + 1 < lgamma_zero_constants::count && xk < 0.5 * (zeros[index].offset_hi + zeros[index + 1].offset_hi)) { ++index; }
+			const lgamma_zero & z = zeros[index];
+
+			const auto d	= type::two_sum(xk, -z.offset_hi);
+			const double t	= d.lo - z.offset_lo;
+			if (!((d.hi < 0 ? -d.hi : d.hi) <= z.radius)) { return false; }
+
+			const auto e1 = type::two_sum(z.offset_hi, 1.0);
+			const auto qa = lgamma_quotient(xk, type::DoubleDouble{z.offset_hi, z.offset_lo});
+			const auto qb = lgamma_quotient(xk + 1.0, type::exact_add(e1.hi, e1.lo + z.offset_lo));
+			const auto l  = gamma_log(gamma_mult(qa, qb));
+
+			const auto s	  = type::exact_mult(z.slope, d.hi);
+			const double tail = z.slope * t + d.hi * d.hi * support::polyeval_array(d.hi, z.poly);
+			const auto u	  = type::two_sum(s.hi, -l.hi);
+			r				  = u.hi + (u.lo + ((s.lo + tail) - l.lo));
+			return true;
+		}
+
+		/**
+		 * @brief -pi / (y * sin(pi * y) * g * 2^e), the reflected tgamma for -y.
+		 *
+		 * s = sin(pi * y) != 0 and g * 2^e = tgamma(y) come as double-double values, so the only roundings left are
+		 * those of g and of the final scaling, which also takes subnormal results.
+		 */
+		template <typename Lane>
+		constexpr Lane tgamma_reflect(Lane y, type::BasicDoubleDouble<Lane> const & s, type::BasicDoubleDouble<Lane> const & g, Lane e) noexcept
+		{
+			using constants = gamma_constants;
+
+			// pi / d with the remainder of the first quotient folded back in, as in erfc_tail.
+			const auto d  = gamma_mult(gamma_mult(type::BasicDoubleDouble<Lane>{y, Lane(0.0)}, s), g);
+			const Lane q0 = constants::pi_hi / d.hi;
+			const auto p  = type::exact_mult(q0, d.hi);
+			const Lane q  = q0 + ((((constants::pi_hi - p.hi) - p.lo) + constants::pi_lo) - q0 * d.lo) / d.hi;
+			return exp_scale(-q, -e);
+		}
+
+		constexpr double lgamma_impl(double x) noexcept
+		{
+			using constants = gamma_constants;
+			using FPBits_t	= support::fp::FPBits<double>;
+
+			if (x != x) { return x; }
+			const double ax = x < 0 ? -x : x;
+			if (ax < constants::tiny_limit)
+			{
+				if (CCM_UNLIKELY(ax == 0.0))
+				{
+					support::fenv::set_errno_if_required(ERANGE);
+					support::fenv::raise_except_if_required(FE_DIVBYZERO);
+					return FPBits_t::inf().get_val();
+				}
+				const auto l = log_dd(ax);
+				return -(l.hi + l.lo);
+			}
+			if (x > 0)
+			{
+				if (CCM_UNLIKELY(x > constants::lgamma_max))
+				{
+					if (x != FPBits_t::inf().get_val())
+					{
+						support::fenv::set_errno_if_required(ERANGE);
+						support::fenv::raise_except_if_required(FE_OVERFLOW);
+					}
+					return FPBits_t::inf().get_val();
+				}
+				const auto l = lgamma_positive(x);
+				return l.hi + l.lo;
+			}
+
+			if (CCM_UNLIKELY(ax == FPBits_t::inf().get_val())) { return ax; }
+			const auto s = ax < constants::integral_limit ? gamma_sinpi(ax) : type::DoubleDouble{0.0, 0.0};
+			if (CCM_UNLIKELY(s.hi == 0.0))
+			{
+				// lgamma has a pole at every nonpositive integer.
+				support::fenv::set_errno_if_required(ERANGE);
+				support::fenv::raise_except_if_required(FE_DIVBYZERO);
+				return FPBits_t::inf().get_val();
+			}
+			double value = 0.0;
+			if (lgamma_near_zero(x, value)) { return value; }
+			const auto r = lgamma_reflect(ax, s, lgamma_positive(ax));
+			return r.hi + r.lo;
+		}
+
+		constexpr double tgamma_impl(double x) noexcept
+		{
+			using constants = gamma_constants;
+			using FPBits_t	= support::fp::FPBits<double>;
+
+			if (x != x) { return x; }
+			const double ax = x < 0 ? -x : x;
+			if (ax < constants::tiny_limit)
+			{
+				// tgamma(±0) = ±inf is a pole error, and 1/x may overflow for subnormal x.
+				const double r = 1.0 / x;
+				if (CCM_UNLIKELY(r == FPBits_t::inf().get_val() || r == -FPBits_t::inf().get_val()))
+				{
+					support::fenv::set_errno_if_required(ERANGE);
+					support::fenv::raise_except_if_required(ax == 0.0 ? FE_DIVBYZERO : FE_OVERFLOW);
+				}
+				return r;
+			}
+			if (x > 0)
+			{
+				if (CCM_UNLIKELY(x > constants::tgamma_max))
+				{
+					if (x != FPBits_t::inf().get_val())
+					{
+						support::fenv::set_errno_if_required(ERANGE);
+						support::fenv::raise_except_if_required(FE_OVERFLOW);
+					}
+					return FPBits_t::inf().get_val();
+				}
+				return tgamma_positive(x);
+			}
+
+			const auto s = ax < constants::integral_limit ? gamma_sinpi(ax) : type::DoubleDouble{0.0, 0.0};
+			if (CCM_UNLIKELY(s.hi == 0.0))
+			{
+				// Negative integers and -inf are outside the domain.
+				support::fenv::set_errno_if_required(EDOM);
+				support::fenv::raise_except_if_required(FE_INVALID);
+				return FPBits_t::quiet_nan().get_val();
+			}
+
+			double r = 0.0;
+			if (ax <= constants::reflect_limit)
+			{
+				double e	 = 0.0;
+				const auto g = tgamma_positive_scaled(ax, e);
+				r			 = tgamma_reflect(ax, s, g, e);
+			}
+			else
+			{
+				const auto l = lgamma_reflect(ax, s, lgamma_positive(ax));
+				r			 = exp_dd(l.hi, l.lo);
+				r			 = s.hi < 0 ? r : -r;
+			}
+			if (r == 0.0)
+			{
+				support::fenv::set_errno_if_required(ERANGE);
+				support::fenv::raise_except_if_required(FE_UNDERFLOW);
+			}
+			return r;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Gamma function of x, within 1.6 ulp for positive x and 2 ulp for negative x.
+	 * @return ±inf for ±0 as a pole error, NaN for negative integers and -inf as a domain error, and +inf on overflow.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tgamma_gen(T x) noexcept
+	{
+		return static_cast<T>(internal::tgamma_impl(static_cast<double>(x)));
+	}
+
+	/**
+	 * @brief Natural logarithm of the absolute value of the gamma function of x.
+	 * @return +inf for nonpositive integers as a pole error, and for ±inf.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T lgamma_gen(T x) noexcept
+	{
+		return static_cast<T>(internal::lgamma_impl(static_cast<double>(x)));
+	}
+} // namespace ccm::gen
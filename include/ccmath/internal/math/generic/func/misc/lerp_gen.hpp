@@ -10,41 +10,30 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/func/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/math/basic/fma.hpp"
 
-namespace ccm
+/*
+ * Linear interpolation as two fused multiply-adds, a + t * (b - a) = t * b + (a - t * a).
+ * https://developer.nvidia.com/blog/lerp-faster-cuda/
+ *
+ * lerp(a, b, 0) is exactly a and lerp(a, b, 1) exactly b. The vector version runs the same two fmas on every lane and
+ * gives the same results, it is only fast where intrin::has_fma_v holds. ext::mix is the unfused alternative.
+ */
+
+namespace ccm::gen
 {
 	template <typename T>
-	constexpr T lerp(T a, T b, T t) noexcept
+	constexpr T lerp_gen(T a, T b, T t) noexcept
 	{
-		// Optimized version of lerp
-		// https://developer.nvidia.com/blog/lerp-faster-cuda/
-		// TODO: Validate this works for all cases of a lerp.
 		return ccm::fma(t, b, ccm::fma(-t, a, a));
 	}
 
-	template <typename T, typename U, typename V>
-	constexpr std::enable_if_t<std::is_arithmetic_v<T> && std::is_arithmetic_v<U> && std::is_arithmetic_v<V>, std::common_type_t<T, U, V>>
-	lerp(T a, U b, V t) noexcept
+	template <typename T, typename Abi>
+	CCM_ALWAYS_INLINE intrin::simd<T, Abi> lerp_gen(intrin::simd<T, Abi> const & a, intrin::simd<T, Abi> const & b, intrin::simd<T, Abi> const & t) noexcept
 	{
-		using result_type = std::common_type_t<T, U, V>;
-		static_assert(!(std::is_same_v<T, result_type> && std::is_same_v<U, result_type> && std::is_same_v<V, result_type>));
-		return lerp(static_cast<result_type>(a), static_cast<result_type>(b), static_cast<result_type>(t));
-	}
-
-	// TODO: Remove this once we confirm the new lerp is 100% stable
-	template <typename T>
-	[[maybe_unused]] [[deprecated(
-		"Do not use ccm::lerp_old it is only being kept as a fallback until ccm::lerp has been validated as conforming to std::lerp")]] constexpr T
-	old_lerp(T a, T b, T t) noexcept
-	{
-		if ((a <= 0 && b >= 0) || (a >= 0 && b <= 0)) { return t * b + (1 - t) * a; }
-
-		if (t == 1) { return b; }
-
-		const T x = a + t * (b - a);
-		if ((t > 1) == (b > a)) { return b < x ? x : b; }
-
-		return x < b ? x : b;
+		// The simd negation is 0 - t, which loses the sign of a zero t. Multiplying by -1 keeps it.
+		return intrin::fma(t, b, intrin::fma(t * T(-1), a, a));
 	}
-} // namespace ccm
+} // namespace ccm::gen
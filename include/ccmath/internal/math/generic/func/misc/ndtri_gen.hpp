@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+
+#include <type_traits>
+
+/*
+ * Quantile function of the standard normal distribution, after Wichura's algorithm AS 241 (PPND16).
+ *
+ * For |p - 0.5| <= 0.425 the quantile is q * A(r) / B(r) with q = p - 0.5 and r = 0.180625 - q^2. In the tails
+ * r = sqrt(-log(min(p, 1 - p))) and the quantile is C(r - 1.6) / D(r - 1.6) for r <= 5, E(r - 5) / F(r - 5) beyond,
+ * with the sign of q. Every ratio is of degree 7 over 7, and the relative error stays below 1e-15, which is up to 7 ulp
+ * far out in the tails.
+ *
+ * Everything is computed in double. The rational functions are plain arithmetic on a lane type, so the vector ndtri
+ * runs the same steps on intrin::simd<double> lanes with the vector log and sqrt.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		struct ndtri_constants
+		{
+			// The central ratio is used for |p - 0.5| <= central_limit, and the near tail ratio for r <= tail_split.
+			static constexpr double central_limit = 0.425;
+			static constexpr double central_base  = 0.180625;
+			static constexpr double near_shift	  = 1.6;
+			static constexpr double tail_split	  = 5.0;
+
+			// Highest degree first.
+			static constexpr double central_num[] = {
+				2.5090809287301226727e+3, 3.3430575583588128105e+4, 6.7265770927008700853e+4, 4.5921953931549871457e+4,
+				1.3731693765509461125e+4, 1.9715909503065514427e+3, 1.3314166789178437745e+2, 3.3871328727963666080e+0,
+			};
+			static constexpr double central_den[] = {
+				5.2264952788528545610e+3, 2.8729085735721942674e+4, 3.9307895800092710610e+4, 2.1213794301586595867e+4,
+				5.3941960214247511077e+3, 6.8718700749205790830e+2, 4.2313330701600911252e+1, 1.0,
+			};
+			static constexpr double near_num[] = {
+				7.74545014278341407640e-4, 2.27238449892691845833e-2, 2.41780725177450611770e-1, 1.27045825245236838258e+0,
+				3.64784832476320460504e+0, 5.76949722146069140550e+0, 4.63033784615654529590e+0, 1.42343711074968357734e+0,
+			};
+			static constexpr double near_den[] = {
+				1.05075007164441684324e-9, 5.47593808499534494600e-4, 1.51986665636164571966e-2, 1.48103976427480074590e-1,
+				6.89767334985100004550e-1, 1.67638483018380384940e+0, 2.05319162663775882187e+0, 1.0,
+			};
+			static constexpr double far_num[] = {
+				2.01033439929228813265e-7, 2.71155556874348757815e-5, 1.24266094738807843860e-3, 2.65321895265761230930e-2,
+				2.96560571828504891230e-1, 1.78482653991729133580e+0, 5.46378491116411436990e+0, 6.65790464350110377720e+0,
+			};
+			static constexpr double far_den[] = {
+				2.04426310338993978564e-15, 1.42151175831644588870e-7, 1.84631831751005468180e-5, 7.86869131145613259100e-4,
+				1.48753612908506148525e-2,	1.36929880922735805310e-1, 5.99832206555887937690e-1, 1.0,
+			};
+		};
+
+		/**
+		 * @brief Quantile divided by q, for q = p - 0.5 with |q| <= ndtri_constants::central_limit.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane ndtri_slope(Lane q) noexcept
+		{
+			using constants = ndtri_constants;
+
+			const Lane r = Lane(constants::central_base) - q * q;
+			return support::polyeval_array(r, constants::central_num) / support::polyeval_array(r, constants::central_den);
+		}
+
+		/**
+		 * @brief Quantile for q = p - 0.5 with |q| <= ndtri_constants::central_limit.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane ndtri_central(Lane q) noexcept
+		{
+			return q * ndtri_slope(q);
+		}
+
+		/**
+		 * @brief Magnitude of the quantile for r = sqrt(-log(p)), p being the smaller tail, and r <= ndtri_constants::tail_split.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane ndtri_near(Lane r) noexcept
+		{
+			using constants = ndtri_constants;
+
+			const Lane t = r - constants::near_shift;
+			return support::polyeval_array(t, constants::near_num) / support::polyeval_array(t, constants::near_den);
+		}
+
+		/**
+		 * @brief Magnitude of the quantile for r = sqrt(-log(p)) > ndtri_constants::tail_split.
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane>
+		constexpr Lane ndtri_far(Lane r) noexcept
+		{
+			using constants = ndtri_constants;
+
+			const Lane t = r - constants::tail_split;
+			return support::polyeval_array(t, constants::far_num) / support::polyeval_array(t, constants::far_den);
+		}
+
+		/// Magnitude of the quantile for t = -log(p) > 0, p being the smaller tail and outside the central range.
+		constexpr double ndtri_tail(double t) noexcept
+		{
+			const double r = sqrt_gen(t);
+			return r <= ndtri_constants::tail_split ? ndtri_near(r) : ndtri_far(r);
+		}
+
+		constexpr double ndtri_impl(double p) noexcept
+		{
+			using constants = ndtri_constants;
+			using FPBits_t	= support::fp::FPBits<double>;
+
+			if (p != p) { return p; }
+			if (!(p >= 0.0 && p <= 1.0)) { return FPBits_t::quiet_nan().get_val(); }
+			if (p == 0.0) { return -FPBits_t::inf().get_val(); }
+			if (p == 1.0) { return FPBits_t::inf().get_val(); }
+
+			const double q	= p - 0.5;
+			const double aq = q < 0 ? -q : q;
+			if (aq <= constants::central_limit) { return ndtri_central(q); }
+
+			// 1 - p is exact for p >= 0.5.
+			const auto l   = log_dd(q < 0 ? p : 1.0 - p);
+			const double v = ndtri_tail(-(l.hi + l.lo));
+			return q < 0 ? -v : v;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Quantile of the standard normal distribution: the x with Phi(x) = p.
+	 * @return -inf for p = 0, +inf for p = 1 and NaN outside [0, 1].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T ndtri_gen(T p) noexcept
+	{
+		return static_cast<T>(internal::ndtri_impl(static_cast<double>(p)));
+	}
+} // namespace ccm::gen
@@ -10,7 +10,168 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <type_traits>
+
+/*
+ * Overflow-safe hypot.
+ *
+ * Arguments that are very large or very small are scaled by a power of two first, so the squares can neither
+ * overflow nor underflow, and the result is scaled back at the end. The squares and their sum are kept as double-double
+ * values and the square root gets one correction step from the exact residual, which makes the result correctly
+ * rounded except for rare cases within a hair of a halfway point. Subnormal results are rounded a second time when
+ * scaled back and are within 0.75 ulp.
+ *
+ * internal::hypot_kernel is plain arithmetic on a lane type and the scale factors are picked by comparisons, so the
+ * vector hypot runs the same steps on intrin::simd lanes and gives the same results.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		constexpr T hypot_sqrt(T x) noexcept
+		{
+			return ccm::sqrt(x);
+		}
+
+		template <typename T, typename Abi>
+		intrin::simd<T, Abi> hypot_sqrt(intrin::simd<T, Abi> const & x) noexcept
+		{
+			return intrin::sqrt(x);
+		}
+
+		template <typename T, int N>
+		intrin::simd<T, intrin::abi::pack<N>> hypot_sqrt(intrin::simd<T, intrin::abi::pack<N>> const & x) noexcept
+		{
+			return intrin::lanewise([](T v) { return ccm::sqrt(v); }, x);
+		}
+
+		/// sqrt(hi + lo) for a double-double value, with one correction step from the exact residual.
+		template <typename Lane>
+		constexpr Lane hypot_sqrt(Lane hi, Lane lo) noexcept
+		{
+			const Lane h  = hypot_sqrt(hi + lo);
+			const auto hh = type::exact_mult(h, h);
+			// h * h is within a few ulp of hi, so hi - hh.hi is exact.
+			const Lane r = ((hi - hh.hi) - hh.lo) + lo;
+			return h + r / (h + h);
+		}
+
+		/**
+		 * @brief sqrt(a^2 + b^2) for finite a and b, not both zero, whose squares neither overflow nor underflow.
+		 * @tparam Lane float, double or an intrin::simd of either.
+		 */
+		template <typename Lane>
+		constexpr Lane hypot_kernel(Lane a, Lane b) noexcept
+		{
+			const auto aa = type::exact_mult(a, a);
+			const auto bb = type::exact_mult(b, b);
+			const auto s  = type::two_sum(aa.hi, bb.hi);
+			return hypot_sqrt(s.hi, s.lo + (aa.lo + bb.lo));
+		}
+
+		/// sqrt(a^2 + b^2 + c^2) under the same conditions as the two argument kernel.
+		template <typename Lane>
+		constexpr Lane hypot_kernel(Lane a, Lane b, Lane c) noexcept
+		{
+			const auto aa = type::exact_mult(a, a);
+			const auto bb = type::exact_mult(b, b);
+			const auto cc = type::exact_mult(c, c);
+			const auto s  = type::two_sum(aa.hi, bb.hi);
+			const auto t  = type::two_sum(s.hi, cc.hi);
+			return hypot_sqrt(t.hi, (s.lo + t.lo) + ((aa.lo + bb.lo) + cc.lo));
+		}
+
+		/**
+		 * @brief Power of two scale factors, picked by comparing the largest argument against big and small.
+		 *
+		 * Values above big are multiplied by down and those below small by up. Either way the largest argument ends up
+		 * where its square, and the rounding error of its square, are normal numbers. Comparisons are cheaper than
+		 * reading the exponent and work the same way on vector lanes.
+		 */
+		template <typename T>
+		struct hypot_constants;
+
+		template <>
+		struct hypot_constants<float>
+		{
+			static constexpr float big	 = 0x1.0p50F;
+			static constexpr float small = 0x1.0p-50F;
+			static constexpr float down	 = 0x1.0p-100F;
+			static constexpr float up	 = 0x1.0p100F;
+		};
+
+		template <>
+		struct hypot_constants<double>
+		{
+			static constexpr double big	  = 0x1.0p450;
+			static constexpr double small = 0x1.0p-450;
+			static constexpr double down  = 0x1.0p-600;
+			static constexpr double up	  = 0x1.0p600;
+		};
+
+		template <typename T>
+		constexpr T hypot_impl(T x, T y) noexcept
+		{
+			using FPBits_t	= support::fp::FPBits<T>;
+			using constants = hypot_constants<T>;
+
+			const FPBits_t x_bits(x);
+			const FPBits_t y_bits(y);
+			// hypot(±inf, y) is +inf even if y is NaN.
+			if (x_bits.is_inf() || y_bits.is_inf()) { return FPBits_t::inf().get_val(); }
+			if (x_bits.is_nan() || y_bits.is_nan()) { return x + y; }
+			if (x_bits.is_zero() && y_bits.is_zero()) { return T(0); }
+
+			const T ax = x_bits.abs().get_val();
+			const T ay = y_bits.abs().get_val();
+			const T m  = ax < ay ? ay : ax;
+			if (m > constants::big) { return hypot_kernel(ax * constants::down, ay * constants::down) * constants::up; }
+			if (m < constants::small) { return hypot_kernel(ax * constants::up, ay * constants::up) * constants::down; }
+			return hypot_kernel(ax, ay);
+		}
+
+		template <typename T>
+		constexpr T hypot_impl(T x, T y, T z) noexcept
+		{
+			using FPBits_t	= support::fp::FPBits<T>;
+			using constants = hypot_constants<T>;
+
+			const FPBits_t x_bits(x);
+			const FPBits_t y_bits(y);
+			const FPBits_t z_bits(z);
+			if (x_bits.is_inf() || y_bits.is_inf() || z_bits.is_inf()) { return FPBits_t::inf().get_val(); }
+			if (x_bits.is_nan() || y_bits.is_nan() || z_bits.is_nan()) { return x + y + z; }
+			if (x_bits.is_zero() && y_bits.is_zero() && z_bits.is_zero()) { return T(0); }
+
+			const T ax = x_bits.abs().get_val();
+			const T ay = y_bits.abs().get_val();
+			const T az = z_bits.abs().get_val();
+			T m		   = ax < ay ? ay : ax;
+			m		   = m < az ? az : m;
+			if (m > constants::big) { return hypot_kernel(ax * constants::down, ay * constants::down, az * constants::down) * constants::up; }
+			if (m < constants::small) { return hypot_kernel(ax * constants::up, ay * constants::up, az * constants::up) * constants::down; }
+			return hypot_kernel(ax, ay, az);
+		}
+	} // namespace internal
+
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot_gen(T x, T y) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) { return internal::hypot_impl(x, y); }
+		else { return static_cast<T>(internal::hypot_impl(static_cast<double>(x), static_cast<double>(y))); }
+	}
 
-} // namespace ccm
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot_gen(T x, T y, T z) noexcept
+	{
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) { return internal::hypot_impl(x, y, z); }
+		else { return static_cast<T>(internal::hypot_impl(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z))); }
+	}
+} // namespace ccm::gen
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Approximate reciprocal by Newton-Raphson.
+ *
+ * Subtracting the bit pattern of a positive float from a magic constant negates its exponent and gives 1/x to about
+ * 4 bits. Two Newton steps r += r * (1 - x * r) square the relative error each time and bring it to 2^-17, which is
+ * at least as good as the hardware estimates (rcpps is within 1.5 * 2^-12). That is the estimate of Steps = 0, and
+ * every further step takes it to about twice as many bits:
+ *
+ *   Steps = 0: relative error below 1.5 * 2^-12
+ *   Steps = 1: relative error below 2^-21 for float and 2^-22 for double
+ *   Steps = 2: relative error below 2^-22 for float (about 1 ulp) and 2^-43 for double
+ *
+ * The bounds hold for the vector estimates too, so they are what intrin::rcp guarantees on every ABI. The steps are
+ * plain lane arithmetic and internal::rcp_refine runs unchanged on intrin::simd lanes.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		template <typename T>
+		struct rcp_constants;
+
+		template <>
+		struct rcp_constants<float>
+		{
+			static constexpr std::uint32_t magic = 0x7EF311C3U;
+			// Above 2^125 the seed and 1/x leave the normal range.
+			static constexpr float limit = 0x1.0p125F;
+		};
+
+		template <>
+		struct rcp_constants<double>
+		{
+			static constexpr std::uint64_t magic = 0x7FDE623822FC16E6ULL;
+			// Above 2^1021 the seed and 1/x leave the normal range.
+			static constexpr double limit = 0x1.0p1021;
+		};
+
+		/// Bit trick estimate of 1/x to about 4 bits for a positive normal x below rcp_constants<T>::limit.
+		template <typename T>
+		constexpr T rcp_seed(T x) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { return support::bit_cast<float>(rcp_constants<float>::magic - support::bit_cast<std::uint32_t>(x)); }
+			else { return support::bit_cast<double>(rcp_constants<double>::magic - support::bit_cast<std::uint64_t>(x)); }
+		}
+
+		/// One Newton step for 1/x from the estimate r.
+		template <typename Lane>
+		constexpr Lane rcp_newton(Lane x, Lane r) noexcept
+		{
+			using T = type::detail::lane_value_t<Lane>;
+			return r + r * (Lane(T(1)) - x * r);
+		}
+
+		/// Steps Newton steps for 1/x from the estimate r.
+		template <int Steps, typename Lane>
+		constexpr Lane rcp_refine(Lane x, Lane r) noexcept
+		{
+			if constexpr (Steps == 0) { return r; }
+			else { return rcp_refine<Steps - 1>(x, rcp_newton(x, r)); }
+		}
+
+		/// Estimate of 1/x within 2^-17 for a positive normal x below rcp_constants<T>::limit.
+		template <typename T>
+		constexpr T rcp_estimate(T x) noexcept
+		{
+			return rcp_refine<2>(x, rcp_seed(x));
+		}
+
+		template <int Steps, typename T>
+		constexpr T rcp_impl(T x) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<T>;
+
+			const FPBits_t bits(x);
+			const T ax = bits.abs().get_val();
+
+			// ±0, ±inf, NaN and the edges of the range where 1/x is not a normal number are divided exactly.
+			if (!(ax >= FPBits_t::min_normal().get_val() && ax < rcp_constants<T>::limit)) { return T(1) / x; }
+
+			const T r = rcp_refine<Steps>(ax, rcp_estimate(ax));
+			return bits.is_neg() ? -r : r;
+		}
+	} // namespace internal
+
+	// Only float and double have a seed. long double has no faster route than the exact 1 / x.
+	template <int Steps, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rcp_gen(T x) noexcept
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rcp takes 0, 1 or 2 refinement steps");
+		return internal::rcp_impl<Steps>(x);
+	}
+} // namespace ccm::gen
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * Approximate reciprocal square root by Newton-Raphson.
+ *
+ * Halving the bit pattern of a positive float and subtracting it from a magic constant gives 1/sqrt(x) to about 5
+ * bits. Two Newton steps y += y / 2 * (1 - x * y^2) each take the relative error e to about 1.5 * e^2 and bring it to
+ * 2^-17, at least as good as the hardware estimates (rsqrtps is within 1.5 * 2^-12). That is the estimate of
+ * Steps = 0, and every further step takes it to about twice as many bits:
+ *
+ *   Steps = 0: relative error below 1.5 * 2^-12
+ *   Steps = 1: relative error below 2^-21 for float and 2^-22 for double
+ *   Steps = 2: relative error below 2^-22 for float (about 1 ulp) and 2^-42 for double
+ *
+ * As for rcp, the bounds hold for the vector estimates too and internal::rsqrt_refine runs on intrin::simd lanes.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		template <typename T>
+		struct rsqrt_constants;
+
+		template <>
+		struct rsqrt_constants<float>
+		{
+			static constexpr std::uint32_t magic = 0x5F375A86U;
+		};
+
+		template <>
+		struct rsqrt_constants<double>
+		{
+			static constexpr std::uint64_t magic = 0x5FE6EB50C7B537A9ULL;
+		};
+
+		/// Bit trick estimate of 1/sqrt(x) to about 5 bits for a positive normal finite x.
+		template <typename T>
+		constexpr T rsqrt_seed(T x) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				return support::bit_cast<float>(rsqrt_constants<float>::magic - (support::bit_cast<std::uint32_t>(x) >> 1U));
+			}
+			else { return support::bit_cast<double>(rsqrt_constants<double>::magic - (support::bit_cast<std::uint64_t>(x) >> 1U)); }
+		}
+
+		/// One Newton step for 1/sqrt(x) from the estimate y. x * y is formed first, so nothing overflows.
+		template <typename Lane>
+		constexpr Lane rsqrt_newton(Lane x, Lane y) noexcept
+		{
+			using T = type::detail::lane_value_t<Lane>;
+			return y + (y * T(0.5)) * (Lane(T(1)) - (x * y) * y);
+		}
+
+		/// Steps Newton steps for 1/sqrt(x) from the estimate y.
+		template <int Steps, typename Lane>
+		constexpr Lane rsqrt_refine(Lane x, Lane y) noexcept
+		{
+			if constexpr (Steps == 0) { return y; }
+			else { return rsqrt_refine<Steps - 1>(x, rsqrt_newton(x, y)); }
+		}
+
+		/// Estimate of 1/sqrt(x) within 2^-17 for a positive normal finite x.
+		template <typename T>
+		constexpr T rsqrt_estimate(T x) noexcept
+		{
+			return rsqrt_refine<2>(x, rsqrt_seed(x));
+		}
+
+		template <int Steps, typename T>
+		constexpr T rsqrt_impl(T x) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<T>;
+
+			// ±0, +inf, negative numbers, NaN and subnormals take the exact route: 1/sqrt(±0) = ±inf, 1/sqrt(+inf) = 0
+			// and the rest of the special values give NaN.
+			if (!(x >= FPBits_t::min_normal().get_val() && x < FPBits_t::inf().get_val())) { return T(1) / sqrt_gen(x); }
+
+			return rsqrt_refine<Steps>(x, rsqrt_estimate(x));
+		}
+	} // namespace internal
+
+	// Only float and double have a seed. long double has no faster route than the exact 1 / sqrt(x).
+	template <int Steps, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rsqrt_gen(T x) noexcept
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rsqrt takes 0, 1 or 2 refinement steps");
+		return internal::rsqrt_impl<Steps>(x);
+	}
+} // namespace ccm::gen
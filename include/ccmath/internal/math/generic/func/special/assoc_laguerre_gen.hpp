@@ -10,7 +10,90 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/special/recurrence_scale_impl.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+/*
+ * Associated Laguerre polynomials L_n^m(x) for x >= 0, and the Laguerre polynomials L_n(x) = L_n^0(x).
+ *
+ * The three-term recurrence (k + 1) L_{k+1}^m = (2k + 1 + m - x) L_k^m - (k + m) L_{k-1}^m runs upwards from L_0^m = 1
+ * and L_1^m = 1 + m - x, so the _all forms get every degree up to n_max in one pass. Large values are carried scaled,
+ * see recurrence_scale_impl.hpp, so the ones beyond double come out as the signed infinity they round to, and
+ * L_n^m(inf) is (-1)^n inf for n >= 1.
+ *
+ * Everything is computed in double. The recurrence is plain arithmetic on a lane type, so the vector assoc_laguerre
+ * runs the same steps on intrin::simd<double> lanes and gives the same results.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/**
+		 * @brief Passes L_0^m(x) to L_n^m(x) to store(k, L_k^m(x)) in increasing order and returns L_n^m(x).
+		 * @tparam Lane double or an intrin::simd of double.
+		 *
+		 * A NaN argument only shows from L_1^m on, L_0^m is 1 for every x. The callers return NaN for it in every degree.
+		 */
+		template <typename Lane, typename Store>
+		constexpr Lane assoc_laguerre_recurrence(unsigned n, unsigned m, Lane x, Store && store) noexcept
+		{
+			Lane l_prev = Lane(1.0);
+			store(0U, l_prev);
+			if (n == 0) { return l_prev; }
+
+			const auto dm = static_cast<double>(m);
+			Lane l		  = (1.0 + dm) - x;
+			recurrence_scale_state<Lane> scale;
+			recurrence_rescale(scale, l, l_prev);
+			store(1U, recurrence_value(scale, l));
+			for (unsigned k = 1; k < n; ++k)
+			{
+				const auto dk	= static_cast<double>(k);
+				const Lane a	= (2.0 * dk + 1.0 + dm) - x;
+				const Lane next = recurrence_step(scale, l, (a * l - (dk + dm) * l_prev) / (dk + 1.0), a);
+				l_prev			= l;
+				l				= next;
+				recurrence_rescale(scale, l, l_prev);
+				store(k + 1, recurrence_value(scale, l));
+			}
+			return recurrence_value(scale, l);
+		}
+
+		/// Whether every degree is NaN at x: x is negative or NaN.
+		constexpr bool laguerre_nan(double x) noexcept
+		{
+			return !(x >= 0.0);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Associated Laguerre polynomial of degree n and order m.
+	 * @return NaN for negative x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T assoc_laguerre_gen(unsigned n, unsigned m, T x) noexcept
+	{
+		const auto xd = static_cast<double>(x);
+		if (internal::laguerre_nan(xd)) { return support::fp::FPBits<T>::quiet_nan().get_val(); }
+		return static_cast<T>(internal::assoc_laguerre_recurrence(n, m, xd, [](unsigned, double) {}));
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Associated Laguerre polynomials of order m and every degree up to n_max.
+	 * @param out Receives L_0^m(x) to L_{n_max}^m(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void assoc_laguerre_all_gen(unsigned n_max, unsigned m, T x, T * out) noexcept
+	{
+		const auto xd = static_cast<double>(x);
+		if (internal::laguerre_nan(xd))
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { out[k] = support::fp::FPBits<T>::quiet_nan().get_val(); }
+			return;
+		}
+		internal::assoc_laguerre_recurrence(n_max, m, xd, [out](unsigned k, double l) { out[k] = static_cast<T>(l); });
+	}
+} // namespace ccm::gen
@@ -10,7 +10,88 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/special/legendre_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/recurrence_scale_impl.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <type_traits>
+
+/*
+ * Associated Legendre functions P_l^m(x) on [-1, 1], without the Condon-Shortley phase, as std::assoc_legendre.
+ *
+ * P_m^m = (2m - 1)!! s^m with s = sqrt(1 - x^2), P_{m+1}^m = (2m + 1) x P_m^m, and from there upwards in l
+ * (l - m + 1) P_{l+1}^m = (2l + 1) x P_l^m - (l + m) P_{l-1}^m. The degrees below m are zero, so assoc_legendre_all
+ * fills them with zeros and then continues with the recurrence. For large m the values pass the range of double, so
+ * they are carried scaled, see recurrence_scale_impl.hpp, and come out as the signed infinity they round to.
+ *
+ * Everything is computed in double. The recurrence is plain arithmetic on a lane type once s is known, so the vector
+ * assoc_legendre runs the same steps on intrin::simd<double> lanes and gives the same results.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/**
+		 * @brief Passes P_0^m(x) to P_n^m(x) to store(l, P_l^m(x)) in increasing order and returns P_n^m(x).
+		 * @tparam Lane double or an intrin::simd of double.
+		 * @param s sqrt((1 - x)(1 + x)).
+		 */
+		template <typename Lane, typename Store>
+		constexpr Lane assoc_legendre_recurrence(unsigned n, unsigned m, Lane x, Lane s, Store && store) noexcept
+		{
+			// x - x keeps NaN arguments NaN in every degree, also in the ones below m.
+			const Lane zero = x - x;
+			for (unsigned l = 0; l < m && l <= n; ++l) { store(l, zero); }
+			if (m > n) { return zero; }
+
+			Lane p_prev = Lane(1.0) + zero;
+			recurrence_scale_state<Lane> scale;
+			for (unsigned i = 1; i <= m; ++i)
+			{
+				p_prev = p_prev * (static_cast<double>(2 * i - 1) * s);
+				recurrence_rescale(scale, p_prev);
+			}
+			store(m, recurrence_value(scale, p_prev));
+			if (n == m) { return recurrence_value(scale, p_prev); }
+
+			const auto dm = static_cast<double>(m);
+			Lane p		  = (2.0 * dm + 1.0) * x * p_prev;
+			recurrence_rescale(scale, p, p_prev);
+			store(m + 1, recurrence_value(scale, p));
+			for (unsigned l = m + 1; l < n; ++l)
+			{
+				const auto dl	= static_cast<double>(l);
+				const Lane next = ((2.0 * dl + 1.0) * x * p - (dl + dm) * p_prev) / (dl - dm + 1.0);
+				p_prev			= p;
+				p				= next;
+				recurrence_rescale(scale, p, p_prev);
+				store(l + 1, recurrence_value(scale, p));
+			}
+			return recurrence_value(scale, p);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Associated Legendre function of degree n and order m.
+	 * @return 0 for m > n and NaN for x outside [-1, 1].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T assoc_legendre_gen(unsigned n, unsigned m, T x) noexcept
+	{
+		const double xd = internal::legendre_arg(static_cast<double>(x));
+		return static_cast<T>(internal::assoc_legendre_recurrence(n, m, xd, ccm::sqrt((1.0 - xd) * (1.0 + xd)), [](unsigned, double) {}));
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Associated Legendre functions of order m and every degree up to n_max.
+	 * @param out Receives P_0^m(x) to P_{n_max}^m(x), n_max + 1 values, the ones below m being 0.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void assoc_legendre_all_gen(unsigned n_max, unsigned m, T x, T * out) noexcept
+	{
+		const double xd = internal::legendre_arg(static_cast<double>(x));
+		internal::assoc_legendre_recurrence(n_max, m, xd, ccm::sqrt((1.0 - xd) * (1.0 + xd)),
+											[out](unsigned l, double p) { out[l] = static_cast<T>(p); });
+	}
+} // namespace ccm::gen
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_impl.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+/*
+ * Modified cylindrical Bessel functions of the first and second kind I_nu(x) and K_nu(x), see cyl_bessel_impl.hpp.
+ *
+ * For x < 2 Temme's series gives K_mu and K_{mu + 1}. From 2 on Temme's CF2 gives them multiplied by e^x, and the
+ * exponential is only applied at the end, merged into the final scaling by a power of 2, so neither e^x nor e^-x has
+ * to be in the range of double on its own. I is scaled with the Wronskian I_mu K_{mu + 1} + I_{mu + 1} K_mu = 1 / x.
+ * Below 2^-27 I_nu is the leading term of its series. From x >= 1500 on, I_nu(x) for nu <= x is past the range of double
+ * and K_nu(x) below it, and they are inf and 0 without further work.
+ */
+
+namespace ccm::gen::internal
+{
+	struct cyl_bessel_ik_constants
+	{
+		static constexpr double range_limit = 1500.0;
+	};
+
+	/// Temme's CF2 for K, K_mu(x) e^x and K_{mu + 1}(x) e^x for x >= 2.
+	template <typename Lane>
+	constexpr void cyl_bessel_cf2_k(double mu, Lane x, Lane & k_mu, Lane & k_mu1) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const double a1 = 0.25 - mu * mu;
+		double a		= -a1;
+		double c		= a1;
+		Lane b			= 2.0 * (1.0 + x);
+		Lane d			= 1.0 / b;
+		Lane h			= d;
+		Lane delh		= d;
+		Lane q1			= Lane(0.0);
+		Lane q2			= Lane(1.0);
+		Lane q			= Lane(a1);
+		Lane s			= 1.0 + q * delh;
+
+		auto active = Lane(0.0) == Lane(0.0);
+		for (int i = 2; recurrence_any(active); ++i)
+		{
+			a -= 2.0 * static_cast<double>(i - 1);
+			c				  = -a * c / static_cast<double>(i);
+			const Lane q_next = (q1 - b * q2) / a;
+			q1				  = q2;
+			q2				  = q_next;
+			q				  = q + c * q_next;
+			b				  = b + 2.0;
+			d				  = 1.0 / (b + a * d);
+			delh			  = (b * d - 1.0) * delh;
+			const Lane dels	  = q * delh;
+			h				  = intrin::choose(active, h + delh, h);
+			s				  = intrin::choose(active, s + dels, s);
+			active			  = active && cyl_bessel_abs(s) * constants::eps < cyl_bessel_abs(dels);
+		}
+
+		k_mu  = cyl_bessel_sqrt(constants::half_pi / x) / s;
+		k_mu1 = k_mu * (mu + x + 0.5 - a1 * h) / x;
+	}
+
+	/**
+	 * @brief K_mu(x) and K_{mu + 1}(x) for x > 0, as y 2^e K_mu and y 2^e K_{mu + 1}.
+	 *
+	 * y 2^e is e^-x from 2 on and 1 below.
+	 */
+	template <typename Lane>
+	constexpr void cyl_bessel_k_start(cyl_bessel_temme_coeffs const & tc, Lane x, Lane & k_mu, Lane & k_mu1, Lane & y, Lane & e) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto temme = x < Lane(constants::temme_limit);
+		Lane k_temme	 = Lane(0.0);
+		Lane k1_temme	 = Lane(0.0);
+		Lane k_cf2		 = Lane(0.0);
+		Lane k1_cf2		 = Lane(0.0);
+		y				 = Lane(1.0);
+		e				 = Lane(0.0);
+		if (recurrence_any(temme)) { cyl_bessel_temme_k(tc, intrin::choose(temme, x, Lane(1.0)), k_temme, k1_temme); }
+		if (recurrence_any(!temme))
+		{
+			const Lane xs = intrin::choose(temme, Lane(constants::temme_limit), x);
+			cyl_bessel_cf2_k(tc.mu, xs, k_cf2, k1_cf2);
+			Lane k		 = Lane(0.0);
+			const Lane r = exp_reduce(-xs, Lane(0.0), k);
+			y			 = intrin::choose(temme, y, r);
+			e			 = intrin::choose(temme, e, k);
+		}
+		k_mu  = intrin::choose(temme, k_temme, k_cf2);
+		k_mu1 = intrin::choose(temme, k1_temme, k1_cf2);
+	}
+
+	/**
+	 * @brief Passes I_{nu + k}(x) to store(k, v) for k from n_max down to 0, for x >= series_limit.
+	 *
+	 * As cyl_bessel_j_downward, with I_mu from the Wronskian.
+	 */
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_i_downward(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto split	 = cyl_bessel_split(nu);
+		const double top	 = nu + static_cast<double>(n_max);
+		const unsigned steps = split.nl + n_max;
+
+		// f_{top + 1} = 1 and f_top = g.
+		Lane unused		 = Lane(1.0);
+		const Lane f_top = cyl_bessel_cf1<true>(top, x, unused);
+
+		const auto step = [&](unsigned j, Lane & f, Lane & f_next, cyl_bessel_scale<Lane> & scale)
+		{
+			const double order = top - static_cast<double>(j);
+			const Lane f_prev  = (2.0 * order) / x * f + f_next;
+			f_next			   = f;
+			f				   = f_prev;
+			cyl_bessel_rescale(scale, f, f_next);
+		};
+
+		Lane f		= f_top;
+		Lane f_next = Lane(1.0);
+		cyl_bessel_scale<Lane> scale{};
+		for (unsigned j = 0; j < steps; ++j) { step(j, f, f_next, scale); }
+
+		// K scaled by y 2^e, so I by 2^-e / y.
+		Lane k_mu  = Lane(0.0);
+		Lane k_mu1 = Lane(0.0);
+		Lane y	   = Lane(1.0);
+		Lane e	   = Lane(0.0);
+		cyl_bessel_k_start(cyl_bessel_temme_init(split.mu), x, k_mu, k_mu1, y, e);
+		const Lane c	  = (1.0 / x) / ((f * k_mu1 + f_next * k_mu) * y);
+		const auto scaled = [&](Lane const & v, cyl_bessel_scale<Lane> const & at)
+		{ return exp_scale(c * v, (at.count - scale.count) * constants::rescale_exp - e); };
+
+		cyl_bessel_scale<Lane> again{};
+		store(n_max, scaled(f_top, again));
+		if (n_max == 0) { return; }
+
+		Lane h		= f_top;
+		Lane h_next = Lane(1.0);
+		for (unsigned j = 0; j < n_max; ++j)
+		{
+			step(j, h, h_next, again);
+			store(n_max - j - 1, scaled(h, again));
+		}
+	}
+
+	/// Passes K_{nu + k}(x) to store(k, v) for k from 0 up to n_max, for x > 0.
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_k_upward(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto split	= cyl_bessel_split(nu);
+		const unsigned last = split.nl + n_max;
+
+		Lane k_prev = Lane(0.0);
+		Lane k		= Lane(0.0);
+		Lane y		= Lane(1.0);
+		Lane e		= Lane(0.0);
+		cyl_bessel_k_start(cyl_bessel_temme_init(split.mu), x, k_prev, k, y, e);
+
+		cyl_bessel_scale<Lane> scale{};
+		const auto scaled = [&](Lane const & v) { return exp_scale(y * v, scale.count * constants::rescale_exp + e); };
+		if (split.nl == 0) { store(0U, scaled(k_prev)); }
+		if (last == 0) { return; }
+		if (split.nl <= 1) { store(1U - split.nl, scaled(k)); }
+
+		for (unsigned j = 1; j < last; ++j)
+		{
+			const double order = split.mu + static_cast<double>(j);
+			const Lane next	   = (2.0 * order) / x * k + k_prev;
+			k_prev			   = k;
+			k				   = next;
+			cyl_bessel_rescale(scale, k, k_prev);
+			if (j + 1 >= split.nl) { store(j + 1 - split.nl, scaled(k)); }
+		}
+	}
+
+	/// Passes I_{nu + k}(x) to store(k, v) for every k <= n_max, each k once.
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_i_impl(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+		using FPBits_t	= support::fp::FPBits<double>;
+
+		const Lane zero(0.0);
+		const Lane inf(FPBits_t::inf().get_val());
+		const Lane nan(FPBits_t::quiet_nan().get_val());
+		const double top = nu + static_cast<double>(n_max);
+		if (!(nu >= 0.0 && top < constants::order_limit))
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { store(k, nan); }
+			return;
+		}
+
+		const auto valid   = zero < x || x == zero;
+		const auto regular = zero < x && x < inf;
+		const auto series  = regular && x < Lane(constants::series_limit);
+		const auto large   = !(x < Lane(cyl_bessel_ik_constants::range_limit));
+		const auto recur   = regular && !series && !(large && !(x < Lane(top)));
+
+		// 0 for x = 0 but I_0(0) = 1, +inf for +inf, NaN for negative and NaN x.
+		const Lane fill = intrin::choose(valid, intrin::choose(x == zero, zero, inf), nan);
+
+		const auto value = [&](unsigned k, Lane const & v)
+		{
+			const double order = nu + static_cast<double>(k);
+			Lane r			   = intrin::choose(regular, v, order == 0.0 ? intrin::choose(x == zero, Lane(1.0), fill) : fill);
+			if (recurrence_any(series))
+			{
+				const Lane xs = intrin::choose(series, x, Lane(constants::series_limit));
+				r			  = intrin::choose(series, cyl_bessel_leading(order, lgamma_positive(order + 1.0), xs), r);
+			}
+			store(k, intrin::choose(regular && large && !(x < Lane(order)), inf, r));
+		};
+
+		if (recurrence_any(recur)) { cyl_bessel_i_downward(nu, n_max, intrin::choose(recur, x, Lane(1.0)), value); }
+		else
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { value(k, zero); }
+		}
+	}
+
+	/// Passes K_{nu + k}(x) to store(k, v) for every k <= n_max, each k once.
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_k_impl(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+		using FPBits_t	= support::fp::FPBits<double>;
+
+		const Lane zero(0.0);
+		const Lane inf(FPBits_t::inf().get_val());
+		const Lane nan(FPBits_t::quiet_nan().get_val());
+		const double top = nu + static_cast<double>(n_max);
+		if (!(nu >= 0.0 && top < constants::order_limit))
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { store(k, nan); }
+			return;
+		}
+
+		const auto regular = zero < x && x < inf;
+		const auto large   = !(x < Lane(cyl_bessel_ik_constants::range_limit));
+		const auto recur   = regular && !(large && !(x < Lane(top)));
+
+		// +inf for x = 0, 0 for +inf, NaN for negative and NaN x.
+		const Lane fill = intrin::choose(x == zero, inf, intrin::choose(x == inf, zero, nan));
+
+		const auto value = [&](unsigned k, Lane const & v)
+		{
+			const double order = nu + static_cast<double>(k);
+			store(k, intrin::choose(regular, intrin::choose(large && !(x < Lane(order)), zero, v), fill));
+		};
+
+		if (recurrence_any(recur)) { cyl_bessel_k_upward(nu, n_max, intrin::choose(recur, x, Lane(1.0)), value); }
+		else
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { value(k, zero); }
+		}
+	}
+} // namespace ccm::gen::internal
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/generic/func/misc/gamma_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/recurrence_scale_impl.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <array>
+#include <type_traits>
+
+/*
+ * Pieces shared by the cylindrical Bessel functions J, Y, I and K of a real order nu >= 0, after Numerical Recipes'
+ * bessjy and bessik.
+ *
+ * nu is split into nu = mu + nl with nl = int(nu + 1/2) and |mu| <= 1/2. Near mu the functions of the second kind come
+ * from Temme's series for x < 2 and from Steed's or Temme's continued fraction CF2 above, and the upward recurrence
+ * takes them to nu, which is stable for them. The functions of the first kind start from the continued fraction CF1 for
+ * the ratio of two consecutive orders at nu, go down to mu by the recurrence, which is stable for them, and are scaled
+ * there with the Wronskian. Values that grow past 2^256 on the way are scaled down and the number of times is counted,
+ * so the recurrences do not overflow before the result does.
+ *
+ * Everything is plain arithmetic and intrin::choose on a lane type, with the order shared by all lanes, so double and
+ * intrin::simd<double> lanes take the same steps. Every lane takes the same orders, and the continued fractions and
+ * series run until all of their lanes have converged, each lane keeping its value from the step where it did.
+ */
+
+namespace ccm::gen::internal
+{
+	struct cyl_bessel_constants
+	{
+		// Relative size of the last term or factor at which the series and continued fractions stop.
+		static constexpr double eps = 0x1.0p-52;
+		// Keeps the modified Lentz method clear of division by zero.
+		static constexpr double tiny = 0x1.0p-900;
+
+		// Below series_limit J_nu and I_nu are the leading term of their series, and x < temme_limit takes Temme's series.
+		static constexpr double series_limit = 0x1.0p-27;
+		static constexpr double temme_limit	 = 2.0;
+		// Orders from order_limit on give NaN, as the recurrences would take that many steps.
+		static constexpr double order_limit = 0x1.0p31;
+
+		static constexpr double rescale_limit = 0x1.0p256;
+		static constexpr double rescale		  = 0x1.0p-256;
+		static constexpr double rescale_exp	  = 256.0;
+
+		static constexpr double pi			= 0x1.921fb54442d18p+1;
+		static constexpr double half_pi		= 0x1.921fb54442d18p+0;
+		static constexpr double two_over_pi = 0x1.45f306dc9c883p-1;
+		static constexpr double ln2_hi		= 0x1.62e42fefa39efp-1;
+		static constexpr double ln2_lo		= 0x1.abc9e3b39803fp-56;
+
+		// Coefficients a_j of 1 / Gamma(1 + t) = sum a_j t^j, the odd ones from a_21 down to a_1 and the even ones from
+		// a_20 down to a_0, for Temme's gamma_1 and gamma_2.
+		static constexpr double inv_gamma_odd[] = {
+			0x1.1f20151323cd0p-41, 0x1.11d065bfaf067p-37, -0x1.44b4cedca388fp-30, 0x1.a44b7ba22d629p-28,
+			0x1.302509dbc0de3p-20, -0x1.51ce8af47eabep-16, -0x1.c364fe6f1563dp-13, 0x1.d919c527f60b2p-8,
+			-0x1.59af103c34092p-5, -0x1.5815e8fa27048p-5, 0x1.2788cfc6fb619p-1,
+		};
+		static constexpr double inv_gamma_even[] = {
+			-0x1.0423bac8ca3fbp-38, 0x1.cae7675c18607p-34, 0x1.57bc3fc384334p-28, -0x1.b9986666c225dp-23,
+			-0x1.4fad41fc34fbbp-20, 0x1.0c8a78cd9f9d2p-13, -0x1.317112ce3a2a8p-10, -0x1.3b4af28483e21p-7,
+			0x1.5512320b43fbep-3,	-0x1.4fcf4026afa2ep-1, 0x1.0000000000000p+0,
+		};
+
+		// sinh(e) / e = sum e^2k / (2k + 1)! in e^2 for |e| < sinhc_limit, highest degree first.
+		static constexpr double sinhc_limit = 0.5;
+		static constexpr double sinhc[]		= {
+			0x1.2f49b46814157p-57, 0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-41, 0x1.6124613a86d09p-33, 0x1.ae64567f544e4p-26,
+			0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-13, 0x1.1111111111111p-7,	 0x1.5555555555555p-3,	0x1.0000000000000p+0,
+		};
+	};
+
+	template <typename Lane>
+	constexpr Lane cyl_bessel_abs(Lane v) noexcept
+	{
+		return intrin::choose(v < Lane(0.0), -v, v);
+	}
+
+	constexpr double cyl_bessel_sqrt(double x) noexcept
+	{
+		return ccm::sqrt(x);
+	}
+
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> cyl_bessel_sqrt(intrin::simd<T, Abi> const & x) noexcept
+	{
+		return intrin::sqrt(x);
+	}
+
+	constexpr void cyl_bessel_sincos(double x, double & s, double & c) noexcept
+	{
+		sincos_impl(x, s, c);
+	}
+
+	/// sin(x) and cos(x) of every lane, taken lane by lane.
+	template <typename T, typename Abi>
+	void cyl_bessel_sincos(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> & s, intrin::simd<T, Abi> & c) noexcept
+	{
+		std::array<T, intrin::simd<T, Abi>::size()> xs{};
+		std::array<T, intrin::simd<T, Abi>::size()> ss{};
+		std::array<T, intrin::simd<T, Abi>::size()> cs{};
+		x.copy_to(xs.data(), intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < xs.size(); ++i) { sincos_impl(xs[i], ss[i], cs[i]); }
+		s = intrin::simd<T, Abi>(ss.data(), intrin::element_aligned_tag());
+		c = intrin::simd<T, Abi>(cs.data(), intrin::element_aligned_tag());
+	}
+
+	/// exp(a) for |a| < 2^20.
+	template <typename Lane>
+	constexpr Lane cyl_bessel_exp(Lane a) noexcept
+	{
+		Lane k		 = Lane(0.0);
+		const Lane y = exp_reduce(a, Lane(0.0), k);
+		return exp_scale(y, k);
+	}
+
+	/// Rescales done so far in a recurrence, per lane.
+	template <typename Lane>
+	struct cyl_bessel_scale
+	{
+		Lane count = Lane(0.0);
+	};
+
+	/// Scales v and v_other down by 2^-256 in the lanes where |v| passed 2^256.
+	template <typename Lane>
+	constexpr void cyl_bessel_rescale(cyl_bessel_scale<Lane> & scale, Lane & v, Lane & v_other) noexcept
+	{
+		using constants	 = cyl_bessel_constants;
+		const auto large = Lane(constants::rescale_limit) < v || v < Lane(-constants::rescale_limit);
+		if (!recurrence_any(large)) { return; }
+
+		const Lane f = intrin::choose(large, Lane(constants::rescale), Lane(1.0));
+		scale.count	 = scale.count + intrin::choose(large, Lane(1.0), Lane(0.0));
+		v			 = v * f;
+		v_other		 = v_other * f;
+	}
+
+	/// nu = mu + nl with nl = int(nu + 1/2), for 0 <= nu < cyl_bessel_constants::order_limit.
+	struct cyl_bessel_order
+	{
+		double mu;
+		unsigned nl;
+	};
+
+	constexpr cyl_bessel_order cyl_bessel_split(double nu) noexcept
+	{
+		const auto nl = static_cast<unsigned>(nu + 0.5);
+		return {nu - static_cast<double>(nl), nl};
+	}
+
+	/**
+	 * @brief (x / 2)^nu / Gamma(nu + 1), the leading term of the series of J_nu and I_nu, for x > 0.
+	 * @param lg lgamma(nu + 1) as a double-double value.
+	 *
+	 * The power is taken as exp(nu log(x / 2) - lgamma(nu + 1)) with the exponent carried as a double-double value, so
+	 * its size does not reach the result.
+	 */
+	template <typename Lane>
+	constexpr Lane cyl_bessel_leading(double nu, type::DoubleDouble const & lg, Lane x) noexcept
+	{
+		using constants		   = cyl_bessel_constants;
+		constexpr double floor = -2000.0;
+
+		if (nu == 0.0) { return Lane(1.0); }
+		const auto l  = gamma_log(x);
+		const auto lx = type::two_sum(l.hi, Lane(-constants::ln2_hi));
+		const auto p  = type::exact_mult(Lane(nu), lx.hi);
+		const auto a  = type::two_sum(p.hi, Lane(-lg.hi));
+		const Lane lo = a.lo + (p.lo + nu * (lx.lo + (l.lo - constants::ln2_lo)) - lg.lo);
+
+		// Far below the range of double the exponent is only clamped, the result being 0 either way.
+		const auto under = a.hi < Lane(floor);
+		Lane k			 = Lane(0.0);
+		const Lane y	 = exp_reduce(intrin::choose(under, Lane(floor), a.hi), intrin::choose(under, Lane(0.0), lo), k);
+		return exp_scale(y, k);
+	}
+
+	/// The parts of Temme's series that only depend on mu.
+	struct cyl_bessel_temme_coeffs
+	{
+		double mu;
+		// Temme's gamma_1 and gamma_2, 1 / Gamma(1 + mu) and 1 / Gamma(1 - mu).
+		double gam1;
+		double gam2;
+		double gampl;
+		double gammi;
+		// pi mu / sin(pi mu), and pi (pi mu / 2) (sin(pi mu / 2) / (pi mu / 2))^2.
+		double fact;
+		double r;
+	};
+
+	constexpr cyl_bessel_temme_coeffs cyl_bessel_temme_init(double mu) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		cyl_bessel_temme_coeffs tc{};
+		const double mu2 = mu * mu;
+		tc.mu			 = mu;
+		tc.gam1			 = -support::polyeval_array(mu2, constants::inv_gamma_odd);
+		tc.gam2			 = support::polyeval_array(mu2, constants::inv_gamma_even);
+		tc.gampl		 = tc.gam2 - mu * tc.gam1;
+		tc.gammi		 = tc.gam2 + mu * tc.gam1;
+
+		const double pimu  = constants::pi * mu;
+		const double pimu2 = 0.5 * pimu;
+		double s		   = 0.0;
+		double c		   = 0.0;
+		tc.fact			   = 1.0;
+		double fact3	   = 1.0;
+		if (mu != 0.0)
+		{
+			sincos_impl(pimu, s, c);
+			tc.fact = pimu / s;
+			sincos_impl(pimu2, s, c);
+			fact3 = s / pimu2;
+		}
+		tc.r = constants::pi * pimu2 * fact3 * fact3;
+		return tc;
+	}
+
+	/// The parts of Temme's series that depend on x: d = log(2 / x), cosh(mu d), sinh(mu d) / (mu d) and exp(mu d).
+	template <typename Lane>
+	struct cyl_bessel_temme_base
+	{
+		Lane d;
+		Lane cosh_e;
+		Lane sinhc_e;
+		Lane exp_e;
+	};
+
+	template <typename Lane>
+	constexpr cyl_bessel_temme_base<Lane> cyl_bessel_temme_base_init(double mu, Lane x) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		cyl_bessel_temme_base<Lane> b{};
+		const auto l = gamma_log(x);
+		b.d			 = (constants::ln2_hi - l.hi) + (constants::ln2_lo - l.lo);
+
+		const Lane e  = mu * b.d;
+		b.exp_e		  = cyl_bessel_exp(e);
+		const Lane ie = 1.0 / b.exp_e;
+		b.cosh_e	  = 0.5 * (b.exp_e + ie);
+		const auto small = cyl_bessel_abs(e) < Lane(constants::sinhc_limit);
+		// e is not 0 where it is used, as small lanes take the series.
+		const Lane e_nz = intrin::choose(small, Lane(1.0), e);
+		b.sinhc_e		= intrin::choose(small, support::polyeval_array(e * e, constants::sinhc), (b.exp_e - ie) / (2.0 * e_nz));
+		return b;
+	}
+
+	/// Y_mu(x) and Y_{mu + 1}(x) from Temme's series, for 0 < x < 2.
+	template <typename Lane>
+	constexpr void cyl_bessel_temme_y(cyl_bessel_temme_coeffs const & tc, Lane x, Lane & y_mu, Lane & y_mu1) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto b   = cyl_bessel_temme_base_init(tc.mu, x);
+		const double m = tc.mu;
+		Lane ff		   = constants::two_over_pi * tc.fact * (tc.gam1 * b.cosh_e + tc.gam2 * b.sinhc_e * b.d);
+		Lane p		   = b.exp_e / (tc.gampl * constants::pi);
+		Lane q		   = 1.0 / (b.exp_e * (constants::pi * tc.gammi));
+		const Lane x2  = 0.5 * x;
+		const Lane dd  = -(x2 * x2);
+		Lane c		   = Lane(1.0);
+		Lane sum	   = ff + tc.r * q;
+		Lane sum1	   = p;
+
+		auto active = Lane(0.0) == Lane(0.0);
+		for (int i = 1; recurrence_any(active); ++i)
+		{
+			const auto di	= static_cast<double>(i);
+			ff				= (di * ff + p + q) / (di * di - m * m);
+			c				= c * (dd / di);
+			p				= p / (di - m);
+			q				= q / (di + m);
+			const Lane del	= c * (ff + tc.r * q);
+			const Lane del1 = c * p - di * del;
+			sum				= intrin::choose(active, sum + del, sum);
+			sum1			= intrin::choose(active, sum1 + del1, sum1);
+			active			= active && (1.0 + cyl_bessel_abs(sum)) * constants::eps < cyl_bessel_abs(del);
+		}
+		y_mu  = -sum;
+		y_mu1 = -sum1 * (2.0 / x);
+	}
+
+	/// K_mu(x) and K_{mu + 1}(x) from Temme's series, for 0 < x < 2.
+	template <typename Lane>
+	constexpr void cyl_bessel_temme_k(cyl_bessel_temme_coeffs const & tc, Lane x, Lane & k_mu, Lane & k_mu1) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto b   = cyl_bessel_temme_base_init(tc.mu, x);
+		const double m = tc.mu;
+		Lane ff		   = tc.fact * (tc.gam1 * b.cosh_e + tc.gam2 * b.sinhc_e * b.d);
+		Lane p		   = 0.5 * b.exp_e / tc.gampl;
+		Lane q		   = 0.5 / (b.exp_e * tc.gammi);
+		const Lane x2  = 0.5 * x;
+		const Lane dd  = x2 * x2;
+		Lane c		   = Lane(1.0);
+		Lane sum	   = ff;
+		Lane sum1	   = p;
+
+		auto active = Lane(0.0) == Lane(0.0);
+		for (int i = 1; recurrence_any(active); ++i)
+		{
+			const auto di	= static_cast<double>(i);
+			ff				= (di * ff + p + q) / (di * di - m * m);
+			c				= c * (dd / di);
+			p				= p / (di - m);
+			q				= q / (di + m);
+			const Lane del	= c * ff;
+			const Lane del1 = c * (p - di * ff);
+			sum				= intrin::choose(active, sum + del, sum);
+			sum1			= intrin::choose(active, sum1 + del1, sum1);
+			active			= active && cyl_bessel_abs(sum) * constants::eps < cyl_bessel_abs(del);
+		}
+		k_mu  = sum;
+		k_mu1 = sum1 * (2.0 / x);
+	}
+
+	/**
+	 * @brief CF1 for the ratio g = F_nu / F_{nu + 1} of the functions of the first kind, by the modified Lentz method.
+	 *
+	 * g = b_1 - sign / (b_2 - sign / (b_3 - ...)) with b_k = 2 (nu + k) / x, sign being 1 for J and -1 for I. For J the
+	 * signs of the partial denominators give the sign of J_{nu + 1}, which is returned in sign_next. For I it is 1.
+	 */
+	template <bool modified, typename Lane>
+	constexpr Lane cyl_bessel_cf1(double nu, Lane x, Lane & sign_next) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const Lane xi2 = 2.0 / x;
+		const Lane t(constants::tiny);
+		Lane b		= (nu + 1.0) * xi2;
+		Lane g		= b;
+		Lane c		= b;
+		Lane d		= Lane(0.0);
+		sign_next	= Lane(1.0);
+		auto active = Lane(0.0) == Lane(0.0);
+		for (int i = 2; recurrence_any(active); ++i)
+		{
+			b = (nu + static_cast<double>(i)) * xi2;
+			if constexpr (modified)
+			{
+				d = 1.0 / (b + d);
+				c = b + 1.0 / c;
+			}
+			else
+			{
+				d = b - d;
+				d = intrin::choose(cyl_bessel_abs(d) < t, t, d);
+				c = b - 1.0 / c;
+				c = intrin::choose(cyl_bessel_abs(c) < t, t, c);
+				d = 1.0 / d;
+				sign_next = intrin::choose(active && d < Lane(0.0), -sign_next, sign_next);
+			}
+			const Lane del = c * d;
+			g			   = intrin::choose(active, g * del, g);
+			active		   = active && Lane(constants::eps) < cyl_bessel_abs(del - 1.0);
+		}
+		return g;
+	}
+} // namespace ccm::gen::internal
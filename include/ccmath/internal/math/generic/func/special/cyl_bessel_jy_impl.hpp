@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_impl.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+/*
+ * Cylindrical Bessel functions of the first and second kind J_nu(x) and Y_nu(x), see cyl_bessel_impl.hpp.
+ *
+ * For x < 2 Temme's series gives Y_mu and Y_{mu + 1}, and the Wronskian J_{mu + 1} Y_mu - J_mu Y_{mu + 1} = 2 / (pi x)
+ * scales J. From 2 on Steed's CF2 gives p + iq = (J'_mu + i Y'_mu) / (J_mu + i Y_mu), which fixes both the size of J_mu
+ * and Y_mu / J_mu. For Y, CF1 runs at mu itself. CF1 takes about x steps once x is past the order, so from
+ * x >= max(25, nu^2 / 8) on Hankel's asymptotic expansion is used instead. There its terms get below the rounding
+ * error before they start to grow. Below 2^-27 J_nu is the leading term of its series. Y_nu goes to -inf there, and
+ * values past the range of double become -inf.
+ */
+
+namespace ccm::gen::internal
+{
+	struct cyl_bessel_jy_constants
+	{
+		// Hankel's expansion is used from x >= max(hankel_min, hankel_factor * nu^2) on.
+		static constexpr double hankel_min	  = 25.0;
+		static constexpr double hankel_factor = 0.125;
+		// The terms are below the rounding error long before this many there.
+		static constexpr int hankel_terms = 100;
+	};
+
+	constexpr double cyl_bessel_hankel_limit(double nu) noexcept
+	{
+		using constants = cyl_bessel_jy_constants;
+
+		const double limit = constants::hankel_factor * nu * nu;
+		return limit < constants::hankel_min ? constants::hankel_min : limit;
+	}
+
+	/// J_nu(x) and Y_nu(x) from Hankel's asymptotic expansion, for x >= cyl_bessel_hankel_limit(nu), s = sin(x) and c = cos(x).
+	template <typename Lane>
+	constexpr void cyl_bessel_hankel(double nu, Lane x, Lane s, Lane c, Lane & j, Lane & y) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		// P and Q are the sums of the even and odd terms t_k = prod_{i <= k} (4 nu^2 - (2i - 1)^2) / (k! (8x)^k), with
+		// alternating signs in each.
+		const double mu4 = 4.0 * nu * nu;
+		const Lane x8	 = 8.0 * x;
+		Lane t			 = Lane(1.0);
+		Lane p			 = Lane(1.0);
+		Lane q			 = Lane(0.0);
+		auto active		 = Lane(0.0) == Lane(0.0);
+		for (int k = 1; k < cyl_bessel_jy_constants::hankel_terms && recurrence_any(active); ++k)
+		{
+			const auto odd = static_cast<double>(2 * k - 1);
+			t			   = t * ((mu4 - odd * odd) / (static_cast<double>(k) * x8));
+			const Lane v   = (k & 2) != 0 ? -t : t;
+			if (k % 2 == 0) { p = intrin::choose(active, p + v, p); }
+			else { q = intrin::choose(active, q + v, q); }
+			active = active && Lane(constants::eps) < cyl_bessel_abs(t);
+		}
+
+		// The phase x - (nu / 2 + 1/4) pi, with (nu / 2 + 1/4) reduced modulo 2 first, which is exact.
+		double phase = 0.5 * nu + 0.25;
+		phase		 = phase - 2.0 * static_cast<double>(static_cast<long long>(0.5 * phase));
+		double sp	 = 0.0;
+		double cp	 = 0.0;
+		sincos_impl(constants::pi * phase, sp, cp);
+		const Lane cos_chi = c * cp + s * sp;
+		const Lane sin_chi = s * cp - c * sp;
+
+		const Lane amp = cyl_bessel_sqrt(constants::two_over_pi / x);
+		j			   = amp * (p * cos_chi - q * sin_chi);
+		y			   = amp * (p * sin_chi + q * cos_chi);
+	}
+
+	/// Steed's CF2, p + iq = (J'_mu + i Y'_mu) / (J_mu + i Y_mu), for x >= 2.
+	template <typename Lane>
+	constexpr void cyl_bessel_cf2_jy(double mu, Lane x, Lane & p, Lane & q) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const Lane t(constants::tiny);
+		const Lane xi = 1.0 / x;
+		const Lane br = 2.0 * x;
+		double a	  = 0.25 - mu * mu;
+		double bi	  = 2.0;
+		p			  = -0.5 * xi;
+		q			  = Lane(1.0);
+
+		const Lane fact0 = a * xi / (p * p + q * q);
+		Lane cr			 = br + q * fact0;
+		Lane ci			 = bi + p * fact0;
+		Lane den		 = br * br + bi * bi;
+		Lane dr			 = br / den;
+		Lane di			 = -bi / den;
+		Lane dlr		 = cr * dr - ci * di;
+		Lane dli		 = cr * di + ci * dr;
+		Lane temp		 = p * dlr - q * dli;
+		q				 = p * dli + q * dlr;
+		p				 = temp;
+
+		auto active = Lane(0.0) == Lane(0.0);
+		for (int i = 2; recurrence_any(active); ++i)
+		{
+			a += 2.0 * static_cast<double>(i - 1);
+			bi += 2.0;
+			dr				  = a * dr + br;
+			di				  = a * di + bi;
+			dr				  = intrin::choose(cyl_bessel_abs(dr) + cyl_bessel_abs(di) < t, t, dr);
+			const Lane fact	  = a / (cr * cr + ci * ci);
+			cr				  = br + cr * fact;
+			ci				  = bi - ci * fact;
+			cr				  = intrin::choose(cyl_bessel_abs(cr) + cyl_bessel_abs(ci) < t, t, cr);
+			den				  = dr * dr + di * di;
+			dr				  = dr / den;
+			di				  = -di / den;
+			dlr				  = cr * dr - ci * di;
+			dli				  = cr * di + ci * dr;
+			temp			  = p * dlr - q * dli;
+			const Lane q_next = p * dli + q * dlr;
+			p				  = intrin::choose(active, temp, p);
+			q				  = intrin::choose(active, q_next, q);
+			active			  = active && Lane(constants::eps) < cyl_bessel_abs(dlr - 1.0) + cyl_bessel_abs(dli);
+		}
+	}
+
+	/// The factor c with J_mu = c f and J_{mu + 1} = c f_next, for f and f_next proportional to them.
+	template <typename Lane>
+	constexpr Lane cyl_bessel_j_norm(cyl_bessel_temme_coeffs const & tc, Lane x, Lane f, Lane f_next) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto temme = x < Lane(constants::temme_limit);
+		Lane c_temme	 = Lane(0.0);
+		Lane c_steed	 = Lane(0.0);
+		if (recurrence_any(temme))
+		{
+			const Lane xt = intrin::choose(temme, x, Lane(1.0));
+			Lane y		  = Lane(0.0);
+			Lane y_next	  = Lane(0.0);
+			cyl_bessel_temme_y(tc, xt, y, y_next);
+			c_temme = (constants::two_over_pi / xt) / (f_next * y - f * y_next);
+		}
+		if (recurrence_any(!temme))
+		{
+			const Lane xs = intrin::choose(temme, Lane(constants::temme_limit), x);
+			Lane p		  = Lane(0.0);
+			Lane q		  = Lane(0.0);
+			cyl_bessel_cf2_jy(tc.mu, xs, p, q);
+			// |J_mu|^2 ((p - J'_mu / J_mu)^2 + q^2) = q 2 / (pi x), and J_mu has the sign of f.
+			const Lane a = p * f - (tc.mu / xs * f - f_next);
+			const Lane b = q * f;
+			c_steed		 = cyl_bessel_sqrt((constants::two_over_pi / xs) * q / (a * a + b * b));
+		}
+		return intrin::choose(temme, c_temme, c_steed);
+	}
+
+	/**
+	 * @brief Passes J_{nu + k}(x) to store(k, v) for k from n_max down to 0, for x >= series_limit.
+	 *
+	 * CF1 runs at nu + n_max and the recurrence goes down from there. With n_max = 0 the value comes from that pass.
+	 * Otherwise a second pass stores the values, scaled by the rescales still to come below them.
+	 */
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_j_downward(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto split	 = cyl_bessel_split(nu);
+		const double top	 = nu + static_cast<double>(n_max);
+		const unsigned steps = split.nl + n_max;
+
+		// f_{top + 1} = sign and f_top = g sign have the signs of J.
+		Lane sign		 = Lane(1.0);
+		const Lane g	 = cyl_bessel_cf1<false>(top, x, sign);
+		const Lane f_top = g * sign;
+
+		const auto step = [&](unsigned j, Lane & f, Lane & f_next, cyl_bessel_scale<Lane> & scale)
+		{
+			const double order = top - static_cast<double>(j);
+			const Lane f_prev  = (2.0 * order) / x * f - f_next;
+			f_next			   = f;
+			f				   = f_prev;
+			cyl_bessel_rescale(scale, f, f_next);
+		};
+
+		Lane f		= f_top;
+		Lane f_next = sign;
+		cyl_bessel_scale<Lane> scale{};
+		for (unsigned j = 0; j < steps; ++j) { step(j, f, f_next, scale); }
+
+		const Lane c	  = cyl_bessel_j_norm(cyl_bessel_temme_init(split.mu), x, f, f_next);
+		const auto scaled = [&](Lane const & v, cyl_bessel_scale<Lane> const & at)
+		{ return exp_scale(c * v, (at.count - scale.count) * constants::rescale_exp); };
+
+		cyl_bessel_scale<Lane> again{};
+		store(n_max, scaled(f_top, again));
+		if (n_max == 0) { return; }
+
+		Lane h		= f_top;
+		Lane h_next = sign;
+		for (unsigned j = 0; j < n_max; ++j)
+		{
+			step(j, h, h_next, again);
+			store(n_max - j - 1, scaled(h, again));
+		}
+	}
+
+	/// Y_mu(x) and Y_{mu + 1}(x) for x > 0.
+	template <typename Lane>
+	constexpr void cyl_bessel_y_start(cyl_bessel_temme_coeffs const & tc, Lane x, Lane & y, Lane & y_next) noexcept
+	{
+		using constants = cyl_bessel_constants;
+
+		const auto temme = x < Lane(constants::temme_limit);
+		Lane y_temme	 = Lane(0.0);
+		Lane y1_temme	 = Lane(0.0);
+		Lane y_steed	 = Lane(0.0);
+		Lane y1_steed	 = Lane(0.0);
+		if (recurrence_any(temme)) { cyl_bessel_temme_y(tc, intrin::choose(temme, x, Lane(1.0)), y_temme, y1_temme); }
+		if (recurrence_any(!temme))
+		{
+			const Lane xs = intrin::choose(temme, Lane(constants::temme_limit), x);
+			Lane sign	  = Lane(1.0);
+			const Lane f  = cyl_bessel_cf1<false>(tc.mu, xs, sign) * sign;
+			Lane p		  = Lane(0.0);
+			Lane q		  = Lane(0.0);
+			cyl_bessel_cf2_jy(tc.mu, xs, p, q);
+
+			// With J'_mu = p J_mu - q Y_mu and Y'_mu = p Y_mu + q J_mu.
+			const Lane a  = p * f - (tc.mu / xs * f - sign);
+			const Lane b  = q * f;
+			const Lane c  = cyl_bessel_sqrt((constants::two_over_pi / xs) * q / (a * a + b * b));
+			y_steed		  = c * a / q;
+			const Lane yp = p * y_steed + q * (c * f);
+			y1_steed	  = tc.mu / xs * y_steed - yp;
+		}
+		y	   = intrin::choose(temme, y_temme, y_steed);
+		y_next = intrin::choose(temme, y1_temme, y1_steed);
+	}
+
+	/// Passes Y_{nu + k}(x) to store(k, v) for k from 0 up to n_max, for x > 0. Orders past the range of double give -inf.
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_y_upward(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using FPBits_t = support::fp::FPBits<double>;
+
+		const auto split	= cyl_bessel_split(nu);
+		const unsigned last = split.nl + n_max;
+		const Lane inf(FPBits_t::inf().get_val());
+
+		Lane y_prev = Lane(0.0);
+		Lane y		= Lane(0.0);
+		cyl_bessel_y_start(cyl_bessel_temme_init(split.mu), x, y_prev, y);
+		if (split.nl == 0) { store(0U, y_prev); }
+		if (last == 0) { return; }
+		if (split.nl <= 1) { store(1U - split.nl, y); }
+
+		for (unsigned j = 1; j < last; ++j)
+		{
+			// Overflowed lanes stay at their infinity.
+			const double order	= split.mu + static_cast<double>(j);
+			const auto overflow = y == inf || y == -inf;
+			const Lane next		= intrin::choose(overflow, y, (2.0 * order) / x * y - y_prev);
+			y_prev				= y;
+			y					= next;
+			if (j + 1 >= split.nl) { store(j + 1 - split.nl, y); }
+		}
+	}
+
+	/**
+	 * @brief Passes J_{nu + k}(x) to store(k, v) for every k <= n_max, each k once.
+	 *
+	 * Every lane takes the leading term of the series, Hankel's expansion or the recurrence, and each of them runs if
+	 * some lane needs it.
+	 */
+	template <typename Lane, typename Store>
+	constexpr void cyl_bessel_j_impl(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+		using FPBits_t	= support::fp::FPBits<double>;
+
+		const Lane zero(0.0);
+		const Lane inf(FPBits_t::inf().get_val());
+		const Lane nan(FPBits_t::quiet_nan().get_val());
+		const double top = nu + static_cast<double>(n_max);
+		if (!(nu >= 0.0 && top < constants::order_limit))
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { store(k, nan); }
+			return;
+		}
+
+		const auto valid   = zero < x || x == zero;
+		const auto regular = zero < x && x < inf;
+		const auto series  = regular && x < Lane(constants::series_limit);
+		const auto recur   = regular && !series && x < Lane(cyl_bessel_hankel_limit(top));
+		const auto hankel  = regular && !(x < Lane(cyl_bessel_hankel_limit(nu)));
+
+		// 0 for x = 0 and +inf but J_0(0) = 1, NaN for negative and NaN x.
+		const Lane fill = intrin::choose(valid, zero, nan);
+
+		Lane s = zero;
+		Lane c = zero;
+		if (recurrence_any(hankel)) { cyl_bessel_sincos(intrin::choose(hankel, x, zero), s, c); }
+
+		const auto value = [&](unsigned k, Lane const & v)
+		{
+			const double order = nu + static_cast<double>(k);
+			Lane r			   = intrin::choose(regular, v, order == 0.0 ? intrin::choose(x == zero, Lane(1.0), fill) : fill);
+			if (recurrence_any(series))
+			{
+				const Lane xs = intrin::choose(series, x, Lane(constants::series_limit));
+				r			  = intrin::choose(series, cyl_bessel_leading(order, lgamma_positive(order + 1.0), xs), r);
+			}
+			const double limit = cyl_bessel_hankel_limit(order);
+			const auto large   = regular && !(x < Lane(limit));
+			if (recurrence_any(large))
+			{
+				Lane j = zero;
+				Lane y = zero;
+				cyl_bessel_hankel(order, intrin::choose(large, x, Lane(limit)), s, c, j, y);
+				r = intrin::choose(large, j, r);
+			}
+			store(k, r);
+		};
+
+		if (recurrence_any(recur)) { cyl_bessel_j_downward(nu, n_max, intrin::choose(recur, x, Lane(1.0)), value); }
+		else
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { value(k, zero); }
+		}
+	}
+
+	/// Passes Y_{nu + k}(x) to store(k, v) for every k <= n_max, each k once.
+	template <typename Lane, typename Store>
+	constexpr void cyl_neumann_impl(double nu, unsigned n_max, Lane x, Store && store) noexcept
+	{
+		using constants = cyl_bessel_constants;
+		using FPBits_t	= support::fp::FPBits<double>;
+
+		const Lane zero(0.0);
+		const Lane inf(FPBits_t::inf().get_val());
+		const Lane nan(FPBits_t::quiet_nan().get_val());
+		const double top = nu + static_cast<double>(n_max);
+		if (!(nu >= 0.0 && top < constants::order_limit))
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { store(k, nan); }
+			return;
+		}
+
+		const auto regular = zero < x && x < inf;
+		const auto recur   = regular && x < Lane(cyl_bessel_hankel_limit(top));
+		const auto hankel  = regular && !(x < Lane(cyl_bessel_hankel_limit(nu)));
+
+		// -inf for x = 0, 0 for +inf, NaN for negative and NaN x.
+		const Lane fill = intrin::choose(x == zero, -inf, intrin::choose(x == inf, zero, nan));
+
+		Lane s = zero;
+		Lane c = zero;
+		if (recurrence_any(hankel)) { cyl_bessel_sincos(intrin::choose(hankel, x, zero), s, c); }
+
+		const auto value = [&](unsigned k, Lane const & v)
+		{
+			const double order = nu + static_cast<double>(k);
+			Lane r			   = intrin::choose(regular, v, fill);
+			const double limit = cyl_bessel_hankel_limit(order);
+			const auto large   = regular && !(x < Lane(limit));
+			if (recurrence_any(large))
+			{
+				Lane j = zero;
+				Lane y = zero;
+				cyl_bessel_hankel(order, intrin::choose(large, x, Lane(limit)), s, c, j, y);
+				r = intrin::choose(large, y, r);
+			}
+			store(k, r);
+		};
+
+		if (recurrence_any(recur)) { cyl_bessel_y_upward(nu, n_max, intrin::choose(recur, x, Lane(1.0)), value); }
+		else
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { value(k, zero); }
+		}
+	}
+} // namespace ccm::gen::internal
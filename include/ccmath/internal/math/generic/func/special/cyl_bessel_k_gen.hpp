@@ -10,7 +10,31 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_ik_impl.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Modified cylindrical Bessel function of the second kind of order nu.
+	 * @return +inf for x = 0 and NaN for negative x or nu.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cyl_bessel_k_gen(T nu, T x) noexcept
+	{
+		double r = 0;
+		internal::cyl_bessel_k_impl(static_cast<double>(nu), 0U, static_cast<double>(x), [&r](unsigned, double v) { r = v; });
+		return static_cast<T>(r);
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Modified cylindrical Bessel functions of the second kind of the orders nu to nu + n_max.
+	 * @param out Receives K_nu(x) to K_{nu + n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void cyl_bessel_k_all_gen(T nu, unsigned n_max, T x, T * out) noexcept
+	{
+		internal::cyl_bessel_k_impl(static_cast<double>(nu), n_max, static_cast<double>(x), [out](unsigned k, double v) { out[k] = static_cast<T>(v); });
+	}
+} // namespace ccm::gen
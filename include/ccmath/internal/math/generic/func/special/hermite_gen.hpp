@@ -10,7 +10,75 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/special/recurrence_scale_impl.hpp"
+
+#include <type_traits>
+
+/*
+ * Physicists' Hermite polynomials H_n(x).
+ *
+ * H_{k+1}(x) = 2x H_k(x) - 2k H_{k-1}(x) runs upwards from H_0 = 1 and H_1 = 2x, so hermite_all gets every degree up
+ * to n_max in one pass. The values grow like 2^n x^n. Large ones are carried scaled, see recurrence_scale_impl.hpp, so
+ * the ones beyond double come out as the signed infinity they round to, and H_n(±inf) is (±1)^n inf for n >= 1.
+ *
+ * Everything is computed in double. The recurrence is plain arithmetic on a lane type, so the vector hermite runs the
+ * same steps on intrin::simd<double> lanes and gives the same results.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/**
+		 * @brief Passes H_0(x) to H_n(x) to store(k, H_k(x)) in increasing order and returns H_n(x).
+		 * @tparam Lane double or an intrin::simd of double.
+		 *
+		 * A NaN argument only shows from H_1 on, H_0 is 1 for every x. The callers return NaN for it in every degree.
+		 */
+		template <typename Lane, typename Store>
+		constexpr Lane hermite_recurrence(unsigned n, Lane x, Store && store) noexcept
+		{
+			Lane h_prev = Lane(1.0);
+			store(0U, h_prev);
+			if (n == 0) { return h_prev; }
+
+			const Lane two_x = x + x;
+			Lane h			 = two_x;
+			recurrence_scale_state<Lane> scale;
+			recurrence_rescale(scale, h, h_prev);
+			store(1U, recurrence_value(scale, h));
+			for (unsigned k = 1; k < n; ++k)
+			{
+				const Lane next = recurrence_step(scale, h, two_x * h - (2.0 * static_cast<double>(k)) * h_prev, two_x);
+				h_prev			= h;
+				h				= next;
+				recurrence_rescale(scale, h, h_prev);
+				store(k + 1, recurrence_value(scale, h));
+			}
+			return recurrence_value(scale, h);
+		}
+	} // namespace internal
+
+	/// Physicists' Hermite polynomial of degree n.
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hermite_gen(unsigned n, T x) noexcept
+	{
+		if (x != x) { return x; }
+		return static_cast<T>(internal::hermite_recurrence(n, static_cast<double>(x), [](unsigned, double) {}));
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Physicists' Hermite polynomials of every degree up to n_max.
+	 * @param out Receives H_0(x) to H_{n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void hermite_all_gen(unsigned n_max, T x, T * out) noexcept
+	{
+		if (x != x)
+		{
+			for (unsigned k = 0; k <= n_max; ++k) { out[k] = x; }
+			return;
+		}
+		internal::hermite_recurrence(n_max, static_cast<double>(x), [out](unsigned k, double h) { out[k] = static_cast<T>(h); });
+	}
+} // namespace ccm::gen
@@ -10,7 +10,29 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/special/assoc_laguerre_gen.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Laguerre polynomial of degree n, the associated Laguerre polynomial of order 0.
+	 * @return NaN for negative x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T laguerre_gen(unsigned n, T x) noexcept
+	{
+		return assoc_laguerre_gen<T>(n, 0, x);
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Laguerre polynomials of every degree up to n_max.
+	 * @param out Receives L_0(x) to L_{n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void laguerre_all_gen(unsigned n_max, T x, T * out) noexcept
+	{
+		assoc_laguerre_all_gen<T>(n_max, 0, x, out);
+	}
+} // namespace ccm::gen
@@ -10,7 +10,74 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+/*
+ * Legendre polynomials P_n(x) on [-1, 1].
+ *
+ * Bonnet's recurrence (l + 1) P_{l+1}(x) = (2l + 1) x P_l(x) - l P_{l-1}(x) runs upwards from P_0 = 1 and P_1 = x. It is
+ * stable on [-1, 1] and every order below n comes out on the way, so legendre_all costs no more than legendre.
+ *
+ * Everything is computed in double. The recurrence is plain arithmetic on a lane type, so the vector legendre runs the
+ * same steps on intrin::simd<double> lanes and gives the same results.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/**
+		 * @brief Passes P_0(x) to P_n(x) to store(l, P_l(x)) in increasing order and returns P_n(x).
+		 * @tparam Lane double or an intrin::simd of double.
+		 */
+		template <typename Lane, typename Store>
+		constexpr Lane legendre_recurrence(unsigned n, Lane x, Store && store) noexcept
+		{
+			// Adding x - x makes P_0 NaN too for a NaN argument.
+			Lane p_prev = Lane(1.0) + (x - x);
+			store(0U, p_prev);
+			if (n == 0) { return p_prev; }
+
+			Lane p = x;
+			store(1U, p);
+			for (unsigned l = 1; l < n; ++l)
+			{
+				const auto dl	= static_cast<double>(l);
+				const Lane next = ((2.0 * dl + 1.0) * x * p - dl * p_prev) / (dl + 1.0);
+				p_prev			= p;
+				p				= next;
+				store(l + 1, p);
+			}
+			return p;
+		}
+
+		/// x itself if it is in [-1, 1], NaN otherwise, so every order comes out NaN.
+		constexpr double legendre_arg(double x) noexcept
+		{
+			return x >= -1.0 && x <= 1.0 ? x : support::fp::FPBits<double>::quiet_nan().get_val();
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Legendre polynomial of degree n.
+	 * @return NaN for x outside [-1, 1].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T legendre_gen(unsigned n, T x) noexcept
+	{
+		return static_cast<T>(internal::legendre_recurrence(n, internal::legendre_arg(static_cast<double>(x)), [](unsigned, double) {}));
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Legendre polynomials of every degree up to n_max.
+	 * @param out Receives P_0(x) to P_{n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void legendre_all_gen(unsigned n_max, T x, T * out) noexcept
+	{
+		internal::legendre_recurrence(n_max, internal::legendre_arg(static_cast<double>(x)),
+									  [out](unsigned l, double p) { out[l] = static_cast<T>(p); });
+	}
+} // namespace ccm::gen
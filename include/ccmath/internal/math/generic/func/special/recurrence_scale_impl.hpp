@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/common.hpp"
+
+/*
+ * Overflow handling shared by the upward recurrences of the orthogonal polynomials.
+ *
+ * Once |v_k| passes 2^512, v_k and v_{k-1} are scaled by 2^-512 and the lane counts it, so the next step cannot
+ * overflow and the terms keep their signs, also where the polynomial oscillates. The value passed on is
+ * v_k 2^(512 count), which becomes the signed infinity the true value rounds to. A lane that is already infinite,
+ * because its argument is, is only multiplied by the leading coefficient from there on, as the other term would make
+ * inf - inf.
+ *
+ * Everything is plain arithmetic and intrin::choose on a lane type, so double and intrin::simd<double> lanes take the
+ * same steps. Until some lane passes the limit the recurrences run unchanged, the state only being checked.
+ */
+
+namespace ccm::gen::internal
+{
+	struct recurrence_scale_constants
+	{
+		static constexpr double limit = 0x1.0p512;
+		static constexpr double down  = 0x1.0p-512;
+		static constexpr double up	  = 0x1.0p512;
+		// v 2^(512 count) is ±inf from this count on unless v is below 2^-512, far under the rounding error of the
+		// recurrence relative to its size.
+		static constexpr int max_count = 3;
+	};
+
+	/// Rescales done so far, per lane, and whether there have been any.
+	template <typename Lane>
+	struct recurrence_scale_state
+	{
+		Lane count	= Lane(0.0);
+		bool scaled = false;
+	};
+
+	constexpr bool recurrence_any(bool mask) noexcept
+	{
+		return mask;
+	}
+
+	template <typename Mask>
+	bool recurrence_any(Mask const & mask) noexcept
+	{
+		return any_of(mask);
+	}
+
+	/// Scales v and v_prev down by 2^-512 in the lanes where |v| passed the limit.
+	template <typename Lane>
+	constexpr void recurrence_rescale(recurrence_scale_state<Lane> & state, Lane & v, Lane & v_prev) noexcept
+	{
+		using constants	 = recurrence_scale_constants;
+		const auto large = Lane(constants::limit) < v || v < Lane(-constants::limit);
+		if (!recurrence_any(large)) { return; }
+
+		state.scaled   = true;
+		state.count	   = state.count + intrin::choose(large, Lane(1.0), Lane(0.0));
+		const Lane f   = intrin::choose(large, Lane(constants::down), Lane(1.0));
+		v			   = v * f;
+		v_prev		   = v_prev * f;
+	}
+
+	/// Scales v down by 2^-512 in the lanes where |v| passed the limit.
+	template <typename Lane>
+	constexpr void recurrence_rescale(recurrence_scale_state<Lane> & state, Lane & v) noexcept
+	{
+		Lane unused = Lane(0.0);
+		recurrence_rescale(state, v, unused);
+	}
+
+	/// v 2^(512 count), the value a scaled term stands for.
+	template <typename Lane>
+	constexpr Lane recurrence_value(recurrence_scale_state<Lane> const & state, Lane v) noexcept
+	{
+		using constants = recurrence_scale_constants;
+		if (!state.scaled) { return v; }
+		for (int i = 0; i < constants::max_count; ++i) { v = intrin::choose(Lane(static_cast<double>(i) + 0.5) < state.count, v * constants::up, v); }
+		return v;
+	}
+
+	/// next where v is finite, lead * v where it is infinite, once any lane has been.
+	template <typename Lane>
+	constexpr Lane recurrence_step(recurrence_scale_state<Lane> const & state, Lane const & v, Lane const & next, Lane const & lead) noexcept
+	{
+		// Infinite lanes passed the limit, so they are scaled.
+		if (!state.scaled) { return next; }
+		return intrin::choose(v - v == Lane(0.0), next, lead * v);
+	}
+} // namespace ccm::gen::internal
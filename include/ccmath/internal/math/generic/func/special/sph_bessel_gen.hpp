@@ -10,7 +10,238 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/math/fmanip/ldexp.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <type_traits>
+
+/*
+ * Spherical Bessel functions of the first kind j_n(x) for x >= 0.
+ *
+ * j_{k+1}(x) = (2k + 1) / x j_k(x) - j_{k-1}(x) from j_0 = sin(x) / x and j_1 = (j_0 - cos(x)) / x is only stable
+ * while k < x, so it is used when x > n. Below that Miller's algorithm runs the recurrence downwards from an order
+ * well above n, where the minimal solution dominates, and scales the result with the sum rule
+ * sum_k (2k + 1) j_k(x)^2 = 1, the sign coming from j_0 and j_1. Values that grow past 2^256 on the way are scaled
+ * down and the number of times is counted, so nothing overflows even for tiny x. For x below 2^-26 the leading term
+ * x^n / (2n + 1)!! of the series is exact to double precision and used instead.
+ *
+ * Everything is computed in double, sin and cos coming from sincos_gen.hpp.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		struct sph_bessel_constants
+		{
+			static constexpr double series_limit = 0x1p-26;
+
+			// The downward recurrence starts at n + start_margin + sqrt(start_factor * n).
+			static constexpr unsigned start_margin = 20;
+			static constexpr double start_factor   = 40.0;
+
+			static constexpr int rescale_exp	   = 256;
+			static constexpr double rescale_limit  = 0x1p256;
+			static constexpr double rescale		   = 0x1p-256;
+			static constexpr double rescale_square = 0x1p-512;
+			// Each rescale owed means the lower orders, which are at most 1, outgrew the value by 2^256, so one still owing
+			// this many is below 2^-1280 and rounds to 0.
+			static constexpr int rescale_cutoff = 6;
+		};
+
+		/// Passes j_0(x) to j_n(x) to store(k, j_k(x)) for 0 <= x < sph_bessel_constants::series_limit.
+		template <typename Store>
+		constexpr void sph_bessel_series(unsigned n, double x, Store && store) noexcept
+		{
+			double t = 1.0;
+			store(0U, t);
+			for (unsigned k = 1; k <= n; ++k)
+			{
+				t = t * (x / static_cast<double>(2 * k + 1));
+				store(k, t);
+			}
+		}
+
+		/// Passes j_0(x) to j_n(x) to store(k, j_k(x)) for x > n, s = sin(x) and c = cos(x), by the upward recurrence.
+		template <typename Store>
+		constexpr void sph_bessel_upward(unsigned n, double x, double s, double c, Store && store) noexcept
+		{
+			double j_prev = s / x;
+			store(0U, j_prev);
+			if (n == 0) { return; }
+
+			double j = (j_prev - c) / x;
+			store(1U, j);
+			for (unsigned k = 1; k < n; ++k)
+			{
+				const double next = static_cast<double>(2 * k + 1) / x * j - j_prev;
+				j_prev			  = j;
+				j				  = next;
+				store(k + 1, j);
+			}
+		}
+
+		/// State of the downward recurrence at order k, f_k and f_{k+1} up to a common factor.
+		struct sph_bessel_miller_state
+		{
+			double f;
+			double f_next;
+			unsigned k;
+			int rescales;
+		};
+
+		constexpr unsigned sph_bessel_start(unsigned n) noexcept
+		{
+			using constants = sph_bessel_constants;
+
+			return n + constants::start_margin + static_cast<unsigned>(ccm::sqrt(constants::start_factor * static_cast<double>(n)));
+		}
+
+		/// Takes the downward recurrence one order down, rescaling if f gets too large.
+		constexpr void sph_bessel_miller_step(sph_bessel_miller_state & st, double x) noexcept
+		{
+			using constants = sph_bessel_constants;
+
+			const double f_prev = static_cast<double>(2 * st.k + 1) / x * st.f - st.f_next;
+			st.f_next			= st.f;
+			st.f				= f_prev;
+			--st.k;
+			if (st.f > constants::rescale_limit || st.f < -constants::rescale_limit)
+			{
+				st.f *= constants::rescale;
+				st.f_next *= constants::rescale;
+				++st.rescales;
+			}
+		}
+
+		/**
+		 * @brief Passes j_0(x) to j_n(x) to store(k, j_k(x)) for series_limit <= x <= n, s = sin(x) and c = cos(x).
+		 *
+		 * The first pass down to order 0 gives the normalization and the number of rescales, the second one stores the
+		 * values, scaled by the rescales still to come below them. If store_all is false only j_n is passed, and it is
+		 * taken from the first pass.
+		 */
+		template <bool store_all, typename Store>
+		constexpr void sph_bessel_miller(unsigned n, double x, double s, double c, Store && store) noexcept
+		{
+			using constants = sph_bessel_constants;
+
+			const unsigned start = sph_bessel_start(n);
+			sph_bessel_miller_state st{1.0, 0.0, start, 0};
+			double sum		= static_cast<double>(2 * start + 1);
+			double f_n		= 0.0;
+			int rescales_n	= 0;
+			while (st.k > 0)
+			{
+				const int before = st.rescales;
+				sph_bessel_miller_step(st, x);
+				if (st.rescales != before) { sum *= constants::rescale_square; }
+				sum += static_cast<double>(2 * st.k + 1) * st.f * st.f;
+				if (st.k == n)
+				{
+					f_n		   = st.f;
+					rescales_n = st.rescales;
+				}
+			}
+
+			const double j0 = s / x;
+			const double j1 = (j0 - c) / x;
+			double norm		= 1.0 / ccm::sqrt(sum);
+			if (st.f * j0 + st.f_next * j1 < 0) { norm = -norm; }
+
+			const auto scaled = [&](double f, int rescales)
+			{
+				const int pending = st.rescales - rescales;
+				const double v	  = f * norm;
+				if (pending >= constants::rescale_cutoff) { return v < 0 ? -0.0 : 0.0; }
+				return ccm::ldexp(v, -constants::rescale_exp * pending);
+			};
+
+			if constexpr (!store_all) { store(n, scaled(f_n, rescales_n)); }
+			else
+			{
+				sph_bessel_miller_state again{1.0, 0.0, start, 0};
+				while (again.k > 0)
+				{
+					sph_bessel_miller_step(again, x);
+					if (again.k <= n) { store(again.k, scaled(again.f, again.rescales)); }
+				}
+			}
+		}
+
+		/// Passes j_k(x) to store(k, j_k(x)), for every k <= n if store_all, for k = n only otherwise.
+		template <bool store_all, typename Store>
+		constexpr void sph_bessel_impl(unsigned n, double x, Store && store) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
+
+			const auto fill = [&](double v)
+			{
+				for (unsigned k = store_all ? 0 : n; k <= n; ++k) { store(k, v); }
+			};
+			if (!(x >= 0.0))
+			{
+				fill(FPBits_t::quiet_nan().get_val());
+				return;
+			}
+			if (x == FPBits_t::inf().get_val())
+			{
+				fill(0.0);
+				return;
+			}
+			if (x < sph_bessel_constants::series_limit)
+			{
+				if constexpr (store_all) { sph_bessel_series(n, x, store); }
+				else
+				{
+					sph_bessel_series(n, x, [&](unsigned k, double j)
+									   {
+										   if (k == n) { store(k, j); }
+									   });
+				}
+				return;
+			}
+
+			double s = 0;
+			double c = 0;
+			sincos_impl(x, s, c);
+			if (x > static_cast<double>(n))
+			{
+				if constexpr (store_all) { sph_bessel_upward(n, x, s, c, store); }
+				else
+				{
+					sph_bessel_upward(n, x, s, c, [&](unsigned k, double j)
+									   {
+										   if (k == n) { store(k, j); }
+									   });
+				}
+				return;
+			}
+			sph_bessel_miller<store_all>(n, x, s, c, store);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Spherical Bessel function of the first kind of order n.
+	 * @return NaN for negative x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_bessel_gen(unsigned n, T x) noexcept
+	{
+		double r = 0;
+		internal::sph_bessel_impl<false>(n, static_cast<double>(x), [&r](unsigned, double j) { r = j; });
+		return static_cast<T>(r);
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Spherical Bessel functions of the first kind of every order up to n_max.
+	 * @param out Receives j_0(x) to j_{n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_bessel_all_gen(unsigned n_max, T x, T * out) noexcept
+	{
+		internal::sph_bessel_impl<true>(n_max, static_cast<double>(x), [out](unsigned k, double j) { out[k] = static_cast<T>(j); });
+	}
+} // namespace ccm::gen
@@ -10,7 +10,107 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <type_traits>
+
+/*
+ * Spherical harmonics Y_l^m(theta, 0), with the Condon-Shortley phase, as std::sph_legendre.
+ *
+ * The normalized functions are computed directly, so nothing overflows for large l and m the way the factorials of
+ * the normalization would. With x = cos(theta) and s = |sin(theta)|:
+ *   Y_m^m     = (-1)^m sqrt((2m + 1) / (4 pi)) prod_{i=1..m} sqrt((2i - 1) / (2i)) s
+ *   Y_{m+1}^m = sqrt(2m + 3) x Y_m^m
+ *   Y_l^m     = a_l (x Y_{l-1}^m - Y_{l-2}^m / a_{l-1}),   a_l = sqrt((4l^2 - 1) / (l^2 - m^2))
+ * The degrees below m are zero. s comes from sin(theta) itself rather than sqrt(1 - x^2), which keeps its relative
+ * accuracy near the poles.
+ *
+ * Everything is computed in double. The recurrence is plain arithmetic on a lane type once x and s are known, and its
+ * coefficients only depend on l and m, so the vector sph_legendre runs the same steps on intrin::simd<double> lanes.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		struct sph_legendre_constants
+		{
+			static constexpr double inv_sqrt_4pi = 0x1.20dd750429b6dp-2;
+		};
+
+		/**
+		 * @brief Passes Y_0^m to Y_n^m to store(l, Y_l^m) in increasing order and returns Y_n^m.
+		 * @tparam Lane double or an intrin::simd of double.
+		 * @param x cos(theta).
+		 * @param s |sin(theta)|.
+		 */
+		template <typename Lane, typename Store>
+		constexpr Lane sph_legendre_recurrence(unsigned n, unsigned m, Lane x, Lane s, Store && store) noexcept
+		{
+			// x - x keeps NaN arguments NaN in every degree, also in the ones below m.
+			const Lane zero = x - x;
+			for (unsigned l = 0; l < m && l <= n; ++l) { store(l, zero); }
+			if (m > n) { return zero; }
+
+			Lane y_prev = Lane(sph_legendre_constants::inv_sqrt_4pi) + zero;
+			for (unsigned i = 1; i <= m; ++i)
+			{
+				const double c = ccm::sqrt(static_cast<double>(2 * i - 1) / static_cast<double>(2 * i));
+				y_prev		   = y_prev * (-c * s);
+			}
+			const auto dm = static_cast<double>(m);
+			y_prev		  = ccm::sqrt(2.0 * dm + 1.0) * y_prev;
+			store(m, y_prev);
+			if (n == m) { return y_prev; }
+
+			double a_prev = ccm::sqrt(2.0 * dm + 3.0);
+			Lane y		  = a_prev * x * y_prev;
+			store(m + 1, y);
+			for (unsigned l = m + 2; l <= n; ++l)
+			{
+				const auto dl	= static_cast<double>(l);
+				const double a	= ccm::sqrt(((2.0 * dl - 1.0) * (2.0 * dl + 1.0)) / ((dl - dm) * (dl + dm)));
+				const Lane next = a * (x * y - y_prev / a_prev);
+				y_prev			= y;
+				y				= next;
+				a_prev			= a;
+				store(l, y);
+			}
+			return y;
+		}
+
+		/// Sets x = cos(theta) and s = |sin(theta)|.
+		constexpr void sph_legendre_arg(double theta, double & x, double & s) noexcept
+		{
+			sincos_impl(theta, s, x);
+			s = s < 0 ? -s : s;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Spherical harmonic Y_l^m(theta, 0) of degree l and order m.
+	 * @return 0 for m > l and NaN for infinite or NaN theta.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_legendre_gen(unsigned l, unsigned m, T theta) noexcept
+	{
+		double x = 0;
+		double s = 0;
+		internal::sph_legendre_arg(static_cast<double>(theta), x, s);
+		return static_cast<T>(internal::sph_legendre_recurrence(l, m, x, s, [](unsigned, double) {}));
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Spherical harmonics of order m and every degree up to l_max.
+	 * @param out Receives Y_0^m(theta, 0) to Y_{l_max}^m(theta, 0), l_max + 1 values, the ones below m being 0.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_legendre_all_gen(unsigned l_max, unsigned m, T theta, T * out) noexcept
+	{
+		double x = 0;
+		double s = 0;
+		internal::sph_legendre_arg(static_cast<double>(theta), x, s);
+		internal::sph_legendre_recurrence(l_max, m, x, s, [out](unsigned l, double y) { out[l] = static_cast<T>(y); });
+	}
+} // namespace ccm::gen
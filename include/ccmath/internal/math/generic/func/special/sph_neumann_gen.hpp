@@ -10,7 +10,95 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+/*
+ * Spherical Bessel functions of the second kind y_n(x) for x >= 0.
+ *
+ * y_{k+1}(x) = (2k + 1) / x y_k(x) - y_{k-1}(x) from y_0 = -cos(x) / x and y_1 = (y_0 - sin(x)) / x is stable upwards
+ * for every x, y_n being the dominant solution, so sph_neumann_all gets every order up to n_max in one pass. Once the
+ * values overflow they stay at -inf, instead of turning into NaN in the next step.
+ *
+ * Everything is computed in double, sin and cos coming from sincos_gen.hpp.
+ */
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/// Passes y_0(x) to y_n(x) to store(k, y_k(x)) in increasing order.
+		template <typename Store>
+		constexpr void sph_neumann_impl(unsigned n, double x, Store && store) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
+
+			const double inf  = FPBits_t::inf().get_val();
+			const auto fill	  = [&](unsigned from, double v)
+			{
+				for (unsigned k = from; k <= n; ++k) { store(k, v); }
+			};
+			if (!(x >= 0.0))
+			{
+				fill(0, FPBits_t::quiet_nan().get_val());
+				return;
+			}
+			if (x == 0.0)
+			{
+				fill(0, -inf);
+				return;
+			}
+			if (x == inf)
+			{
+				fill(0, 0.0);
+				return;
+			}
+
+			double s = 0;
+			double c = 0;
+			sincos_impl(x, s, c);
+			double y_prev = -c / x;
+			store(0U, y_prev);
+			if (n == 0) { return; }
+
+			double y = (y_prev - s) / x;
+			store(1U, y);
+			for (unsigned k = 1; k < n; ++k)
+			{
+				if (y == -inf || y == inf)
+				{
+					fill(k + 1, y);
+					return;
+				}
+				const double next = static_cast<double>(2 * k + 1) / x * y - y_prev;
+				y_prev			  = y;
+				y				  = next;
+				store(k + 1, y);
+			}
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Spherical Bessel function of the second kind of order n.
+	 * @return -inf for x = 0 and NaN for negative x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_neumann_gen(unsigned n, T x) noexcept
+	{
+		double r = 0;
+		internal::sph_neumann_impl(n, static_cast<double>(x), [&r](unsigned, double y) { r = y; });
+		return static_cast<T>(r);
+	}
 
-} // namespace ccm
+	/**
+	 * @brief Spherical Bessel functions of the second kind of every order up to n_max.
+	 * @param out Receives y_0(x) to y_{n_max}(x), n_max + 1 values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_neumann_all_gen(unsigned n_max, T x, T * out) noexcept
+	{
+		internal::sph_neumann_impl(n_max, static_cast<double>(x), [out](unsigned k, double y) { out[k] = static_cast<T>(y); });
+	}
+} // namespace ccm::gen
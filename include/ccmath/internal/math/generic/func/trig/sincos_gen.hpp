@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <cstdint>
+
+/*
+ * sin(x) and cos(x) together, in double, for the functions that need them of an angle.
+ *
+ * x is reduced by the nearest multiple n of pi/2, which leaves r = x - n pi/2 as an unevaluated sum y0 + y1. Below
+ * 2^20 pi/2 pi/2 is split in up to three parts, as fdlibm's __ieee754_rem_pio2 does for medium arguments. Above that
+ * x 2/pi is formed exactly from the bits of 2/pi that matter (Payne and Hanek), in integers so that it stays constexpr.
+ * fdlibm's __kernel_sin and __kernel_cos take it from there and n mod 4 picks the quadrant. Results are within 1 ulp.
+ * ±inf and NaN give NaN.
+ */
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		struct sincos_constants
+		{
+			// (sin(r) - r) / r^3 and (cos(r) - 1 + r^2 / 2) / r^4 in r^2 on [-pi/4, pi/4], highest degree first.
+			static constexpr double sin[] = {
+				1.58969099521155010221e-10, -2.50507602534068634195e-08, 2.75573137070700676789e-06,
+				-1.98412698298579493134e-04, 8.33333333332248946124e-03,  -1.66666666666666324348e-01,
+			};
+			static constexpr double cos[] = {
+				-1.13596475577881948265e-11, 2.08757232129817482790e-09, -2.75573143513906633035e-07,
+				2.48015872894767294178e-05,	 -1.38888888888741095749e-03, 4.16666666666666019037e-02,
+			};
+
+			static constexpr double pio4	= 0x1.921fb54442d18p-1;
+			static constexpr double invpio2 = 0x1.45f306dc9c883p-1;
+			// pi/2 = pio2_1 + pio2_1t = pio2_1 + pio2_2 + pio2_2t = pio2_1 + pio2_2 + pio2_3 + pio2_3t. pio2_1, pio2_2 and
+			// pio2_3 have 33 bits, so n * pio2_k is exact.
+			static constexpr double pio2_1	= 0x1.921fb544p+0;
+			static constexpr double pio2_1t = 0x1.0b4611a626331p-34;
+			static constexpr double pio2_2	= 0x1.0b4611a6p-34;
+			static constexpr double pio2_2t = 0x1.3198a2e037073p-69;
+			static constexpr double pio2_3	= 0x1.3198a2ep-69;
+			static constexpr double pio2_3t = 0x1.b839a252049c1p-104;
+			// Adding and subtracting it rounds to an integer.
+			static constexpr double round_magic = 0x1.8p52;
+
+			// Above it the medium reduction is no longer exact.
+			static constexpr double medium_limit = 0x1.921fb54442d18p20;
+			// 2/pi in 24 bit chunks, the j-th one weighing 2^(-24 (j + 1)), enough for every finite double.
+			static constexpr std::uint64_t two_over_pi[] = {
+				0xA2F983, 0x6E4E44, 0x1529FC, 0x2757D1, 0xF534DD, 0xC0DB62, 0x95993C, 0x439041, 0xFE5163, 0xABDEBB, 0xC561B7,
+				0x246E3A, 0x424DD2, 0xE00649, 0x2EEA09, 0xD1921C, 0xFE1DEB, 0x1CB129, 0xA73EE8, 0x8235F5, 0x2EBB44, 0x84E99C,
+				0x7026B4, 0x5F7E41, 0x3991D6, 0x398353, 0x39F49C, 0x845F8B, 0xBDF928, 0x3B1FF8, 0x97FFDE, 0x05980F, 0xEF2F11,
+				0x8B5A0A, 0x6D1F6D, 0x367ECF, 0x27CB09, 0xB74F46, 0x3F669E, 0x5FEA2D, 0x7527BA, 0xC7EBE5, 0xF17B3D, 0x0739F7,
+				0x8A5292, 0xEA6BFB, 0x5FB11F, 0x8D5D08, 0x560330, 0x46FC7B, 0x6BABF0, 0xCFBC20, 0x9AF436, 0x1DA9E3, 0x91615E,
+				0xE61B08, 0x659985, 0x5F14A0, 0x68408D, 0xFFD880, 0x4D7327, 0x310606, 0x1556CA, 0x73A8C9, 0x60E27B, 0xC08C6B,
+			};
+			// Chunks of x 2/pi kept below the binary point. Cancellation costs at most about 61 of their bits.
+			static constexpr int large_chunks = 8;
+			// pi/2 = pio2_hi + pio2_lo and the splitting constant of Dekker's product.
+			static constexpr double pio2_hi = 0x1.921fb54442d18p0;
+			static constexpr double pio2_lo = 0x1.1a62633145c07p-54;
+			static constexpr double split	= 0x1.0000002p27;
+		};
+
+		/// Reduces x >= sincos_constants::medium_limit to y0 + y1 = x - n pi/2 with |y0 + y1| <= pi/4, returning n mod 4.
+		constexpr int rem_pio2_large(double x, double & y0, double & y1) noexcept
+		{
+			using constants = sincos_constants;
+			constexpr std::uint64_t chunk_mask = 0xFFFFFF;
+
+			// x = (x_0 2^48 + x_1 2^24 + x_2) 2^e, so x_i t_j weighs 2^(e + 24 - 24 (i + j)). Sums of equal weight below 4
+			// are kept, the ones above being multiples of 4 that leave n mod 4 alone.
+			const support::fp::FPBits<double> bits(x);
+			const std::uint64_t m = bits.get_explicit_mantissa();
+			const int e			  = bits.get_exponent() - 52;
+			const std::uint64_t xs[3] = {m >> 48, (m >> 24) & chunk_mask, m & chunk_mask};
+
+			const int k0 = e + 22 < 0 ? 0 : (e + 22) / 24 + 1;
+			const int s	 = e + 24 - 24 * k0; // Weight of chunk k0, between 2^-22 and 2^1.
+			std::uint64_t q[constants::large_chunks] = {};
+			for (int c = 0; c < constants::large_chunks; ++c)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					const int j = k0 + c - i;
+					if (j >= 0) { q[c] += xs[i] * constants::two_over_pi[j]; }
+				}
+			}
+			for (int c = constants::large_chunks - 1; c > 0; --c)
+			{
+				q[c - 1] += q[c] >> 24;
+				q[c] &= chunk_mask;
+			}
+
+			// The bits of chunk 0 from 2^2 up are dropped, the ones from 2^0 give n and the rest start the fraction.
+			const int frac_bits	  = 24 - s;
+			const std::uint64_t a = ((q[0] & ((std::uint64_t(1) << (2 - s)) - 1)) << 24) | q[1];
+			int n				  = static_cast<int>(a >> frac_bits);
+			q[1]				  = a & ((std::uint64_t(1) << frac_bits) - 1);
+
+			// Rounding to the nearest n makes the fraction 1 - f, negated, when it is at least a half.
+			const bool upper = ((q[1] >> (frac_bits - 1)) & 1) != 0;
+			if (upper)
+			{
+				n += 1;
+				std::uint64_t carry = 1;
+				for (int c = constants::large_chunks - 1; c > 0; --c)
+				{
+					const std::uint64_t width = c == 1 ? (std::uint64_t(1) << frac_bits) - 1 : chunk_mask;
+					q[c]					  = (q[c] ^ width) + carry;
+					carry					  = q[c] >> (c == 1 ? frac_bits : 24);
+					q[c] &= width;
+				}
+			}
+
+			// Chunk c weighs 2^(s - 24 c). Summed from the smallest for the high part, the low part is what it missed.
+			double weight = 1.0;
+			for (int i = 0; i < frac_bits; ++i) { weight *= 0.5; }
+			double w[constants::large_chunks] = {};
+			for (int c = 1; c < constants::large_chunks; ++c)
+			{
+				w[c] = weight;
+				weight *= 0x1p-24;
+			}
+			double hi = 0.0;
+			for (int c = constants::large_chunks - 1; c > 0; --c) { hi += static_cast<double>(q[c]) * w[c]; }
+			double lo = static_cast<double>(q[1]) * w[1] - hi;
+			for (int c = 2; c < constants::large_chunks; ++c) { lo += static_cast<double>(q[c]) * w[c]; }
+
+			// (hi + lo) pi/2 with hi pio2_hi exact by Dekker's product.
+			const double hi_big	  = hi * constants::split;
+			const double hi_h	  = hi_big - (hi_big - hi);
+			const double hi_l	  = hi - hi_h;
+			const double p_big	  = constants::pio2_hi * constants::split;
+			const double p_h	  = p_big - (p_big - constants::pio2_hi);
+			const double p_l	  = constants::pio2_hi - p_h;
+			const double r_hi	  = hi * constants::pio2_hi;
+			const double r_err	  = ((hi_h * p_h - r_hi) + hi_h * p_l + hi_l * p_h) + hi_l * p_l;
+			const double r_lo	  = r_err + hi * constants::pio2_lo + lo * constants::pio2_hi;
+			const double r		  = r_hi + r_lo;
+			const double r_tail	  = r_lo - (r - r_hi);
+			y0					  = upper ? -r : r;
+			y1					  = upper ? -r_tail : r_tail;
+			return n & 3;
+		}
+
+		/// sin(x + y) for |x + y| <= pi/4, y being below half an ulp of x.
+		constexpr double sin_kernel(double x, double y) noexcept
+		{
+			constexpr auto & S = sincos_constants::sin;
+
+			const double z = x * x;
+			const double w = z * z;
+			const double r = S[4] + z * (S[3] + z * S[2]) + z * w * (S[1] + z * S[0]);
+			const double v = z * x;
+			return x - ((z * (0.5 * y - v * r) - y) - v * S[5]);
+		}
+
+		/// cos(x + y) for |x + y| <= pi/4, y being below half an ulp of x.
+		constexpr double cos_kernel(double x, double y) noexcept
+		{
+			constexpr auto & C = sincos_constants::cos;
+
+			const double z	= x * x;
+			double w		= z * z;
+			const double r	= z * (C[5] + z * (C[4] + z * C[3])) + w * w * (C[2] + z * (C[1] + z * C[0]));
+			const double hz = 0.5 * z;
+			w				= 1.0 - hz;
+			return w + (((1.0 - w) - hz) + (z * r - x * y));
+		}
+
+		/// Sets s = sin(x) and c = cos(x).
+		constexpr void sincos_impl(double x, double & s, double & c) noexcept
+		{
+			using constants = sincos_constants;
+
+			if (x != x || x - x != x - x)
+			{
+				s = support::fp::FPBits<double>::quiet_nan().get_val();
+				c = s;
+				return;
+			}
+
+			const double ax = x < 0 ? -x : x;
+			if (ax <= constants::pio4)
+			{
+				s = sin_kernel(x, 0.0);
+				c = cos_kernel(x, 0.0);
+				return;
+			}
+
+			if (ax >= constants::medium_limit)
+			{
+				double y0 = 0;
+				double y1 = 0;
+				const int q		= rem_pio2_large(ax, y0, y1);
+				const double sr = sin_kernel(y0, y1);
+				const double cr = cos_kernel(y0, y1);
+				const double sa = q == 0 ? sr : (q == 1 ? cr : (q == 2 ? -sr : -cr));
+				c				= q == 0 ? cr : (q == 1 ? -sr : (q == 2 ? -cr : sr));
+				s				= x < 0 ? -sa : sa;
+				return;
+			}
+
+			// __ieee754_rem_pio2 for medium arguments: a second and a third step are taken when the first ones cancelled
+			// more than 16 and 49 bits, counted from the exponents.
+			using FPBits_t	  = support::fp::FPBits<double>;
+			const int x_exp	  = FPBits_t(x).get_biased_exponent();
+			const double fn	  = (x * constants::invpio2 + constants::round_magic) - constants::round_magic;
+			double r		  = x - fn * constants::pio2_1;
+			double w		  = fn * constants::pio2_1t;
+			double y0		  = r - w;
+			if (x_exp - FPBits_t(y0).get_biased_exponent() > 16)
+			{
+				double t = r;
+				w		 = fn * constants::pio2_2;
+				r		 = t - w;
+				w		 = fn * constants::pio2_2t - ((t - r) - w);
+				y0		 = r - w;
+				if (x_exp - FPBits_t(y0).get_biased_exponent() > 49)
+				{
+					t  = r;
+					w  = fn * constants::pio2_3;
+					r  = t - w;
+					w  = fn * constants::pio2_3t - ((t - r) - w);
+					y0 = r - w;
+				}
+			}
+			const double y1 = (r - y0) - w;
+
+			const double fq = fn - 4.0 * ((fn * 0.25 + constants::round_magic) - constants::round_magic);
+			const int q		= static_cast<int>(fq < 0 ? fq + 4.0 : fq) & 3;
+			const double sr = sin_kernel(y0, y1);
+			const double cr = cos_kernel(y0, y1);
+			switch (q)
+			{
+			case 0:
+				s = sr;
+				c = cr;
+				break;
+			case 1:
+				s = cr;
+				c = -sr;
+				break;
+			case 2:
+				s = -sr;
+				c = -cr;
+				break;
+			default:
+				s = -cr;
+				c = sr;
+				break;
+			}
+		}
+	} // namespace internal
+} // namespace ccm::gen
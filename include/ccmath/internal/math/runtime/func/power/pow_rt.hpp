@@ -35,10 +35,15 @@ namespace ccm::rt::simd_impl
 	#endif
 	[[nodiscard]] inline T pow_simd_impl(T base, T exp) noexcept
 	{
+		#if CCMATH_HAS_SIMD_SVML
 		intrin::simd<T, intrin::abi::native> const base_m(base);
 		intrin::simd<T, intrin::abi::native> const exp_m(exp);
 		intrin::simd<T, intrin::abi::native> const pow_m = intrin::pow(base_m, exp_m);
 		return pow_m.convert();
+		#else
+		// Without SVML the vector pow runs gen::pow_gen on every lane, one call is enough here.
+		return gen::pow_gen(base, exp);
+		#endif
 	}
 #endif
 } // namespace ccm::rt::simd_impl
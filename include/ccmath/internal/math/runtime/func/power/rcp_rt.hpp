@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/generic/func/power/rcp_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#if defined(CCMATH_HAS_SIMD_AVX512F)
+		#include <immintrin.h>
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		#include <xmmintrin.h>
+	#elif defined(CCMATH_HAS_SIMD_NEON)
+		#include <arm_neon.h>
+	#endif
+#endif
+
+namespace ccm::rt::simd_impl
+{
+	/// Whether rcp_estimate has a hardware estimate for T. x86 has no double estimate before AVX-512.
+	template <typename T>
+	inline constexpr bool has_rcp_estimate_v =
+#if defined(CCMATH_HAS_SIMD_AVX512F) || defined(CCMATH_HAS_SIMD_NEON)
+		std::is_same_v<T, float> || std::is_same_v<T, double>;
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		std::is_same_v<T, float>;
+#else
+		false;
+#endif
+
+	/**
+	 * @brief Hardware estimate of 1/x within 1.5 * 2^-12, for a normal x whose magnitude is below
+	 * gen::internal::rcp_constants<T>::limit.
+	 *
+	 * rcp14 is within 2^-14. vrecpe is only good to 8 bits and takes one vrecps step, as in intrin::rcp_estimate.
+	 */
+	template <typename T, std::enable_if_t<has_rcp_estimate_v<T>, bool> = true>
+	inline T rcp_estimate(T x) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_rcp14_ss(_mm_setzero_ps(), _mm_set_ss(x))); }
+		else { return _mm_cvtsd_f64(_mm_rcp14_sd(_mm_setzero_pd(), _mm_set_sd(x))); }
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		return _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(x)));
+#elif defined(CCMATH_HAS_SIMD_NEON)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const float r = vrecpes_f32(x);
+			return r * vrecpss_f32(x, r);
+		}
+		else
+		{
+			const double r = vrecped_f64(x);
+			return r * vrecpsd_f64(x, r);
+		}
+#endif
+	}
+} // namespace ccm::rt::simd_impl
+
+namespace ccm::rt
+{
+	/**
+	 * @brief Approximate reciprocal with Steps Newton steps after a hardware estimate, see gen::rcp_gen for the bounds.
+	 *
+	 * Unlike gen::rcp_gen, which has to start from the bit trick seed, Steps = 0 is the bare estimate. Types and targets
+	 * without an estimate are divided, which is exact and faster than the seed with its Newton steps.
+	 */
+	template <int Steps, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline T rcp_rt(T x) noexcept
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rcp takes 0, 1 or 2 refinement steps");
+		if constexpr (simd_impl::has_rcp_estimate_v<T>)
+		{
+			using FPBits_t	   = support::fp::FPBits<T>;
+			constexpr auto min = FPBits_t::min_normal().uintval();
+			constexpr auto end = FPBits_t(gen::internal::rcp_constants<T>::limit).uintval();
+
+			// ±0, ±inf, NaN and the edges of the range where 1/x is not a normal number are divided exactly. The range of
+			// |x| is checked with one unsigned compare of its bits.
+			if (CCM_UNLIKELY(FPBits_t(x).abs().uintval() - min >= end - min)) { return T(1) / x; }
+			return gen::internal::rcp_refine<Steps>(x, simd_impl::rcp_estimate(x));
+		}
+		else { return T(1) / x; }
+	}
+} // namespace ccm::rt
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/config/errno_policy.hpp"
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/func/power/sqrt_rt.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#if defined(CCMATH_HAS_SIMD_AVX512F)
+		#include <immintrin.h>
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		#include <emmintrin.h>
+	#elif defined(CCMATH_HAS_SIMD_NEON)
+		#include <arm_neon.h>
+	#endif
+#endif
+
+namespace ccm::rt::simd_impl
+{
+	/// Whether rsqrt_estimate has a hardware estimate for T.
+	template <typename T>
+	inline constexpr bool has_rsqrt_estimate_v =
+#if defined(CCMATH_HAS_SIMD_AVX512F) || defined(CCMATH_HAS_SIMD_SSE2) || defined(CCMATH_HAS_SIMD_NEON)
+		std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+		false;
+#endif
+
+	/**
+	 * @brief Arguments rsqrt_estimate takes, [min, limit).
+	 *
+	 * Before AVX-512 x86 has no double estimate, and double arguments are estimated as floats, in the range of float.
+	 */
+	template <typename T>
+	struct rsqrt_estimate_range
+	{
+		static constexpr T min	 = support::fp::FPBits<T>::min_normal().get_val();
+		static constexpr T limit = support::fp::FPBits<T>::inf().get_val();
+	};
+
+#if defined(CCMATH_HAS_SIMD_SSE2) && !defined(CCMATH_HAS_SIMD_AVX512F)
+	template <>
+	struct rsqrt_estimate_range<double>
+	{
+		static constexpr double min	  = 0x1.0p-126;
+		static constexpr double limit = 0x1.0p127;
+	};
+#endif
+
+	/**
+	 * @brief Hardware estimate of 1/sqrt(x) within 1.5 * 2^-12, for x in rsqrt_estimate_range<T>.
+	 *
+	 * rsqrt14 is within 2^-14. vrsqrte is only good to 8 bits and takes one vrsqrts step, as in intrin::rsqrt_estimate.
+	 */
+	template <typename T, std::enable_if_t<has_rsqrt_estimate_v<T>, bool> = true>
+	inline T rsqrt_estimate(T x) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_rsqrt14_ss(_mm_setzero_ps(), _mm_set_ss(x))); }
+		else { return _mm_cvtsd_f64(_mm_rsqrt14_sd(_mm_setzero_pd(), _mm_set_sd(x))); }
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x))); }
+		else { return static_cast<double>(_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(static_cast<float>(x))))); }
+#elif defined(CCMATH_HAS_SIMD_NEON)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const float y = vrsqrtes_f32(x);
+			return y * vrsqrtss_f32(x * y, y);
+		}
+		else
+		{
+			const double y = vrsqrted_f64(x);
+			return y * vrsqrtsd_f64(x * y, y);
+		}
+#endif
+	}
+} // namespace ccm::rt::simd_impl
+
+namespace ccm::rt
+{
+	/**
+	 * @brief Approximate reciprocal square root with Steps Newton steps after a hardware estimate, see gen::rsqrt_gen
+	 * for the bounds.
+	 *
+	 * Unlike gen::rsqrt_gen, which has to start from the bit trick seed, Steps = 0 is the bare estimate. Without an
+	 * estimate the exact 1 / sqrt(x) is faster than the seed with its Newton steps.
+	 */
+	template <int Steps, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline T rsqrt_rt(T x) noexcept
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rsqrt takes 0, 1 or 2 refinement steps");
+		if constexpr (simd_impl::has_rsqrt_estimate_v<T>)
+		{
+			using FPBits_t	   = support::fp::FPBits<T>;
+			using range		   = simd_impl::rsqrt_estimate_range<T>;
+			constexpr auto min = FPBits_t(range::min).uintval();
+			constexpr auto end = FPBits_t(range::limit).uintval();
+
+			// ±0, +inf, negative numbers, NaN and the rest of the arguments outside the estimate take gen::rsqrt_gen. The
+			// sign bit puts negative numbers past the end, so the range is checked with one unsigned compare of the bits.
+			if (CCM_UNLIKELY(FPBits_t(x).uintval() - min >= end - min)) { return gen::rsqrt_gen<Steps>(x); }
+			return gen::internal::rsqrt_refine<Steps>(x, simd_impl::rsqrt_estimate(x));
+		}
+		else { return T(1) / sqrt_rt<T, policy::no_errno>(x); }
+	}
+} // namespace ccm::rt
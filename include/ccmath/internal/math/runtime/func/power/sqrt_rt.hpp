@@ -10,15 +10,18 @@
 
 #pragma once
 
+#include "ccmath/internal/config/errno_policy.hpp"
 #include "ccmath/internal/config/type_support.hpp"
 #include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
 #include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/always_false.hpp"
 #include "ccmath/internal/support/bits.hpp"
 #include "ccmath/internal/support/fenv/rounding_mode.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 
+#include <limits>
 #include <type_traits>
 
 namespace ccm::rt::simd_impl
@@ -47,9 +50,24 @@ namespace ccm::rt::simd_impl
 
 namespace ccm::rt
 {
-	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	template <typename T, typename Policy = policy::default_errno, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
 	T sqrt_rt(T num)
 	{
+		if constexpr (std::is_same_v<Policy, policy::no_errno>)
+		{
+			// Without -fno-math-errno the builtin keeps a call to libm for negative inputs so it can set errno.
+#if defined(CCMATH_HAS_SIMD)
+			// The SIMD instruction returns the same value with no side effects and lets the compiler drop that call.
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			{
+				if (CCM_UNLIKELY(ccm::support::fenv::get_rounding_mode() != FE_TONEAREST)) { return gen::sqrt_gen<T>(num); }
+				return simd_impl::sqrt_simd_impl(num);
+			}
+#endif
+			// Otherwise answer the inputs libm would report an error for before it is reached.
+			if (CCM_UNLIKELY(num < static_cast<T>(0))) { return std::numeric_limits<T>::quiet_NaN(); }
+		}
+
 #if CCM_HAS_BUILTIN(__builtin_sqrt) || defined(__builtin_sqrt) // Prefer the builtins if available.
 		if constexpr (std::is_same_v<T, float>) { return __builtin_sqrtf(num); }
 		else if constexpr (std::is_same_v<T, double>) { return __builtin_sqrt(num); }
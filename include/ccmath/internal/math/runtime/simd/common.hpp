@@ -141,6 +141,45 @@ namespace ccm::intrin
 		std::array<T, simd<T, Abi>::size()> m_value;
 	};
 
+	/**
+	 * @brief Applies a scalar callable to every lane of a simd value.
+	 *
+	 * This is the fallback used by functions that do not have a dedicated vector kernel for the active ABI.
+	 * The lanes are spilled to the stack, transformed one by one and reloaded.
+	 */
+	template <class T, class Abi, class F>
+	CCM_ALWAYS_INLINE simd<T, Abi> lanewise(F && func, simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		for (int i = 0; i < simd<T, Abi>::size(); ++i) { lanes[i] = func(lanes[i]); }
+		return simd<T, Abi>(lanes.data(), element_aligned_tag());
+	}
+
+	template <class T, class Abi, class F>
+	CCM_ALWAYS_INLINE simd<T, Abi> lanewise(F && func, simd<T, Abi> const & a, simd<T, Abi> const & b)
+	{
+		std::array<T, simd<T, Abi>::size()> lhs;
+		std::array<T, simd<T, Abi>::size()> rhs;
+		a.copy_to(lhs.data(), element_aligned_tag());
+		b.copy_to(rhs.data(), element_aligned_tag());
+		for (int i = 0; i < simd<T, Abi>::size(); ++i) { lhs[i] = func(lhs[i], rhs[i]); }
+		return simd<T, Abi>(lhs.data(), element_aligned_tag());
+	}
+
+	template <class T, class Abi, class F>
+	CCM_ALWAYS_INLINE simd<T, Abi> lanewise(F && func, simd<T, Abi> const & a, simd<T, Abi> const & b, simd<T, Abi> const & c)
+	{
+		std::array<T, simd<T, Abi>::size()> x;
+		std::array<T, simd<T, Abi>::size()> y;
+		std::array<T, simd<T, Abi>::size()> z;
+		a.copy_to(x.data(), element_aligned_tag());
+		b.copy_to(y.data(), element_aligned_tag());
+		c.copy_to(z.data(), element_aligned_tag());
+		for (int i = 0; i < simd<T, Abi>::size(); ++i) { x[i] = func(x[i], y[i], z[i]); }
+		return simd<T, Abi>(x.data(), element_aligned_tag());
+	}
+
 	template <class T>
 	struct simd_size
 	{
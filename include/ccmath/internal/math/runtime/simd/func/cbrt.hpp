@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// Generic implementation, written in terms of the simd operators
+#include "impl/scalar/cbrt.hpp"
+
+// Only the bit trick seed needs integer instructions, the rest runs on the generic implementation.
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include "impl/sse2/cbrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE3
+		#include "impl/sse3/cbrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSSE3
+		#include "impl/ssse3/cbrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4
+		#include "impl/sse4/cbrt.hpp"
+	#endif
+
+	// AVX without AVX2 has no 256-bit integer instructions and keeps the lane by lane seed.
+
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include "impl/avx2/cbrt.hpp"
+	#endif
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// The final scaling uses the vector ldexp and Steed's normalization the vector sqrt.
+#include "ldexp.hpp"
+#include "sqrt.hpp"
+
+// Generic implementation, written in terms of the simd operators. Every ABI uses it as is.
+#include "impl/scalar/cyl_bessel.hpp"
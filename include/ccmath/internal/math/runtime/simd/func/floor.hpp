@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// Generic implementation, written in terms of the simd operators
+#include "impl/scalar/floor.hpp"
+
+// SSE4.1 and AVX have a rounding instruction, the older ABIs use the generic implementation.
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE4
+		#include "impl/sse4/floor.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include "impl/avx/floor.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include "impl/avx2/floor.hpp"
+	#endif
+#endif
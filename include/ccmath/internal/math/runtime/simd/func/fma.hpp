@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// Generic implementation and the has_fma_v trait
+#include "impl/scalar/fma.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	// FMA3 for every x86 ABI, see there.
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include "impl/sse2/fma.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_NEON
+		#include "impl/neon/fma.hpp"
+	#endif
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// frexp is written in terms of logb_normal, so it picks up its integer instruction versions.
+#include "logb.hpp"
+
+// Generic implementation, written in terms of the simd operators
+#include "impl/scalar/frexp.hpp"
+
+// Only frexp_mantissa has its own bitwise instruction versions, the rest runs on the generic implementation.
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include "impl/sse2/frexp.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE3
+		#include "impl/sse3/frexp.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSSE3
+		#include "impl/ssse3/frexp.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4
+		#include "impl/sse4/frexp.hpp"
+	#endif
+
+	// AVX without AVX2 works lane by lane, as the rest of this family does.
+
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include "impl/avx2/frexp.hpp"
+	#endif
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// The gamma functions are built on the vector exp and log.
+#include "exp.hpp"
+#include "log.hpp"
+
+// Generic implementation, written in terms of the simd operators. Every ABI uses it as is.
+#include "impl/scalar/gamma.hpp"
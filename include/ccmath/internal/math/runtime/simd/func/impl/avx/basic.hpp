@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		// vmaxps/vminps return their second operand when either lane is NaN or both are zeros. The zeros are fixed up with
+		// the and (fmax) or or (fmin) of the two lanes, then a NaN second operand is replaced by the first.
+
+		CCM_ALWAYS_INLINE __m256 select_ps(__m256 mask, __m256 a, __m256 b)
+		{
+			return _mm256_blendv_ps(b, a, mask);
+		}
+
+		CCM_ALWAYS_INLINE __m256d select_pd(__m256d mask, __m256d a, __m256d b)
+		{
+			return _mm256_blendv_pd(b, a, mask);
+		}
+
+		CCM_ALWAYS_INLINE __m256 fabs_ps(__m256 x)
+		{
+			return _mm256_andnot_ps(_mm256_set1_ps(-0.0F), x);
+		}
+
+		CCM_ALWAYS_INLINE __m256d fabs_pd(__m256d x)
+		{
+			return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+		}
+
+		CCM_ALWAYS_INLINE __m256 copysign_ps(__m256 mag, __m256 sgn)
+		{
+			const __m256 sign = _mm256_set1_ps(-0.0F);
+			return _mm256_or_ps(_mm256_andnot_ps(sign, mag), _mm256_and_ps(sign, sgn));
+		}
+
+		CCM_ALWAYS_INLINE __m256d copysign_pd(__m256d mag, __m256d sgn)
+		{
+			const __m256d sign = _mm256_set1_pd(-0.0);
+			return _mm256_or_pd(_mm256_andnot_pd(sign, mag), _mm256_and_pd(sign, sgn));
+		}
+
+		CCM_ALWAYS_INLINE __m256 fmax_ps(__m256 x, __m256 y)
+		{
+			const __m256 r = select_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ), _mm256_and_ps(x, y), _mm256_max_ps(x, y));
+			return select_ps(_mm256_cmp_ps(y, y, _CMP_UNORD_Q), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m256d fmax_pd(__m256d x, __m256d y)
+		{
+			const __m256d r = select_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ), _mm256_and_pd(x, y), _mm256_max_pd(x, y));
+			return select_pd(_mm256_cmp_pd(y, y, _CMP_UNORD_Q), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m256 fmin_ps(__m256 x, __m256 y)
+		{
+			const __m256 r = select_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ), _mm256_or_ps(x, y), _mm256_min_ps(x, y));
+			return select_ps(_mm256_cmp_ps(y, y, _CMP_UNORD_Q), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m256d fmin_pd(__m256d x, __m256d y)
+		{
+			const __m256d r = select_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ), _mm256_or_pd(x, y), _mm256_min_pd(x, y));
+			return select_pd(_mm256_cmp_pd(y, y, _CMP_UNORD_Q), x, r);
+		}
+
+		// !(x <= y) holds where x > y and where a lane is NaN, x - y is then the result.
+		CCM_ALWAYS_INLINE __m256 fdim_ps(__m256 x, __m256 y)
+		{
+			return _mm256_and_ps(_mm256_cmp_ps(x, y, _CMP_NLE_UQ), _mm256_sub_ps(x, y));
+		}
+
+		CCM_ALWAYS_INLINE __m256d fdim_pd(__m256d x, __m256d y)
+		{
+			return _mm256_and_pd(_mm256_cmp_pd(x, y, _CMP_NLE_UQ), _mm256_sub_pd(x, y));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> fabs(simd<float, abi::avx> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(detail::fabs_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> fabs(simd<double, abi::avx> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx>(detail::fabs_pd(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> copysign(simd<float, abi::avx> const & a, simd<float, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(detail::copysign_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> copysign(simd<double, abi::avx> const & a, simd<double, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx>(detail::copysign_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> fmax(simd<float, abi::avx> const & a, simd<float, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(detail::fmax_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> fmax(simd<double, abi::avx> const & a, simd<double, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx>(detail::fmax_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> fmin(simd<float, abi::avx> const & a, simd<float, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(detail::fmin_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> fmin(simd<double, abi::avx> const & a, simd<double, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx>(detail::fmin_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> fdim(simd<float, abi::avx> const & a, simd<float, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(detail::fdim_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> fdim(simd<double, abi::avx> const & a, simd<double, abi::avx> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx>(detail::fdim_pd(a.get(), b.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX
+#endif	   // CCMATH_HAS_SIMD
@@ -14,19 +14,34 @@
 
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_AVX
+
+		#if !CCMATH_HAS_SIMD_SVML
+			#include "ccmath/internal/math/generic/func/power/pow_gen.hpp"
+		#endif
+
 namespace ccm::intrin
 {
 
 	CCM_ALWAYS_INLINE simd<float, abi::avx> pow(simd<float, abi::avx> const & a, simd<float, abi::avx> const & b)
 	{
+		// _mm256_pow_ps is an SVML function, see the SSE2 version.
+		#if CCMATH_HAS_SIMD_SVML
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
 		return simd<float, abi::avx>(_mm256_pow_ps(a.get(), b.get()));
+		#else
+		return lanewise([](float x, float y) { return gen::pow_gen(x, y); }, a, b);
+		#endif
 	}
 
 	CCM_ALWAYS_INLINE simd<double, abi::avx> pow(simd<double, abi::avx> const & a, simd<double, abi::avx> const & b)
 	{
+		// _mm256_pow_pd is an SVML function, see the SSE2 version.
+		#if CCMATH_HAS_SIMD_SVML
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
 		return simd<double, abi::avx>(_mm256_pow_pd(a.get(), b.get()));
+		#else
+		return lanewise([](double x, double y) { return gen::pow_gen(x, y); }, a, b);
+		#endif
 	}
 
 } // namespace ccm::intrin
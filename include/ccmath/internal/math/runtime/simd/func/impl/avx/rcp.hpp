@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rcp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx> rcp_estimate(simd<float, abi::avx> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(_mm256_rcp_ps(a.get()));
+	}
+
+	// No double estimate here either, see the SSE2 version.
+	template <int Steps>
+	CCM_ALWAYS_INLINE simd<double, abi::avx> rcp(simd<double, abi::avx> const & a)
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rcp takes 0, 1 or 2 refinement steps");
+		return simd<double, abi::avx>(1.0) / a;
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rsqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		CCM_ALWAYS_INLINE __m128d rsqrt_seed_avx_half(__m128d x)
+		{
+			const __m128i magic = _mm_set1_epi64x(static_cast<long long>(gen::internal::rsqrt_constants<double>::magic));
+			return _mm_castsi128_pd(_mm_sub_epi64(magic, _mm_srli_epi64(_mm_castpd_si128(x), 1)));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx> rsqrt_estimate(simd<float, abi::avx> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx>(_mm256_rsqrt_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx> rsqrt_estimate(simd<double, abi::avx> const & a)
+	{
+		// AVX has no 256-bit integer subtraction, so the bit trick seed is formed on each 128-bit half.
+		const __m128d lo = detail::rsqrt_seed_avx_half(_mm256_castpd256_pd128(a.get()));
+		const __m128d hi = detail::rsqrt_seed_avx_half(_mm256_extractf128_pd(a.get(), 1));
+		const simd<double, abi::avx> seed(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1));
+		return gen::internal::rsqrt_refine<2>(a, seed);
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/avx/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> fabs(simd<float, abi::avx2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(detail::fabs_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> fabs(simd<double, abi::avx2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(detail::fabs_pd(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> copysign(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(detail::copysign_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> copysign(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(detail::copysign_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> fmax(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(detail::fmax_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> fmax(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(detail::fmax_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> fmin(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(detail::fmin_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> fmin(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(detail::fmin_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> fdim(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(detail::fdim_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> fdim(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(detail::fdim_pd(a.get(), b.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/cbrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		// n / 3 == (n * 0xAAAAAAAB) >> 33 for every 32-bit n. _mm256_mul_epu32 multiplies the even 32-bit lanes.
+		CCM_ALWAYS_INLINE __m256i cbrt_divide_by_three_epu64(__m256i n)
+		{
+			return _mm256_srli_epi64(_mm256_mul_epu32(n, _mm256_set1_epi32(static_cast<int>(0xAAAAAAABU))), 33);
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> cbrt_seed(simd<float, abi::avx2> const & a)
+	{
+		const __m256i bits = _mm256_castps_si256(a.get());
+		const __m256i even = detail::cbrt_divide_by_three_epu64(bits);
+		const __m256i odd  = detail::cbrt_divide_by_three_epu64(_mm256_srli_epi64(bits, 32));
+		const __m256i q	   = _mm256_or_si256(even, _mm256_slli_epi64(odd, 32));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(
+			_mm256_castsi256_ps(_mm256_add_epi32(q, _mm256_set1_epi32(static_cast<int>(gen::internal::cbrt_constants<float>::bias_third)))));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> cbrt_seed(simd<double, abi::avx2> const & a)
+	{
+		const __m256i high = _mm256_srli_epi64(_mm256_castpd_si256(a.get()), 32);
+		const __m256i q	   = detail::cbrt_divide_by_three_epu64(high);
+		const __m256i seed = _mm256_add_epi32(q, _mm256_set1_epi32(static_cast<int>(gen::internal::cbrt_constants<double>::bias_third)));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(_mm256_castsi256_pd(_mm256_slli_epi64(seed, 32)));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
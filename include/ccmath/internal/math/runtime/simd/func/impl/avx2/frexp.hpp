@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/frexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> frexp_mantissa(simd<float, abi::avx2> const & a)
+	{
+		const __m256 keep = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x807FFFFFU)));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(_mm256_or_ps(_mm256_and_ps(a.get(), keep), _mm256_set1_ps(0.5F)));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> frexp_mantissa(simd<double, abi::avx2> const & a)
+	{
+		const __m256d keep = _mm256_castsi256_pd(_mm256_set1_epi64x(static_cast<long long>(0x800FFFFFFFFFFFFFULL)));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(_mm256_or_pd(_mm256_and_pd(a.get(), keep), _mm256_set1_pd(0.5)));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> pow2i(simd<float, abi::avx2> const & n)
+	{
+		const __m256i biased = _mm256_add_epi32(_mm256_cvttps_epi32(n.get()), _mm256_set1_epi32(127));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(_mm256_castsi256_ps(_mm256_slli_epi32(biased, 23)));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> pow2i(simd<double, abi::avx2> const & n)
+	{
+		// Four 32-bit exponents, widened to the four 64-bit lanes before shifting into place.
+		const __m128i biased = _mm_add_epi32(_mm256_cvttpd_epi32(n.get()), _mm_set1_epi32(1023));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(biased), 52)));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/logb.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> logb_normal(simd<float, abi::avx2> const & a)
+	{
+		const __m256i e = _mm256_srli_epi32(_mm256_castps_si256(a.get()), 23);
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(_mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(127))));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> logb_normal(simd<double, abi::avx2> const & a)
+	{
+		// The exponents end up in the low halves of the 64-bit lanes, gather them into the four low 32-bit lanes.
+		const __m256i shifted = _mm256_srli_epi64(_mm256_castpd_si256(a.get()), 52);
+		const __m128i e		  = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(shifted, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::avx2>(_mm256_cvtepi32_pd(_mm_sub_epi32(e, _mm_set1_epi32(1023))));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
@@ -14,19 +14,34 @@
 
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_AVX2
+
+		#if !CCMATH_HAS_SIMD_SVML
+			#include "ccmath/internal/math/generic/func/power/pow_gen.hpp"
+		#endif
+
 namespace ccm::intrin
 {
 
 	CCM_ALWAYS_INLINE simd<float, abi::avx2> pow(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
 	{
+		// _mm256_pow_ps is an SVML function, see the SSE2 version.
+		#if CCMATH_HAS_SIMD_SVML
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
 		return simd<float, abi::avx2>(_mm256_pow_ps(a.get(), b.get()));
+		#else
+		return lanewise([](float x, float y) { return gen::pow_gen(x, y); }, a, b);
+		#endif
 	}
 
 	CCM_ALWAYS_INLINE simd<double, abi::avx2> pow(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
 	{
+		// _mm256_pow_pd is an SVML function, see the SSE2 version.
+		#if CCMATH_HAS_SIMD_SVML
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
 		return simd<double, abi::avx2>(_mm256_pow_pd(a.get(), b.get()));
+		#else
+		return lanewise([](double x, double y) { return gen::pow_gen(x, y); }, a, b);
+		#endif
 
 	}
 
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rsqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include <immintrin.h>
+
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::avx2> rsqrt_estimate(simd<float, abi::avx2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::avx2>(_mm256_rsqrt_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx2> rsqrt_estimate(simd<double, abi::avx2> const & a)
+	{
+		const __m256i magic = _mm256_set1_epi64x(static_cast<long long>(gen::internal::rsqrt_constants<double>::magic));
+		const simd<double, abi::avx2> seed(_mm256_castsi256_pd(_mm256_sub_epi64(magic, _mm256_srli_epi64(_mm256_castpd_si256(a.get()), 1))));
+		return gen::internal::rsqrt_refine<2>(a, seed);
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX2
+#endif	   // CCMATH_HAS_SIMD
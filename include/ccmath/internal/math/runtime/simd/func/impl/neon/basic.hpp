@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_NEON
+namespace ccm::intrin
+{
+	// fmaxnm/fminnm already ignore a quiet NaN lane and order -0 below +0.
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fabs(simd<float, abi::neon> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vabsq_f32(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fabs(simd<double, abi::neon> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vabsq_f64(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> copysign(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vbslq_f32(vdupq_n_u32(0x80000000U), b.get(), a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> copysign(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vbslq_f64(vdupq_n_u64(0x8000000000000000ULL), b.get(), a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fmax(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vmaxnmq_f32(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fmax(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vmaxnmq_f64(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fmin(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vminnmq_f32(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fmin(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vminnmq_f64(a.get(), b.get()));
+	}
+
+	// x <= y is false where x > y and where a lane is NaN, x - y is then the result.
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fdim(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vbslq_f32(vcleq_f32(a.get(), b.get()), vdupq_n_f32(0.0F), vsubq_f32(a.get(), b.get())));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fdim(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vbslq_f64(vcleq_f64(a.get(), b.get()), vdupq_n_f64(0.0), vsubq_f64(a.get(), b.get())));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_NEON
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_NEON
+namespace ccm::intrin::detail
+{
+	template <class T>
+	struct fma_instruction<T, abi::neon> : std::true_type
+	{
+		// vfmaq takes the addend first.
+		static CCM_ALWAYS_INLINE float32x4_t apply(float32x4_t a, float32x4_t b, float32x4_t c) { return vfmaq_f32(c, a, b); }
+		static CCM_ALWAYS_INLINE float64x2_t apply(float64x2_t a, float64x2_t b, float64x2_t c) { return vfmaq_f64(c, a, b); }
+	};
+} // namespace ccm::intrin::detail
+
+	#endif // CCMATH_HAS_SIMD_NEON
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rcp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_NEON
+namespace ccm::intrin
+{
+	// vrecpe is only good to 8 bits. vrecps gives 2 - a * b, so one step of r * vrecps(x, r) takes it past 12.
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> rcp_estimate(simd<float, abi::neon> const & a)
+	{
+		const float32x4_t r = vrecpeq_f32(a.get());
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vmulq_f32(r, vrecpsq_f32(a.get(), r)));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> rcp_estimate(simd<double, abi::neon> const & a)
+	{
+		const float64x2_t r = vrecpeq_f64(a.get());
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vmulq_f64(r, vrecpsq_f64(a.get(), r)));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_NEON
+#endif	   // CCMATH_HAS_SIMD
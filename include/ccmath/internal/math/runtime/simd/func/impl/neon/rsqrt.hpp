@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rsqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_NEON
+namespace ccm::intrin
+{
+	// vrsqrte is only good to 8 bits. vrsqrts gives (3 - a * b) / 2, so one step of y * vrsqrts(x * y, y) takes it
+	// past 12.
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> rsqrt_estimate(simd<float, abi::neon> const & a)
+	{
+		const float32x4_t y = vrsqrteq_f32(a.get());
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::neon>(vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a.get(), y), y)));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> rsqrt_estimate(simd<double, abi::neon> const & a)
+	{
+		const float64x2_t y = vrsqrteq_f64(a.get());
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::neon>(vmulq_f64(y, vrsqrtsq_f64(vmulq_f64(a.get(), y), y)));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_NEON
+#endif	   // CCMATH_HAS_SIMD
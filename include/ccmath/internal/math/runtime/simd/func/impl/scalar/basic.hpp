@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/bits.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * fabs, copysign, fmax, fmin and fdim without branches.
+ *
+ * fabs and copysign only touch the sign bit. fmax and fmin return the other lane when one of them is NaN, NaN when
+ * both are, and +0 (fmax) or -0 (fmin) for a pair of zeros of opposite signs, whatever the order of the arguments.
+ * fdim is x - y where x > y or a lane is NaN, and +0 elsewhere. These are the results of the scalar ccm functions.
+ *
+ * The fallbacks below run the same selects one lane at a time, which the compiler can keep branch free. The x86 and
+ * NEON ABIs overload them with the vector instructions.
+ */
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		template <class T>
+		using basic_bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+		template <class T>
+		inline constexpr basic_bits_t<T> basic_sign_mask = basic_bits_t<T>{1} << (sizeof(T) * 8 - 1);
+
+		template <class T>
+		CCM_ALWAYS_INLINE T fabs_lane(T x) noexcept
+		{
+			return support::bit_cast<T>(support::bit_cast<basic_bits_t<T>>(x) & ~basic_sign_mask<T>);
+		}
+
+		template <class T>
+		CCM_ALWAYS_INLINE T copysign_lane(T mag, T sgn) noexcept
+		{
+			return support::bit_cast<T>((support::bit_cast<basic_bits_t<T>>(mag) & ~basic_sign_mask<T>) |
+										(support::bit_cast<basic_bits_t<T>>(sgn) & basic_sign_mask<T>));
+		}
+
+		template <class T>
+		CCM_ALWAYS_INLINE T fmax_lane(T x, T y) noexcept
+		{
+			T r = y < x ? x : y;
+			r	= y != y ? x : r;
+			// Equal lanes only differ for ±0, and the and of the bits keeps +0.
+			return x == y ? support::bit_cast<T>(support::bit_cast<basic_bits_t<T>>(x) & support::bit_cast<basic_bits_t<T>>(y)) : r;
+		}
+
+		template <class T>
+		CCM_ALWAYS_INLINE T fmin_lane(T x, T y) noexcept
+		{
+			T r = x < y ? x : y;
+			r	= y != y ? x : r;
+			// Equal lanes only differ for ±0, and the or of the bits keeps -0.
+			return x == y ? support::bit_cast<T>(support::bit_cast<basic_bits_t<T>>(x) | support::bit_cast<basic_bits_t<T>>(y)) : r;
+		}
+
+		template <class T>
+		CCM_ALWAYS_INLINE T fdim_lane(T x, T y) noexcept
+		{
+			return x <= y ? T(0) : x - y;
+		}
+	} // namespace detail
+
+	/// Absolute value of every lane.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> fabs(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return detail::fabs_lane(x); }, a);
+	}
+
+	/// Magnitude of every lane of mag with the sign of the same lane of sgn.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> copysign(simd<T, Abi> const & mag, simd<T, Abi> const & sgn)
+	{
+		return lanewise([](T x, T y) { return detail::copysign_lane(x, y); }, mag, sgn);
+	}
+
+	/// Larger of every pair of lanes, NaN lanes being ignored.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> fmax(simd<T, Abi> const & a, simd<T, Abi> const & b)
+	{
+		return lanewise([](T x, T y) { return detail::fmax_lane(x, y); }, a, b);
+	}
+
+	/// Smaller of every pair of lanes, NaN lanes being ignored.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> fmin(simd<T, Abi> const & a, simd<T, Abi> const & b)
+	{
+		return lanewise([](T x, T y) { return detail::fmin_lane(x, y); }, a, b);
+	}
+
+	/// Positive difference of every pair of lanes.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> fdim(simd<T, Abi> const & a, simd<T, Abi> const & b)
+	{
+		return lanewise([](T x, T y) { return detail::fdim_lane(x, y); }, a, b);
+	}
+} // namespace ccm::intrin
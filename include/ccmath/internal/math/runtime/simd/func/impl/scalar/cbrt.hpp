@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Bit trick estimate of cbrt for positive normal lanes, see gen::internal::cbrt_seed.
+	 *
+	 * This fallback computes it one lane at a time. ABIs with integer vector instructions overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cbrt_seed(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return gen::internal::cbrt_seed(x); }, a);
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cbrt(simd<T, Abi> const & a)
+	{
+		using constants = gen::internal::cbrt_constants<T>;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> ax = choose(a < zero, -a, a);
+
+		// Same steps as gen::internal::cbrt_impl, with selects in place of branches.
+		const auto tiny		 = ax < simd<T, Abi>(std::numeric_limits<T>::min());
+		const simd<T, Abi> t = cbrt_seed(choose(tiny, ax * constants::tiny_scale, ax));
+		simd<T, Abi> r		 = gen::internal::cbrt_refine(ax, choose(tiny, t * constants::tiny_unscale, t));
+		r					 = choose(a < zero, -r, r);
+
+		// ±0, ±inf and NaN are returned as they are.
+		const auto regular = zero < ax && ax < simd<T, Abi>(std::numeric_limits<T>::infinity());
+		return choose(regular, r, a);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> cbrt(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::cbrt_gen(a.get()));
+	}
+} // namespace ccm::intrin
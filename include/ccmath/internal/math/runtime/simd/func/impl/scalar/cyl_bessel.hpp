@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_i_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_j_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_k_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/cyl_neumann_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+/*
+ * The gen::internal implementations are written on a lane type, so the vector forms run them on double lanes as they
+ * are. The order is shared by every lane, and the recurrences take the same orders in each of them. The series,
+ * continued fractions and Hankel's expansion run until all of their lanes are done, with the rest masked off.
+ */
+
+namespace ccm::intrin
+{
+	/// Cylindrical Bessel function of the first kind of order nu of double lanes, the same steps as gen::cyl_bessel_j_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cyl_bessel_j(double nu, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector cyl_bessel_j works on double lanes, float values are converted first");
+		simd<T, Abi> r(T(0));
+		gen::internal::cyl_bessel_j_impl(nu, 0U, x, [&r](unsigned, simd<T, Abi> const & v) { r = v; });
+		return r;
+	}
+
+	/// Cylindrical Bessel function of the second kind of order nu of double lanes, the same steps as gen::cyl_neumann_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cyl_neumann(double nu, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector cyl_neumann works on double lanes, float values are converted first");
+		simd<T, Abi> r(T(0));
+		gen::internal::cyl_neumann_impl(nu, 0U, x, [&r](unsigned, simd<T, Abi> const & v) { r = v; });
+		return r;
+	}
+
+	/// Modified cylindrical Bessel function of the first kind of order nu of double lanes, the same steps as gen::cyl_bessel_i_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cyl_bessel_i(double nu, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector cyl_bessel_i works on double lanes, float values are converted first");
+		simd<T, Abi> r(T(0));
+		gen::internal::cyl_bessel_i_impl(nu, 0U, x, [&r](unsigned, simd<T, Abi> const & v) { r = v; });
+		return r;
+	}
+
+	/// Modified cylindrical Bessel function of the second kind of order nu of double lanes, the same steps as gen::cyl_bessel_k_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> cyl_bessel_k(double nu, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector cyl_bessel_k works on double lanes, float values are converted first");
+		simd<T, Abi> r(T(0));
+		gen::internal::cyl_bessel_k_impl(nu, 0U, x, [&r](unsigned, simd<T, Abi> const & v) { r = v; });
+		return r;
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> cyl_bessel_j(double nu, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::cyl_bessel_j_gen<T>(static_cast<T>(nu), x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> cyl_neumann(double nu, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::cyl_neumann_gen<T>(static_cast<T>(nu), x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> cyl_bessel_i(double nu, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::cyl_bessel_i_gen<T>(static_cast<T>(nu), x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> cyl_bessel_k(double nu, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::cyl_bessel_k_gen<T>(static_cast<T>(nu), x.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/misc/erf_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	/// Error function of double lanes. Each range of gen::internal::erf_impl is only evaluated if some lane is in it.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> erf(simd<T, Abi> const & a)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector erf works on double lanes, float values are converted first");
+		using constants = gen::internal::erf_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const auto neg		  = a < zero;
+		const simd<T, Abi> ax = choose(neg, -a, a);
+
+		const auto small = ax < simd<T, Abi>(constants::small_limit);
+		const auto mid	 = !small && ax < simd<T, Abi>(constants::one_limit);
+
+		simd<T, Abi> r = choose(neg, -one, one);
+		if (any_of(small)) { r = choose(small, gen::internal::erf_small(a), r); }
+		if (any_of(mid))
+		{
+			const simd<T, Abi> m = one - gen::internal::erfc_tail(choose(mid, ax, one));
+			r					 = choose(mid, choose(neg, -m, m), r);
+		}
+
+		// NaN propagates.
+		return choose(a == a, r, a);
+	}
+
+	/// Complementary error function of double lanes, see erf.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> erfc(simd<T, Abi> const & a)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector erfc works on double lanes, float values are converted first");
+		using constants = gen::internal::erf_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> two(T(2));
+		const auto neg		  = a < zero;
+		const simd<T, Abi> ax = choose(neg, -a, a);
+
+		const auto small = ax < simd<T, Abi>(constants::erfc_small_limit);
+		const auto mid	 = !small && simd<T, Abi>(-constants::one_limit) < a && a < simd<T, Abi>(constants::erfc_max);
+
+		// erfc is 2 far left and underflows to 0 far right.
+		simd<T, Abi> r = choose(neg, two, zero);
+		if (any_of(small)) { r = choose(small, one - gen::internal::erf_small(a), r); }
+		if (any_of(mid))
+		{
+			const simd<T, Abi> t = gen::internal::erfc_tail(choose(mid, ax, one));
+			r					 = choose(mid, choose(neg, two - t, t), r);
+		}
+
+		return choose(a == a, r, a);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> erf(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::erf_gen(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> erfc(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::erfc_gen(a.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/misc/erfinv_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/log.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ndtri.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// Magnitude of erfinv in the lanes selected by tail, from 1 - |d| in arg. The other lanes are unspecified.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> erfinv_tail(simd<T, Abi> const & arg, simd_mask<T, Abi> const & tail)
+		{
+			using constants = gen::internal::erfinv_constants;
+
+			return ndtri_tail(simd<T, Abi>(constants::ln2) - log(arg), tail) * constants::sqrt1_2;
+		}
+	} // namespace detail
+
+	/// Inverse error function of double lanes. Each range of gen::internal::erfinv_impl is only evaluated if some lane is in it.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> erfinv(simd<T, Abi> const & y)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector erfinv works on double lanes, float values are converted first");
+		using constants = gen::internal::erfinv_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		const auto neg		  = y < zero;
+		const simd<T, Abi> ay = choose(neg, -y, y);
+
+		// NaN lanes count as central, which carries them through.
+		const auto central = !(simd<T, Abi>(constants::central_limit) < ay);
+		const auto tail	   = !central && ay < one;
+
+		// ±1 gives ±inf, and everything outside [-1, 1] NaN.
+		simd<T, Abi> r = choose(ay == one, choose(neg, -inf, inf), simd<T, Abi>(std::numeric_limits<T>::quiet_NaN()));
+		if (any_of(central)) { r = choose(central, gen::internal::erfinv_central(y), r); }
+		if (any_of(tail))
+		{
+			// 1 - |y| is exact for |y| >= 0.5. Lanes outside the tails run on 0.5.
+			const simd<T, Abi> v = detail::erfinv_tail(choose(tail, one - ay, simd<T, Abi>(T(0.5))), tail);
+			r					 = choose(tail, choose(neg, -v, v), r);
+		}
+		return r;
+	}
+
+	/// Inverse complementary error function of double lanes, see erfinv.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> erfcinv(simd<T, Abi> const & z)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector erfcinv works on double lanes, float values are converted first");
+		using constants = gen::internal::erfinv_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> two(T(2));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		const simd<T, Abi> d  = simd<T, Abi>(T(1)) - z;
+		const auto neg		  = d < zero;
+		const simd<T, Abi> ad = choose(neg, -d, d);
+
+		const auto central = !(simd<T, Abi>(constants::central_limit) < ad);
+		const auto tail	   = !central && zero < z && z < two;
+
+		// 0 gives +inf, 2 gives -inf, and everything outside [0, 2] NaN.
+		simd<T, Abi> r = choose(z == zero, inf, choose(z == two, -inf, simd<T, Abi>(std::numeric_limits<T>::quiet_NaN())));
+		if (any_of(central)) { r = choose(central, gen::internal::erfinv_central(d), r); }
+		if (any_of(tail))
+		{
+			// 1 - |d| is z on the right and 2 - z, which is exact, on the left.
+			const simd<T, Abi> v = detail::erfinv_tail(choose(tail, choose(neg, two - z, z), simd<T, Abi>(T(0.5))), tail);
+			r					 = choose(tail, choose(neg, -v, v), r);
+		}
+		return r;
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> erfinv(simd<T, abi::scalar> const & y)
+	{
+		return simd<T, abi::scalar>(gen::erfinv_gen(y.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> erfcinv(simd<T, abi::scalar> const & z)
+	{
+		return simd<T, abi::scalar>(gen::erfcinv_gen(z.get()));
+	}
+} // namespace ccm::intrin
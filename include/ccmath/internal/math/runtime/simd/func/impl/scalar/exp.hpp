@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/exp_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/math/expo/impl/exp_double_impl.hpp"
+#include "ccmath/math/expo/impl/exp_float_impl.hpp"
+
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// Below this magnitude k = round(x / ln2) stays inside the normal exponent range, so 2^k is a single pow2i.
+		template <class T>
+		inline constexpr T exp_lean_limit = std::is_same_v<T, float> ? T(87) : T(708);
+
+		/**
+		 * @brief exp(hi + lo) for double-double lanes, see gen::internal::exp_dd.
+		 *
+		 * Arguments outside the clamp range give inf or 0 and NaN lanes are returned as they are. When every lane is
+		 * within exp_lean_limit the clamp, the NaN patching and the range check of ldexp are skipped, which gives the
+		 * same result with one compare for the whole vector.
+		 */
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> exp_dd(simd<T, Abi> const & hi, simd<T, Abi> const & lo)
+		{
+			using constants = gen::internal::exp_constants<T>;
+
+			const simd<T, Abi> limit(exp_lean_limit<T>);
+			if (all_of(simd<T, Abi>(T(0)) - limit < hi && hi < limit))
+			{
+				simd<T, Abi> k		 = simd<T, Abi>(T(0));
+				const simd<T, Abi> y = gen::internal::exp_reduce(hi, lo, k);
+				return y * pow2i(k);
+			}
+
+			const simd<T, Abi> clamp_lo(constants::clamp_lo);
+			const simd<T, Abi> clamp_hi(constants::clamp_hi);
+
+			// NaN lanes run on 0 so that ldexp sees an integral k, and are put back at the end.
+			const auto nan	 = !(hi == hi);
+			simd<T, Abi> h	 = choose(nan, simd<T, Abi>(T(0)), hi);
+			h				 = choose(h < clamp_lo, clamp_lo, choose(clamp_hi < h, clamp_hi, h));
+			simd<T, Abi> k	 = simd<T, Abi>(T(0));
+			simd<T, Abi> y	 = gen::internal::exp_reduce(h, lo, k);
+			return choose(nan, hi, ldexp(y, k));
+		}
+	} // namespace detail
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> exp(simd<T, Abi> const & a)
+	{
+		// Clamping takes care of ±inf: exp(+inf) = +inf and exp(-inf) = 0.
+		return detail::exp_dd(a, simd<T, Abi>(T(0)));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> exp(simd<T, abi::scalar> const & a)
+	{
+		// A single lane takes the table driven kernel of ccm::exp, which handles every special value itself.
+		if constexpr (std::is_same_v<T, float>) { return simd<T, abi::scalar>(ccm::internal::impl::exp_float_impl(a.get())); }
+		else { return simd<T, abi::scalar>(static_cast<T>(ccm::internal::impl::exp_double_impl(static_cast<double>(a.get())))); }
+	}
+
+	/// 2^a for every lane, computed as exp(a * ln2) with the product carried to double-double precision.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> exp2(simd<T, Abi> const & a)
+	{
+		using constants = gen::internal::exp_constants<T>;
+
+		// Clamping keeps the product finite, twice the clamp range of exp still rounds to 0 or inf.
+		const simd<T, Abi> lo(T(2) * constants::clamp_lo);
+		const simd<T, Abi> hi(T(2) * constants::clamp_hi);
+		const simd<T, Abi> x = choose(a < lo, lo, choose(hi < a, hi, a));
+		const auto p		 = type::exact_mult(x, simd<T, Abi>(constants::ln2));
+		return detail::exp_dd(p.hi, p.lo + x * constants::ln2_tail);
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Largest integer value not greater than every lane.
+	 *
+	 * Adding and subtracting 2^(digits - 1) rounds a lane below that magnitude to the nearest integer, the lanes that
+	 * were rounded up are then stepped down by one. Larger lanes, ±0, ±inf and NaN are already integral and are
+	 * returned unchanged. The steps are plain lane arithmetic, so this also serves the scalar ABI.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> floor(simd<T, Abi> const & a)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> magic(T(1) / std::numeric_limits<T>::epsilon());
+
+		const auto positive	  = zero < a;
+		const auto fractional = choose(positive, a, zero - a) < magic && !(a == zero);
+		simd<T, Abi> r		  = choose(positive, (a + magic) - magic, (a - magic) + magic);
+		r					  = r - choose(a < r, one, zero);
+		return choose(fractional, r, a);
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/**
+		 * @brief The fused multiply-add instruction of an ABI, for the ABIs that have one.
+		 *
+		 * Those specialize it as a std::true_type with a static apply(a, b, c) giving a * b + c on the registers of
+		 * simd<T, Abi>, so the overload below is written once for all of them.
+		 */
+		template <class T, class Abi, class = void>
+		struct fma_instruction : std::false_type
+		{
+		};
+	} // namespace detail
+
+	/**
+	 * @brief True when fma on simd<T, Abi> is a single fused instruction.
+	 *
+	 * The fallback below is still correctly rounded, but it goes through one scalar fma per lane, which is slower than
+	 * the handful of extra multiplications callers such as Dekker's product need to avoid it.
+	 */
+	template <class T, class Abi>
+	struct has_fma : std::bool_constant<detail::fma_instruction<T, Abi>::value>
+	{
+	};
+
+	template <class T, class Abi>
+	inline constexpr bool has_fma_v = has_fma<T, Abi>::value;
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> fma(simd<T, Abi> const & a, simd<T, Abi> const & b, simd<T, Abi> const & c)
+	{
+		if constexpr (has_fma_v<T, Abi>)
+		{
+			// NOLINTNEXTLINE(modernize-return-braced-init-list)
+			return simd<T, Abi>(detail::fma_instruction<T, Abi>::apply(a.get(), b.get(), c.get()));
+		}
+		else { return lanewise([](T x, T y, T z) { return ccm::support::multiply_add(x, y, z); }, a, b, c); }
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> fma(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b,
+																	 simd<T, abi::scalar> const & c)
+	{
+		return simd<T, abi::scalar>(ccm::support::multiply_add(a.get(), b.get(), c.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/fmanip/frexp_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/logb.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Replaces the exponent field of normal lanes with that of 0.5, which leaves the sign and a mantissa in [0.5, 1).
+	 *
+	 * This fallback works one lane at a time. ABIs with bitwise vector instructions overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> frexp_mantissa(simd<T, Abi> const & a)
+	{
+		return lanewise(
+			[](T x)
+			{
+				support::fp::FPBits<T> bits(x);
+				bits.set_biased_exponent(support::fp::FPBits<T>::exponent_bias - 1);
+				return bits.get_val();
+			},
+			a);
+	}
+
+	/**
+	 * @brief Splits every lane into a mantissa in [0.5, 1) and a power of two, as ccm::frexp does.
+	 * @param a Input lanes.
+	 * @param exp Receives the powers of two as integral values of T. Zero for ±0, ±inf and NaN.
+	 * @return The mantissas with the sign of a, or a itself in lanes holding ±0, ±inf or NaN.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> frexp(simd<T, Abi> const & a, simd<T, Abi> & exp)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		simd<T, Abi> ax			 = choose(a < zero, zero - a, a);
+		const simd<T, Abi> shift = detail::normalize_subnormals(ax);
+		const simd<T, Abi> e	 = logb_normal(ax);
+
+		// Subnormal lanes were scaled by a power of two, which leaves their mantissa bits where frexp_mantissa wants them.
+		const simd<T, Abi> m = frexp_mantissa(choose(a < zero, zero - ax, ax));
+
+		const auto regular = zero < ax && ax < inf;
+		exp				   = choose(regular, e + simd<T, Abi>(T(1)) - shift, zero);
+		return choose(regular, m, a);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> frexp(simd<T, abi::scalar> const & a, simd<T, abi::scalar> & exp)
+	{
+		int e	  = 0;
+		const T m = gen::frexp_gen(a.get(), e);
+		exp		  = simd<T, abi::scalar>(static_cast<T>(e));
+		return simd<T, abi::scalar>(m);
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/misc/gamma_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/exp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/log.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/**
+		 * @brief lgamma(y) as a double-double value for lanes in (0, gamma_constants::lgamma_max].
+		 *
+		 * Same steps as gen::internal::lgamma_positive, with selects in place of branches. Stirling's series and each
+		 * rational piece are only evaluated if some lane needs them.
+		 */
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE type::BasicDoubleDouble<simd<T, Abi>> lgamma_positive(simd<T, Abi> const & y)
+		{
+			using constants = gen::internal::gamma_constants;
+			using dd		= type::BasicDoubleDouble<simd<T, Abi>>;
+
+			const simd<T, Abi> zero(T(0));
+			const simd<T, Abi> one(T(1));
+			const simd<T, Abi> two(T(2));
+			const auto big = !(y < simd<T, Abi>(constants::stirling_limit));
+
+			dd r{zero, zero};
+			if (any_of(big)) { r = gen::internal::lgamma_stirling(choose(big, y, simd<T, Abi>(constants::stirling_limit))); }
+			if (all_of(big)) { return r; }
+
+			const simd<T, Abi> ys = choose(big, two, y);
+			const auto under	  = ys < one;
+
+			// Lanes below 1 add -log(y), those from 3 on the log of the shifts. Both share one log.
+			simd<T, Abi> z = ys;
+			const dd p	   = gen::internal::lgamma_shift_down(z);
+			const dd l	   = gen::internal::gamma_log(gen::internal::gamma_choose(under, dd{ys, zero}, p));
+			const dd extra = gen::internal::gamma_choose(under, dd{-l.hi, -l.lo}, l);
+
+			const simd<T, Abi> zm1 = choose(under, ys, z - T(1));
+			const simd<T, Abi> zm2 = choose(under, ys - T(1), z - T(2));
+			z					   = choose(under, ys + T(1), z);
+
+			const auto two_three = !(z < two);
+			const auto near_one	 = !two_three && !(simd<T, Abi>(T(1.5)) < z);
+			const auto near_two	 = !two_three && !near_one;
+
+			simd<T, Abi> v = zero;
+			if (any_of(two_three)) { v = choose(two_three, gen::internal::lgamma_two_three(z, zm2), v); }
+			if (any_of(near_one)) { v = choose(near_one, gen::internal::lgamma_near_one(zm1, zm2), v); }
+			if (any_of(near_two)) { v = choose(near_two, gen::internal::lgamma_near_two(zm1, zm2), v); }
+
+			const auto s = type::two_sum(extra.hi, v);
+			return gen::internal::gamma_choose(big, r, type::exact_add(s.hi, s.lo + extra.lo));
+		}
+
+		/// tgamma(y) / 2^e as a double-double value for lanes in [gamma_constants::tiny_limit, gamma_constants::reflect_limit].
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE type::BasicDoubleDouble<simd<T, Abi>> tgamma_positive_scaled(simd<T, Abi> const & y, simd<T, Abi> & e)
+		{
+			using constants = gen::internal::gamma_constants;
+			using dd		= type::BasicDoubleDouble<simd<T, Abi>>;
+
+			const simd<T, Abi> limit(constants::stirling_limit);
+			const auto big = !(y < limit);
+
+			dd g{simd<T, Abi>(T(0)), simd<T, Abi>(T(0))};
+			e = simd<T, Abi>(T(0));
+			if (any_of(big)) { g = gen::internal::tgamma_stirling_scaled(choose(big, y, limit), e); }
+			if (all_of(big)) { return g; }
+
+			const auto l	   = lgamma_positive(choose(big, simd<T, Abi>(T(1)), y));
+			simd<T, Abi> k	   = simd<T, Abi>(T(0));
+			const simd<T, Abi> m = gen::internal::exp_reduce_m1(l.hi, l.lo, k);
+			e				   = choose(big, e, k);
+			return gen::internal::gamma_choose(big, g, type::exact_add(simd<T, Abi>(T(1)), m));
+		}
+	} // namespace detail
+
+	/// Gamma function of double lanes, with the results of gen::tgamma_gen when both are built with -ffp-contract=off.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> tgamma(simd<T, Abi> const & a)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector tgamma works on double lanes, float values are converted first");
+		using constants = gen::internal::gamma_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> max(constants::tgamma_max);
+		const auto neg		  = a < zero;
+		const simd<T, Abi> ax = choose(neg, -a, a);
+
+		const auto tiny		 = ax < simd<T, Abi>(constants::tiny_limit);
+		const auto regular	 = !tiny && ax < simd<T, Abi>(constants::integral_limit);
+		const auto reflect	 = neg && regular;
+		const simd<T, Abi> y = choose(regular, ax, one);
+
+		// Positive lanes are clamped to tgamma_max and negative ones to reflect_limit, beyond which they take lgamma.
+		const simd<T, Abi> limit = choose(neg, simd<T, Abi>(constants::reflect_limit), max);
+		simd<T, Abi> e			 = zero;
+		const auto g			 = detail::tgamma_positive_scaled(choose(limit < y, limit, y), e);
+		simd<T, Abi> r			 = gen::internal::exp_scale(g.hi + g.lo, e);
+		auto domain				 = neg && !regular && !tiny;
+		if (any_of(reflect))
+		{
+			// Integers give s = 0 and are outside the domain, they run on 1 in the meantime.
+			auto s		= gen::internal::gamma_sinpi(y);
+			domain		= domain || (reflect && s.hi == zero);
+			s			= gen::internal::gamma_choose(s.hi == zero, type::BasicDoubleDouble<simd<T, Abi>>{one, zero}, s);
+			simd<T, Abi> n = gen::internal::tgamma_reflect(choose(limit < y, limit, y), s, g, e);
+
+			const auto far = reflect && limit < y;
+			if (any_of(far))
+			{
+				const auto l		 = gen::internal::lgamma_reflect(y, s, detail::lgamma_positive(choose(far, y, one)));
+				const simd<T, Abi> v = detail::exp_dd(l.hi, l.lo);
+				// Negated by a multiply, which keeps the sign of an underflowed 0.
+				n = choose(far, choose(s.hi < zero, v, v * T(-1)), n);
+			}
+			r = choose(neg, n, r);
+		}
+
+		// 1/x near 0 gives ±inf for ±0 and positive lanes overflow past tgamma_max. Negative integers, -inf and NaN give
+		// NaN.
+		r = choose(tiny, one / a, r);
+		r = choose(max < a, simd<T, Abi>(std::numeric_limits<T>::infinity()), r);
+		return choose(domain || !(a == a), simd<T, Abi>(std::numeric_limits<T>::quiet_NaN()), r);
+	}
+
+	/// Logarithm of the absolute value of the gamma function of double lanes, with the results of gen::lgamma_gen when
+	/// both are built with -ffp-contract=off.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> lgamma(simd<T, Abi> const & a)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector lgamma works on double lanes, float values are converted first");
+		using constants = gen::internal::gamma_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+		const auto neg		  = a < zero;
+		const simd<T, Abi> ax = choose(neg, -a, a);
+
+		// Negative lanes from integral_limit on are all poles and positive ones above lgamma_max overflow.
+		const simd<T, Abi> limit = choose(neg, simd<T, Abi>(constants::below_integral_limit), simd<T, Abi>(constants::lgamma_max));
+		const auto tiny			 = ax < simd<T, Abi>(constants::tiny_limit);
+		const auto regular		 = !tiny && !(limit < ax) && ax < inf;
+		const simd<T, Abi> y	 = choose(regular, ax, one);
+
+		const auto l	   = detail::lgamma_positive(y);
+		simd<T, Abi> r	   = l.hi + l.lo;
+		auto pole		   = !regular && !tiny;
+		const auto reflect = neg && regular;
+		if (any_of(reflect))
+		{
+			using dd	  = type::BasicDoubleDouble<simd<T, Abi>>;
+			const auto s  = gen::internal::gamma_sinpi(y);
+			const auto lr = gen::internal::lgamma_reflect(y, gen::internal::gamma_choose(s.hi == zero, dd{one, zero}, s), l);
+			r			  = choose(neg, lr.hi + lr.lo, r);
+			pole		  = pole || (reflect && s.hi == zero);
+
+			// Next to the zeros below -2 the reflection only keeps the absolute error. Those lanes take the expansion
+			// around the closest zero from the table one at a time, and the rest are left alone.
+			using zero_constants = gen::internal::lgamma_zero_constants;
+			if (any_of(reflect && simd<T, Abi>(zero_constants::lower_limit) < a && a < simd<T, Abi>(zero_constants::upper_limit)))
+			{
+				r = lanewise(
+					[](T x, T v)
+					{
+						gen::internal::lgamma_near_zero(x, v);
+						return v;
+					},
+					a, r);
+			}
+		}
+
+		// lgamma(x) = -log|x| near 0, which is +inf at ±0. Poles, overflow and ±inf give +inf and NaN propagates.
+		if (any_of(tiny)) { r = choose(tiny, -log(ax), r); }
+		r = choose(pole, inf, r);
+		return choose(a == a, r, a);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> tgamma(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::tgamma_gen(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> lgamma(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::lgamma_gen(a.get()));
+	}
+} // namespace ccm::intrin
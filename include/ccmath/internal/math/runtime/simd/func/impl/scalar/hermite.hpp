@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/hermite_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// Hermite polynomials of double lanes, passing every degree up to n to store(k, H_k).
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> hermite(unsigned n, simd<T, Abi> const & x, Store && store)
+		{
+			// NaN lanes are NaN in every degree, H_0 included.
+			const auto valid = x == x;
+			return choose(valid, gen::internal::hermite_recurrence(n, x, [&](unsigned k, simd<T, Abi> const & h) { store(k, choose(valid, h, x)); }), x);
+		}
+	} // namespace detail
+
+	/// Physicists' Hermite polynomial of degree n of double lanes, the same steps as gen::hermite_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> hermite(unsigned n, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector hermite works on double lanes, float values are converted first");
+		return detail::hermite(n, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> hermite(unsigned n, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::hermite_gen(n, x.get()));
+	}
+} // namespace ccm::intrin
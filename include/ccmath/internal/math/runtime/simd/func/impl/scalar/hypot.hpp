@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> hypot_abs(simd<T, Abi> const & a)
+		{
+			return choose(a < simd<T, Abi>(T(0)), -a, a);
+		}
+
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> hypot_max(simd<T, Abi> const & a, simd<T, Abi> const & b)
+		{
+			return choose(a < b, b, a);
+		}
+
+		/// Scales the lanes by the power of two picked from m, the largest argument, runs the kernel and scales back.
+		template <class T, class Abi, class Kernel>
+		CCM_ALWAYS_INLINE simd<T, Abi> hypot_scaled(simd<T, Abi> const & m, Kernel && kernel)
+		{
+			using constants = gen::internal::hypot_constants<T>;
+
+			const simd<T, Abi> one(T(1));
+			const auto big			   = simd<T, Abi>(constants::big) < m;
+			const auto small		   = m < simd<T, Abi>(constants::small);
+			const simd<T, Abi> scale   = choose(big, simd<T, Abi>(constants::down), choose(small, simd<T, Abi>(constants::up), one));
+			const simd<T, Abi> unscale = choose(big, simd<T, Abi>(constants::up), choose(small, simd<T, Abi>(constants::down), one));
+			return kernel(scale) * unscale;
+		}
+	} // namespace detail
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> hypot(simd<T, Abi> const & x, simd<T, Abi> const & y)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+		const simd<T, Abi> ax = detail::hypot_abs(x);
+		const simd<T, Abi> ay = detail::hypot_abs(y);
+
+		const simd<T, Abi> r = detail::hypot_scaled(detail::hypot_max(ax, ay), [&](simd<T, Abi> const & scale)
+													{ return gen::internal::hypot_kernel(ax * scale, ay * scale); });
+
+		// The kernel gives NaN for two zeros, and NaN rather than inf for an infinite argument.
+		return choose(ax == inf || ay == inf, inf, choose(ax == zero && ay == zero, zero, r));
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> hypot(simd<T, Abi> const & x, simd<T, Abi> const & y, simd<T, Abi> const & z)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+		const simd<T, Abi> ax = detail::hypot_abs(x);
+		const simd<T, Abi> ay = detail::hypot_abs(y);
+		const simd<T, Abi> az = detail::hypot_abs(z);
+
+		const simd<T, Abi> r = detail::hypot_scaled(detail::hypot_max(detail::hypot_max(ax, ay), az), [&](simd<T, Abi> const & scale)
+													{ return gen::internal::hypot_kernel(ax * scale, ay * scale, az * scale); });
+
+		return choose(ax == inf || ay == inf || az == inf, inf, choose(ax == zero && ay == zero && az == zero, zero, r));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> hypot(simd<T, abi::scalar> const & x, simd<T, abi::scalar> const & y)
+	{
+		return simd<T, abi::scalar>(gen::hypot_gen(x.get(), y.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> hypot(simd<T, abi::scalar> const & x, simd<T, abi::scalar> const & y,
+																	   simd<T, abi::scalar> const & z)
+	{
+		return simd<T, abi::scalar>(gen::hypot_gen(x.get(), y.get(), z.get()));
+	}
+} // namespace ccm::intrin
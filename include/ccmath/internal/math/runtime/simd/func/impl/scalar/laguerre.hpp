@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/laguerre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// Associated Laguerre polynomials of double lanes, passing every degree up to n to store(k, L_k^m).
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> assoc_laguerre(unsigned n, unsigned m, simd<T, Abi> const & x, Store && store)
+		{
+			// Negative and NaN lanes are NaN in every degree, L_0^m included.
+			const simd<T, Abi> zero(T(0));
+			const auto valid = zero < x || x == zero;
+			const simd<T, Abi> nan(std::numeric_limits<T>::quiet_NaN());
+			return choose(valid,
+						  gen::internal::assoc_laguerre_recurrence(n, m, choose(valid, x, zero),
+																   [&](unsigned k, simd<T, Abi> const & l) { store(k, choose(valid, l, nan)); }),
+						  nan);
+		}
+	} // namespace detail
+
+	/// Associated Laguerre polynomial of degree n and order m of double lanes, the same steps as gen::assoc_laguerre_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> assoc_laguerre(unsigned n, unsigned m, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector assoc_laguerre works on double lanes, float values are converted first");
+		return detail::assoc_laguerre(n, m, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	/// Laguerre polynomial of degree n of double lanes, the same steps as gen::laguerre_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> laguerre(unsigned n, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector laguerre works on double lanes, float values are converted first");
+		return detail::assoc_laguerre(n, 0, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> assoc_laguerre(unsigned n, unsigned m, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::assoc_laguerre_gen(n, m, x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> laguerre(unsigned n, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::laguerre_gen(n, x.get()));
+	}
+} // namespace ccm::intrin
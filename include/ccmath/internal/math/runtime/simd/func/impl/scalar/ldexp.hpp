@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/sign.hpp"
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief 2^n for lanes holding an integral n in the normal exponent range, built in the exponent field.
+	 *
+	 * This fallback builds it one lane at a time. ABIs with integer vector instructions overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> pow2i(simd<T, Abi> const & n)
+	{
+		return lanewise(
+			[](T e)
+			{
+				using FPBits_t = support::fp::FPBits<T>;
+				return FPBits_t::create_value(types::Sign::POS, static_cast<typename FPBits_t::storage_type>(static_cast<int>(e) + FPBits_t::exponent_bias), 0)
+					.get_val();
+			},
+			n);
+	}
+
+	/**
+	 * @brief x * 2^n for lanes holding an integral n, rounded once.
+	 *
+	 * When every n is in the normal exponent range this is a single multiply. Otherwise the scaling is split as in
+	 * musl's scalbn: at most two steps of 2^emax or 2^(emin + digits) first, then the rest, so the only multiply that
+	 * can round is the last one.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> ldexp(simd<T, Abi> const & x, simd<T, Abi> const & n)
+	{
+		using FPBits_t		   = support::fp::FPBits<T>;
+		constexpr T emax	   = static_cast<T>(FPBits_t::exponent_bias);
+		constexpr T emin	   = static_cast<T>(1 - FPBits_t::exponent_bias);
+		constexpr T down_shift = emin + static_cast<T>(FPBits_t::fraction_length + 1);
+		const simd<T, Abi> hi(emax);
+		const simd<T, Abi> lo(emin);
+
+		if (!any_of(hi < n || n < lo)) { return x * pow2i(n); }
+
+		const simd<T, Abi> up	= pow2i(hi);
+		const simd<T, Abi> down = pow2i(simd<T, Abi>(down_shift));
+
+		simd<T, Abi> y = x;
+		simd<T, Abi> k = n;
+		for (int step = 0; step < 2; ++step)
+		{
+			const auto big	 = hi < k;
+			const auto small = k < lo;
+			y				 = choose(big, y * up, choose(small, y * down, y));
+			k				 = choose(big, k - hi, choose(small, k - simd<T, Abi>(down_shift), k));
+		}
+		k = choose(hi < k, hi, choose(k < lo, lo, k));
+		return y * pow2i(k);
+	}
+
+	/// Same as ldexp, FLT_RADIX being 2.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> scalbn(simd<T, Abi> const & x, simd<T, Abi> const & n)
+	{
+		return ldexp(x, n);
+	}
+} // namespace ccm::intrin
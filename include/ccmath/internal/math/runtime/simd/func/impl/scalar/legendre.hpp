@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/assoc_legendre_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/legendre_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/sph_legendre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <array>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// x in the lanes inside [-1, 1], NaN in the others, so every degree comes out NaN there.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> legendre_arg(simd<T, Abi> const & x)
+		{
+			const simd<T, Abi> one(T(1));
+			return choose(one < x || x < -one, simd<T, Abi>(std::numeric_limits<T>::quiet_NaN()), x);
+		}
+
+		/// Legendre polynomials of double lanes, passing every degree up to n to store(l, P_l).
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> legendre(unsigned n, simd<T, Abi> const & x, Store && store)
+		{
+			return gen::internal::legendre_recurrence(n, legendre_arg(x), store);
+		}
+
+		/// Associated Legendre functions of double lanes, passing every degree up to n to store(l, P_l^m).
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> assoc_legendre(unsigned n, unsigned m, simd<T, Abi> const & x, Store && store)
+		{
+			const simd<T, Abi> one(T(1));
+			const simd<T, Abi> arg = legendre_arg(x);
+			return gen::internal::assoc_legendre_recurrence(n, m, arg, sqrt((one - arg) * (one + arg)), store);
+		}
+
+		/// Spherical harmonics of double lanes, passing every degree up to n to store(l, Y_l^m). cos and sin are taken lane by lane.
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> sph_legendre(unsigned n, unsigned m, simd<T, Abi> const & theta, Store && store)
+		{
+			std::array<T, simd<T, Abi>::size()> x;
+			std::array<T, simd<T, Abi>::size()> s;
+			theta.copy_to(x.data(), element_aligned_tag());
+			for (int i = 0; i < simd<T, Abi>::size(); ++i) { gen::internal::sph_legendre_arg(x[i], x[i], s[i]); }
+			return gen::internal::sph_legendre_recurrence(n, m, simd<T, Abi>(x.data(), element_aligned_tag()),
+														  simd<T, Abi>(s.data(), element_aligned_tag()), store);
+		}
+	} // namespace detail
+
+	/// Legendre polynomial of degree n of double lanes, the same steps as gen::legendre_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> legendre(unsigned n, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector legendre works on double lanes, float values are converted first");
+		return detail::legendre(n, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	/// Associated Legendre function of degree n and order m of double lanes, the same steps as gen::assoc_legendre_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> assoc_legendre(unsigned n, unsigned m, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector assoc_legendre works on double lanes, float values are converted first");
+		return detail::assoc_legendre(n, m, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	/// Spherical harmonic of degree l and order m of double lanes, the same steps as gen::sph_legendre_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> sph_legendre(unsigned l, unsigned m, simd<T, Abi> const & theta)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector sph_legendre works on double lanes, float values are converted first");
+		return detail::sph_legendre(l, m, theta, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> legendre(unsigned n, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::legendre_gen(n, x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> assoc_legendre(unsigned n, unsigned m, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::assoc_legendre_gen(n, m, x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> sph_legendre(unsigned l, unsigned m, simd<T, abi::scalar> const & theta)
+	{
+		return simd<T, abi::scalar>(gen::sph_legendre_gen(l, m, theta.get()));
+	}
+} // namespace ccm::intrin
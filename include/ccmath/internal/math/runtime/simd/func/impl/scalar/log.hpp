@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/frexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/logb.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/expo/impl/log_double_impl.hpp"
+#include "ccmath/math/expo/impl/log_float_impl.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/**
+		 * @brief log(ax) as a double-double value for positive normal finite lanes.
+		 * @param ax The lanes, subnormal ones already scaled up by normalize_subnormals.
+		 * @param shift The power of two each lane was scaled by.
+		 */
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE type::BasicDoubleDouble<simd<T, Abi>> log_dd_normal(simd<T, Abi> const & ax, simd<T, Abi> const & shift)
+		{
+			using constants = gen::internal::log_constants<T>;
+
+			simd<T, Abi> e = logb_normal(ax) + T(1) - shift;
+			simd<T, Abi> m = frexp_mantissa(ax);
+
+			// Same split as gen::internal::log_split: m in [sqrt(1/2), sqrt(2)).
+			const auto low = m < simd<T, Abi>(constants::sqrt_half);
+			m			   = choose(low, m + m, m);
+			e			   = choose(low, e - T(1), e);
+			return gen::internal::log_reduced(m - T(1), e);
+		}
+
+		/// log(a) as a double-double value for positive finite lanes, see gen::internal::log_dd.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE type::BasicDoubleDouble<simd<T, Abi>> log_dd(simd<T, Abi> const & a)
+		{
+			simd<T, Abi> ax			 = a;
+			const simd<T, Abi> shift = normalize_subnormals(ax);
+			return log_dd_normal(ax, shift);
+		}
+	} // namespace detail
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> log(simd<T, Abi> const & a)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		// Vectors of positive normal lanes skip the subnormal scaling and the special value selects below.
+		if (all_of(!(a < simd<T, Abi>(std::numeric_limits<T>::min())) && a < inf))
+		{
+			const auto r = detail::log_dd_normal(a, zero);
+			return r.hi + r.lo;
+		}
+
+		const auto regular	 = zero < a && a < inf;
+		const auto r		 = detail::log_dd(choose(regular, a, simd<T, Abi>(T(1))));
+		const simd<T, Abi> v = r.hi + r.lo;
+
+		// log(±0) = -inf, log(+inf) = +inf, NaN propagates and negative lanes give NaN.
+		return choose(regular, v,
+					  choose(a == zero, zero - inf, choose(a < zero, simd<T, Abi>(std::numeric_limits<T>::quiet_NaN()), a)));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> log(simd<T, abi::scalar> const & a)
+	{
+		// A single lane takes the table driven kernel of ccm::log, with the special values of the lanes above.
+		const T x = a.get();
+		if (!(x > T(0) && x < std::numeric_limits<T>::infinity()))
+		{
+			if (x == T(0)) { return simd<T, abi::scalar>(-std::numeric_limits<T>::infinity()); }
+			return simd<T, abi::scalar>(x < T(0) ? std::numeric_limits<T>::quiet_NaN() : x);
+		}
+		if constexpr (std::is_same_v<T, float>) { return simd<T, abi::scalar>(ccm::internal::log_float(x)); }
+		else { return simd<T, abi::scalar>(static_cast<T>(ccm::internal::log_double(static_cast<double>(x)))); }
+	}
+} // namespace ccm::intrin
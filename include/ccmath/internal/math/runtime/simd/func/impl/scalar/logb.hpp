@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/fmanip/logb_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Unbiased exponent of positive normal lanes, read from the exponent field.
+	 *
+	 * This fallback reads it one lane at a time. ABIs with integer vector instructions overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> logb_normal(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return static_cast<T>(support::fp::FPBits<T>(x).get_exponent()); }, a);
+	}
+
+	namespace detail
+	{
+		/**
+		 * @brief Normalizes subnormal lanes of a nonnegative ax and returns the amount to subtract from their exponent.
+		 *
+		 * Lanes are only rescaled when at least one of them is subnormal, so the common case costs one compare.
+		 */
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> normalize_subnormals(simd<T, Abi> & ax)
+		{
+			const auto tiny = ax < simd<T, Abi>(std::numeric_limits<T>::min());
+			if (!any_of(tiny)) { return simd<T, Abi>(T(0)); }
+
+			constexpr T scale = gen::internal::subnormal_scale<T>();
+			ax				  = choose(tiny, ax * scale, ax);
+			return choose(tiny, simd<T, Abi>(static_cast<T>(support::fp::FPBits<T>::fraction_length + 1)), simd<T, Abi>(T(0)));
+		}
+	} // namespace detail
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> logb(simd<T, Abi> const & a)
+	{
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		simd<T, Abi> ax			 = choose(a < zero, zero - a, a);
+		const simd<T, Abi> shift = detail::normalize_subnormals(ax);
+		const simd<T, Abi> e	 = logb_normal(ax) - shift;
+
+		// logb(±0) = -inf, logb(±inf) = +inf and NaN propagates.
+		return choose(zero < ax && ax < inf, e, choose(ax == zero, zero - inf, ax));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> logb(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::logb_gen(a.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/misc/ndtri_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/log.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// gen::internal::ndtri_tail of the lanes of t selected by tail. The other lanes are unspecified but finite.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> ndtri_tail(simd<T, Abi> const & t, simd_mask<T, Abi> const & tail)
+		{
+			using constants = gen::internal::ndtri_constants;
+
+			const simd<T, Abi> s = sqrt(t);
+			const auto near		 = !(simd<T, Abi>(constants::tail_split) < s);
+
+			simd<T, Abi> v(T(0));
+			if (any_of(tail && near)) { v = choose(near, gen::internal::ndtri_near(s), v); }
+			if (any_of(tail && !near)) { v = choose(near, v, gen::internal::ndtri_far(s)); }
+			return v;
+		}
+	} // namespace detail
+
+	/// Standard normal quantile of double lanes. Each range of gen::internal::ndtri_impl is only evaluated if some lane is in it.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> ndtri(simd<T, Abi> const & p)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector ndtri works on double lanes, float values are converted first");
+		using constants = gen::internal::ndtri_constants;
+
+		const simd<T, Abi> zero(T(0));
+		const simd<T, Abi> one(T(1));
+		const simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+
+		const simd<T, Abi> q  = p - T(0.5);
+		const auto neg		  = q < zero;
+		const simd<T, Abi> aq = choose(neg, -q, q);
+
+		// NaN lanes count as central, which carries them through.
+		const auto central = !(simd<T, Abi>(constants::central_limit) < aq);
+		const auto tail	   = !central && zero < p && p < one;
+
+		// p = 0 gives -inf, p = 1 gives +inf, and everything outside [0, 1] NaN.
+		simd<T, Abi> r = choose(p == zero, -inf, choose(p == one, inf, simd<T, Abi>(std::numeric_limits<T>::quiet_NaN())));
+		if (any_of(central)) { r = choose(central, gen::internal::ndtri_central(q), r); }
+		if (any_of(tail))
+		{
+			// 1 - p is exact for p >= 0.5. Lanes outside the tails run on 0.5.
+			const simd<T, Abi> small = choose(tail, choose(neg, p, one - p), simd<T, Abi>(T(0.5)));
+			const simd<T, Abi> v	 = detail::ndtri_tail(zero - log(small), tail);
+			r						 = choose(tail, choose(neg, -v, v), r);
+		}
+		return r;
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> ndtri(simd<T, abi::scalar> const & p)
+	{
+		return simd<T, abi::scalar>(gen::ndtri_gen(p.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rcp_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Estimate of 1/a within 1.5 * 2^-12 for positive normal lanes below gen::internal::rcp_constants::limit.
+	 *
+	 * This fallback computes gen::internal::rcp_estimate one lane at a time. ABIs with a reciprocal estimate
+	 * instruction, or with integer vector instructions for the bit trick seed, overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> rcp_estimate(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return gen::internal::rcp_estimate(x); }, a);
+	}
+
+	/// Approximate reciprocal of every lane with Steps Newton steps, see gen::rcp_gen for the error bounds.
+	template <int Steps, class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> rcp(simd<T, Abi> const & a)
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rcp takes 0, 1 or 2 refinement steps");
+		using constants = gen::internal::rcp_constants<T>;
+
+		const simd<T, Abi> min(std::numeric_limits<T>::min());
+		const simd<T, Abi> limit(constants::limit);
+
+		// Same steps as gen::internal::rcp_impl, on a instead of |a|: the estimates and the Newton steps are odd in x.
+		// Lanes outside the range of the estimate run on 1 in the meantime.
+		const auto regular	 = (!(a < min) && a < limit) || (!(-min < a) && -limit < a);
+		const simd<T, Abi> x = choose(regular, a, simd<T, Abi>(T(1)));
+		simd<T, Abi> r		 = gen::internal::rcp_refine<Steps>(x, rcp_estimate(x));
+
+		// ±0, ±inf, NaN and the edges of the range are divided exactly, one lane at a time.
+		if (!all_of(regular)) { r = choose(regular, r, lanewise([](T v) { return gen::rcp_gen<Steps>(v); }, a)); }
+		return r;
+	}
+
+	template <int Steps, class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> rcp(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::rcp_gen<Steps>(a.get()));
+	}
+} // namespace ccm::intrin
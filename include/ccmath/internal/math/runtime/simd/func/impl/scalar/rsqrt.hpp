@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <limits>
+
+namespace ccm::intrin
+{
+	/**
+	 * @brief Estimate of 1/sqrt(a) within 1.5 * 2^-12 for positive normal finite lanes.
+	 *
+	 * This fallback computes gen::internal::rsqrt_estimate one lane at a time. ABIs with a reciprocal square root
+	 * estimate instruction, or with integer vector instructions for the bit trick seed, overload it.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> rsqrt_estimate(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return gen::internal::rsqrt_estimate(x); }, a);
+	}
+
+	/// Approximate reciprocal square root of every lane with Steps Newton steps, see gen::rsqrt_gen for the error bounds.
+	template <int Steps, class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> rsqrt(simd<T, Abi> const & a)
+	{
+		static_assert(Steps >= 0 && Steps <= 2, "rsqrt takes 0, 1 or 2 refinement steps");
+
+		// Lanes outside the range of the estimate run on 1 in the meantime.
+		const auto regular	 = !(a < simd<T, Abi>(std::numeric_limits<T>::min())) && a < simd<T, Abi>(std::numeric_limits<T>::infinity());
+		const simd<T, Abi> x = choose(regular, a, simd<T, Abi>(T(1)));
+		simd<T, Abi> r		 = gen::internal::rsqrt_refine<Steps>(x, rsqrt_estimate(x));
+
+		// ±0, +inf, negative lanes, NaN and subnormals take the exact route, one lane at a time.
+		if (!all_of(regular)) { r = choose(regular, r, lanewise([](T v) { return gen::rsqrt_gen<Steps>(v); }, a)); }
+		return r;
+	}
+
+	template <int Steps, class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> rsqrt(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(gen::rsqrt_gen<Steps>(a.get()));
+	}
+} // namespace ccm::intrin
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/floor.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+
+#include <limits>
+
+/*
+ * sin(pi * x) and cos(pi * x) together.
+ *
+ * Scaling by pi after the reduction makes it exact: t = 2x is split into the nearest integer q and d = t - q in
+ * [-0.5, 0.5], both without rounding, and sin and cos of r = d * pi / 2 come from fdlibm's kernels (cephes' for
+ * float) on [-pi/4, pi/4]. q mod 4 picks the quadrant. Results are within 2 ulp, integers give exact zeros and ±1,
+ * and ±inf and NaN give NaN.
+ */
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		template <class T>
+		struct sincospi_constants;
+
+		template <>
+		struct sincospi_constants<float>
+		{
+			static constexpr float pio2 = 0x1.921fb6p+0F;
+			// (sin(r) - r) / r^3 and (cos(r) - 1 + r^2 / 2) / r^4 in r^2, highest degree first.
+			static constexpr float sin[] = {-1.9515295891e-4F, 8.3321608736e-3F, -1.6666654611e-1F};
+			static constexpr float cos[] = {2.443315711809948e-5F, -1.388731625493765e-3F, 4.166664568298827e-2F};
+		};
+
+		template <>
+		struct sincospi_constants<double>
+		{
+			static constexpr double pio2  = 0x1.921fb54442d18p+0;
+			static constexpr double sin[] = {
+				1.58969099521155010221e-10, -2.50507602534068634195e-08, 2.75573137070700676789e-06,
+				-1.98412698298579493134e-04, 8.33333333332248946124e-03,  -1.66666666666666324348e-01,
+			};
+			static constexpr double cos[] = {
+				-1.13596475577881948265e-11, 2.08757232129817482790e-09, -2.75573143513906633035e-07,
+				2.48015872894767294178e-05,	 -1.38888888888741095749e-03, 4.16666666666666019037e-02,
+			};
+		};
+
+		/// Lanes rounded to the nearest integer, ties to even. Lanes of 2^(digits - 1) and more are already integral.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE simd<T, Abi> round_even(simd<T, Abi> const & a)
+		{
+			const simd<T, Abi> zero(T(0));
+			const simd<T, Abi> magic(T(1) / std::numeric_limits<T>::epsilon());
+
+			const auto positive	  = zero < a;
+			const auto fractional = choose(positive, a, zero - a) < magic;
+			return choose(fractional, choose(positive, (a + magic) - magic, (a - magic) + magic), a);
+		}
+	} // namespace detail
+
+	/**
+	 * @brief sin(pi * a) and cos(pi * a) of every lane.
+	 * @param a Input lanes.
+	 * @param s Receives sin(pi * a).
+	 * @param c Receives cos(pi * a).
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE void sincospi(simd<T, Abi> const & a, simd<T, Abi> & s, simd<T, Abi> & c)
+	{
+		using constants = detail::sincospi_constants<T>;
+
+		const simd<T, Abi> t = a + a;
+		const simd<T, Abi> q = detail::round_even(t);
+		const simd<T, Abi> r = (t - q) * constants::pio2;
+		const simd<T, Abi> z = r * r;
+
+		const simd<T, Abi> sin_r = r + (r * z) * support::polyeval_array(z, constants::sin);
+		// 1 - z / 2 plus the part of it that rounding dropped, as fdlibm's __kernel_cos does.
+		const simd<T, Abi> hz	 = z * T(0.5);
+		const simd<T, Abi> w	 = simd<T, Abi>(T(1)) - hz;
+		const simd<T, Abi> cos_r = w + (((simd<T, Abi>(T(1)) - w) - hz) + (z * z) * support::polyeval_array(z, constants::cos));
+
+		// q mod 4 is exact: q / 4 only moves the exponent.
+		const simd<T, Abi> m = q - floor(q * T(0.25)) * T(4);
+		const auto odd		 = m == simd<T, Abi>(T(1)) || m == simd<T, Abi>(T(3));
+		const auto neg_sin	 = simd<T, Abi>(T(1.5)) < m;
+		const auto neg_cos	 = m == simd<T, Abi>(T(1)) || m == simd<T, Abi>(T(2));
+
+		const simd<T, Abi> sv = choose(odd, cos_r, sin_r);
+		const simd<T, Abi> cv = choose(odd, sin_r, cos_r);
+		s					  = choose(neg_sin, -sv, sv);
+		c					  = choose(neg_cos, -cv, cv);
+	}
+} // namespace ccm::intrin
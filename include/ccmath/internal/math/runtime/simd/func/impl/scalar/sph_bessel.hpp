@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/special/sph_bessel_gen.hpp"
+#include "ccmath/internal/math/generic/func/special/sph_neumann_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/sqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <array>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		/// sin(x) and cos(x) of every lane, taken lane by lane.
+		template <class T, class Abi>
+		CCM_ALWAYS_INLINE void sph_bessel_sincos(simd<T, Abi> const & x, simd<T, Abi> & s, simd<T, Abi> & c)
+		{
+			std::array<T, simd<T, Abi>::size()> xs;
+			std::array<T, simd<T, Abi>::size()> ss;
+			std::array<T, simd<T, Abi>::size()> cs;
+			x.copy_to(xs.data(), element_aligned_tag());
+			for (int i = 0; i < simd<T, Abi>::size(); ++i) { gen::internal::sincos_impl(xs[i], ss[i], cs[i]); }
+			s = simd<T, Abi>(ss.data(), element_aligned_tag());
+			c = simd<T, Abi>(cs.data(), element_aligned_tag());
+		}
+
+		/**
+		 * @brief Miller's algorithm on double lanes, the same steps as gen::internal::sph_bessel_miller.
+		 *
+		 * The starting order only depends on n, so every lane steps through the same orders and only the rescales are
+		 * per lane. Returns j_n, and if store_all also passes j_k to store(k, j_k) for every k <= n in decreasing order.
+		 */
+		template <bool store_all, class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> sph_bessel_miller(unsigned n, simd<T, Abi> const & x, simd<T, Abi> const & s, simd<T, Abi> const & c,
+														 Store && store)
+		{
+			using constants = gen::internal::sph_bessel_constants;
+			using lane		= simd<T, Abi>;
+
+			const lane zero(T(0));
+			const lane one(T(1));
+			const unsigned start = gen::internal::sph_bessel_start(n);
+
+			// f_k and f_{k+1} up to a common factor, and the rescales so far.
+			const auto step = [&](unsigned k, lane & f, lane & f_next, lane & rescales, lane & sum)
+			{
+				const lane f_prev = lane(static_cast<double>(2 * k + 1)) / x * f - f_next;
+				f_next			  = f;
+				f				  = f_prev;
+				const auto large  = lane(constants::rescale_limit) < f || f < lane(-constants::rescale_limit);
+				if (any_of(large))
+				{
+					const lane scale = choose(large, lane(constants::rescale), one);
+					f				 = f * scale;
+					f_next			 = f_next * scale;
+					rescales		 = rescales + choose(large, one, zero);
+					sum				 = sum * choose(large, lane(constants::rescale_square), one);
+				}
+			};
+
+			lane f		  = one;
+			lane f_next	  = zero;
+			lane rescales = zero;
+			lane sum(static_cast<double>(2 * start + 1));
+			lane f_n		  = zero;
+			lane rescales_n	  = zero;
+			for (unsigned k = start; k > 0; --k)
+			{
+				step(k, f, f_next, rescales, sum);
+				sum = sum + lane(static_cast<double>(2 * k - 1)) * f * f;
+				if (k - 1 == n)
+				{
+					f_n		   = f;
+					rescales_n = rescales;
+				}
+			}
+
+			const lane j0 = s / x;
+			const lane j1 = (j0 - c) / x;
+			lane norm	  = one / sqrt(sum);
+			norm		  = choose(f * j0 + f_next * j1 < zero, -norm, norm);
+
+			const auto scaled = [&](lane const & fk, lane const & rescales_k)
+			{
+				const lane pending = rescales - rescales_k;
+				const lane v	   = fk * norm;
+				const lane under   = choose(v < zero, lane(T(-0.0)), zero);
+				return choose(lane(static_cast<double>(constants::rescale_cutoff) - 0.5) < pending, under,
+							  ldexp(v, lane(static_cast<double>(-constants::rescale_exp)) * pending));
+			};
+
+			if constexpr (store_all)
+			{
+				lane g			= one;
+				lane g_next		= zero;
+				lane again		= zero;
+				lane unused_sum = zero;
+				for (unsigned k = start; k > 0; --k)
+				{
+					step(k, g, g_next, again, unused_sum);
+					if (k - 1 <= n) { store(k - 1, scaled(g, again)); }
+				}
+			}
+			return scaled(f_n, rescales_n);
+		}
+
+		/**
+		 * @brief Spherical Bessel functions of the first kind of double lanes, the same steps as gen::internal::sph_bessel_impl.
+		 *
+		 * Each lane takes the series, the upward recurrence or Miller's algorithm as in the scalar version, and each of
+		 * them runs on the whole block if some lane needs it. Returns j_n. If store_all, store(k, j_k, mask) sets the
+		 * lanes of mask to j_k for every k <= n. The first call for each k sets every lane and later ones are merged
+		 * into it, as Miller's algorithm and the upward recurrence go through the orders in opposite directions.
+		 */
+		template <bool store_all, class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> sph_bessel(unsigned n, simd<T, Abi> const & x, Store && store)
+		{
+			using constants = gen::internal::sph_bessel_constants;
+			using lane		= simd<T, Abi>;
+
+			const lane zero(T(0));
+			const lane one(T(1));
+			const lane inf(std::numeric_limits<T>::infinity());
+			const auto valid  = zero < x || x == zero;
+			const auto finite = valid && x < inf;
+			const auto series = valid && x < lane(constants::series_limit);
+			const auto upward = finite && !series && lane(static_cast<double>(n)) < x;
+			const auto miller = finite && !series && !upward;
+			const auto all	  = zero == zero;
+
+			// NaN for negative and NaN lanes, 0 for +inf.
+			const lane fill = choose(valid, zero, lane(std::numeric_limits<T>::quiet_NaN()));
+
+			lane s = zero;
+			lane c = zero;
+			if (any_of(upward || miller)) { sph_bessel_sincos(choose(upward || miller, x, one), s, c); }
+
+			lane result = fill;
+			if (any_of(miller))
+			{
+				const lane xm = choose(miller, x, one);
+				result		  = choose(miller, sph_bessel_miller<store_all>(n, xm, s, c, [&](unsigned k, lane const & j) { store(k, j, all); }), result);
+			}
+			if (all_of(miller)) { return result; }
+
+			// The series, the upward recurrence and the constant lanes all go up through the orders, so they share one pass.
+			const lane xs = choose(series, x, zero);
+			const lane xu = choose(upward, x, one);
+			const auto rest = !miller;
+			const auto value = [&](lane const & t, lane const & j) { return choose(series, t, choose(upward, j, fill)); };
+
+			lane j_prev = s / xu;
+			lane j		= (j_prev - c) / xu;
+			lane t		= n > 0 ? xs / lane(T(3)) : one;
+			if constexpr (store_all)
+			{
+				store(0U, value(one, j_prev), rest);
+				if (n > 0) { store(1U, value(t, j), rest); }
+			}
+			for (unsigned k = 1; k < n; ++k)
+			{
+				t				 = t * (xs / lane(static_cast<double>(2 * k + 3)));
+				const lane next	 = lane(static_cast<double>(2 * k + 1)) / xu * j - j_prev;
+				j_prev			 = j;
+				j				 = next;
+				if constexpr (store_all) { store(k + 1, value(t, j), rest); }
+			}
+			return choose(rest, value(t, n == 0 ? j_prev : j), result);
+		}
+
+		/// Spherical Bessel functions of the second kind of double lanes, passing every order up to n to store(k, y_k).
+		template <class T, class Abi, class Store>
+		CCM_ALWAYS_INLINE simd<T, Abi> sph_neumann(unsigned n, simd<T, Abi> const & x, Store && store)
+		{
+			using lane = simd<T, Abi>;
+
+			const lane zero(T(0));
+			const lane one(T(1));
+			const lane inf(std::numeric_limits<T>::infinity());
+			const auto regular = zero < x && x < inf;
+
+			// NaN for negative and NaN lanes, -inf for 0 and 0 for +inf.
+			const lane fill = choose(x == zero, -inf, choose(x == inf, zero, lane(std::numeric_limits<T>::quiet_NaN())));
+
+			lane s = zero;
+			lane c = zero;
+			const lane xr = choose(regular, x, one);
+			if (any_of(regular)) { sph_bessel_sincos(xr, s, c); }
+
+			lane y_prev = -c / xr;
+			store(0U, choose(regular, y_prev, fill));
+			if (n == 0) { return choose(regular, y_prev, fill); }
+
+			lane y = (y_prev - s) / xr;
+			store(1U, choose(regular, y, fill));
+			for (unsigned k = 1; k < n; ++k)
+			{
+				// Overflowed lanes stay at their infinity.
+				const auto overflow = y == -inf || y == inf;
+				const lane next		= choose(overflow, y, lane(static_cast<double>(2 * k + 1)) / xr * y - y_prev);
+				y_prev				= y;
+				y					= next;
+				store(k + 1, choose(regular, y, fill));
+			}
+			return choose(regular, y, fill);
+		}
+	} // namespace detail
+
+	/// Spherical Bessel function of the first kind of order n of double lanes, the same steps as gen::sph_bessel_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> sph_bessel(unsigned n, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector sph_bessel works on double lanes, float values are converted first");
+		return detail::sph_bessel<false>(n, x, [](unsigned, simd<T, Abi> const &, auto const &) {});
+	}
+
+	/// Spherical Bessel function of the second kind of order n of double lanes, the same steps as gen::sph_neumann_gen.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> sph_neumann(unsigned n, simd<T, Abi> const & x)
+	{
+		static_assert(std::is_same_v<T, double>, "the vector sph_neumann works on double lanes, float values are converted first");
+		return detail::sph_neumann(n, x, [](unsigned, simd<T, Abi> const &) {});
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> sph_bessel(unsigned n, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::sph_bessel_gen(n, x.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> sph_neumann(unsigned n, simd<T, abi::scalar> const & x)
+	{
+		return simd<T, abi::scalar>(gen::sph_neumann_gen(n, x.get()));
+	}
+} // namespace ccm::intrin
@@ -15,6 +15,13 @@
 
 namespace ccm::intrin
 {
+	/// Lane by lane fallback for the ABIs without a square root instruction.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> sqrt(simd<T, Abi> const & a)
+	{
+		return lanewise([](T x) { return gen::sqrt_gen(x); }, a);
+	}
+
 	template <class T>
 	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> sqrt(simd<T, abi::scalar> const& a)
 	{
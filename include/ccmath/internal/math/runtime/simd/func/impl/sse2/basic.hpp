@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		// maxps/minps return their second operand when either lane is NaN or both are zeros. The zeros are fixed up with
+		// the and (fmax) or or (fmin) of the two lanes, then a NaN second operand is replaced by the first.
+
+		CCM_ALWAYS_INLINE __m128 select_ps(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		CCM_ALWAYS_INLINE __m128d select_pd(__m128d mask, __m128d a, __m128d b)
+		{
+			return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+		}
+
+		CCM_ALWAYS_INLINE __m128 fabs_ps(__m128 x)
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.0F), x);
+		}
+
+		CCM_ALWAYS_INLINE __m128d fabs_pd(__m128d x)
+		{
+			return _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+		}
+
+		CCM_ALWAYS_INLINE __m128 copysign_ps(__m128 mag, __m128 sgn)
+		{
+			const __m128 sign = _mm_set1_ps(-0.0F);
+			return _mm_or_ps(_mm_andnot_ps(sign, mag), _mm_and_ps(sign, sgn));
+		}
+
+		CCM_ALWAYS_INLINE __m128d copysign_pd(__m128d mag, __m128d sgn)
+		{
+			const __m128d sign = _mm_set1_pd(-0.0);
+			return _mm_or_pd(_mm_andnot_pd(sign, mag), _mm_and_pd(sign, sgn));
+		}
+
+		CCM_ALWAYS_INLINE __m128 fmax_ps(__m128 x, __m128 y)
+		{
+			const __m128 r = select_ps(_mm_cmpeq_ps(x, y), _mm_and_ps(x, y), _mm_max_ps(x, y));
+			return select_ps(_mm_cmpunord_ps(y, y), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m128d fmax_pd(__m128d x, __m128d y)
+		{
+			const __m128d r = select_pd(_mm_cmpeq_pd(x, y), _mm_and_pd(x, y), _mm_max_pd(x, y));
+			return select_pd(_mm_cmpunord_pd(y, y), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m128 fmin_ps(__m128 x, __m128 y)
+		{
+			const __m128 r = select_ps(_mm_cmpeq_ps(x, y), _mm_or_ps(x, y), _mm_min_ps(x, y));
+			return select_ps(_mm_cmpunord_ps(y, y), x, r);
+		}
+
+		CCM_ALWAYS_INLINE __m128d fmin_pd(__m128d x, __m128d y)
+		{
+			const __m128d r = select_pd(_mm_cmpeq_pd(x, y), _mm_or_pd(x, y), _mm_min_pd(x, y));
+			return select_pd(_mm_cmpunord_pd(y, y), x, r);
+		}
+
+		// !(x <= y) holds where x > y and where a lane is NaN, x - y is then the result.
+		CCM_ALWAYS_INLINE __m128 fdim_ps(__m128 x, __m128 y)
+		{
+			return _mm_and_ps(_mm_cmpnle_ps(x, y), _mm_sub_ps(x, y));
+		}
+
+		CCM_ALWAYS_INLINE __m128d fdim_pd(__m128d x, __m128d y)
+		{
+			return _mm_and_pd(_mm_cmpnle_pd(x, y), _mm_sub_pd(x, y));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> fabs(simd<float, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::fabs_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> fabs(simd<double, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::fabs_pd(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> copysign(simd<float, abi::sse2> const & a, simd<float, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::copysign_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> copysign(simd<double, abi::sse2> const & a, simd<double, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::copysign_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> fmax(simd<float, abi::sse2> const & a, simd<float, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::fmax_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> fmax(simd<double, abi::sse2> const & a, simd<double, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::fmax_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> fmin(simd<float, abi::sse2> const & a, simd<float, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::fmin_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> fmin(simd<double, abi::sse2> const & a, simd<double, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::fmin_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> fdim(simd<float, abi::sse2> const & a, simd<float, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::fdim_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> fdim(simd<double, abi::sse2> const & a, simd<double, abi::sse2> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::fdim_pd(a.get(), b.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
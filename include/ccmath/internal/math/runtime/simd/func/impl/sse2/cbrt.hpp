@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/cbrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		// n / 3 == (n * 0xAAAAAAAB) >> 33 for every 32-bit n. _mm_mul_epu32 multiplies the even 32-bit lanes.
+		CCM_ALWAYS_INLINE __m128i cbrt_divide_by_three_epu64(__m128i n)
+		{
+			return _mm_srli_epi64(_mm_mul_epu32(n, _mm_set1_epi32(static_cast<int>(0xAAAAAAABU))), 33);
+		}
+
+		CCM_ALWAYS_INLINE __m128 cbrt_seed_ps(__m128 x)
+		{
+			const __m128i bits = _mm_castps_si128(x);
+			const __m128i even = cbrt_divide_by_three_epu64(bits);
+			const __m128i odd  = cbrt_divide_by_three_epu64(_mm_srli_epi64(bits, 32));
+			const __m128i q	   = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+			return _mm_castsi128_ps(_mm_add_epi32(q, _mm_set1_epi32(static_cast<int>(gen::internal::cbrt_constants<float>::bias_third))));
+		}
+
+		CCM_ALWAYS_INLINE __m128d cbrt_seed_pd(__m128d x)
+		{
+			const __m128i high = _mm_srli_epi64(_mm_castpd_si128(x), 32);
+			const __m128i q	   = cbrt_divide_by_three_epu64(high);
+			const __m128i seed = _mm_add_epi32(q, _mm_set1_epi32(static_cast<int>(gen::internal::cbrt_constants<double>::bias_third)));
+			return _mm_castsi128_pd(_mm_slli_epi64(seed, 32));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> cbrt_seed(simd<float, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::cbrt_seed_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> cbrt_seed(simd<double, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::cbrt_seed_pd(a.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
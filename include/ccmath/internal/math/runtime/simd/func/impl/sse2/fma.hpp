@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#if defined(CCMATH_HAS_SIMD_SSE2) && defined(CCMATH_HAS_SIMD_FMA)
+		#include <immintrin.h>
+
+namespace ccm::intrin::detail
+{
+	// FMA3 works on the registers of every x86 ABI, the 128-bit ones of SSE2 to SSE4 and the 256-bit ones of AVX and
+	// AVX2, so this header covers all of them.
+	CCM_ALWAYS_INLINE __m128 fma3(__m128 a, __m128 b, __m128 c)
+	{
+		return _mm_fmadd_ps(a, b, c);
+	}
+
+	CCM_ALWAYS_INLINE __m128d fma3(__m128d a, __m128d b, __m128d c)
+	{
+		return _mm_fmadd_pd(a, b, c);
+	}
+
+	CCM_ALWAYS_INLINE __m256 fma3(__m256 a, __m256 b, __m256 c)
+	{
+		return _mm256_fmadd_ps(a, b, c);
+	}
+
+	CCM_ALWAYS_INLINE __m256d fma3(__m256d a, __m256d b, __m256d c)
+	{
+		return _mm256_fmadd_pd(a, b, c);
+	}
+
+	template <class Abi>
+	inline constexpr bool is_x86_abi_v = false;
+
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::sse2> = true;
+
+		#ifdef CCMATH_HAS_SIMD_SSE3
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::sse3> = true;
+		#endif
+
+		#ifdef CCMATH_HAS_SIMD_SSSE3
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::ssse3> = true;
+		#endif
+
+		#ifdef CCMATH_HAS_SIMD_SSE4
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::sse4> = true;
+		#endif
+
+		#ifdef CCMATH_HAS_SIMD_AVX
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::avx> = true;
+		#endif
+
+		#ifdef CCMATH_HAS_SIMD_AVX2
+	template <>
+	inline constexpr bool is_x86_abi_v<abi::avx2> = true;
+		#endif
+
+	template <class T, class Abi>
+	struct fma_instruction<T, Abi, std::enable_if_t<is_x86_abi_v<Abi>>> : std::true_type
+	{
+		template <class Register>
+		static CCM_ALWAYS_INLINE Register apply(Register a, Register b, Register c)
+		{
+			return fma3(a, b, c);
+		}
+	};
+} // namespace ccm::intrin::detail
+
+	#endif // CCMATH_HAS_SIMD_SSE2 && CCMATH_HAS_SIMD_FMA
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/frexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		CCM_ALWAYS_INLINE __m128 frexp_mantissa_ps(__m128 x)
+		{
+			const __m128 keep = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x807FFFFFU)));
+			return _mm_or_ps(_mm_and_ps(x, keep), _mm_set1_ps(0.5F));
+		}
+
+		CCM_ALWAYS_INLINE __m128d frexp_mantissa_pd(__m128d x)
+		{
+			const __m128d keep = _mm_castsi128_pd(_mm_set1_epi64x(static_cast<long long>(0x800FFFFFFFFFFFFFULL)));
+			return _mm_or_pd(_mm_and_pd(x, keep), _mm_set1_pd(0.5));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> frexp_mantissa(simd<float, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::frexp_mantissa_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> frexp_mantissa(simd<double, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::frexp_mantissa_pd(a.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
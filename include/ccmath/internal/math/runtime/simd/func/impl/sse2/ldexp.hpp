@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		CCM_ALWAYS_INLINE __m128 pow2i_ps(__m128 n)
+		{
+			const __m128i biased = _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127));
+			return _mm_castsi128_ps(_mm_slli_epi32(biased, 23));
+		}
+
+		CCM_ALWAYS_INLINE __m128d pow2i_pd(__m128d n)
+		{
+			// Two 32-bit exponents, widened to the two 64-bit lanes before shifting into place.
+			const __m128i biased = _mm_add_epi32(_mm_cvttpd_epi32(n), _mm_set1_epi32(1023));
+			return _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> pow2i(simd<float, abi::sse2> const & n)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::pow2i_ps(n.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> pow2i(simd<double, abi::sse2> const & n)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::pow2i_pd(n.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
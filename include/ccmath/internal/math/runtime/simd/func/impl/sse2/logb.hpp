@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/logb.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		CCM_ALWAYS_INLINE __m128 logb_normal_ps(__m128 x)
+		{
+			const __m128i e = _mm_srli_epi32(_mm_castps_si128(x), 23);
+			return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(127)));
+		}
+
+		CCM_ALWAYS_INLINE __m128d logb_normal_pd(__m128d x)
+		{
+			// The exponents end up in the low halves of the 64-bit lanes, gather them into the two low 32-bit lanes.
+			const __m128i e = _mm_shuffle_epi32(_mm_srli_epi64(_mm_castpd_si128(x), 52), _MM_SHUFFLE(3, 1, 2, 0));
+			return _mm_cvtepi32_pd(_mm_sub_epi32(e, _mm_set1_epi32(1023)));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> logb_normal(simd<float, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(detail::logb_normal_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> logb_normal(simd<double, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse2>(detail::logb_normal_pd(a.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
@@ -30,8 +30,8 @@ namespace ccm::intrin
 		#if CCMATH_HAS_SIMD_SVML
 		return {_mm_pow_ps(a.get(), b.get())};
 		#else
-		// TODO: Replace this with a refined solution. For the time being this is temporary.
-		return {gen::pow_gen(a.convert(), b.convert())};
+		// TODO: Replace this with a vector kernel. Until then every lane goes through gen::pow_gen.
+		return lanewise([](float x, float y) { return gen::pow_gen(x, y); }, a, b);
 		#endif
 	}
 
@@ -42,8 +42,8 @@ namespace ccm::intrin
 		#if CCMATH_HAS_SIMD_SVML
 		return {_mm_pow_pd(a.get(), b.get())};
 		#else
-		// TODO: Replace this with a refined solution. For the time being this is temporary.
-		return {gen::pow_gen(a.convert(), b.convert())};
+		// TODO: Replace this with a vector kernel. Until then every lane goes through gen::pow_gen.
+		return lanewise([](double x, double y) { return gen::pow_gen(x, y); }, a, b);
 		#endif
 	}
 } // namespace ccm::intrin
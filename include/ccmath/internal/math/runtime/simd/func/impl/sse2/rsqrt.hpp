@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/impl/scalar/rsqrt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h>
+
+namespace ccm::intrin
+{
+	namespace detail
+	{
+		// There is no double estimate before AVX-512, so double lanes take the bit trick seed of gen::internal::rsqrt_seed.
+		CCM_ALWAYS_INLINE __m128d rsqrt_seed_pd(__m128d x)
+		{
+			const __m128i magic = _mm_set1_epi64x(static_cast<long long>(gen::internal::rsqrt_constants<double>::magic));
+			return _mm_castsi128_pd(_mm_sub_epi64(magic, _mm_srli_epi64(_mm_castpd_si128(x), 1)));
+		}
+	} // namespace detail
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse2> rsqrt_estimate(simd<float, abi::sse2> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse2>(_mm_rsqrt_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse2> rsqrt_estimate(simd<double, abi::sse2> const & a)
+	{
+		return gen::internal::rsqrt_refine<2>(a, simd<double, abi::sse2>(detail::rsqrt_seed_pd(a.get())));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
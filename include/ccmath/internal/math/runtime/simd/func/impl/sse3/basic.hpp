@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/func/impl/sse2/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE3
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::sse3> fabs(simd<float, abi::sse3> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse3>(detail::fabs_ps(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse3> fabs(simd<double, abi::sse3> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse3>(detail::fabs_pd(a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse3> copysign(simd<float, abi::sse3> const & a, simd<float, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse3>(detail::copysign_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse3> copysign(simd<double, abi::sse3> const & a, simd<double, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse3>(detail::copysign_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse3> fmax(simd<float, abi::sse3> const & a, simd<float, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse3>(detail::fmax_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse3> fmax(simd<double, abi::sse3> const & a, simd<double, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse3>(detail::fmax_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse3> fmin(simd<float, abi::sse3> const & a, simd<float, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse3>(detail::fmin_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse3> fmin(simd<double, abi::sse3> const & a, simd<double, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse3>(detail::fmin_pd(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::sse3> fdim(simd<float, abi::sse3> const & a, simd<float, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sse3>(detail::fdim_ps(a.get(), b.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sse3> fdim(simd<double, abi::sse3> const & a, simd<double, abi::sse3> const & b)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sse3>(detail::fdim_pd(a.get(), b.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE3
+#endif	   // CCMATH_HAS_SIMD
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// Generic implementation, written in terms of the simd operators
+#include "impl/scalar/logb.hpp"
+
+// Only logb_normal reads the exponent field with integer instructions, the rest runs on the generic implementation.
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include "impl/sse2/logb.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE3
+		#include "impl/sse3/logb.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSSE3
+		#include "impl/ssse3/logb.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4
+		#include "impl/sse4/logb.hpp"
+	#endif
+
+	// AVX without AVX2 has no 256-bit integer instructions and works lane by lane.
+
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include "impl/avx2/logb.hpp"
+	#endif
+#endif
@@ -40,10 +40,6 @@
 		#include "impl/avx2/pow.hpp"
 	#endif
 
-	#ifdef CCMATH_HAS_SIMD_AVX512F
-		#include "impl/avx512/pow.hpp"
-	#endif
-
 	// TODO: NEON does not have any builtin intrinsic for pow.
 	//		 Need to implement this later.
 	//#ifdef CCMATH_HAS_SIMD_NEON
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+
+// Generic implementation, written in terms of the simd operators
+#include "impl/scalar/rsqrt.hpp"
+
+// Only the estimate is ABI specific, the Newton steps run on the generic implementation.
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include "impl/sse2/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE3
+		#include "impl/sse3/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSSE3
+		#include "impl/ssse3/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4
+		#include "impl/sse4/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include "impl/avx/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_AVX2
+		#include "impl/avx2/rsqrt.hpp"
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_NEON
+		#include "impl/neon/rsqrt.hpp"
+	#endif
+#endif
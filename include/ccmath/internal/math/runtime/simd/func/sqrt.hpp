@@ -40,10 +40,6 @@
 		#include "impl/avx2/sqrt.hpp"
 	#endif
 
-	#ifdef CCMATH_HAS_SIMD_AVX512F
-		#include "impl/avx512/sqrt.hpp"
-	#endif
-
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include "impl/neon/sqrt.hpp"
 	#endif
@@ -109,7 +109,7 @@ namespace ccm::intrin
 														   simd<float, abi::sse2> const & c)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<float, abi::sse2>(_mm_add_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get())));
+		return simd<float, abi::sse2>(_mm_or_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get())));
 	}
 
 	template <>
@@ -195,7 +195,7 @@ namespace ccm::intrin
 															simd<double, abi::sse2> const & c)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<double, abi::sse2>(_mm_add_pd(_mm_and_pd(a.get(), b.get()), _mm_andnot_pd(a.get(), c.get())));
+		return simd<double, abi::sse2>(_mm_or_pd(_mm_and_pd(a.get(), b.get()), _mm_andnot_pd(a.get(), c.get())));
 	}
 } // namespace ccm::intrin
 
@@ -13,6 +13,9 @@
 #include "common.hpp"
 #include "simd_vectorize.hpp"
 
+#include <array>
+#include <cstdint>
+
 namespace ccm::intrin
 {
 
@@ -17,6 +17,8 @@
 #include "pack.hpp"
 #include "vector_size.hpp"
 
+#include <type_traits>
+
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_SSE2
 		#include "instructions/sse2.hpp"
@@ -51,9 +53,8 @@ namespace ccm::intrin
 {
 	namespace abi
 	{
-#if defined(CCMATH_HAS_SIMD_AVX512F)
-		using native = avx512;
-#elif defined(CCMATH_HAS_SIMD_AVX2)
+// TODO: Select an avx512 ABI once there is one, AVX-512 targets run on AVX2 until then.
+#if defined(CCMATH_HAS_SIMD_AVX2)
 		using native = avx2;
 #elif defined(CCMATH_HAS_SIMD_AVX)
 		using native = avx;
@@ -85,3 +86,31 @@ namespace ccm::intrin
 	template <class T>
 	using native_simd = simd<T, abi::native>;
 } // namespace ccm::intrin
+
+namespace ccm
+{
+	/**
+	 * @brief True for intrin::simd types.
+	 *
+	 * The ccm math functions have overloads for intrin::simd that apply the function to every lane, so generic code can
+	 * call ccm::exp(x) with x a scalar, evaluated at compile time where possible, or a native_simd at run time. This
+	 * trait lets such code tell the two apart.
+	 */
+	template <typename T>
+	struct is_simd : std::false_type
+	{
+	};
+
+	template <typename T, typename Abi>
+	struct is_simd<intrin::simd<T, Abi>> : std::true_type
+	{
+	};
+
+	template <typename T>
+	struct is_simd<const T> : is_simd<T>
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool is_simd_v = is_simd<T>::value;
+} // namespace ccm
@@ -13,12 +13,14 @@
 
 #pragma once
 
+#include "ccmath/internal/config/errno_policy.hpp"
 #include "ccmath/internal/support/fenv/rounding_mode.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 
 #include <cerrno>
 #include <cfenv>
 #include <cstdint>
+#include <type_traits>
 
 #if defined(_MSC_VER) && !defined(__clang__)
 #include "ccmath/internal/predef/compiler_suppression/msvc_compiler_suppression.hpp"
@@ -110,13 +112,19 @@ namespace ccm::support::fenv
 		eErrnoExcept = 2,
 	};
 
+	template <typename Policy = policy::default_errno>
 	constexpr bool is_errno_enabled()
 	{
+		static_assert(policy::is_errno_policy_v<Policy>, "Policy must be ccm::policy::default_errno or ccm::policy::no_errno");
+		if constexpr (std::is_same_v<Policy, policy::no_errno>) { return false; }
+		else
+		{
 		#if defined(__FAST_MATH__) || defined(CCM_CONFIG_DISABLE_ERRNO)
-		return false;
+			return false;
 		#else
-		return true;
+			return true;
 		#endif
+		}
 	}
 
 	// Helper function to convert the enum class to an integer to enable bitwise operations.
@@ -141,11 +149,12 @@ namespace ccm::support::fenv
 	}
 
 	// ReSharper disable once CppDFAConstantFunctionResult
-	inline int set_except_if_required(const int excepts)
+	template <typename Policy = policy::default_errno>
+	int set_except_if_required(const int excepts)
 	{
 		// Now following the mentality that fenv exceptions will enforce a constexpr function must be evaluated at runtime.
 		//if (is_constant_evaluated()) { return 0; } // We cannot raise fenv exceptions in a constexpr context. So we return.
-		if constexpr (is_errno_enabled())
+		if constexpr (is_errno_enabled<Policy>())
 		{
 			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0) { return internal::set_except(excepts); }
 		}
@@ -153,11 +162,12 @@ namespace ccm::support::fenv
 		return 0;
 	}
 
-	inline int raise_except_if_required(const int excepts)
+	template <typename Policy = policy::default_errno>
+	int raise_except_if_required(const int excepts)
 	{
 		// Now following the mentality that fenv exceptions will enforce a constexpr function must be evaluated at runtime.
 		//if (is_constant_evaluated()) { return 0; } // We cannot raise fenv exceptions in a constexpr context. So we return.
-		if constexpr (is_errno_enabled())
+		if constexpr (is_errno_enabled<Policy>())
 		{
 			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0) { return internal::raise_except(excepts); }
 		}
@@ -165,9 +175,10 @@ namespace ccm::support::fenv
 		return 0;
 	}
 
-	inline void set_errno_if_required(const int err)
+	template <typename Policy = policy::default_errno>
+	void set_errno_if_required(const int err)
 	{
-		if constexpr (is_errno_enabled())
+		if constexpr (is_errno_enabled<Policy>())
 		{
 			if constexpr ((ccm_math_err_handling() & get_mode(ccm_math_err_mode::eErrnoExcept)) != 0) { errno = err; }
 		}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+namespace ccm::support::helpers
+{
+	/**
+	 * @brief cos(pi * t) for t in [0, 1], accurate to about an ulp.
+	 *
+	 * Only meant for placing Chebyshev points at compile time; it is not a general cosine.
+	 */
+	constexpr double cos_pi(double t)
+	{
+		constexpr double pi = 3.141592653589793238462643383279502884;
+
+		double sign = 1.0;
+		if (t > 0.5)
+		{
+			t	 = 1.0 - t;
+			sign = -1.0;
+		}
+
+		// Reduce to |x| <= pi / 4, where the Taylor series converges in a handful of terms.
+		const bool use_sin = t > 0.25;
+		const double x	   = pi * (use_sin ? 0.5 - t : t);
+		const double x2	   = x * x;
+		double term		   = use_sin ? x : 1.0;
+		double sum		   = term;
+		for (int k = 1; k < 12; ++k)
+		{
+			const double n = static_cast<double>(2 * k);
+			term *= -x2 / (use_sin ? n * (n + 1.0) : (n - 1.0) * n);
+			sum += term;
+		}
+		return sign * sum;
+	}
+} // namespace ccm::support::helpers
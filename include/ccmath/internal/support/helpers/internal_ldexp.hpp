@@ -12,6 +12,7 @@
 
 #include <cfenv>
 
+#include "ccmath/internal/config/errno_policy.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/bits.hpp"
 #include "ccmath/internal/support/fenv/fenv_support.hpp"
@@ -21,7 +22,7 @@
 
 namespace ccm::support::helpers
 {
-	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+	template <typename Policy = policy::default_errno, typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
 	constexpr T internal_ldexp(T x, int exp)
 	{
 		support::fp::FPBits<T> bits(x);
@@ -39,11 +40,11 @@ namespace ccm::support::helpers
 				return fp::FPBits<T>::max_normal(sign).get_val();
 			}
 
-			if constexpr (fenv::is_errno_enabled())
+			if constexpr (fenv::is_errno_enabled<Policy>())
 			{
 				// These func do nothing at compile time, but at runtime will set errno and raise exceptions if required.
-				fenv::set_errno_if_required(ERANGE);
-				fenv::raise_except_if_required(FE_OVERFLOW);
+				fenv::set_errno_if_required<Policy>(ERANGE);
+				fenv::raise_except_if_required<Policy>(FE_OVERFLOW);
 			}
 
 			return fp::FPBits<T>::inf(sign).get_val();
@@ -60,8 +61,8 @@ namespace ccm::support::helpers
 			}
 
 			// These func do nothing at compile time, but at runtime will set errno and raise exceptions if required.
-			support::fenv::set_errno_if_required(ERANGE);
-			support::fenv::raise_except_if_required(FE_UNDERFLOW);
+			support::fenv::set_errno_if_required<Policy>(ERANGE);
+			support::fenv::raise_except_if_required<Policy>(FE_UNDERFLOW);
 
 			return support::fp::FPBits<T>::zero(sign).get_val();
 		}
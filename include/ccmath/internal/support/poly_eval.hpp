@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/support/multiply_add.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::support
@@ -54,6 +55,16 @@ namespace ccm::support
 		return multiply_add(x, polyeval(x, a...), a0);
 	}
 
+	// Horner's scheme over an array of coefficients, highest degree first. Only plain multiplies and adds are used, so
+	// x may also be an intrin::simd of the coefficient type.
+	template <typename Lane, typename T, std::size_t N>
+	constexpr Lane polyeval_array(Lane x, const T (&coeffs)[N])
+	{
+		Lane r = Lane(coeffs[0]);
+		for (std::size_t i = 1; i < N; ++i) { r = r * x + coeffs[i]; }
+		return r;
+	}
+
 	struct fp_helpers
 	{
 
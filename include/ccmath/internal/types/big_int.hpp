@@ -79,6 +79,51 @@ namespace ccm::types
 		template <typename T>
 		using half_width_t = typename half_width<T>::type;
 
+		/**
+		 * @brief Type trait that maps unsigned integers to an unsigned type twice as wide, or to void if the platform has none.
+		 *
+		 * Words with a double-width type can be multiplied and divided with one native operation per word pair instead of
+		 * being split into half words.
+		 */
+		template <typename T>
+		struct double_width : support::traits::type_identity<void>
+		{
+		};
+
+		template <>
+		struct double_width<std::uint8_t> : support::traits::type_identity<std::uint16_t>
+		{
+		};
+
+		template <>
+		struct double_width<std::uint16_t> : support::traits::type_identity<std::uint32_t>
+		{
+		};
+#ifdef CCM_TYPES_HAS_INT64
+		template <>
+		struct double_width<std::uint32_t> : support::traits::type_identity<std::uint64_t>
+		{
+		};
+	#ifdef CCM_TYPES_HAS_INT128
+		template <>
+		struct double_width<std::uint64_t> : support::traits::type_identity<__uint128_t>
+		{
+		};
+	#endif
+#endif
+
+		/**
+		 * @brief Alias for the double-width type of the given unsigned integer type.
+		 */
+		template <typename T>
+		using double_width_t = typename double_width<T>::type;
+
+		/**
+		 * @brief Whether the given unsigned integer type has a double-width type.
+		 */
+		template <typename T>
+		inline constexpr bool has_double_width_v = !std::is_void_v<double_width_t<T>>;
+
 		/**
 		 * @brief An array of two elements for use in multiword operations.
 		 *
@@ -463,6 +508,179 @@ namespace ccm::types
 			dst.back() = acc.carry();
 		}
 
+		/**
+		 * @brief Adds 'rhs' to 'dst' starting at word 'offset' and returns the carry out of 'dst'.
+		 *
+		 * @tparam word The type of the elements in the arrays.
+		 * @tparam N The size of the 'dst' array.
+		 * @tparam M The size of the 'rhs' array.
+		 * @param dst The destination array to be modified by the addition.
+		 * @param rhs The source array providing the values to add.
+		 * @param offset The index of the word of 'dst' that receives rhs[0].
+		 * @return The carry value after the addition completes.
+		 */
+		template <typename word, std::size_t N, std::size_t M>
+		constexpr word add_with_carry_at(std::array<word, N> & dst, const std::array<word, M> & rhs, std::size_t offset)
+		{
+			word carry = 0;
+			std::size_t i = offset;
+			for (std::size_t j = 0; j < M && i < N; ++i, ++j) { dst[i] = ccm::support::add_with_carry<word>(dst[i], rhs[j], carry, carry); }
+			for (; carry != 0 && i < N; ++i) { dst[i] = ccm::support::add_with_carry<word>(dst[i], 0, carry, carry); }
+			return carry;
+		}
+
+		/**
+		 * @brief Multiplies 'lhs' by 'rhs' row by row in the double-width type of 'word' and stores the result in 'dst'.
+		 *
+		 * Each step computes lhs[i] * rhs[j] + dst[i + j] + carry, which always fits in the double-width type, so the
+		 * inner loop is one widening multiply and two additions. GCC and Clang lower it to mulx and adc/adcx when BMI2
+		 * and ADX are enabled, and it stays usable in constant evaluation, which the intrinsics are not.
+		 * Only the low O words of the product are computed, so a truncated product costs about half of a full one.
+		 *
+		 * @tparam word The type of the elements in the arrays. Must have a double-width type.
+		 * @tparam O The size of the 'dst' array.
+		 * @tparam M The size of the 'lhs' array.
+		 * @tparam N The size of the 'rhs' array.
+		 * @param dst The array to store the (truncated) product.
+		 * @param lhs The left-hand side operand array.
+		 * @param rhs The right-hand side operand array.
+		 */
+		template <typename word, std::size_t O, std::size_t M, std::size_t N>
+		constexpr void multiply_rows(std::array<word, O> & dst, const std::array<word, M> & lhs, const std::array<word, N> & rhs)
+		{
+			static_assert(has_double_width_v<word>);
+			using wide					= double_width_t<word>;
+			constexpr std::size_t WIDTH = std::numeric_limits<word>::digits;
+
+			dst = {};
+			for (std::size_t i = 0; i < M && i < O; ++i)
+			{
+				// Without truncation the row length is a constant, which lets the compiler unroll the row.
+				constexpr bool full		 = O >= M + N;
+				const std::size_t length = full || i + N <= O ? N : O - i;
+				word carry				 = 0;
+				for (std::size_t j = 0; j < (full ? N : length); ++j)
+				{
+					const wide t = static_cast<wide>(lhs[i]) * rhs[j] + dst[i + j] + carry;
+					dst[i + j]	 = static_cast<word>(t);
+					carry		 = static_cast<word>(t >> WIDTH);
+				}
+				if (full || i + N < O) { dst[i + N] = carry; }
+			}
+		}
+
+		/**
+		 * @brief Number of words from which multiply uses Karatsuba's method for a product of two equally sized operands.
+		 *
+		 * Each level of the recursion trades one of four half-size products for three additions and subtractions of the
+		 * full size, which only pays off once the products are large. Measured with benchmark/benchmarks/internal.
+		 */
+		template <typename word>
+		inline constexpr std::size_t karatsuba_threshold = has_double_width_v<word> ? 16 : 8;
+
+		/**
+		 * @brief Multiplies 'lhs' by 'rhs' with Karatsuba's method and stores the full product in 'dst'.
+		 *
+		 * With lhs = a1 B + a0 and rhs = b1 B + b0, the product is z2 B^2 + z1 B + z0 where z0 = a0 b0, z2 = a1 b1 and
+		 * z1 = (a0 + a1)(b0 + b1) - z0 - z2, so three half-size products replace four. The halves recurse until they are
+		 * below karatsuba_threshold.
+		 *
+		 * @tparam word The type of the elements in the arrays.
+		 * @tparam N The size of the operand arrays.
+		 * @param dst The array to store the product.
+		 * @param lhs The left-hand side operand array.
+		 * @param rhs The right-hand side operand array.
+		 */
+		template <typename word, std::size_t N>
+		constexpr void karatsuba(std::array<word, 2 * N> & dst, const std::array<word, N> & lhs, const std::array<word, N> & rhs);
+
+		/**
+		 * @brief Multiplies 'lhs' by 'rhs' and stores the low O words of the product in 'dst'.
+		 *
+		 * Picks Karatsuba's method for full products of large, equally sized operands, the row by row product when the
+		 * word has a double-width type, and the column by column product with multiword carries otherwise.
+		 *
+		 * @tparam word The type of the elements in the arrays.
+		 * @tparam O The size of the 'dst' array.
+		 * @tparam M The size of the 'lhs' array.
+		 * @tparam N The size of the 'rhs' array.
+		 * @param dst The array to store the product.
+		 * @param lhs The left-hand side operand array.
+		 * @param rhs The right-hand side operand array.
+		 */
+		template <typename word, std::size_t O, std::size_t M, std::size_t N>
+		constexpr void multiply(std::array<word, O> & dst, const std::array<word, M> & lhs, const std::array<word, N> & rhs)
+		{
+			if constexpr (M == N && O >= 2 * N && N >= karatsuba_threshold<word>)
+			{
+				std::array<word, 2 * N> product{};
+				karatsuba(product, lhs, rhs);
+				dst = {};
+				for (std::size_t i = 0; i < 2 * N; ++i) { dst[i] = product[i]; }
+			}
+			else if constexpr (has_double_width_v<word>) { multiply_rows(dst, lhs, rhs); }
+			else if constexpr (O >= M + N) { multiply_with_carry(dst, lhs, rhs); }
+			else
+			{
+				std::array<word, M + N> product{};
+				multiply_with_carry(product, lhs, rhs);
+				for (std::size_t i = 0; i < O; ++i) { dst[i] = product[i]; }
+			}
+		}
+
+		template <typename word, std::size_t N>
+		constexpr void karatsuba(std::array<word, 2 * N> & dst, const std::array<word, N> & lhs, const std::array<word, N> & rhs)
+		{
+			if constexpr (N < karatsuba_threshold<word>) { multiply(dst, lhs, rhs); }
+			else
+			{
+				// Split at L words; the high halves get the extra word when N is odd.
+				constexpr std::size_t L = N / 2;
+				constexpr std::size_t H = N - L;
+
+				std::array<word, L> a0{};
+				std::array<word, L> b0{};
+				std::array<word, H> a1{};
+				std::array<word, H> b1{};
+				for (std::size_t i = 0; i < L; ++i)
+				{
+					a0[i] = lhs[i];
+					b0[i] = rhs[i];
+				}
+				for (std::size_t i = 0; i < H; ++i)
+				{
+					a1[i] = lhs[L + i];
+					b1[i] = rhs[L + i];
+				}
+
+				std::array<word, 2 * L> z0{};
+				std::array<word, 2 * H> z2{};
+				karatsuba(z0, a0, b0);
+				karatsuba(z2, a1, b1);
+
+				// The sums can carry into one more word, whose contribution to their product is added separately.
+				std::array<word, H> sa = a1;
+				std::array<word, H> sb = b1;
+				const word carry_a	   = add_with_carry(sa, a0);
+				const word carry_b	   = add_with_carry(sb, b0);
+
+				std::array<word, 2 * H> middle{};
+				karatsuba(middle, sa, sb);
+				std::array<word, 2 * H + 1> z1{};
+				add_with_carry_at(z1, middle, 0);
+				if (carry_a != 0) { add_with_carry_at(z1, sb, H); }
+				if (carry_b != 0) { add_with_carry_at(z1, sa, H); }
+				if (carry_a != 0 && carry_b != 0) { add_with_carry_at(z1, std::array<word, 1>{1}, 2 * H); }
+				sub_with_borrow(z1, z0);
+				sub_with_borrow(z1, z2);
+
+				dst = {};
+				for (std::size_t i = 0; i < 2 * L; ++i) { dst[i] = z0[i]; }
+				for (std::size_t i = 0; i < 2 * H; ++i) { dst[2 * L + i] = z2[i]; }
+				add_with_carry_at(dst, z1, L);
+			}
+		}
+
 		/**
 		 * @brief Checks if the value represented by the array is negative.
 		 *
@@ -568,6 +786,118 @@ namespace ccm::types
 		DECLARE_COUNTBIT(countr_one, i)			 // iterating forward
 		DECLARE_COUNTBIT(countl_zero, N - i - 1) // iterating backward
 		DECLARE_COUNTBIT(countl_one, N - i - 1)	 // iterating backward
+
+		/**
+		 * @brief Divides 'dividend' by 'divider' and stores the quotient and the remainder, one word of quotient per step.
+		 *
+		 * Dividers of a single word use short division. Longer ones use Knuth's algorithm D (TAOCP vol. 2, 4.3.1): the
+		 * divider is normalized so its top bit is set, each quotient word is estimated from the top two words of the
+		 * running remainder and the top word of the divider, corrected with the second word so it is at most one too
+		 * large, and fixed up by adding the divider back in the rare case it still is.
+		 *
+		 * References:
+		 * - https://skanthak.hier-im-netz.de/division.html
+		 * - Hacker's Delight, 2nd edition, section 9-2
+		 *
+		 * @tparam word The type of the elements in the arrays. Must have a double-width type.
+		 * @tparam N The size of the arrays.
+		 * @param quotient The array to store the quotient.
+		 * @param remainder The array to store the remainder.
+		 * @param dividend The dividend.
+		 * @param divider The divider, which must not be zero.
+		 */
+		template <typename word, std::size_t N>
+		constexpr void divide_knuth(std::array<word, N> & quotient, std::array<word, N> & remainder, const std::array<word, N> & dividend,
+									const std::array<word, N> & divider)
+		{
+			static_assert(has_double_width_v<word>);
+			using wide					= double_width_t<word>;
+			constexpr std::size_t WIDTH = std::numeric_limits<word>::digits;
+			constexpr wide BASE			= static_cast<wide>(1) << WIDTH;
+
+			quotient  = {};
+			remainder = {};
+
+			std::size_t m = N;
+			while (m > 0 && dividend[m - 1] == 0) { --m; }
+			std::size_t n = N;
+			while (n > 0 && divider[n - 1] == 0) { --n; }
+
+			if (m < n)
+			{
+				remainder = dividend;
+				return;
+			}
+
+			if (n == 1)
+			{
+				const wide d = divider[0];
+				wide rem	 = 0;
+				for (std::size_t i = m; i-- > 0;)
+				{
+					const wide num = (rem << WIDTH) | dividend[i];
+					quotient[i]	   = static_cast<word>(num / d);
+					rem			   = num % d;
+				}
+				remainder[0] = static_cast<word>(rem);
+				return;
+			}
+
+			// Normalize so the top word of the divider has its top bit set; the dividend gets one extra word for the shift.
+			const int s = ccm::support::countl_zero<word>(divider[n - 1]);
+			const auto shift_in = [s](word high, word low) -> word
+			{ return s == 0 ? high : static_cast<word>((high << s) | (low >> (static_cast<int>(WIDTH) - s))); };
+
+			std::array<word, N> vn{};
+			for (std::size_t i = n - 1; i > 0; --i) { vn[i] = shift_in(divider[i], divider[i - 1]); }
+			vn[0] = static_cast<word>(divider[0] << s);
+
+			std::array<word, N + 1> un{};
+			un[m] = s == 0 ? 0 : static_cast<word>(dividend[m - 1] >> (static_cast<int>(WIDTH) - s));
+			for (std::size_t i = m - 1; i > 0; --i) { un[i] = shift_in(dividend[i], dividend[i - 1]); }
+			un[0] = static_cast<word>(dividend[0] << s);
+
+			for (std::size_t j = m - n + 1; j-- > 0;)
+			{
+				// Estimate the quotient word from the top two words, then correct it with the next one.
+				const wide num = (static_cast<wide>(un[j + n]) << WIDTH) | un[j + n - 1];
+				wide qhat	   = num / vn[n - 1];
+				wide rhat	   = num % vn[n - 1];
+				while (qhat >= BASE || qhat * vn[n - 2] > ((rhat << WIDTH) | un[j + n - 2]))
+				{
+					--qhat;
+					rhat += vn[n - 1];
+					if (rhat >= BASE) { break; }
+				}
+
+				// Multiply and subtract.
+				word mul_carry = 0;
+				word borrow	   = 0;
+				for (std::size_t i = 0; i < n; ++i)
+				{
+					const wide p = qhat * vn[i] + mul_carry;
+					mul_carry	 = static_cast<word>(p >> WIDTH);
+					un[i + j]	 = ccm::support::sub_with_borrow<word>(un[i + j], static_cast<word>(p), borrow, borrow);
+				}
+				un[j + n] = ccm::support::sub_with_borrow<word>(un[j + n], mul_carry, borrow, borrow);
+
+				// The estimate was one too large: add the divider back.
+				quotient[j] = static_cast<word>(qhat);
+				if (borrow != 0)
+				{
+					--quotient[j];
+					word carry = 0;
+					for (std::size_t i = 0; i < n; ++i) { un[i + j] = ccm::support::add_with_carry<word>(un[i + j], vn[i], carry, carry); }
+					un[j + n] = static_cast<word>(un[j + n] + carry);
+				}
+			}
+
+			// Undo the normalization.
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				remainder[i] = s == 0 ? un[i] : static_cast<word>((un[i] >> s) | (un[i + 1] << (static_cast<int>(WIDTH) - s)));
+			}
+		}
 	} // namespace multiword
 
 	template <std::size_t Bits, bool Signed, typename WordType = std::uint64_t>
@@ -791,7 +1121,12 @@ namespace ccm::types
 		[[nodiscard]] constexpr bool is_zero() const
 		{
 			// If at any point this operation see's a value that is not zero, it will return false.
-			return std::none_of(val.begin(), val.end(), [](auto part) { return part != 0; });
+			// A plain loop is used as std::none_of is not constexpr before C++20.
+			for (const auto part : val)
+			{
+				if (part != 0) { return false; }
+			}
+			return true;
 		}
 
 		/**
@@ -879,14 +1214,21 @@ namespace ccm::types
 		constexpr auto ful_mul(const BigInt<OtherBits, Signed, WordType> & other) const
 		{
 			BigInt<Bits + OtherBits, Signed, WordType> result;
-			multiword::multiply_with_carry(result.val, val, other.val);
+			multiword::multiply(result.val, val, other.val);
 			return result;
 		}
 
 		/**
 		 * @brief Multiplies this BigInt with another and returns the full product tructated.
+		 *
+		 * Only the low WORD_COUNT words of the product are computed.
 		 */
-		constexpr BigInt operator*(const BigInt & other) const { return BigInt(ful_mul(other)); }
+		constexpr BigInt operator*(const BigInt & other) const
+		{
+			BigInt result;
+			multiword::multiply(result.val, val, other.val);
+			return result;
+		}
 
 		/**
 		 * @brief Approximates the high bits of the full product of two BigInts.
@@ -1266,6 +1608,14 @@ namespace ccm::types
 
 		constexpr static Division divide_unsigned(const BigInt & dividend, const BigInt & divider)
 		{
+			if constexpr (multiword::has_double_width_v<WordType>)
+			{
+				Division result;
+				multiword::divide_knuth(result.quotient.val, result.remainder.val, dividend.val, divider.val);
+				return result;
+			}
+
+			// Without a double-width type there is no word by word quotient estimate, so fall back to one bit per step.
 			BigInt remainder = dividend;
 			BigInt quotient;
 			if (remainder >= divider)
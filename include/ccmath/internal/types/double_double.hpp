@@ -10,91 +10,202 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/func/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/internal/support/multiply_add.hpp"
 #include "ccmath/internal/types/number_pair.hpp"
 
+#include <type_traits>
+
 namespace ccm
 {
 	namespace type
 	{
-		using DoubleDouble = NumberPair<double>;
+		/**
+		 * @brief Unevaluated sum hi + lo of two values of a lane type.
+		 *
+		 * The lane type is double for the scalar routines, or intrin::simd<double, Abi> to run the same error-free
+		 * transformations on every lane at once. float lanes work the same way and give a float-float pair.
+		 *
+		 * These transformations rely on every operation being rounded separately. Wherever the compiler can fuse a
+		 * product into a following sum, the products here go through an explicit fused multiply-add instead, so they
+		 * hold under any floating point contraction mode. Dekker's product is only used where no FMA exists, and
+		 * there is nothing to fuse. Callers passing a plain product into two_sum or exact_add should pass
+		 * exact_mult(a, b).hi instead, for the same reason.
+		 */
+		template <typename Lane>
+		using BasicDoubleDouble = NumberPair<Lane>;
+
+		using DoubleDouble = BasicDoubleDouble<double>;
+
+		namespace detail
+		{
+			template <typename Lane>
+			struct lane_value
+			{
+			};
+
+			template <>
+			struct lane_value<float>
+			{
+				using type = float;
+			};
+
+			template <>
+			struct lane_value<double>
+			{
+				using type = double;
+			};
+
+			template <typename T, typename Abi>
+			struct lane_value<intrin::simd<T, Abi>> : lane_value<T>
+			{
+			};
+
+			template <typename Lane>
+			using lane_value_t = typename lane_value<Lane>::type;
+
+			template <typename Lane, typename = void>
+			struct is_floating_lane : std::false_type
+			{
+			};
+
+			template <typename Lane>
+			struct is_floating_lane<Lane, std::void_t<lane_value_t<Lane>>> : std::true_type
+			{
+			};
+
+			template <typename Lane>
+			inline constexpr bool is_floating_lane_v = is_floating_lane<Lane>::value;
+
+			template <typename Lane>
+			constexpr Lane lane_multiply_add(const Lane & a, const Lane & b, const Lane & c)
+			{
+				if constexpr (std::is_floating_point_v<Lane>) { return support::multiply_add(a, b, c); }
+				else { return intrin::fma(a, b, c); }
+			}
+
+			template <typename Lane>
+			inline constexpr bool has_fused_multiply_add_v =
+		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__) && defined(__FP_FAST_FMA)
+				// GCC's builtin FMA is usable in constant expressions. Without __FP_FAST_FMA it is a libm call at run time,
+				// which is slower than Dekker's product.
+				std::is_floating_point_v<Lane>;
+		#else
+				false;
+		#endif
+
+			template <typename T, typename Abi>
+			inline constexpr bool has_fused_multiply_add_v<intrin::simd<T, Abi>> = intrin::has_fma_v<T, Abi>;
+
+			/// a * b rounded once. With an FMA it is fma(a, b, -0), bitwise the same, which the compiler cannot fuse into the caller's sums.
+			template <typename Lane>
+			constexpr Lane rounded_product(const Lane & a, const Lane & b)
+			{
+				if constexpr (has_fused_multiply_add_v<Lane>) { return lane_multiply_add(a, b, Lane(-0.0)); }
+				else { return a * b; }
+			}
+		} // namespace detail
 
 		// The output of Dekker's FastTwoSum algorithm is correct, i.e.:
 		//   r.hi + r.lo = a + b exactly
 		//   and |r.lo| < eps(r.lo)
 		// if assumption: |a| >= |b|, or a = 0.
-		constexpr DoubleDouble exact_add(double a, double b)
+		template <typename Lane, std::enable_if_t<detail::is_floating_lane_v<Lane>, bool> = true>
+		constexpr BasicDoubleDouble<Lane> exact_add(Lane a, Lane b)
 		{
-			DoubleDouble r{0.0, 0.0};
-			r.hi		   = a + b;
-			const double t = r.hi - a;
-			r.lo		   = b - t;
+			BasicDoubleDouble<Lane> r{};
+			r.hi		 = a + b;
+			const Lane t = r.hi - a;
+			r.lo		 = b - t;
+			return r;
+		}
+
+		// Knuth's TwoSum: r.hi + r.lo = a + b exactly, with no assumption on the magnitudes of a and b.
+		// Three more additions than exact_add, but no comparison, so it is the one to use in reductions.
+		template <typename Lane, std::enable_if_t<detail::is_floating_lane_v<Lane>, bool> = true>
+		constexpr BasicDoubleDouble<Lane> two_sum(Lane a, Lane b)
+		{
+			BasicDoubleDouble<Lane> r{};
+			r.hi		  = a + b;
+			const Lane bb = r.hi - a;
+			r.lo		  = (a - (r.hi - bb)) + (b - bb);
 			return r;
 		}
 
 		// Assumption: |a.hi| >= |b.hi|
-		constexpr DoubleDouble add(const DoubleDouble & a, const DoubleDouble & b)
+		template <typename Lane>
+		constexpr BasicDoubleDouble<Lane> add(const BasicDoubleDouble<Lane> & a, const BasicDoubleDouble<Lane> & b)
 		{
-			const DoubleDouble r = exact_add(a.hi, b.hi);
-			const double lo		 = a.lo + b.lo;
+			const BasicDoubleDouble<Lane> r = exact_add(a.hi, b.hi);
+			const Lane lo					= a.lo + b.lo;
 			return exact_add(r.hi, r.lo + lo);
 		}
 
 		// Assumption: |a.hi| >= |b|
-		constexpr DoubleDouble add(const DoubleDouble & a, double b)
+		template <typename Lane>
+		constexpr BasicDoubleDouble<Lane> add(const BasicDoubleDouble<Lane> & a, Lane b)
 		{
-			const DoubleDouble r = exact_add(a.hi, b);
+			const BasicDoubleDouble<Lane> r = exact_add(a.hi, b);
 			return exact_add(r.hi, r.lo + a.lo);
 		}
 
-		// Velkamp's Splitting for double precision.
-		constexpr DoubleDouble split(double a)
+		// Veltkamp's splitting.
+		template <typename Lane, std::enable_if_t<detail::is_floating_lane_v<Lane>, bool> = true>
+		constexpr BasicDoubleDouble<Lane> split(Lane a)
 		{
-			DoubleDouble r{0.0, 0.0};
-			// Splitting constant = 2^ceil(prec(double)/2) + 1 = 2^27 + 1.
-			constexpr double C = 0x1.0p27 + 1.0;
-			const double t1	   = C * a;
-			const double t2	   = a - t1;
-			r.hi			   = t1 + t2;
-			r.lo			   = a - r.hi;
+			BasicDoubleDouble<Lane> r{};
+			// Splitting constant = 2^ceil(prec/2) + 1, i.e. 2^27 + 1 for double and 2^12 + 1 for float.
+			using T		  = detail::lane_value_t<Lane>;
+			constexpr T C = std::is_same_v<T, float> ? T(0x1.0p12F + 1.0F) : T(0x1.0p27 + 1.0);
+			const Lane t1 = detail::rounded_product(Lane(C), a);
+			const Lane t2 = a - t1;
+			r.hi		  = t1 + t2;
+			r.lo		  = a - r.hi;
 			return r;
 		}
 
-		constexpr DoubleDouble exact_mult(double a, double b)
+		template <typename Lane, std::enable_if_t<detail::is_floating_lane_v<Lane>, bool> = true>
+		constexpr BasicDoubleDouble<Lane> exact_mult(Lane a, Lane b)
 		{
-			DoubleDouble r{0.0, 0.0};
-
-			// If we have builtin FMA, we can use it to get the exact product.
-			#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-			r.hi = a * b;
-			r.lo = support::multiply_add(a, b, -r.hi);
-			#else
-			// Dekker's Product.
-			const DoubleDouble as = split(a);
-			const DoubleDouble bs = split(b);
-			r.hi				  = a * b;
-			const double t1		  = as.hi * bs.hi - r.hi;
-			const double t2		  = as.hi * bs.lo + t1;
-			const double t3		  = as.lo * bs.hi + t2;
-			r.lo				  = as.lo * bs.lo + t3;
-			#endif
+			BasicDoubleDouble<Lane> r{};
+
+			// If we have a fused multiply-add, it gives the rounding error of the product directly.
+			if constexpr (detail::has_fused_multiply_add_v<Lane>)
+			{
+				r.hi = detail::rounded_product(a, b);
+				r.lo = detail::lane_multiply_add(a, b, -r.hi);
+			}
+			else
+			{
+				r.hi = a * b;
+				// Dekker's Product.
+				const BasicDoubleDouble<Lane> as = split(a);
+				const BasicDoubleDouble<Lane> bs = split(b);
+				const Lane t1					 = as.hi * bs.hi - r.hi;
+				const Lane t2					 = as.hi * bs.lo + t1;
+				const Lane t3					 = as.lo * bs.hi + t2;
+				r.lo							 = as.lo * bs.lo + t3;
+			}
 
 			return r;
 		}
 
-		constexpr DoubleDouble quick_mult(double a, const DoubleDouble & b)
+		template <typename Lane, std::enable_if_t<detail::is_floating_lane_v<Lane>, bool> = true>
+		constexpr BasicDoubleDouble<Lane> quick_mult(Lane a, const BasicDoubleDouble<Lane> & b)
 		{
-			DoubleDouble r = exact_mult(a, b.hi);
-			r.lo		   = support::multiply_add(a, b.lo, r.lo);
+			BasicDoubleDouble<Lane> r = exact_mult(a, b.hi);
+			r.lo					  = detail::lane_multiply_add(a, b.lo, r.lo);
 			return r;
 		}
 
-		constexpr DoubleDouble quick_mult(const DoubleDouble & a, const DoubleDouble & b)
+		template <typename Lane>
+		constexpr BasicDoubleDouble<Lane> quick_mult(const BasicDoubleDouble<Lane> & a, const BasicDoubleDouble<Lane> & b)
 		{
-			DoubleDouble r	= exact_mult(a.hi, b.hi);
-			const double t1 = support::multiply_add(a.hi, b.lo, r.lo);
-			const double t2 = support::multiply_add(a.lo, b.hi, t1);
-			r.lo			= t2;
+			BasicDoubleDouble<Lane> r = exact_mult(a.hi, b.hi);
+			const Lane t1			  = detail::lane_multiply_add(a.hi, b.lo, r.lo);
+			const Lane t2			  = detail::lane_multiply_add(a.lo, b.hi, t1);
+			r.lo					  = t2;
 			return r;
 		}
 
@@ -18,8 +18,11 @@
 #include "ccmath/internal/support/type_traits.hpp"
 #include "ccmath/internal/types/big_int.hpp"
 
+#include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
 
 namespace ccm::types
 {
@@ -181,7 +184,7 @@ namespace ccm::types
 			bool sticky_bit		 = !(mantissa & sticky_mask).is_zero();
 			int round_and_sticky = static_cast<int>(round_bit) * 2 + static_cast<int>(sticky_bit);
 
-			T d_lo;
+			T d_lo{};
 
 			if (CCM_UNLIKELY(exp_lo <= 0))
 			{
@@ -231,6 +234,88 @@ namespace ccm::types
 		}
 	};
 
+#ifdef CCM_TYPES_HAS_INT128
+	// DyadicFloat<128> keeps its mantissa in a UInt<128>, which is a single __uint128_t for the compiler. The quick_*
+	// functions below route Bits == 128 through these, which do the whole operation on __uint128_t with no loops over
+	// words, so the slow paths of the float functions do not pay for the generality of BigInt.
+	namespace dyadic_128
+	{
+		constexpr __uint128_t to_u128(const UInt<128> & m) { return (static_cast<__uint128_t>(m.val[1]) << 64) | m.val[0]; }
+
+		constexpr UInt<128> from_u128(__uint128_t m)
+		{
+			UInt<128> result;
+			result.val[0] = static_cast<std::uint64_t>(m);
+			result.val[1] = static_cast<std::uint64_t>(m >> 64);
+			return result;
+		}
+
+		constexpr int countl_zero(__uint128_t m)
+		{
+			const auto hi = static_cast<std::uint64_t>(m >> 64);
+			return hi != 0 ? support::countl_zero(hi) : 64 + support::countl_zero(static_cast<std::uint64_t>(m));
+		}
+
+		constexpr __uint128_t shift_right(__uint128_t m, int shift) { return shift >= 128 ? 0 : m >> shift; }
+
+		constexpr DyadicFloat<128> make(Sign sign, int exponent, __uint128_t mantissa)
+		{
+			DyadicFloat<128> result;
+			result.sign		= sign;
+			result.exponent = exponent;
+			result.mantissa = from_u128(mantissa);
+			return result;
+		}
+
+		// High half of the product, without the high half of the low word product, as in UInt<128>::quick_mul_hi.
+		constexpr __uint128_t mul_hi(__uint128_t a, __uint128_t b)
+		{
+			constexpr __uint128_t mask = (static_cast<__uint128_t>(1) << 64) - 1;
+			const __uint128_t a1 = a >> 64;
+			const __uint128_t a0 = a & mask;
+			const __uint128_t b1 = b >> 64;
+			const __uint128_t b0 = b & mask;
+			const __uint128_t hl = a1 * b0;
+			const __uint128_t lh = a0 * b1;
+			const __uint128_t mid = (hl & mask) + (lh & mask);
+			return a1 * b1 + (hl >> 64) + (lh >> 64) + (mid >> 64);
+		}
+
+		// Sum of two mantissas at the given exponents, normalized once at the end. Inputs need not be normalized.
+		constexpr DyadicFloat<128> add(Sign a_sign, int a_exp, __uint128_t a, Sign b_sign, int b_exp, __uint128_t b)
+		{
+			if (CCM_UNLIKELY(a == 0)) { return make(b_sign, b_exp, b).normalize(); }
+			if (CCM_UNLIKELY(b == 0)) { return make(a_sign, a_exp, a).normalize(); }
+
+			if (a_exp > b_exp)
+			{
+				b	  = shift_right(b, a_exp - b_exp);
+				b_exp = a_exp;
+			}
+			else if (b_exp > a_exp)
+			{
+				a	  = shift_right(a, b_exp - a_exp);
+				a_exp = b_exp;
+			}
+
+			if (a_sign == b_sign)
+			{
+				const __uint128_t sum = a + b;
+				if (sum < a) { return make(a_sign, a_exp + 1, (sum >> 1) | (static_cast<__uint128_t>(1) << 127)); }
+				const int shift = countl_zero(sum);
+				return make(a_sign, a_exp - shift, sum << shift);
+			}
+
+			const bool a_larger		= a >= b;
+			const __uint128_t diff	= a_larger ? a - b : b - a;
+			const Sign sign			= a_larger ? a_sign : b_sign;
+			if (diff == 0) { return make(sign, a_exp, 0); }
+			const int shift = countl_zero(diff);
+			return make(sign, a_exp - shift, diff << shift);
+		}
+	} // namespace dyadic_128
+#endif
+
 	// Quick add - Add 2 dyadic floats with rounding toward 0 and then normalize the
 	// output:
 	//   - Align the exponents so that:
@@ -246,6 +331,12 @@ namespace ccm::types
 	template <size_t Bits>
 	constexpr DyadicFloat<Bits> quick_add(DyadicFloat<Bits> a, DyadicFloat<Bits> b)
 	{
+#ifdef CCM_TYPES_HAS_INT128
+		if constexpr (Bits == 128)
+		{
+			return dyadic_128::add(a.sign, a.exponent, dyadic_128::to_u128(a.mantissa), b.sign, b.exponent, dyadic_128::to_u128(b.mantissa));
+		}
+#endif
 		if (CCM_UNLIKELY(a.mantissa.is_zero())) { return b; }
 		if (CCM_UNLIKELY(b.mantissa.is_zero())) { return a; }
 
@@ -301,6 +392,18 @@ namespace ccm::types
 	template <size_t Bits>
 	constexpr DyadicFloat<Bits> quick_mul(DyadicFloat<Bits> a, DyadicFloat<Bits> b)
 	{
+#ifdef CCM_TYPES_HAS_INT128
+		if constexpr (Bits == 128)
+		{
+			const Sign sign		  = (a.sign != b.sign) ? Sign::NEG : Sign::POS;
+			const int exponent	  = a.exponent + b.exponent + 128;
+			const __uint128_t hi = dyadic_128::mul_hi(dyadic_128::to_u128(a.mantissa), dyadic_128::to_u128(b.mantissa));
+			if (hi == 0) { return dyadic_128::make(sign, exponent, 0); }
+			// Normalized inputs leave the leading bit in one of the top two positions.
+			const bool top_set = (hi >> 127) != 0;
+			return dyadic_128::make(sign, top_set ? exponent : exponent - 1, top_set ? hi : hi << 1);
+		}
+#endif
 		DyadicFloat<Bits> result;
 		result.sign		= (a.sign != b.sign) ? Sign::NEG : Sign::POS;
 		result.exponent = a.exponent + b.exponent + static_cast<int>(Bits);
@@ -316,11 +419,89 @@ namespace ccm::types
 		return result;
 	}
 
+	// Quick FMA - a * b + c with rounding toward 0 and a single normalization:
+	//   - The high half of the product is kept as quick_mul computes it, without moving its leading bit into place.
+	//   - It is aligned with c and added or subtracted as in quick_add.
+	//   - Only the sum is normalized.
+	// This saves the normalization of the product, which a Horner step through quick_mul and quick_add pays for on
+	// every term. The error is that of quick_mul plus that of quick_add, plus at most one ULP of the product when the
+	// product is the smaller operand and its leading bit was not in place.
+	// Only DyadicFloat<128> is fused this way; other widths compute quick_add(c, quick_mul(a, b)).
+	// Assume inputs are normalized.
+	template <size_t Bits>
+	constexpr DyadicFloat<Bits> quick_fma(const DyadicFloat<Bits> & a, const DyadicFloat<Bits> & b, const DyadicFloat<Bits> & c)
+	{
+#ifdef CCM_TYPES_HAS_INT128
+		if constexpr (Bits == 128)
+		{
+			const Sign product_sign	   = (a.sign != b.sign) ? Sign::NEG : Sign::POS;
+			const int product_exponent = a.exponent + b.exponent + 128;
+			const __uint128_t product = dyadic_128::mul_hi(dyadic_128::to_u128(a.mantissa), dyadic_128::to_u128(b.mantissa));
+			return dyadic_128::add(product_sign, product_exponent, product, c.sign, c.exponent, dyadic_128::to_u128(c.mantissa));
+		}
+#endif
+		// With BigInt mantissas a general shift of the sum costs more than the one bit shift that puts the leading bit
+		// of the product in place, so the generic path keeps that shift and lets quick_add do the rest.
+		return quick_add(c, quick_mul(a, b));
+	}
+
 	// Simple polynomial approximation.
 	template <size_t Bits>
 	constexpr DyadicFloat<Bits> multiply_add(const DyadicFloat<Bits> & a, const DyadicFloat<Bits> & b, const DyadicFloat<Bits> & c)
 	{
-		return quick_add(c, quick_mul(a, b));
+		return quick_fma(a, b, c);
+	}
+
+	/**
+	 * @brief Evaluates the polynomial with the given coefficients at x with Horner's scheme and quick_fma.
+	 * @param x The point to evaluate at.
+	 * @param coeffs The coefficients of x^0 .. x^(N - 1).
+	 * @return The value of the polynomial.
+	 */
+	template <size_t Bits, std::size_t N>
+	constexpr DyadicFloat<Bits> polyeval(const DyadicFloat<Bits> & x, const std::array<DyadicFloat<Bits>, N> & coeffs)
+	{
+		static_assert(N > 0);
+		DyadicFloat<Bits> result = coeffs[N - 1];
+		for (std::size_t i = N - 1; i-- > 0;) { result = quick_fma(result, x, coeffs[i]); }
+		return result;
+	}
+
+	namespace internal
+	{
+		// The chains are unrolled over the points so each stays in registers rather than in an array.
+		template <size_t Bits, std::size_t N, std::size_t M, std::size_t... Js>
+		constexpr std::array<DyadicFloat<Bits>, M> polyeval_batch(const std::array<DyadicFloat<Bits>, M> & xs, const std::array<DyadicFloat<Bits>, N> & coeffs,
+																	std::index_sequence<Js...> /* unused */)
+		{
+			std::array<DyadicFloat<Bits>, M> results = {{(static_cast<void>(Js), coeffs[N - 1])...}};
+			for (std::size_t i = N - 1; i-- > 0;) { ((results[Js] = quick_fma(results[Js], xs[Js], coeffs[i])), ...); }
+			return results;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Evaluates the polynomial with the given coefficients at every point of xs.
+	 *
+	 * The Horner chains of the points are independent. For DyadicFloat<128> they are interleaved term by term, so the
+	 * multiplications of one term overlap instead of each waiting for the previous one, which is the latency a single
+	 * polyeval is bound by. Wider mantissas are evaluated one point after the other.
+	 * @param xs The points to evaluate at.
+	 * @param coeffs The coefficients of x^0 .. x^(N - 1).
+	 * @return The value of the polynomial at each point.
+	 */
+	template <size_t Bits, std::size_t N, std::size_t M>
+	constexpr std::array<DyadicFloat<Bits>, M> polyeval(const std::array<DyadicFloat<Bits>, M> & xs, const std::array<DyadicFloat<Bits>, N> & coeffs)
+	{
+		static_assert(N > 0);
+		if constexpr (Bits == 128) { return internal::polyeval_batch(xs, coeffs, std::make_index_sequence<M>{}); }
+		else
+		{
+			// BigInt mantissas do not fit in registers several at a time, and interleaving them only adds spills.
+			std::array<DyadicFloat<Bits>, M> results{};
+			for (std::size_t j = 0; j < M; ++j) { results[j] = polyeval(xs[j], coeffs); }
+			return results;
+		}
 	}
 
 	// Simple exponentiation implementation for printf. Only handles positive
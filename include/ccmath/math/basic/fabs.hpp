@@ -13,6 +13,8 @@
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/math/generic/builtins/basic/fabs.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 #include <limits>
 
@@ -44,6 +46,18 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the absolute value of every lane.
+	 * @param num Lanes to take the absolute value of.
+	 * @note There is no vector kernel for abs yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> abs(intrin::simd<T, Abi> const & num) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>) { return intrin::fabs(num); }
+		else { return intrin::lanewise([](T num_lane) { return ccm::abs(num_lane); }, num); }
+	}
+
 	/**
 	 * @brief Computes the absolute value of a number.
 	 * @tparam T Numeric type.
@@ -90,6 +104,16 @@ namespace ccm
 		return ccm::abs<T>(num);
 	}
 
+	/**
+	 * @brief Computes the absolute value of every lane.
+	 * @param num Lanes to take the absolute value of.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fabs(intrin::simd<T, Abi> const & num) noexcept
+	{
+		return intrin::fabs(num);
+	}
+
 	/**
 	 * @brief Computes the absolute value of a number.
 	 * @tparam Integer Integer type.
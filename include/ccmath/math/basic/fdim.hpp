@@ -13,6 +13,8 @@
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/math/generic/builtins/basic/fdim.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 #include <limits>
 #include <type_traits>
@@ -47,6 +49,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the positive difference of every pair of lanes.
+	 * @param x First lanes.
+	 * @param y Second lanes.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fdim(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y)
+	{
+		return intrin::fdim(x, y);
+	}
+
 	/**
 	 * @brief Computes the positive difference of two floating point values (max(0,x−y))
 	 * @tparam T A floating-point type.
@@ -15,6 +15,7 @@
 #include "ccmath/math/compare/isnan.hpp"
 #include "ccmath/math/compare/signbit.hpp"
 #include "ccmath/internal/math/generic/builtins/basic/fma.hpp"
+#include "ccmath/internal/math/runtime/simd/func/fma.hpp"
 
 #include <limits>
 #include <type_traits>
@@ -75,6 +76,18 @@ namespace ccm
 #endif
 	}
 
+	/**
+	 * @brief Computes x * y + z for every lane, rounded once.
+	 * @param x First factors.
+	 * @param y Second factors.
+	 * @param z Addends.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fma(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y, intrin::simd<T, Abi> const & z)
+	{
+		return intrin::fma(x, y, z);
+	}
+
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr Integer fma(Integer x, Integer y, Integer z) noexcept
 	{
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/math/nearest/trunc.hpp"
@@ -87,6 +88,18 @@ namespace ccm
 		return internal::impl::fmod_impl_check(x, y);
 	}
 
+	/**
+	 * @brief Computes the floating-point remainder of the division of every pair of lanes.
+	 * @param x Dividends.
+	 * @param y Divisors.
+	 * @note There is no vector kernel for fmod yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fmod(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y)
+	{
+		return intrin::lanewise([](T x_lane, T y_lane) { return ccm::fmod(x_lane, y_lane); }, x, y);
+	}
+
 	/**
 	 * @brief Returns the floating-point remainder of the division operation x/y.
 	 * @tparam Integer An integral type.
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 
@@ -42,11 +44,26 @@ namespace ccm
 			if (CCM_UNLIKELY(x_is_nan)) { return y; }
 
 			if (CCM_UNLIKELY(y_is_nan)) { return x; }
+
+			// +0 is the larger zero, whatever the order of the arguments.
+			if (x == y) { return x_bits.is_neg() ? y : x; }
 		}
 
 		return (x > y) ? x : y;
 	}
 
+	/**
+	 * @brief Computes the larger of every pair of lanes.
+	 * @param x Left-hand side of the comparison.
+	 * @param y Right-hand side of the comparison.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> max(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>) { return intrin::fmax(x, y); }
+		else { return intrin::lanewise([](T x_lane, T y_lane) { return ccm::max(x_lane, y_lane); }, x, y); }
+	}
+
 	/**
 	 * @brief Computes the larger of the two values.
 	 * @tparam T Type of left-hand side of the comparison.
@@ -78,6 +95,17 @@ namespace ccm
 		return max<T>(x, y);
 	}
 
+	/**
+	 * @brief Computes the larger of every pair of lanes.
+	 * @param x Left-hand side of the comparison.
+	 * @param y Right-hand side of the comparison.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fmax(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y) noexcept
+	{
+		return intrin::fmax(x, y);
+	}
+
 	/**
 	 * @brief Computes the larger of the two values.
 	 * @tparam T Type of left-hand side of the comparison.
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 
@@ -39,11 +41,26 @@ namespace ccm
 
 			if (CCM_UNLIKELY(x_is_nan)) { return y; }
 			if (CCM_UNLIKELY(y_is_nan)) { return x; }
+
+			// -0 is the smaller zero, whatever the order of the arguments.
+			if (x == y) { return x_bits.is_neg() ? x : y; }
 		}
 
 		return (x < y) ? x : y;
 	}
 
+	/**
+	 * @brief Computes the smaller of every pair of lanes.
+	 * @param x Left-hand side of the comparison.
+	 * @param y Right-hand side of the comparison.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> min(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>) { return intrin::fmin(x, y); }
+		else { return intrin::lanewise([](T x_lane, T y_lane) { return ccm::min(x_lane, y_lane); }, x, y); }
+	}
+
 	/**
 	 * @brief Computes the smaller of the two values.
 	 * @tparam T Left-hand type of the left-hand value to compare.
@@ -75,6 +92,17 @@ namespace ccm
 		return min<Real>(x, y);
 	}
 
+	/**
+	 * @brief Computes the smaller of every pair of lanes.
+	 * @param x Left-hand side of the comparison.
+	 * @param y Right-hand side of the comparison.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> fmin(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y) noexcept
+	{
+		return intrin::fmin(x, y);
+	}
+
 	/**
 	 * @brief Computes the smaller of the two values.
 	 * @tparam T Left-hand type of the left-hand value to compare.
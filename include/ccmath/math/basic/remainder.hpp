@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/math/nearest/trunc.hpp"
@@ -45,6 +46,18 @@ namespace ccm
 		return static_cast<T>(x - (ccm::trunc<T>(x / y) * y));
 	}
 
+	/**
+	 * @brief Computes the IEEE remainder of the division of every pair of lanes.
+	 * @param x Dividends.
+	 * @param y Divisors.
+	 * @note There is no vector kernel for remainder yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> remainder(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y)
+	{
+		return intrin::lanewise([](T x_lane, T y_lane) { return ccm::remainder(x_lane, y_lane); }, x, y);
+	}
+
 	/**
 	 * @brief Returns the remainder of the division of x by y.
 	 * @tparam Integer Type of the values to compare.
@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/math/generic/builtins/compare/isfinite.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 namespace ccm
@@ -34,6 +35,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Checks every lane for a finite value.
+	 * @param num Lanes to check.
+	 * @return A mask with the result of every lane.
+	 */
+	template <typename T, typename Abi>
+	typename intrin::simd<T, Abi>::mask_type isfinite(intrin::simd<T, Abi> const & num) noexcept
+	{
+		return (num - num) == intrin::simd<T, Abi>(T(0));
+	}
+
 	/**
 	 * @brief Checks if the given number has a finite value.
 	 * @tparam Integer The type of the integer.
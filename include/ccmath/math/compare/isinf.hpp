@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/math/generic/builtins/compare/isinf.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 #include <limits>
 #include <type_traits>
@@ -37,6 +38,18 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Checks every lane for positive or negative infinity.
+	 * @param num Lanes to check.
+	 * @return A mask with the result of every lane.
+	 */
+	template <typename T, typename Abi>
+	typename intrin::simd<T, Abi>::mask_type isinf(intrin::simd<T, Abi> const & num) noexcept
+	{
+		const intrin::simd<T, Abi> inf(std::numeric_limits<T>::infinity());
+		return num == inf || num == -inf;
+	}
+
 	/**
 	 * @brief Checks if the given number is infinite.
 	 * @tparam Integer The type of the integer to check.
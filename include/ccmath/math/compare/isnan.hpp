@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ccmath/internal/math/generic/builtins/compare/isnan.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 #include <type_traits>
@@ -36,6 +37,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Checks every lane for NaN.
+	 * @param num Lanes to check.
+	 * @return A mask with the result of every lane.
+	 */
+	template <typename T, typename Abi>
+	typename intrin::simd<T, Abi>::mask_type isnan(intrin::simd<T, Abi> const & num) noexcept
+	{
+		return !(num == num);
+	}
+
 	/**
 	 * @brief Check if the given number is NaN.
 	 * @tparam Integer The type of the number to check.
@@ -10,9 +10,15 @@
 
 #pragma once
 
+#include "ccmath/math/expo/impl/exp_correctly_rounded_impl.hpp"
 #include "ccmath/math/expo/impl/exp_double_impl.hpp"
 #include "ccmath/math/expo/impl/exp_float_impl.hpp"
+#include "ccmath/internal/config/errno_policy.hpp"
+#include "ccmath/internal/config/precision.hpp"
 #include "ccmath/internal/math/generic/builtins/expo/exp.hpp"
+#include "ccmath/internal/support/always_false.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -22,6 +28,18 @@ CCM_DISABLE_MSVC_WARNING(4702) // 4702: unreachable code
 
 namespace ccm
 {
+	namespace internal
+	{
+		template <typename T>
+		constexpr T exp_kernel(T num)
+		{
+			if constexpr (std::is_same_v<T, float>) { return internal::impl::exp_float_impl(num); }
+			if constexpr (std::is_same_v<T, double>) { return internal::impl::exp_double_impl(num); }
+			if constexpr (std::is_same_v<T, long double>) { return static_cast<long double>(internal::impl::exp_double_impl(static_cast<double>(num))); }
+			return static_cast<T>(internal::impl::exp_double_impl(static_cast<double>(num)));
+		}
+	} // namespace internal
+
 	/**
 	 * @brief Computes e raised to the given power
 	 * @tparam T floating-point or integer type
@@ -32,13 +50,62 @@ namespace ccm
 	constexpr T exp(T num)
 	{
 		if constexpr (ccm::builtin::has_constexpr_exp<T>) { return ccm::builtin::exp(num); }
+		else { return internal::exp_kernel(num); }
+	}
+
+	/**
+	 * @brief Computes e raised to the power of every lane.
+	 * @param num Exponents.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> exp(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::exp(num);
+	}
+
+	/**
+	 * @brief Computes e raised to the given power with the given error reporting policy.
+	 * @tparam Policy ccm::policy::default_errno or ccm::policy::no_errno
+	 * @tparam T floating-point type
+	 * @param num floating-point value
+	 * @return If no errors occur, the base-e exponential of num (e^num) is returned.
+	 */
+	template <typename Policy, typename T, std::enable_if_t<policy::is_errno_policy_v<Policy> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T exp(T num)
+	{
+		if constexpr (std::is_same_v<Policy, policy::default_errno>) { return ccm::exp(num); }
 		else
 		{
-			if constexpr (std::is_same_v<T, float>) { return internal::impl::exp_float_impl(num); }
-			if constexpr (std::is_same_v<T, double>) { return internal::impl::exp_double_impl(num); }
-			if constexpr (std::is_same_v<T, long double>) { return static_cast<long double>(internal::impl::exp_double_impl(static_cast<double>(num))); }
-			return static_cast<T>(internal::impl::exp_double_impl(static_cast<double>(num)));
+			// The builtin only touches errno when it calls into libm at runtime.
+			if (ccm::support::is_constant_evaluated()) { return ccm::exp(num); }
+			return internal::exp_kernel(num);
+		}
+	}
+
+	/**
+	 * @brief Computes e raised to the given power with the requested accuracy.
+	 * @tparam Precision ccm::precision::fast, ccm::precision::standard or ccm::precision::correctly_rounded
+	 * @tparam T floating-point type
+	 * @param num floating-point value
+	 * @return If no errors occur, the base-e exponential of num (e^num) is returned.
+	 */
+	template <typename Precision, typename T, std::enable_if_t<precision::is_precision_v<Precision> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T exp(T num)
+	{
+		if constexpr (std::is_same_v<Precision, precision::fast>)
+		{
+			if constexpr (std::is_same_v<T, float>) { return internal::impl::exp_float_impl<true>(num); }
+			else if constexpr (std::is_same_v<T, double>) { return internal::impl::exp_double_impl<true>(num); }
+			else { return ccm::exp(num); }
+		}
+		else if constexpr (std::is_same_v<Precision, precision::correctly_rounded>)
+		{
+			static_assert(!std::is_same_v<T, long double>, "ccm::exp: precision::correctly_rounded is only available for float and double.");
+			if constexpr (std::is_same_v<T, float>) { return internal::impl::exp_float_correctly_rounded_impl(num); }
+			else if constexpr (std::is_same_v<T, double>) { return internal::impl::exp_double_correctly_rounded_impl(num); }
+			else { static_assert(support::always_false<T>, "ccm::exp: unsupported type."); }
 		}
+		else { return ccm::exp(num); }
 	}
 
 	/**
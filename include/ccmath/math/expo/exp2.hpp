@@ -15,6 +15,7 @@
 #include "ccmath/math/expo/impl/exp2_double_impl.hpp"
 #include "ccmath/math/expo/impl/exp2_float_impl.hpp"
 #include "ccmath/internal/math/generic/builtins/expo/exp2.hpp"
+#include "ccmath/internal/math/runtime/simd/func/exp.hpp"
 
 
 #include <type_traits>
@@ -45,6 +46,16 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes 2 raised to the power of every lane.
+	 * @param num Exponents.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> exp2(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::exp2(num);
+	}
+
 	/**
 	 * @brief Returns 2 raised to the given power (2^x)
 	 * @tparam Integer Integer type
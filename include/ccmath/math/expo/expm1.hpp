@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ccmath/internal/math/generic/builtins/expo/expm1.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 #include <type_traits>
 
@@ -31,6 +32,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes e raised to the power of every lane, minus one.
+	 * @param num Exponents.
+	 * @note There is no vector kernel for expm1 yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> expm1(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::expm1(num_lane); }, num);
+	}
+
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr double expm1(Integer num)
 	{
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/support/math_support.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/internal/types/dyadic_float.hpp"
+#include "ccmath/math/expo/impl/exp_double_impl.hpp"
+#include "ccmath/math/expo/impl/exp_float_impl.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	using exp_dyadic_t = ccm::types::DyadicFloat<256>;
+
+	// ln(2) split into five doubles, roughly 265 bits.
+	constexpr std::array<double, 5> exp_cr_ln2_parts = {
+		0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111, -0x1.ace93a4ebe5d1p-165, -0x1.23a2a82ea0c24p-219,
+	};
+
+	// ln(2)/N for the N = 128 table of exp_data<double>, split into three doubles.
+	constexpr std::array<double, 3> exp_cr_ln2_n_parts = {0x1.62e42fefa39efp-8, 0x1.abc9e3b39803fp-63, 0x1.7b57a079a1934p-118};
+
+	// 1/k! in double-double for k = 2 .. 10.
+	constexpr std::array<ccm::type::DoubleDouble, 9> exp_cr_inv_factorial_dd = {
+		ccm::type::DoubleDouble{0x1.0000000000000p-1, 0x0.0p+0},  ccm::type::DoubleDouble{0x1.5555555555555p-3, 0x1.5555555555555p-57},
+		ccm::type::DoubleDouble{0x1.5555555555555p-5, 0x1.5555555555555p-59}, ccm::type::DoubleDouble{0x1.1111111111111p-7, 0x1.1111111111111p-63},
+		ccm::type::DoubleDouble{0x1.6c16c16c16c17p-10, -0x1.f49f49f49f49fp-65}, ccm::type::DoubleDouble{0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-73},
+		ccm::type::DoubleDouble{0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-76}, ccm::type::DoubleDouble{0x1.71de3a556c734p-19, -0x1.c154f8ddc6c00p-73},
+		ccm::type::DoubleDouble{0x1.27e4fb7789f5cp-22, 0x1.cbbc05b4fa99ap-76},
+	};
+
+	// 1/20! split into five doubles.
+	constexpr std::array<double, 5> exp_cr_inv_20_factorial_parts = {
+		0x1.e542ba4020225p-62, 0x1.ea72b4afe3c2fp-120, -0x1.44020dfd65c8cp-174, -0x1.6e69b50fc88abp-231, -0x1.0c0c089e97a26p-288,
+	};
+
+	// 20!/n! for n = 0 .. 20, the Taylor coefficients of e^x scaled to exact integers.
+	constexpr std::array<exp_dyadic_t, 21> exp_cr_make_scaled_taylor()
+	{
+		std::array<exp_dyadic_t, 21> coeffs{};
+		std::uint64_t coeff = 1;
+		coeffs[20]			= exp_dyadic_t(1.0);
+		for (std::size_t n = 20; n > 0; --n)
+		{
+			coeff *= n;
+			coeffs[n - 1] = exp_dyadic_t(ccm::types::Sign::POS, 0, exp_dyadic_t::mantissa_type(coeff));
+		}
+		return coeffs;
+	}
+
+	template <std::size_t N>
+	constexpr exp_dyadic_t exp_cr_sum_parts(const std::array<double, N> & parts)
+	{
+		exp_dyadic_t result(parts[0]);
+		for (std::size_t i = 1; i < N; ++i) { result = ccm::types::quick_add(result, exp_dyadic_t(parts[i])); }
+		return result;
+	}
+
+	constexpr exp_dyadic_t exp_cr_negate(exp_dyadic_t x)
+	{
+		x.sign = x.sign.is_neg() ? ccm::types::Sign::POS : ccm::types::Sign::NEG;
+		return x;
+	}
+
+	// True if a double is within a few ulp of the midpoint between two adjacent floats.
+	constexpr bool is_near_float_midpoint(double x)
+	{
+		constexpr std::uint64_t mask	 = (std::uint64_t{1} << 29U) - 1;
+		constexpr std::uint64_t midpoint = std::uint64_t{1} << 28U;
+		const std::uint64_t low			 = support::double_to_uint64(x) & mask;
+		return (low > midpoint ? low - midpoint : midpoint - low) <= 4;
+	}
+
+	/**
+	 * @brief Multi-precision e^x used when the double-double result is too close to a rounding boundary.
+	 *
+	 * x = k*ln2 + r with |r| <= ln2/2. e^(r/256) is evaluated with a degree 20 Taylor polynomial whose coefficients are
+	 * scaled by 20! so they are exact integers, and then squared eight times. The relative error is below 2^-230.
+	 * Valid for |x| < 2^20.
+	 */
+	constexpr exp_dyadic_t exp_dyadic(const exp_dyadic_t & x)
+	{
+		constexpr exp_dyadic_t ln2			   = exp_cr_sum_parts(exp_cr_ln2_parts);
+		constexpr exp_dyadic_t inv_20_factorial = exp_cr_sum_parts(exp_cr_inv_20_factorial_parts);
+		constexpr int reduction_bits		   = 8;
+
+		const auto approx		= static_cast<double>(x);
+		const double k			= support::helpers::narrow_eval(approx * 0x1.71547652b82fep0 + 0x1.8p52) - 0x1.8p52;
+		const exp_dyadic_t rem	= ccm::types::quick_add(x, exp_cr_negate(ccm::types::quick_mul(exp_dyadic_t(k), ln2)));
+		const exp_dyadic_t frac = ccm::types::mul_pow_2(rem, -reduction_bits);
+
+		// sum_{n=0}^{20} (20!/n!) * frac^n
+		constexpr std::array<exp_dyadic_t, 21> scaled_taylor = exp_cr_make_scaled_taylor();
+		exp_dyadic_t result = ccm::types::quick_mul(ccm::types::polyeval(frac, scaled_taylor), inv_20_factorial);
+
+		for (int i = 0; i < reduction_bits; ++i) { result = ccm::types::quick_mul(result, result); }
+
+		return ccm::types::mul_pow_2(result, static_cast<std::int32_t>(k));
+	}
+
+	/**
+	 * @brief e^x in double-double for -708 < x < 709, relative error below 2^-100.
+	 *
+	 * Uses the same reduction and 2^(k/N) table as exp_double_impl, with the reduced argument kept in double-double
+	 * and a degree 10 Taylor polynomial. The result is returned as mantissa * 2^scale_exp with the mantissa close to
+	 * one, so the low word never becomes subnormal and rounding can be decided before scaling.
+	 */
+	constexpr ccm::type::DoubleDouble exp_double_double(double x, int & scale_exp)
+	{
+		using ccm::type::DoubleDouble;
+
+		const double expo = support::helpers::narrow_eval(exp_invLn2N_dbl * x + exp_shift_dbl) - exp_shift_dbl;
+		const auto k	  = static_cast<std::int64_t>(expo);
+
+		// rem = x - expo*ln2/N
+		const DoubleDouble prod = ccm::type::exact_mult(expo, exp_cr_ln2_n_parts[0]);
+		DoubleDouble rem{};
+		support::two_sum(rem.hi, rem.lo, x, -prod.hi);
+		rem.lo = support::multiply_add(-expo, exp_cr_ln2_n_parts[1], rem.lo - prod.lo);
+		rem.lo = support::multiply_add(-expo, exp_cr_ln2_n_parts[2], rem.lo);
+		rem	   = ccm::type::exact_add(rem.hi, rem.lo);
+
+		// e^rem
+		DoubleDouble poly = exp_cr_inv_factorial_dd[exp_cr_inv_factorial_dd.size() - 1];
+		for (std::size_t i = exp_cr_inv_factorial_dd.size() - 1; i > 0; --i)
+		{
+			poly = support::multiply_add(poly, rem, exp_cr_inv_factorial_dd[i - 1]);
+		}
+		poly = support::multiply_add(poly, rem, DoubleDouble{1.0, 0.0});
+		poly = support::multiply_add(poly, rem, DoubleDouble{1.0, 0.0});
+
+		// 2^(j/N) ~= scale * (1 + tail) for k = e*N + j
+		const auto j			  = static_cast<std::uint64_t>(k & (k_exp_table_n_dbl - 1));
+		const double tail		  = support::uint64_to_double(exp_tab_dbl.at(2 * j));
+		const double scale		  = support::uint64_to_double(exp_tab_dbl.at(2 * j + 1) + (j << (52 - k_exp_table_bits_dbl)));
+		scale_exp				  = static_cast<int>((k - static_cast<std::int64_t>(j)) / k_exp_table_n_dbl);
+
+		return ccm::type::quick_mult(DoubleDouble{scale, scale * tail}, poly);
+	}
+
+	/**
+	 * @brief Correctly rounded e^x for double.
+	 */
+	constexpr double exp_double_correctly_rounded_impl(double x)
+	{
+		// NaN, infinities, overflow, complete underflow and |x| < 2^-54 are already exact in the standard kernel.
+		if (!(x > -0x1.74910d52d3053p9 && x <= 0x1.62e42fefa39efp9) || (x > -0x1p-54 && x < 0x1p-54)) { return exp_double_impl(x); }
+
+		// Subnormal results and the last few values below overflow go straight to the multi-precision path,
+		// the table scale is only valid in between.
+		if (x > -708.0 && x < 709.0)
+		{
+			int scale_exp						 = 0;
+			const ccm::type::DoubleDouble result = exp_double_double(x, scale_exp);
+			const double err					 = result.hi * 0x1p-98;
+			const double lower					 = result.hi + (result.lo - err);
+			const double upper					 = result.hi + (result.lo + err);
+
+			// The result is normal, so scaling by a power of two is exact and keeps the rounding.
+			if (lower == upper) { return lower * support::uint64_to_double(static_cast<std::uint64_t>(scale_exp + 1023) << 52U); }
+		}
+
+		return static_cast<double>(exp_dyadic(exp_dyadic_t(x)));
+	}
+
+	/**
+	 * @brief Correctly rounded e^x for float.
+	 */
+	constexpr float exp_float_correctly_rounded_impl(float x)
+	{
+		// NaN, infinities, overflow and results that underflow to zero are exact in the standard kernel.
+		if (!(x >= -0x1.9fe368p6F && x < 0x1.62e43p6F)) { return exp_float_impl(x); }
+
+		// Results in the float subnormal range are rounded by the multi-precision path.
+		if (x > -0x1.5d589ep6F)
+		{
+			// The double kernel is within 0.52 ulp of double. Rounding it to float is only wrong when the exact result
+			// lies between it and a float midpoint, so anything a few double ulps away from a midpoint is correct.
+			const double approx = exp_double_impl(static_cast<double>(x));
+			if (!is_near_float_midpoint(approx)) { return static_cast<float>(approx); }
+		}
+
+		return static_cast<float>(exp_dyadic(exp_dyadic_t(x)));
+	}
+} // namespace ccm::internal::impl
@@ -48,6 +48,14 @@ namespace ccm::internal
 			0x1.ebfce50fac4f3p-3 / (1 << k_exp_table_bits_flt) / (1 << k_exp_table_bits_flt),
 			0x1.62e42ff0c52d6p-1 / (1 << k_exp_table_bits_flt),
 		};
+
+		// Degree two replacement for poly_scaled used by precision::fast.
+		// 2^(r/N) ~= 1 + poly_fast[1]*r + poly_fast[0]*r^2 for |r| <= 1/2
+		// abs error: 1.78*2^-25
+		std::array<double, 2> poly_fast = {
+			0x1.ebfd1b233416ep-13,
+			0x1.62e584cd1dd0cp-6,
+		};
 	};
 
 	template <>
@@ -70,6 +78,15 @@ namespace ccm::internal
 			0x1.1111167a4d017p-7,
 		};
 
+		// Last three coefficients of a degree four polynomial used by precision::fast.
+		// abs error: 1.43*2^-53
+		// if |x| < ln2/256+eps
+		std::array<double, 3> poly_fast = {
+			0x1.ffffffffffd43p-2,
+			0x1.55555c760b293p-3,
+			0x1.55555da6ad0d8p-5,
+		};
+
 		// 2^(k/N) ~= H[k]*(1 + T[k]) for int k in [0,N)
 		// tab[2*k] = ccm::helpers::double_to_uint64(T[k])
 		// tab[2*k+1] = ccm::helpers::double_to_uint64(H[k]) - (k << 52)/N
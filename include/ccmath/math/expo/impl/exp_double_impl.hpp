@@ -29,6 +29,7 @@ namespace ccm::internal::impl
 	constexpr auto exp_poly_coeff_two_dbl	= internal_exp_data_dbl.poly[6 - k_exp_poly_order_dbl];
 	constexpr auto exp_poly_coeff_three_dbl = internal_exp_data_dbl.poly[7 - k_exp_poly_order_dbl];
 	constexpr auto exp_poly_coeff_four_dbl	= internal_exp_data_dbl.poly[8 - k_exp_poly_order_dbl];
+	constexpr auto exp_poly_fast_dbl		= internal_exp_data_dbl.poly_fast;
 	constexpr auto k_exp_table_n_dbl		= (1 << ccm::internal::k_exp_table_bits_dbl);
 
 	constexpr double handle_special_case(ccm::double_t tmp, std::uint64_t sign_bits, std::uint64_t exponent_int64) // NOLINT
@@ -69,6 +70,10 @@ namespace ccm::internal::impl
 		return result;
 	}
 
+	/**
+	 * @tparam Fast Use the shorter polynomial of precision::fast (max error 2 ulp instead of 0.52 ulp).
+	 */
+	template <bool Fast = false>
 	constexpr double exp_double_impl(double x)
 	{
 		std::uint32_t abs_top{};
@@ -132,8 +137,12 @@ namespace ccm::internal::impl
 		remSqr = rem * rem;
 
 		// Worst case error is less than (0.5+1.11/N+(abs poly error * 2^53))+0.25/N ulp.
-		tmp = tail + rem + remSqr * (exp_poly_coeff_one_dbl + rem * exp_poly_coeff_two_dbl) +
-			  remSqr * remSqr * (exp_poly_coeff_three_dbl + rem * exp_poly_coeff_four_dbl);
+		if constexpr (Fast) { tmp = tail + rem + remSqr * (exp_poly_fast_dbl[0] + rem * exp_poly_fast_dbl[1]) + remSqr * remSqr * exp_poly_fast_dbl[2]; }
+		else
+		{
+			tmp = tail + rem + remSqr * (exp_poly_coeff_one_dbl + rem * exp_poly_coeff_two_dbl) +
+				  remSqr * remSqr * (exp_poly_coeff_three_dbl + rem * exp_poly_coeff_four_dbl);
+		}
 		if (CCM_UNLIKELY(abs_top == 0.0)) { return handle_special_case(tmp, sign_bits, expo_int64); }
 
 		scale = support::uint64_to_double(sign_bits);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/math_support.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/internal/types/dyadic_float.hpp"
+#include "ccmath/math/expo/impl/exp_correctly_rounded_impl.hpp"
+#include "ccmath/math/expo/impl/log_double_impl.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	// x = 2^expo * mant with mant in [sqrt(2)/2, sqrt(2)). Expects a positive finite x.
+	constexpr double log_cr_decompose(double x, int & expo)
+	{
+		std::uint64_t bits = support::double_to_uint64(x);
+		expo			   = 0;
+		if (bits < (std::uint64_t{1} << 52U))
+		{
+			// Subnormal input.
+			bits = support::double_to_uint64(x * 0x1p54);
+			expo = -54;
+		}
+
+		expo += static_cast<int>(bits >> 52U) - 1023;
+		double mant = support::uint64_to_double((bits & ((std::uint64_t{1} << 52U) - 1)) | (std::uint64_t{1023} << 52U));
+		if (mant > 0x1.6a09e667f3bcdp0)
+		{
+			mant *= 0.5;
+			expo += 1;
+		}
+		return mant;
+	}
+
+	/**
+	 * @brief Multi-precision log(2^expo * mant) from an estimate of log(mant).
+	 *
+	 * Each Newton step y += mant * e^-y - 1 doubles the number of correct bits, up to the precision of exp_dyadic.
+	 */
+	constexpr exp_dyadic_t log_dyadic(double mant, int expo, exp_dyadic_t estimate, int steps)
+	{
+		constexpr exp_dyadic_t ln2 = exp_cr_sum_parts(exp_cr_ln2_parts);
+
+		for (int i = 0; i < steps; ++i)
+		{
+			const exp_dyadic_t scaled = ccm::types::quick_mul(exp_dyadic_t(mant), exp_dyadic(exp_cr_negate(estimate)));
+			estimate				  = ccm::types::quick_add(estimate, ccm::types::quick_add(scaled, exp_dyadic_t(-1.0)));
+		}
+
+		if (expo == 0) { return estimate; }
+		return ccm::types::quick_add(ccm::types::quick_mul(exp_dyadic_t(static_cast<double>(expo)), ln2), estimate);
+	}
+
+	/**
+	 * @brief Correctly rounded natural logarithm for double.
+	 *
+	 * Expects a positive, finite x other than one; the frontend deals with the special values.
+	 * A Newton step on exp_double_double lifts log_double_impl to double-double precision.
+	 */
+	constexpr double log_double_correctly_rounded_impl(double x)
+	{
+		using ccm::type::DoubleDouble;
+
+		int expo		  = 0;
+		const double mant = log_cr_decompose(x, expo);
+		const double y0	  = log_double_impl(mant);
+
+		// t = mant * e^-y0 - 1, so log(mant) = y0 + log1p(t) ~= y0 + t - t^2/2.
+		int scale_exp		= 0;
+		DoubleDouble inv	= exp_double_double(-y0, scale_exp);
+		const double factor = support::uint64_to_double(static_cast<std::uint64_t>(scale_exp + 1023) << 52U);
+		inv.hi *= factor;
+		inv.lo *= factor;
+
+		DoubleDouble prod = ccm::type::exact_mult(mant, inv.hi);
+		prod.lo			  = support::multiply_add(mant, inv.lo, prod.lo);
+		DoubleDouble t{};
+		support::two_sum(t.hi, t.lo, prod.hi - 1.0, prod.lo);
+
+		DoubleDouble log_mant{};
+		support::two_sum(log_mant.hi, log_mant.lo, y0, t.hi);
+		log_mant.lo += t.lo - 0.5 * t.hi * t.hi;
+
+		DoubleDouble result = log_mant;
+		if (expo != 0)
+		{
+			const auto e		  = static_cast<double>(expo);
+			const DoubleDouble hi = ccm::type::exact_mult(e, exp_cr_ln2_parts[0]);
+			const DoubleDouble lo = ccm::type::exact_mult(e, exp_cr_ln2_parts[1]);
+			support::two_sum(result.hi, result.lo, hi.hi, log_mant.hi);
+			result.lo += hi.lo + lo.hi + (lo.lo + e * exp_cr_ln2_parts[2] + log_mant.lo);
+		}
+		result = ccm::type::exact_add(result.hi, result.lo);
+
+		const double err   = 0x1p-99 + (result.hi < 0 ? -result.hi : result.hi) * 0x1p-100;
+		const double lower = result.hi + (result.lo - err);
+		const double upper = result.hi + (result.lo + err);
+		if (lower == upper) { return lower; }
+
+		const exp_dyadic_t estimate = ccm::types::quick_add(exp_dyadic_t(log_mant.hi), exp_dyadic_t(log_mant.lo));
+		return static_cast<double>(log_dyadic(mant, expo, estimate, 1));
+	}
+
+	/**
+	 * @brief Correctly rounded natural logarithm for float.
+	 *
+	 * Expects a positive, finite x other than one; the frontend deals with the special values.
+	 */
+	constexpr float log_float_correctly_rounded_impl(float x)
+	{
+		const double approx = log_double_impl(static_cast<double>(x));
+		if (!is_near_float_midpoint(approx)) { return static_cast<float>(approx); }
+
+		int expo		  = 0;
+		const double mant = log_cr_decompose(static_cast<double>(x), expo);
+		return static_cast<float>(log_dyadic(mant, expo, exp_dyadic_t(log_double_impl(mant)), 2));
+	}
+} // namespace ccm::internal::impl
@@ -10,10 +10,15 @@
 
 #pragma once
 
+#include "ccmath/math/expo/impl/log_correctly_rounded_impl.hpp"
 #include "ccmath/math/expo/impl/log_double_impl.hpp"
 #include "ccmath/internal/math/generic/func/expo/log_gen.hpp"
 #include "ccmath/math/expo/impl/log_float_impl.hpp"
+#include "ccmath/internal/config/errno_policy.hpp"
+#include "ccmath/internal/config/precision.hpp"
 #include "ccmath/internal/math/generic/builtins/expo/log.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/internal/math/runtime/simd/func/log.hpp"
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -23,17 +28,10 @@ CCM_DISABLE_MSVC_WARNING(4702)
 
 namespace ccm
 {
-	/**
-	 * @brief Computes the natural (base e) logarithm (lnx) of a number.
-	 * @tparam T The type of the number.
-	 * @param num A floating-point or integer value to find the natural logarithm of.
-	 * @return If no errors occur, the natural (base-e) logarithm of num (ln(num) or loge(num)) is returned.
-	 */
-	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
-	constexpr T log(const T num) noexcept
+	namespace internal
 	{
-		if constexpr (ccm::builtin::has_constexpr_log<T>) { return ccm::builtin::log(num); }
-		else
+		template <typename T>
+		constexpr T log_kernel(const T num) noexcept
 		{
 			// If the number is 1, return +0.
 			if (num == static_cast<T>(1)) { return static_cast<T>(0); }
@@ -56,6 +54,72 @@ namespace ccm
 			if constexpr (std::is_same_v<T, long double>) { return static_cast<long double>(internal::log_double(static_cast<double>(num))); }
 			return static_cast<T>(internal::log_double(num));
 		}
+	} // namespace internal
+
+	/**
+	 * @brief Computes the natural (base e) logarithm (lnx) of a number.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point or integer value to find the natural logarithm of.
+	 * @return If no errors occur, the natural (base-e) logarithm of num (ln(num) or loge(num)) is returned.
+	 */
+	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
+	constexpr T log(const T num) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_log<T>) { return ccm::builtin::log(num); }
+		else { return internal::log_kernel(num); }
+	}
+
+	/**
+	 * @brief Computes the natural logarithm of every lane.
+	 * @param num Lanes to take the logarithm of.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> log(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::log(num);
+	}
+
+	/**
+	 * @brief Computes the natural (base e) logarithm (lnx) of a number with the given error reporting policy.
+	 * @tparam Policy ccm::policy::default_errno or ccm::policy::no_errno
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value to find the natural logarithm of.
+	 * @return If no errors occur, the natural (base-e) logarithm of num (ln(num) or loge(num)) is returned.
+	 */
+	template <typename Policy, typename T, std::enable_if_t<policy::is_errno_policy_v<Policy> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T log(const T num) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, policy::default_errno>) { return ccm::log(num); }
+		else
+		{
+			// The builtin only touches errno when it calls into libm at runtime.
+			if (ccm::support::is_constant_evaluated()) { return ccm::log(num); }
+			return internal::log_kernel(num);
+		}
+	}
+
+	/**
+	 * @brief Computes the natural (base e) logarithm (lnx) of a number with the requested accuracy.
+	 * @tparam Precision ccm::precision::fast, ccm::precision::standard or ccm::precision::correctly_rounded
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value to find the natural logarithm of.
+	 * @return If no errors occur, the natural (base-e) logarithm of num (ln(num) or loge(num)) is returned.
+	 */
+	template <typename Precision, typename T, std::enable_if_t<precision::is_precision_v<Precision> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T log(const T num) noexcept
+	{
+		// There is no cheaper kernel that stays within 4 ulp, so fast shares the standard implementation.
+		if constexpr (!std::is_same_v<Precision, precision::correctly_rounded>) { return ccm::log(num); }
+		else
+		{
+			static_assert(!std::is_same_v<T, long double>, "ccm::log: precision::correctly_rounded is only available for float and double.");
+
+			// The special values are exact in every tier.
+			if (num == static_cast<T>(1) || num <= static_cast<T>(0) || num == std::numeric_limits<T>::infinity() || ccm::isnan(num)) { return ccm::log(num); }
+
+			if constexpr (std::is_same_v<T, float>) { return internal::impl::log_float_correctly_rounded_impl(num); }
+			else { return internal::impl::log_double_correctly_rounded_impl(num); }
+		}
 	}
 
 	/**
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ccmath/internal/math/generic/builtins/expo/log10.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 #include <type_traits>
 
@@ -29,6 +30,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the common logarithm of every lane.
+	 * @param num Lanes to take the logarithm of.
+	 * @note There is no vector kernel for log10 yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> log10(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::log10(num_lane); }, num);
+	}
+
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr double log10(Integer num)
 	{
@@ -13,6 +13,7 @@
 #include <type_traits>
 
 #include "ccmath/internal/math/generic/builtins/expo/log1p.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 namespace ccm
 {
@@ -29,6 +30,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the natural logarithm of one plus every lane.
+	 * @param num Lanes to add to one.
+	 * @note There is no vector kernel for log1p yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> log1p(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::log1p(num_lane); }, num);
+	}
+
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr double log1p(Integer num)
 	{
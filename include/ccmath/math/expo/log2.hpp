@@ -16,6 +16,7 @@
 #include "ccmath/math/compare/signbit.hpp"
 #include "ccmath/math/expo/impl/log2_double_impl.hpp"
 #include "ccmath/math/expo/impl/log2_float_impl.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 #include <limits>
@@ -71,6 +72,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the base 2 logarithm of every lane.
+	 * @param num Lanes to take the logarithm of.
+	 * @note There is no vector kernel for log2 yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> log2(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::log2(num_lane); }, num);
+	}
+
 	/**
 	 * @brief Returns the base 2 logarithm of a number.
 	 * @tparam Integer The type of the integer.
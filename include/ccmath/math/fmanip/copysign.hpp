@@ -14,6 +14,8 @@
 #include "ccmath/math/compare/isnan.hpp"
 #include "ccmath/math/compare/signbit.hpp"
 #include "ccmath/internal/math/generic/builtins/fmanip/copysign.hpp"
+#include "ccmath/internal/math/runtime/simd/func/basic.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 namespace ccm
@@ -45,6 +47,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Composes every lane of mag with the sign of the same lane of sgn.
+	 * @param mag Magnitudes.
+	 * @param sgn Signs.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> copysign(intrin::simd<T, Abi> const & mag, intrin::simd<T, Abi> const & sgn)
+	{
+		return intrin::copysign(mag, sgn);
+	}
+
 	/**
 	 * @brief Copies the sign of an integer value.
 	 * @tparam Integer Type of the integer value.
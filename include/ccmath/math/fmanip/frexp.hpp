@@ -11,32 +11,59 @@
 #pragma once
 
 #include "ccmath/internal/math/generic/builtins/fmanip/frexp.hpp"
-#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/math/generic/func/fmanip/frexp_gen.hpp"
 
-// TODO: Finish implementing.
+#include <type_traits>
 
 namespace ccm
 {
-	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int>  = 0>
-	constexpr T frexp(T x, int & exp)
+	/**
+	 * @brief Decomposes a floating-point value into a normalized fraction and an integral power of two.
+	 * @tparam T A floating-point type.
+	 * @param x Floating-point value.
+	 * @param exp Receives the power of two.
+	 * @return If x is finite and nonzero, the fraction m with 0.5 <= |m| < 1 such that x = m * 2^exp.
+	 * Otherwise x is returned and exp is set to zero.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T frexp(T x, int & exp) noexcept
 	{
-		if constexpr (ccm::builtin::has_constexpr_frexp<T>)
-		{
-			return ccm::builtin::frexp(x, &exp);
-		}
-		else
-		{
-			support::fp::FPBits<T> bits(x);
-			if (bits.is_inf_or_nan())
-			{
-				return x;
-			}
-			if (bits.is_zero())
-			{
-				exp = 0;
-				return x;
-			}
-		}
+		if constexpr (ccm::builtin::has_constexpr_frexp<T>) { return ccm::builtin::frexp(x, &exp); }
+		else { return gen::frexp_gen(x, exp); }
 	}
 
+	/**
+	 * @brief Decomposes an integer value, converted to double, into a normalized fraction and an integral power of two.
+	 * @tparam Integer An integer type.
+	 * @param x Integer value.
+	 * @param exp Receives the power of two.
+	 * @return The fraction m with 0.5 <= |m| < 1 such that x = m * 2^exp, or zero for zero.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double frexp(Integer x, int & exp) noexcept
+	{
+		return ccm::frexp<double>(static_cast<double>(x), exp);
+	}
+
+	/**
+	 * @brief Decomposes a float into a normalized fraction and an integral power of two.
+	 * @param x Floating-point value.
+	 * @param exp Receives the power of two.
+	 * @return The fraction m with 0.5 <= |m| < 1 such that x = m * 2^exp.
+	 */
+	constexpr float frexpf(float x, int & exp) noexcept
+	{
+		return ccm::frexp<float>(x, exp);
+	}
+
+	/**
+	 * @brief Decomposes a long double into a normalized fraction and an integral power of two.
+	 * @param x Floating-point value.
+	 * @param exp Receives the power of two.
+	 * @return The fraction m with 0.5 <= |m| < 1 such that x = m * 2^exp.
+	 */
+	constexpr long double frexpl(long double x, int & exp) noexcept
+	{
+		return ccm::frexp<long double>(x, exp);
+	}
 } // namespace ccm
@@ -10,7 +10,56 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/fmanip/ilogb.hpp"
+#include "ccmath/internal/math/generic/func/fmanip/ilogb_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Extracts the unbiased exponent of a floating-point value as an int.
+	 * @tparam T A floating-point type.
+	 * @param x Floating-point value.
+	 * @return The exponent of x as if x were normalized, i.e. floor(log2(|x|)).
+	 * For ±0 returns FP_ILOGB0, for NaN FP_ILOGBNAN and for ±inf INT_MAX; each of these is a domain error.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr int ilogb(T x) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_ilogb<T>) { return ccm::builtin::ilogb(x); }
+		else { return gen::ilogb_gen(x); }
+	}
+
+	/**
+	 * @brief Extracts the unbiased exponent of an integer value converted to double.
+	 * @tparam Integer An integer type.
+	 * @param x Integer value.
+	 * @return floor(log2(|x|)), or FP_ILOGB0 for zero.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr int ilogb(Integer x) noexcept
+	{
+		return ccm::ilogb<double>(static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Extracts the unbiased exponent of a float as an int.
+	 * @param x Floating-point value.
+	 * @return floor(log2(|x|)) for finite nonzero x.
+	 */
+	constexpr int ilogbf(float x) noexcept
+	{
+		return ccm::ilogb<float>(x);
+	}
 
+	/**
+	 * @brief Extracts the unbiased exponent of a long double as an int.
+	 * @param x Floating-point value.
+	 * @return floor(log2(|x|)) for finite nonzero x.
+	 */
+	constexpr int ilogbl(long double x) noexcept
+	{
+		return ccm::ilogb<long double>(x);
+	}
 } // namespace ccm
@@ -12,7 +12,9 @@
 
 #include "ccmath/internal/config/builtin/bit_cast_support.hpp"
 #include "ccmath/internal/config/builtin/ldexp_support.hpp"
+#include "ccmath/internal/config/errno_policy.hpp"
 #include "ccmath/internal/math/generic/builtins/fmanip/ldexp.hpp"
+#include "ccmath/internal/math/runtime/simd/func/ldexp.hpp"
 #include "ccmath/internal/predef/has_const_builtin.hpp"
 #include "ccmath/internal/support/helpers/internal_ldexp.hpp"
 
@@ -35,6 +37,43 @@ namespace ccm
 		else { return support::helpers::internal_ldexp(num, exp); }
 	}
 
+	/**
+	 * @brief Multiplies every lane by 2 raised to the power of the same lane of exp.
+	 * @param num Lanes to scale.
+	 * @param exp Integral powers of two.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> ldexp(intrin::simd<T, Abi> const & num, intrin::simd<T, Abi> const & exp)
+	{
+		return intrin::ldexp(num, exp);
+	}
+
+	/**
+	 * @brief Multiplies every lane by 2 raised to the power of exp.
+	 * @param num Lanes to scale.
+	 * @param exp Integral power of two.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> ldexp(intrin::simd<T, Abi> const & num, int exp)
+	{
+		return intrin::ldexp(num, intrin::simd<T, Abi>(static_cast<T>(exp)));
+	}
+
+	/**
+	 * @brief Multiplies a floating point value num by the number 2 raised to the exp power with the given error reporting policy.
+	 * @tparam Policy ccm::policy::default_errno or ccm::policy::no_errno
+	 * @tparam T A floating-point type.
+	 * @param num A floating-point value.
+	 * @param exp An integer value.
+	 * @return If no errors occur, num multiplied by 2 to the power of exp (num×2exp) is returned.
+	 */
+	template <typename Policy, typename T, std::enable_if_t<policy::is_errno_policy_v<Policy> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T ldexp(T num, int exp) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, policy::default_errno>) { return ccm::ldexp(num, exp); }
+		else { return support::helpers::internal_ldexp<Policy>(num, exp); }
+	}
+
 	/**
 	 * @brief Multiplies a floating point value num by the number 2 raised to the exp power.
 	 * @note On many implementations, std::ldexp is less efficient than multiplication or division by a power of two using arithmetic operators.
@@ -10,7 +10,67 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/builtins/fmanip/logb.hpp"
+#include "ccmath/internal/math/generic/func/fmanip/logb_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/logb.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Extracts the unbiased exponent of a floating-point value as a floating-point value.
+	 * @tparam T A floating-point type.
+	 * @param x Floating-point value.
+	 * @return The exponent of x as if x were normalized, i.e. floor(log2(|x|)).
+	 * For ±0 returns -inf (a pole error), for ±inf +inf and for NaN NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T logb(T x) noexcept
+	{
+		if constexpr (ccm::builtin::has_constexpr_logb<T>) { return ccm::builtin::logb(x); }
+		else { return gen::logb_gen(x); }
+	}
+
+	/**
+	 * @brief Extracts the unbiased exponent of every lane.
+	 * @param x Lanes to take the exponent of.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> logb(intrin::simd<T, Abi> const & x)
+	{
+		return intrin::logb(x);
+	}
+
+	/**
+	 * @brief Extracts the unbiased exponent of an integer value converted to double.
+	 * @tparam Integer An integer type.
+	 * @param x Integer value.
+	 * @return floor(log2(|x|)) as a double, or -inf for zero.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double logb(Integer x) noexcept
+	{
+		return ccm::logb<double>(static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Extracts the unbiased exponent of a float as a float.
+	 * @param x Floating-point value.
+	 * @return floor(log2(|x|)) for finite nonzero x.
+	 */
+	constexpr float logbf(float x) noexcept
+	{
+		return ccm::logb<float>(x);
+	}
 
+	/**
+	 * @brief Extracts the unbiased exponent of a long double as a long double.
+	 * @param x Floating-point value.
+	 * @return floor(log2(|x|)) for finite nonzero x.
+	 */
+	constexpr long double logbl(long double x) noexcept
+	{
+		return ccm::logb<long double>(x);
+	}
 } // namespace ccm
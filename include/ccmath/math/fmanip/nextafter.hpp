@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/math/generic/func/fmanip/nextafter_gen.hpp"
 #include "ccmath/internal/math/generic/builtins/fmanip/nextafter.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 #include <type_traits>
@@ -26,6 +27,18 @@ namespace ccm
 		else { return gen::nextafter_gen(from, to); }
 	}
 
+	/**
+	 * @brief Computes the next representable value after every lane of from, in the direction of the same lane of to.
+	 * @param from Start values.
+	 * @param to Directions.
+	 * @note There is no vector kernel for nextafter yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> nextafter(intrin::simd<T, Abi> const & from, intrin::simd<T, Abi> const & to) noexcept
+	{
+		return intrin::lanewise([](T from_lane, T to_lane) { return ccm::nextafter(from_lane, to_lane); }, from, to);
+	}
+
 	template <typename Arithmetic1, typename Arithmetic2, std::enable_if_t<std::is_arithmetic_v<Arithmetic1> && std::is_arithmetic_v<Arithmetic2>, bool> = true>
 	constexpr auto nextafter(Arithmetic1 from, Arithmetic2 to) noexcept
 	{
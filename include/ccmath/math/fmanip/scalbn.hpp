@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ccmath/internal/math/generic/builtins/fmanip/scalbn.hpp"
+#include "ccmath/internal/math/runtime/simd/func/ldexp.hpp"
 #include "ccmath/math/fmanip/impl/scalbn_double_impl.hpp"
 #include "ccmath/math/fmanip/impl/scalbn_float_impl.hpp"
 #include "ccmath/math/fmanip/impl/scalbn_ldouble_impl.hpp"
@@ -43,6 +44,28 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Multiplies every lane by 2 raised to the power of the same lane of exp.
+	 * @param num Lanes to scale.
+	 * @param exp Integral powers of two.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> scalbn(intrin::simd<T, Abi> const & num, intrin::simd<T, Abi> const & exp)
+	{
+		return intrin::scalbn(num, exp);
+	}
+
+	/**
+	 * @brief Multiplies every lane by 2 raised to the power of exp.
+	 * @param num Lanes to scale.
+	 * @param exp Integral power of two.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> scalbn(intrin::simd<T, Abi> const & num, int exp)
+	{
+		return intrin::scalbn(num, intrin::simd<T, Abi>(static_cast<T>(exp)));
+	}
+
 	/**
 	 * @brief Multiplies a number by FLT_RADIX raised to a power
 	 * @tparam T Floating-point or integer type.
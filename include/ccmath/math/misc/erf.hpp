@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/misc/erf_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/erf.hpp"
+
+#include <type_traits>
+
+namespace ccm
+{
+	/**
+	 * @brief Computes the error function of a number.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the error function of num (erf(num)) is returned. ±0 and NaN are returned unmodified
+	 * and ±∞ gives ±1.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, within 1 ulp of the exact value for double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T erf(T num) noexcept
+	{
+		return ccm::gen::erf_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the error function of every lane.
+	 * @param num Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> erf(intrin::simd<T, Abi> const & num)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::erf(num); }
+		else { return intrin::lanewise([](T num_lane) { return ccm::erf(num_lane); }, num); }
+	}
+
+	/**
+	 * @brief Computes the error function of a number.
+	 * @tparam Integer Integer type.
+	 * @param num Integer number.
+	 * @return If no errors occur, the error function of num (erf(num)) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double erf(Integer num) noexcept
+	{
+		return ccm::erf<double>(static_cast<double>(num));
+	}
+
+	/**
+	 * @brief Computes the error function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the error function of num (erf(num)) is returned.
+	 */
+	constexpr float erff(float num) noexcept
+	{
+		return ccm::erf<float>(num);
+	}
+
+	/**
+	 * @brief Computes the error function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the error function of num (erf(num)) is returned.
+	 */
+	constexpr long double erfl(long double num) noexcept
+	{
+		return ccm::erf<long double>(num);
+	}
+} // namespace ccm
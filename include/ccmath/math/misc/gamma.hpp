@@ -10,7 +10,70 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/misc/gamma_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/gamma.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the gamma function of a number.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the gamma function of num (Γ(num)) is returned. ±0 gives ±∞ as a pole error, negative
+	 * integers and -∞ give NaN as a domain error and results that overflow give +∞ as a range error.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, within 1.6 ulp of the exact value for positive double arguments and 2 ulp for negative ones.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tgamma(T num) noexcept
+	{
+		return ccm::gen::tgamma_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the gamma function of every lane.
+	 * @param num Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> tgamma(intrin::simd<T, Abi> const & num)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::tgamma(num); }
+		else { return intrin::lanewise([](T num_lane) { return ccm::tgamma(num_lane); }, num); }
+	}
+
+	/**
+	 * @brief Computes the gamma function of a number.
+	 * @tparam Integer Integer type.
+	 * @param num Integer number.
+	 * @return If no errors occur, the gamma function of num (Γ(num)) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double tgamma(Integer num) noexcept
+	{
+		return ccm::tgamma<double>(static_cast<double>(num));
+	}
+
+	/**
+	 * @brief Computes the gamma function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the gamma function of num (Γ(num)) is returned.
+	 */
+	constexpr float tgammaf(float num) noexcept
+	{
+		return ccm::tgamma<float>(num);
+	}
 
+	/**
+	 * @brief Computes the gamma function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the gamma function of num (Γ(num)) is returned.
+	 */
+	constexpr long double tgammal(long double num) noexcept
+	{
+		return ccm::tgamma<long double>(num);
+	}
 } // namespace ccm
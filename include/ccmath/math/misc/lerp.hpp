@@ -10,17 +10,25 @@
 
 #pragma once
 
-#include "ccmath/math/basic/fma.hpp"
+#include "ccmath/internal/math/generic/func/misc/lerp_gen.hpp"
+
+#include <type_traits>
 
 namespace ccm
 {
+	/**
+	 * @brief Linear interpolation between a and b.
+	 * @tparam T Arithmetic type, or intrin::simd to interpolate every lane.
+	 * @param a Value at t = 0.
+	 * @param b Value at t = 1.
+	 * @param t Interpolation parameter, extrapolates outside [0, 1].
+	 * @return a + t * (b - a).
+	 */
 	template <typename T>
 	constexpr T lerp(T a, T b, T t) noexcept
 	{
-		// Optimized version of lerp
-		// https://developer.nvidia.com/blog/lerp-faster-cuda/
 		// TODO: Validate this works for all cases of a lerp.
-		return ccm::fma(t, b, ccm::fma(-t, a, a));
+		return gen::lerp_gen(a, b, t);
 	}
 
 	template <typename T, typename U, typename V>
@@ -10,7 +10,70 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/misc/gamma_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/gamma.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the natural logarithm of the absolute value of the gamma function of a number.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, log(|Γ(num)|) is returned. Nonpositive integers give +∞ as a pole error, ±∞ gives +∞
+	 * and results that overflow give +∞ as a range error.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, within 2 ulp for positive double arguments and 3 ulp for negative ones, its zeros included.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T lgamma(T num) noexcept
+	{
+		return ccm::gen::lgamma_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the logarithm of the absolute value of the gamma function of every lane.
+	 * @param num Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> lgamma(intrin::simd<T, Abi> const & num)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::lgamma(num); }
+		else { return intrin::lanewise([](T num_lane) { return ccm::lgamma(num_lane); }, num); }
+	}
+
+	/**
+	 * @brief Computes the natural logarithm of the absolute value of the gamma function of a number.
+	 * @tparam Integer Integer type.
+	 * @param num Integer number.
+	 * @return If no errors occur, log(|Γ(num)|) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double lgamma(Integer num) noexcept
+	{
+		return ccm::lgamma<double>(static_cast<double>(num));
+	}
+
+	/**
+	 * @brief Computes the natural logarithm of the absolute value of the gamma function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, log(|Γ(num)|) is returned.
+	 */
+	constexpr float lgammaf(float num) noexcept
+	{
+		return ccm::lgamma<float>(num);
+	}
 
+	/**
+	 * @brief Computes the natural logarithm of the absolute value of the gamma function of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, log(|Γ(num)|) is returned.
+	 */
+	constexpr long double lgammal(long double num) noexcept
+	{
+		return ccm::lgamma<long double>(num);
+	}
 } // namespace ccm
@@ -13,6 +13,7 @@
 #include "ccmath/math/compare/isinf.hpp"
 #include "ccmath/math/compare/isnan.hpp"
 #include "ccmath/internal/math/generic/builtins/nearest/floor.hpp"
+#include "ccmath/internal/math/runtime/simd/func/floor.hpp"
 
 #include <limits>
 #include <type_traits>
@@ -97,6 +98,16 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the largest integer value not greater than every lane.
+	 * @param num Lanes to round.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> floor(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::floor(num);
+	}
+
 	/**
 	 * @brief Computes the largest integer value not greater than num.
 	 * @param num A integer value.
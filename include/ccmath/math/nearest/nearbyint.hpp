@@ -33,6 +33,17 @@ namespace ccm
 		return ccm::support::fp::directional_round(num, rounding_mode);
 	}
 
+	/**
+	 * @brief Rounds every lane to an integer value in the current rounding mode.
+	 * @param num Lanes to round.
+	 * @note There is no vector kernel for nearbyint yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> nearbyint(intrin::simd<T, Abi> const & num) noexcept
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::nearbyint(num_lane); }, num);
+	}
+
 	/**
 	 * @brief The nearest integer value to num, according to the rounding mode FE_TONEAREST, is returned.
 	 * @tparam Integer The type of the number.
@@ -13,6 +13,7 @@
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/math/generic/builtins/nearest/trunc.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
 
 
 namespace ccm
@@ -57,6 +58,17 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Rounds every lane to the nearest integer value not greater in magnitude.
+	 * @param num Lanes to round.
+	 * @note There is no vector kernel for trunc yet, the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> trunc(intrin::simd<T, Abi> const & num) noexcept
+	{
+		return intrin::lanewise([](T num_lane) { return ccm::trunc(num_lane); }, num);
+	}
+
 	/**
 	 * @brief Returns the integral value nearest to x with the magnitude of the integral value always less than or equal to x.
 	 * @tparam Integer The type of the input.
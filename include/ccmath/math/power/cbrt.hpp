@@ -10,7 +10,69 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cbrt.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the cube root of a number.
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the cube root of num (∛num) is returned. ±0, ±∞ and NaN are returned unmodified.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result, within 0.67 ulp of
+	 * the exact cube root for double and 0.78 ulp for float.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cbrt(T num) noexcept
+	{
+		return ccm::gen::cbrt_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the cube root of every lane.
+	 * @param num Lanes to take the cube root of.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> cbrt(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::cbrt(num);
+	}
 
+	/**
+	 * @brief Computes the cube root of a number.
+	 * @tparam Integer Integer type.
+	 * @param num Integer number.
+	 * @return If no errors occur, the cube root of num (∛num) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double cbrt(Integer num) noexcept
+	{
+		return ccm::cbrt<double>(static_cast<double>(num));
+	}
+
+	/**
+	 * @brief Computes the cube root of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the cube root of num (∛num) is returned.
+	 */
+	constexpr float cbrtf(float num) noexcept
+	{
+		return ccm::cbrt<float>(num);
+	}
+
+	/**
+	 * @brief Computes the cube root of a number.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, the cube root of num (∛num) is returned.
+	 */
+	constexpr long double cbrtl(long double num) noexcept
+	{
+		return ccm::cbrt<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup power
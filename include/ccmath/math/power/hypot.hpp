@@ -10,7 +10,113 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/hypot.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow.
+	 * @tparam T Floating-point type.
+	 * @param x Floating-point value.
+	 * @param y Floating-point value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle with sides x and y (√(x² + y²)) is returned.
+	 * If either argument is ±∞, +∞ is returned even if the other is NaN. Otherwise a NaN argument gives NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot(T x, T y) noexcept
+	{
+		return ccm::gen::hypot_gen<T>(x, y);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of every pair of lanes.
+	 * @param x First lanes.
+	 * @param y Second lanes.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> hypot(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y)
+	{
+		return intrin::hypot(x, y);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x, y and z, without undue overflow or underflow.
+	 * @tparam T Floating-point type.
+	 * @param x Floating-point value.
+	 * @param y Floating-point value.
+	 * @param z Floating-point value.
+	 * @return If no errors occur, the distance from the origin to the point (x, y, z) (√(x² + y² + z²)) is returned.
+	 * If any argument is ±∞, +∞ is returned even if another is NaN. Otherwise a NaN argument gives NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot(T x, T y, T z) noexcept
+	{
+		return ccm::gen::hypot_gen<T>(x, y, z);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of every triple of lanes.
+	 * @param x First lanes.
+	 * @param y Second lanes.
+	 * @param z Third lanes.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> hypot(intrin::simd<T, Abi> const & x, intrin::simd<T, Abi> const & y, intrin::simd<T, Abi> const & z)
+	{
+		return intrin::hypot(x, y, z);
+	}
 
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y.
+	 * @tparam Integer Integer type.
+	 * @param x Integer value.
+	 * @param y Integer value.
+	 * @return If no errors occur, √(x² + y²) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double hypot(Integer x, Integer y) noexcept
+	{
+		return ccm::hypot<double>(static_cast<double>(x), static_cast<double>(y));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x, y and z.
+	 * @tparam Integer Integer type.
+	 * @param x Integer value.
+	 * @param y Integer value.
+	 * @param z Integer value.
+	 * @return If no errors occur, √(x² + y² + z²) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double hypot(Integer x, Integer y, Integer z) noexcept
+	{
+		return ccm::hypot<double>(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y.
+	 * @param x Floating-point value.
+	 * @param y Floating-point value.
+	 * @return If no errors occur, √(x² + y²) is returned.
+	 */
+	constexpr float hypotf(float x, float y) noexcept
+	{
+		return ccm::hypot<float>(x, y);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y.
+	 * @param x Floating-point value.
+	 * @param y Floating-point value.
+	 * @return If no errors occur, √(x² + y²) is returned.
+	 */
+	constexpr long double hypotl(long double x, long double y) noexcept
+	{
+		return ccm::hypot<long double>(x, y);
+	}
 } // namespace ccm
+
+/// @ingroup power
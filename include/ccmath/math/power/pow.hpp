@@ -14,6 +14,7 @@
 #include "ccmath/internal/math/runtime/func/power/pow_rt.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 #include "ccmath/internal/math/generic/builtins/power/pow.hpp"
+#include "ccmath/internal/math/runtime/simd/func/pow.hpp"
 
 
 #include <type_traits>
@@ -33,6 +34,22 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Raises every lane of base to the power of the same lane of exp.
+	 * @param base Bases.
+	 * @param exp Exponents.
+	 * @note Only the SVML builds have a vector kernel for pow, elsewhere the lanes are computed one at a time.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> pow(intrin::simd<T, Abi> const & base, intrin::simd<T, Abi> const & exp)
+	{
+#if CCMATH_HAS_SIMD_SVML
+		return intrin::pow(base, exp);
+#else
+		return intrin::lanewise([](T base_lane, T exp_lane) { return ccm::pow(base_lane, exp_lane); }, base, exp);
+#endif
+	}
+
 	template <typename Integer, std::enable_if_t<!std::is_floating_point_v<Integer>, bool> = true>
 	constexpr double pow(Integer base, Integer exp)
 	{
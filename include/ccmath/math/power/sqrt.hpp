@@ -10,9 +10,11 @@
 
 #pragma once
 
+#include "ccmath/internal/config/errno_policy.hpp"
 #include "ccmath/internal/math/generic/builtins/power/sqrt.hpp"
 #include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
 #include "ccmath/internal/math/runtime/func/power/sqrt_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 
 #include <type_traits>
@@ -37,6 +39,34 @@ namespace ccm
 		}
 	}
 
+	/**
+	 * @brief Computes the square root of every lane.
+	 * @param num Lanes to take the square root of.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> sqrt(intrin::simd<T, Abi> const & num)
+	{
+		return intrin::sqrt(num);
+	}
+
+	/**
+	 * @brief Calculates the square root of a number with the given error reporting policy.
+	 * @tparam Policy ccm::policy::default_errno or ccm::policy::no_errno
+	 * @tparam T Floating-point type.
+	 * @param num Floating-point number.
+	 * @return If no errors occur, square root of num (√num), is returned.
+	 */
+	template <typename Policy, typename T, std::enable_if_t<policy::is_errno_policy_v<Policy> && std::is_floating_point_v<T>, bool> = true>
+	constexpr T sqrt(T num)
+	{
+		if constexpr (std::is_same_v<Policy, policy::default_errno>) { return ccm::sqrt(num); }
+		else
+		{
+			if (ccm::support::is_constant_evaluated()) { return ccm::sqrt(num); }
+			return ccm::rt::sqrt_rt<T, Policy>(num);
+		}
+	}
+
 	/**
 	 * @brief Calculates the square root of a number.
 	 * @tparam Integer Integer type.
@@ -10,7 +10,94 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/assoc_laguerre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/laguerre.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the associated Laguerre polynomial of degree n and order m.
+	 * @tparam T Floating-point type.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n^m(x) is returned. Negative arguments give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double with the three-term recurrence.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T assoc_laguerre(unsigned n, unsigned m, T x) noexcept
+	{
+		return ccm::gen::assoc_laguerre_gen<T>(n, m, x);
+	}
+
+	/**
+	 * @brief Computes the associated Laguerre polynomial of degree n and order m of every lane.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> assoc_laguerre(unsigned n, unsigned m, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::assoc_laguerre(n, m, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::assoc_laguerre(n, m, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the associated Laguerre polynomial of degree n and order m.
+	 * @tparam Integer Integer type.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, L_n^m(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double assoc_laguerre(unsigned n, unsigned m, Integer x) noexcept
+	{
+		return ccm::assoc_laguerre<double>(n, m, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the associated Laguerre polynomial of degree n and order m.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n^m(x) is returned.
+	 */
+	constexpr float assoc_laguerref(unsigned n, unsigned m, float x) noexcept
+	{
+		return ccm::assoc_laguerre<float>(n, m, x);
+	}
+
+	/**
+	 * @brief Computes the associated Laguerre polynomial of degree n and order m.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n^m(x) is returned.
+	 */
+	constexpr long double assoc_laguerrel(unsigned n, unsigned m, long double x) noexcept
+	{
+		return ccm::assoc_laguerre<long double>(n, m, x);
+	}
 
+	/**
+	 * @brief Computes the associated Laguerre polynomials of every degree up to n_max and order m in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @param out Receives L_0^m(x) to L_{n_max}^m(x), n_max + 1 values. Each one is the same as assoc_laguerre returns for
+	 * that degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void assoc_laguerre_all(unsigned n_max, unsigned m, T x, T * out) noexcept
+	{
+		ccm::gen::assoc_laguerre_all_gen<T>(n_max, m, x, out);
+	}
 } // namespace ccm
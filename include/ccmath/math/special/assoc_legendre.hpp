@@ -10,7 +10,95 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/assoc_legendre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/legendre.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the associated Legendre function of degree n and order m.
+	 * @tparam T Floating-point type.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n^m(x) without the Condon-Shortley phase is returned, 0 for m > n. Arguments outside
+	 * [-1, 1] give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double with the recurrence in the degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T assoc_legendre(unsigned n, unsigned m, T x) noexcept
+	{
+		return ccm::gen::assoc_legendre_gen<T>(n, m, x);
+	}
+
+	/**
+	 * @brief Computes the associated Legendre function of degree n and order m of every lane.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> assoc_legendre(unsigned n, unsigned m, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::assoc_legendre(n, m, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::assoc_legendre(n, m, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the associated Legendre function of degree n and order m.
+	 * @tparam Integer Integer type.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, P_n^m(x) without the Condon-Shortley phase is returned, 0 for m > n.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double assoc_legendre(unsigned n, unsigned m, Integer x) noexcept
+	{
+		return ccm::assoc_legendre<double>(n, m, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the associated Legendre function of degree n and order m.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n^m(x) without the Condon-Shortley phase is returned, 0 for m > n.
+	 */
+	constexpr float assoc_legendref(unsigned n, unsigned m, float x) noexcept
+	{
+		return ccm::assoc_legendre<float>(n, m, x);
+	}
+
+	/**
+	 * @brief Computes the associated Legendre function of degree n and order m.
+	 * @param n Degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n^m(x) without the Condon-Shortley phase is returned, 0 for m > n.
+	 */
+	constexpr long double assoc_legendrel(unsigned n, unsigned m, long double x) noexcept
+	{
+		return ccm::assoc_legendre<long double>(n, m, x);
+	}
 
+	/**
+	 * @brief Computes the associated Legendre functions of every degree up to n_max and order m in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest degree.
+	 * @param m Order.
+	 * @param x Floating-point number.
+	 * @param out Receives P_0^m(x) to P_{n_max}^m(x), the ones below m being 0, n_max + 1 values. Each one is the same as
+	 * assoc_legendre returns for that degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void assoc_legendre_all(unsigned n_max, unsigned m, T x, T * out) noexcept
+	{
+		ccm::gen::assoc_legendre_all_gen<T>(n_max, m, x, out);
+	}
 } // namespace ccm
@@ -10,7 +10,91 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/cyl_bessel_i_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cyl_bessel.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the modified cylindrical Bessel function of the first kind of order nu.
+	 * @tparam T Floating-point type.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, I_nu(x) is returned. Negative arguments or orders give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, with the continued fraction for I_nu / I_{nu + 1} and the downward recurrence, scaled with the Wronskian and
+	 * K. The error is commonly below 16 ulp and below 32 ulp for orders and arguments up to a few hundred.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cyl_bessel_i(T nu, T x) noexcept
+	{
+		return ccm::gen::cyl_bessel_i_gen<T>(nu, x);
+	}
+
+	/**
+	 * @brief Computes the modified cylindrical Bessel function of the first kind of order nu of every lane.
+	 * @param nu Order, the same for every lane.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> cyl_bessel_i(T nu, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::cyl_bessel_i(nu, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::cyl_bessel_i(nu, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the modified cylindrical Bessel function of the first kind of order nu.
+	 * @tparam Integer Integer type.
+	 * @param nu Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, I_nu(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double cyl_bessel_i(Integer nu, Integer x) noexcept
+	{
+		return ccm::cyl_bessel_i<double>(static_cast<double>(nu), static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the modified cylindrical Bessel function of the first kind of order nu.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, I_nu(x) is returned.
+	 */
+	constexpr float cyl_bessel_if(float nu, float x) noexcept
+	{
+		return ccm::cyl_bessel_i<float>(nu, x);
+	}
+
+	/**
+	 * @brief Computes the modified cylindrical Bessel function of the first kind of order nu.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, I_nu(x) is returned.
+	 */
+	constexpr long double cyl_bessel_il(long double nu, long double x) noexcept
+	{
+		return ccm::cyl_bessel_i<long double>(nu, x);
+	}
 
+	/**
+	 * @brief Computes the modified cylindrical Bessel functions of the first kind of the orders nu to nu + n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param nu Lowest order.
+	 * @param n_max Number of orders past nu.
+	 * @param x Floating-point number.
+	 * @param out Receives I_nu(x) to I_{nu + n_max}(x), n_max + 1 values. Where the recurrence is taken it starts at nu +
+	 * n_max rather than at each order, so those values can differ from what cyl_bessel_i returns in the last bits.
+	 * Hankel's expansion and the series give the same values.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void cyl_bessel_i_all(T nu, unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::cyl_bessel_i_all_gen<T>(nu, n_max, x, out);
+	}
 } // namespace ccm
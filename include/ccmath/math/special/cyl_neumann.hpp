@@ -10,7 +10,93 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/cyl_neumann_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cyl_bessel.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the cylindrical Bessel function of the second kind of order nu.
+	 * @tparam T Floating-point type.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, Y_nu(x) is returned. 0 gives -∞ and negative arguments or orders give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, with Hankel's asymptotic expansion for x >= max(25, nu^2 / 8) and otherwise upwards from Temme's series or
+	 * Steed's method near order 0. Values past the range of double are -∞. The error is measured against sqrt(J_nu(x)^2 +
+	 * Y_nu(x)^2), as near the zeros no bound on the relative error holds. It is commonly below 16 ulp of that, and gets to
+	 * a few hundred ulp for orders and arguments in the hundreds with nu < x < nu^2 / 8, where the recurrences take
+	 * hundreds of steps.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cyl_neumann(T nu, T x) noexcept
+	{
+		return ccm::gen::cyl_neumann_gen<T>(nu, x);
+	}
+
+	/**
+	 * @brief Computes the cylindrical Bessel function of the second kind of order nu of every lane.
+	 * @param nu Order, the same for every lane.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> cyl_neumann(T nu, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::cyl_neumann(nu, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::cyl_neumann(nu, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the cylindrical Bessel function of the second kind of order nu.
+	 * @tparam Integer Integer type.
+	 * @param nu Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, Y_nu(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double cyl_neumann(Integer nu, Integer x) noexcept
+	{
+		return ccm::cyl_neumann<double>(static_cast<double>(nu), static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the cylindrical Bessel function of the second kind of order nu.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, Y_nu(x) is returned.
+	 */
+	constexpr float cyl_neumannf(float nu, float x) noexcept
+	{
+		return ccm::cyl_neumann<float>(nu, x);
+	}
+
+	/**
+	 * @brief Computes the cylindrical Bessel function of the second kind of order nu.
+	 * @param nu Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, Y_nu(x) is returned.
+	 */
+	constexpr long double cyl_neumannl(long double nu, long double x) noexcept
+	{
+		return ccm::cyl_neumann<long double>(nu, x);
+	}
 
+	/**
+	 * @brief Computes the cylindrical Bessel functions of the second kind of the orders nu to nu + n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param nu Lowest order.
+	 * @param n_max Number of orders past nu.
+	 * @param x Floating-point number.
+	 * @param out Receives Y_nu(x) to Y_{nu + n_max}(x), n_max + 1 values. Each one is the same as cyl_neumann returns for
+	 * that order.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void cyl_neumann_all(T nu, unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::cyl_neumann_all_gen<T>(nu, n_max, x, out);
+	}
 } // namespace ccm
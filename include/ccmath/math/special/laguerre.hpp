@@ -10,7 +10,88 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/laguerre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/laguerre.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the Laguerre polynomial of degree n.
+	 * @tparam T Floating-point type.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n(x) is returned. Negative arguments give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double with the three-term recurrence.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T laguerre(unsigned n, T x) noexcept
+	{
+		return ccm::gen::laguerre_gen<T>(n, x);
+	}
+
+	/**
+	 * @brief Computes the Laguerre polynomial of degree n of every lane.
+	 * @param n Degree.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> laguerre(unsigned n, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::laguerre(n, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::laguerre(n, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the Laguerre polynomial of degree n.
+	 * @tparam Integer Integer type.
+	 * @param n Degree.
+	 * @param x Integer number.
+	 * @return If no errors occur, L_n(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double laguerre(unsigned n, Integer x) noexcept
+	{
+		return ccm::laguerre<double>(n, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the Laguerre polynomial of degree n.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n(x) is returned.
+	 */
+	constexpr float laguerref(unsigned n, float x) noexcept
+	{
+		return ccm::laguerre<float>(n, x);
+	}
+
+	/**
+	 * @brief Computes the Laguerre polynomial of degree n.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, L_n(x) is returned.
+	 */
+	constexpr long double laguerrel(unsigned n, long double x) noexcept
+	{
+		return ccm::laguerre<long double>(n, x);
+	}
 
+	/**
+	 * @brief Computes the Laguerre polynomials of every degree up to n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest degree.
+	 * @param x Floating-point number.
+	 * @param out Receives L_0(x) to L_{n_max}(x), n_max + 1 values. Each one is the same as laguerre returns for that
+	 * degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void laguerre_all(unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::laguerre_all_gen<T>(n_max, x, out);
+	}
 } // namespace ccm
@@ -10,7 +10,88 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/legendre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/legendre.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the Legendre polynomial of degree n.
+	 * @tparam T Floating-point type.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n(x) is returned. Arguments outside [-1, 1] give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double with Bonnet's recurrence.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T legendre(unsigned n, T x) noexcept
+	{
+		return ccm::gen::legendre_gen<T>(n, x);
+	}
+
+	/**
+	 * @brief Computes the Legendre polynomial of degree n of every lane.
+	 * @param n Degree.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> legendre(unsigned n, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::legendre(n, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::legendre(n, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the Legendre polynomial of degree n.
+	 * @tparam Integer Integer type.
+	 * @param n Degree.
+	 * @param x Integer number.
+	 * @return If no errors occur, P_n(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double legendre(unsigned n, Integer x) noexcept
+	{
+		return ccm::legendre<double>(n, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the Legendre polynomial of degree n.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n(x) is returned.
+	 */
+	constexpr float legendref(unsigned n, float x) noexcept
+	{
+		return ccm::legendre<float>(n, x);
+	}
+
+	/**
+	 * @brief Computes the Legendre polynomial of degree n.
+	 * @param n Degree.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, P_n(x) is returned.
+	 */
+	constexpr long double legendrel(unsigned n, long double x) noexcept
+	{
+		return ccm::legendre<long double>(n, x);
+	}
 
+	/**
+	 * @brief Computes the Legendre polynomials of every degree up to n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest degree.
+	 * @param x Floating-point number.
+	 * @param out Receives P_0(x) to P_{n_max}(x), n_max + 1 values. Each one is the same as legendre returns for that
+	 * degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void legendre_all(unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::legendre_all_gen<T>(n_max, x, out);
+	}
 } // namespace ccm
@@ -10,7 +10,93 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/sph_bessel_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sph_bessel.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the spherical Bessel function of the first kind of order n.
+	 * @tparam T Floating-point type.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, j_n(x) is returned. Negative arguments give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, upwards from j_0 and j_1 for x > n and with Miller's downward recurrence otherwise. For orders up to 200
+	 * the error is within about 20 ulp of the envelope sqrt(j_n(x)^2 + y_n(x)^2). Away from the zeros of j_n that is
+	 * commonly under 10 ulp of the value and seldom over 40. Near a zero the value gets small while the error stays at
+	 * the size of the envelope, so relative to the value it grows without bound there.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_bessel(unsigned n, T x) noexcept
+	{
+		return ccm::gen::sph_bessel_gen<T>(n, x);
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the first kind of order n of every lane.
+	 * @param n Order.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> sph_bessel(unsigned n, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::sph_bessel(n, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::sph_bessel(n, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the first kind of order n.
+	 * @tparam Integer Integer type.
+	 * @param n Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, j_n(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double sph_bessel(unsigned n, Integer x) noexcept
+	{
+		return ccm::sph_bessel<double>(n, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the first kind of order n.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, j_n(x) is returned.
+	 */
+	constexpr float sph_besself(unsigned n, float x) noexcept
+	{
+		return ccm::sph_bessel<float>(n, x);
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the first kind of order n.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, j_n(x) is returned.
+	 */
+	constexpr long double sph_bessell(unsigned n, long double x) noexcept
+	{
+		return ccm::sph_bessel<long double>(n, x);
+	}
 
+	/**
+	 * @brief Computes the spherical Bessel functions of the first kind of every order up to n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest order.
+	 * @param x Floating-point number.
+	 * @param out Receives j_0(x) to j_{n_max}(x), n_max + 1 values. For x > n_max they are the same as sph_bessel
+	 * returns for that order. Below that the downward recurrence starts above n_max rather than above each order. They
+	 * are still within about 20 ulp of the envelope, but can differ from sph_bessel by far more ulp of the value near a
+	 * zero, about 980 ulp for j_28(199) from sph_bessel_all(200, 199.0, out), where j_28 is a fiftieth of its envelope.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_bessel_all(unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::sph_bessel_all_gen<T>(n_max, x, out);
+	}
 } // namespace ccm
@@ -10,7 +10,96 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/sph_legendre_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/legendre.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the spherical harmonic of degree l and order m at polar angle theta and azimuth 0.
+	 * @tparam T Floating-point type.
+	 * @param l Degree.
+	 * @param m Order.
+	 * @param theta Floating-point number.
+	 * @return If no errors occur, Y_l^m(theta, 0) with the Condon-Shortley phase is returned, 0 for m > l. Infinite and NaN
+	 * angles give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double with the recurrence of the normalized functions, so large degrees and orders do not overflow.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_legendre(unsigned l, unsigned m, T theta) noexcept
+	{
+		return ccm::gen::sph_legendre_gen<T>(l, m, theta);
+	}
+
+	/**
+	 * @brief Computes the spherical harmonic of degree l and order m at polar angle theta and azimuth 0 of every lane.
+	 * @param l Degree.
+	 * @param m Order.
+	 * @param theta Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> sph_legendre(unsigned l, unsigned m, intrin::simd<T, Abi> const & theta)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::sph_legendre(l, m, theta); }
+		else { return intrin::lanewise([=](T theta_lane) { return ccm::sph_legendre(l, m, theta_lane); }, theta); }
+	}
+
+	/**
+	 * @brief Computes the spherical harmonic of degree l and order m at polar angle theta and azimuth 0.
+	 * @tparam Integer Integer type.
+	 * @param l Degree.
+	 * @param m Order.
+	 * @param theta Integer number.
+	 * @return If no errors occur, Y_l^m(theta, 0) with the Condon-Shortley phase is returned, 0 for m > l.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double sph_legendre(unsigned l, unsigned m, Integer theta) noexcept
+	{
+		return ccm::sph_legendre<double>(l, m, static_cast<double>(theta));
+	}
+
+	/**
+	 * @brief Computes the spherical harmonic of degree l and order m at polar angle theta and azimuth 0.
+	 * @param l Degree.
+	 * @param m Order.
+	 * @param theta Floating-point number.
+	 * @return If no errors occur, Y_l^m(theta, 0) with the Condon-Shortley phase is returned, 0 for m > l.
+	 */
+	constexpr float sph_legendref(unsigned l, unsigned m, float theta) noexcept
+	{
+		return ccm::sph_legendre<float>(l, m, theta);
+	}
+
+	/**
+	 * @brief Computes the spherical harmonic of degree l and order m at polar angle theta and azimuth 0.
+	 * @param l Degree.
+	 * @param m Order.
+	 * @param theta Floating-point number.
+	 * @return If no errors occur, Y_l^m(theta, 0) with the Condon-Shortley phase is returned, 0 for m > l.
+	 */
+	constexpr long double sph_legendrel(unsigned l, unsigned m, long double theta) noexcept
+	{
+		return ccm::sph_legendre<long double>(l, m, theta);
+	}
 
+	/**
+	 * @brief Computes the spherical harmonics of every degree up to l_max and order m at polar angle theta and azimuth 0 in
+	 * one pass.
+	 * @tparam T Floating-point type.
+	 * @param l_max Highest degree.
+	 * @param m Order.
+	 * @param theta Floating-point number.
+	 * @param out Receives Y_0^m(theta, 0) to Y_{l_max}^m(theta, 0), the ones below m being 0, l_max + 1 values. Each one is
+	 * the same as sph_legendre returns for that degree.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_legendre_all(unsigned l_max, unsigned m, T theta, T * out) noexcept
+	{
+		ccm::gen::sph_legendre_all_gen<T>(l_max, m, theta, out);
+	}
 } // namespace ccm
@@ -10,7 +10,90 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/special/sph_neumann_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sph_bessel.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the spherical Bessel function of the second kind of order n.
+	 * @tparam T Floating-point type.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, y_n(x) is returned. 0 gives -∞ and negative arguments give NaN.
+	 *
+	 * The same implementation runs at compile time and at run time, so both give the same result. It is evaluated in
+	 * double, upwards from y_0 and y_1. For orders up to 200 the error is within about 60 ulp of the envelope
+	 * sqrt(j_n(x)^2 + y_n(x)^2). Away from the zeros of y_n that is commonly under 10 ulp of the value and seldom over
+	 * 40, and near a zero it grows without bound relative to the value.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sph_neumann(unsigned n, T x) noexcept
+	{
+		return ccm::gen::sph_neumann_gen<T>(n, x);
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the second kind of order n of every lane.
+	 * @param n Order.
+	 * @param x Lanes to evaluate.
+	 */
+	template <typename T, typename Abi>
+	intrin::simd<T, Abi> sph_neumann(unsigned n, intrin::simd<T, Abi> const & x)
+	{
+		// The vector kernel works on double lanes, other lanes are computed one at a time.
+		if constexpr (std::is_same_v<T, double>) { return intrin::sph_neumann(n, x); }
+		else { return intrin::lanewise([=](T x_lane) { return ccm::sph_neumann(n, x_lane); }, x); }
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the second kind of order n.
+	 * @tparam Integer Integer type.
+	 * @param n Order.
+	 * @param x Integer number.
+	 * @return If no errors occur, y_n(x) is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double sph_neumann(unsigned n, Integer x) noexcept
+	{
+		return ccm::sph_neumann<double>(n, static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the second kind of order n.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, y_n(x) is returned.
+	 */
+	constexpr float sph_neumannf(unsigned n, float x) noexcept
+	{
+		return ccm::sph_neumann<float>(n, x);
+	}
+
+	/**
+	 * @brief Computes the spherical Bessel function of the second kind of order n.
+	 * @param n Order.
+	 * @param x Floating-point number.
+	 * @return If no errors occur, y_n(x) is returned.
+	 */
+	constexpr long double sph_neumannl(unsigned n, long double x) noexcept
+	{
+		return ccm::sph_neumann<long double>(n, x);
+	}
 
+	/**
+	 * @brief Computes the spherical Bessel functions of the second kind of every order up to n_max in one pass.
+	 * @tparam T Floating-point type.
+	 * @param n_max Highest order.
+	 * @param x Floating-point number.
+	 * @param out Receives y_0(x) to y_{n_max}(x), n_max + 1 values. Each one is the same as sph_neumann returns for that
+	 * order.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sph_neumann_all(unsigned n_max, T x, T * out) noexcept
+	{
+		ccm::gen::sph_neumann_all_gen<T>(n_max, x, out);
+	}
 } // namespace ccm
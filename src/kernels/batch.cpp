@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include "ccmath/ext/basic.hpp"
+#include "ccmath/ext/batch_kernels.hpp"
+#include "ccmath/ext/special.hpp"
+
+#include <cstddef>
+
+/*
+ * Compiled once per instruction set, with CCM_KERNEL_ISA naming it, see ccmath/ext/batch_kernels.hpp.
+ *
+ * The array functions are inline templates, so every object has its own copy of them under the same names. If the
+ * table called those, the linker would keep the copy of any one level for all of them and an AVX-512 body could run
+ * on a CPU without it. The entries below have internal linkage and pull everything they call into themselves, so each
+ * table only reaches code built for its own level. That takes an optimized build, which ccm_add_isa_kernels asks for.
+ * MSVC has no flatten attribute, so ccm_add_isa_kernels builds only the baseline level there and no copies can mix.
+ */
+
+#ifndef CCM_KERNEL_ISA
+	#error "src/kernels/batch.cpp is built once per instruction set, with CCM_KERNEL_ISA naming it."
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define CCM_KERNEL_FLATTEN __attribute__((flatten))
+#else
+	#define CCM_KERNEL_FLATTEN
+#endif
+
+namespace ccm::ext::kernels::CCM_KERNEL_ISA
+{
+	namespace
+	{
+		template <typename T>
+		CCM_KERNEL_FLATTEN void fabs(T const * x, std::size_t n, T * out) noexcept
+		{
+			ext::fabs(x, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void copysign(T const * x, T const * y, std::size_t n, T * out) noexcept
+		{
+			ext::copysign(x, y, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void fmax(T const * x, T const * y, std::size_t n, T * out) noexcept
+		{
+			ext::fmax(x, y, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void fmin(T const * x, T const * y, std::size_t n, T * out) noexcept
+		{
+			ext::fmin(x, y, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void fdim(T const * x, T const * y, std::size_t n, T * out) noexcept
+		{
+			ext::fdim(x, y, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void fma(T const * x, T const * y, T const * z, std::size_t n, T * out) noexcept
+		{
+			ext::fma(x, y, z, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void erf(T const * x, std::size_t n, T * out) noexcept
+		{
+			ext::erf(x, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void erfc(T const * x, std::size_t n, T * out) noexcept
+		{
+			ext::erfc(x, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void tgamma(T const * x, std::size_t n, T * out) noexcept
+		{
+			ext::tgamma(x, n, out);
+		}
+
+		template <typename T>
+		CCM_KERNEL_FLATTEN void lgamma(T const * x, std::size_t n, T * out) noexcept
+		{
+			ext::lgamma(x, n, out);
+		}
+
+		template <typename T>
+		constexpr batch_functions<T> functions{&fabs<T>, &copysign<T>, &fmax<T>, &fmin<T>, &fdim<T>, &fma<T>, &erf<T>, &erfc<T>, &tgamma<T>, &lgamma<T>};
+	} // namespace
+
+	const batch_table table{functions<float>, functions<double>};
+} // namespace ccm::ext::kernels::CCM_KERNEL_ISA
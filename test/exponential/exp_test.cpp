@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cerrno>
 #include <cmath>
 #include <limits>
 #include "../../include/ccmath/math/numbers.hpp"
@@ -95,3 +96,57 @@ TEST(CcmathExponentialTests, Exp)
 
 
 }
+
+TEST(CcmathExponentialTests, Exp_PrecisionTiers)
+{
+	// The correctly rounded tier is usable in constant expressions.
+	static_assert(ccm::exp<ccm::precision::correctly_rounded>(0.5) == 0x1.a61298e1e069cp+0, "exp has failed testing that it is static_assert-able!");
+
+	// Reference values are e^x rounded to nearest from a multi-precision evaluation.
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-1.25), 0x1.25618372a584fp-2);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(10.0), 0x1.5829dcf950560p+14);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(0x1.4c6e00be9c224p+8), 0x1.82983d3f70e3fp+479);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-0x1.600e71dbde76cp+9), 0x1.21feaf1b1a3c5p-1016);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-740.0), 0x0.0000000000055p-1022);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(700.5), 0x1.8625c7d4f56c2p+1010);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(1e-10), 0x1.000000006df38p+0);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(0.0), 1.0);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-std::numeric_limits<double>::infinity()), 0.0);
+	EXPECT_TRUE(std::isnan(ccm::exp<ccm::precision::correctly_rounded>(std::numeric_limits<double>::quiet_NaN())));
+
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(0.5F), 0x1.a61298p+0F);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-3.25F), 0x1.3da368p-5F);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(20.0F), 0x1.ceb088p+28F);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(-90.0F), 0x1.1d85p-130F);
+	EXPECT_EQ(ccm::exp<ccm::precision::correctly_rounded>(88.5F), 0x1.99b988p+127F);
+
+	EXPECT_EQ(ccm::exp<ccm::precision::standard>(2.0), ccm::exp(2.0));
+
+	// The fast tier stays within a few ulp of the standard library.
+	for (double x = -700.0; x < 700.0; x += 0.8125)
+	{
+		const double expected = std::exp(x);
+		EXPECT_NEAR(ccm::exp<ccm::precision::fast>(x), expected, 4 * (std::nextafter(expected, HUGE_VAL) - expected)) << "x = " << x;
+	}
+	for (float x = -80.0F; x < 80.0F; x += 0.0625F)
+	{
+		const float expected = std::exp(x);
+		EXPECT_NEAR(ccm::exp<ccm::precision::fast>(x), expected, 4 * (std::nextafter(expected, HUGE_VALF) - expected)) << "x = " << x;
+	}
+}
+
+TEST(CcmathExponentialTests, Exp_NoErrnoPolicy)
+{
+	static_assert(ccm::exp<ccm::policy::no_errno>(0.0) == 1.0, "exp has failed testing that it is static_assert-able!");
+
+	EXPECT_NEAR(ccm::exp<ccm::policy::no_errno>(1.5), std::exp(1.5), 1e-15);
+	EXPECT_NEAR(ccm::exp<ccm::policy::no_errno>(-2.25F), std::exp(-2.25F), 1e-7F);
+	EXPECT_EQ(ccm::exp<ccm::policy::no_errno>(-std::numeric_limits<double>::infinity()), 0.0);
+	EXPECT_EQ(ccm::exp<ccm::policy::default_errno>(2.0), ccm::exp(2.0));
+
+	errno = 0;
+	volatile double large = 1000.0;
+	EXPECT_EQ(ccm::exp<ccm::policy::no_errno>(static_cast<double>(large)), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::exp<ccm::policy::no_errno>(-static_cast<double>(large)), 0.0);
+	EXPECT_EQ(errno, 0);
+}
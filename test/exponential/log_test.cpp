@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cerrno>
 #include <cmath>
 #include <limits>
 #include "ccmath/ccmath.hpp"
@@ -57,3 +58,45 @@ TEST(CcmathExponentialTests, Log)
 
 
 }
+
+TEST(CcmathExponentialTests, Log_PrecisionTiers)
+{
+	// The correctly rounded tier is usable in constant expressions.
+	static_assert(ccm::log<ccm::precision::correctly_rounded>(10.0) == 0x1.26bb1bbb55516p+1, "log has failed testing that it is static_assert-able!");
+
+	// Reference values are log(x) rounded to nearest from a multi-precision evaluation.
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(0.5), -0x1.62e42fefa39efp-1);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1.37), 0x1.425dbf202b876p-2);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(0x1.5f97da42d241bp+0), 0x1.44e995da96ef4p-2);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1e-300), -0x1.5963447f87fb5p+9);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(5e-324), -0x1.74385446d71c3p+9);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1.0000001), 0x1.ad7f2847b6492p-24);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1e300), 0x1.5963447f87fb5p+9);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1.0), 0.0);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::log<ccm::precision::correctly_rounded>(-1.0)));
+
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(0.1F), -0x1.26bb1cp+1F);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(3.0F), 0x1.193ea8p+0F);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1e-40F), -0x1.7069e4p+6F);
+	EXPECT_EQ(ccm::log<ccm::precision::correctly_rounded>(1e30F), 0x1.144f6ap+6F);
+
+	EXPECT_EQ(ccm::log<ccm::precision::fast>(2.0), ccm::log(2.0));
+	EXPECT_EQ(ccm::log<ccm::precision::standard>(2.0F), ccm::log(2.0F));
+}
+
+TEST(CcmathExponentialTests, Log_NoErrnoPolicy)
+{
+	static_assert(ccm::log<ccm::policy::no_errno>(1.0) == 0.0, "log has failed testing that it is static_assert-able!");
+
+	EXPECT_EQ(ccm::log<ccm::policy::no_errno>(2.0), std::log(2.0));
+	EXPECT_EQ(ccm::log<ccm::policy::no_errno>(10.0F), std::log(10.0F));
+	EXPECT_EQ(ccm::log<ccm::policy::no_errno>(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::log<ccm::policy::default_errno>(3.0), ccm::log(3.0));
+
+	errno = 0;
+	volatile double zero = 0.0;
+	EXPECT_EQ(ccm::log<ccm::policy::no_errno>(static_cast<double>(zero)), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::log<ccm::policy::no_errno>(static_cast<double>(zero) - 1.0)));
+	EXPECT_EQ(errno, 0);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/basic.hpp"
+#include "ccmath/math/basic/fabs.hpp"
+#include "ccmath/math/basic/fdim.hpp"
+#include "ccmath/math/basic/fma.hpp"
+#include "ccmath/math/basic/max.hpp"
+#include "ccmath/math/basic/min.hpp"
+#include "ccmath/math/fmanip/copysign.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Random values with every pair of special values mixed in, so both operands take each of them in turn.
+	template <typename T>
+	void basic_input(std::size_t n, std::vector<T> & x, std::vector<T> & y)
+	{
+		const std::vector<T> special{T(0),
+									 -T(0),
+									 T(1),
+									 T(-1),
+									 std::numeric_limits<T>::infinity(),
+									 -std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(),
+									 -std::numeric_limits<T>::quiet_NaN(),
+									 std::numeric_limits<T>::denorm_min(),
+									 -std::numeric_limits<T>::max()};
+		std::mt19937_64 rng(29);
+		std::uniform_real_distribution<double> dist(-4.0, 4.0);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			x.push_back(static_cast<T>(dist(rng)));
+			y.push_back(i % 4 == 0 ? x.back() : static_cast<T>(dist(rng)));
+		}
+		for (const T a : special)
+		{
+			for (const T b : special)
+			{
+				x.push_back(a);
+				y.push_back(b);
+			}
+		}
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	template <typename T>
+	void check_basic_arrays()
+	{
+		std::vector<T> x;
+		std::vector<T> y;
+		basic_input<T>(1001, x, y);
+		const auto count = x.size();
+		std::vector<T> out(count);
+
+		ccm::ext::fabs(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fabs(x[i]))) << "x = " << x[i]; }
+		ccm::ext::copysign(x.data(), y.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::copysign(x[i], y[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+		ccm::ext::fmax(x.data(), y.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fmax(x[i], y[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+		ccm::ext::fmin(x.data(), y.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fmin(x[i], y[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+		ccm::ext::fdim(x.data(), y.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fdim(x[i], y[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+		ccm::ext::fma(x.data(), y.data(), x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], std::fma(x[i], y[i], x[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+
+		ccm::ext::fmax(x.data(), T(0), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fmax(x[i], T(0)))) << "x = " << x[i]; }
+		ccm::ext::fmin(x.data(), -T(0), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::fmin(x[i], -T(0)))) << "x = " << x[i]; }
+
+		// In place.
+		std::vector<T> z = x;
+		ccm::ext::fabs(z.data(), count, z.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(z[i], ccm::fabs(x[i]))) << "x = " << x[i]; }
+	}
+
+	template <typename T>
+	void check_signed_zero()
+	{
+		const T zero[2]{T(0), -T(0)};
+		const T zero_swapped[2]{-T(0), T(0)};
+		T out[2];
+
+		ccm::ext::fmax(zero, zero_swapped, 2, out);
+		EXPECT_FALSE(std::signbit(out[0]));
+		EXPECT_FALSE(std::signbit(out[1]));
+		ccm::ext::fmin(zero, zero_swapped, 2, out);
+		EXPECT_TRUE(std::signbit(out[0]));
+		EXPECT_TRUE(std::signbit(out[1]));
+		ccm::ext::fdim(zero, zero_swapped, 2, out);
+		EXPECT_FALSE(std::signbit(out[0]));
+		EXPECT_FALSE(std::signbit(out[1]));
+
+		EXPECT_FALSE(std::signbit(ccm::fmax(-T(0), T(0))));
+		EXPECT_FALSE(std::signbit(ccm::fmax(T(0), -T(0))));
+		EXPECT_TRUE(std::signbit(ccm::fmin(-T(0), T(0))));
+		EXPECT_TRUE(std::signbit(ccm::fmin(T(0), -T(0))));
+	}
+} // namespace
+
+TEST(CcmathExtTests, Basic_Double_MatchesScalar)
+{
+	check_basic_arrays<double>();
+	check_signed_zero<double>();
+}
+
+TEST(CcmathExtTests, Basic_Float_MatchesScalar)
+{
+	check_basic_arrays<float>();
+	check_signed_zero<float>();
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/basic.hpp"
+#include "ccmath/ext/batch_kernels.hpp"
+#include "ccmath/ext/special.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> kernel_input(std::size_t n, std::uint64_t seed)
+	{
+		std::mt19937_64 rng(seed);
+		std::uniform_real_distribution<double> dist(-30.0, 30.0);
+		std::vector<T> values(n);
+		for (auto & v : values) { v = static_cast<T>(dist(rng)); }
+		values.insert(values.end(), {T(0), -T(0), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min()});
+		return values;
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	// The special functions may round their last bit differently where the level has an FMA instruction.
+	template <typename T>
+	bool close_value(T a, T b)
+	{
+		if (same_value(a, b)) { return true; }
+		return std::fabs(a - b) <= std::fabs(b) * T(4) * std::numeric_limits<T>::epsilon();
+	}
+
+	template <typename T, typename Ref, typename Cmp>
+	void check_unary(typename ccm::ext::kernels::batch_functions<T>::unary_fn fn, Ref && ref, Cmp && cmp)
+	{
+		const auto x = kernel_input<T>(517, 3);
+		std::vector<T> out(x.size());
+		std::vector<T> expected(x.size());
+		fn(x.data(), x.size(), out.data());
+		ref(x.data(), x.size(), expected.data());
+		for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_TRUE(cmp(out[i], expected[i])) << "x = " << x[i]; }
+	}
+
+	template <typename T, typename Ref>
+	void check_binary(typename ccm::ext::kernels::batch_functions<T>::binary_fn fn, Ref && ref)
+	{
+		const auto x = kernel_input<T>(517, 3);
+		const auto y = kernel_input<T>(517, 5);
+		std::vector<T> out(x.size());
+		std::vector<T> expected(x.size());
+		fn(x.data(), y.data(), x.size(), out.data());
+		ref(x.data(), y.data(), x.size(), expected.data());
+		for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_TRUE(same_value(out[i], expected[i])) << "x = " << x[i] << ", y = " << y[i]; }
+	}
+
+	template <typename T>
+	void check_functions(ccm::ext::kernels::batch_functions<T> const & f)
+	{
+		check_unary<T>(f.fabs, [](T const * x, std::size_t n, T * out) { ccm::ext::fabs(x, n, out); }, same_value<T>);
+		check_binary<T>(f.copysign, [](T const * x, T const * y, std::size_t n, T * out) { ccm::ext::copysign(x, y, n, out); });
+		check_binary<T>(f.fmax, [](T const * x, T const * y, std::size_t n, T * out) { ccm::ext::fmax(x, y, n, out); });
+		check_binary<T>(f.fmin, [](T const * x, T const * y, std::size_t n, T * out) { ccm::ext::fmin(x, y, n, out); });
+		check_binary<T>(f.fdim, [](T const * x, T const * y, std::size_t n, T * out) { ccm::ext::fdim(x, y, n, out); });
+		check_unary<T>(f.erf, [](T const * x, std::size_t n, T * out) { ccm::ext::erf(x, n, out); }, close_value<T>);
+		check_unary<T>(f.erfc, [](T const * x, std::size_t n, T * out) { ccm::ext::erfc(x, n, out); }, close_value<T>);
+		check_unary<T>(f.tgamma, [](T const * x, std::size_t n, T * out) { ccm::ext::tgamma(x, n, out); }, close_value<T>);
+		check_unary<T>(f.lgamma, [](T const * x, std::size_t n, T * out) { ccm::ext::lgamma(x, n, out); }, close_value<T>);
+
+		const auto x = kernel_input<T>(517, 3);
+		const auto y = kernel_input<T>(517, 5);
+		std::vector<T> out(x.size());
+		f.fma(x.data(), y.data(), x.data(), x.size(), out.data());
+		for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_TRUE(same_value(out[i], std::fma(x[i], y[i], x[i]))) << "x = " << x[i] << ", y = " << y[i]; }
+	}
+
+	void check_table(ccm::ext::kernels::batch_table const & table)
+	{
+		check_functions(table.f32);
+		check_functions(table.f64);
+	}
+
+	bool cpu_supports([[maybe_unused]] const char * isa)
+	{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		if (std::strcmp(isa, "avx2") == 0) { return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("bmi2"); }
+		if (std::strcmp(isa, "avx512") == 0)
+		{
+			return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq") &&
+				   __builtin_cpu_supports("avx512bw");
+		}
+#endif
+		return std::strcmp(isa, "sse2") == 0 || std::strcmp(isa, "neon") == 0;
+	}
+} // namespace
+
+#ifdef CCM_CONFIG_KERNELS_HAS_SSE2
+TEST(CcmathExtTests, BatchKernels_Sse2)
+{
+	check_table(ccm::ext::kernels::sse2::table);
+}
+#endif
+
+#ifdef CCM_CONFIG_KERNELS_HAS_AVX2
+TEST(CcmathExtTests, BatchKernels_Avx2)
+{
+	if (!cpu_supports("avx2")) { GTEST_SKIP() << "The CPU does not support AVX2."; }
+	check_table(ccm::ext::kernels::avx2::table);
+}
+#endif
+
+#ifdef CCM_CONFIG_KERNELS_HAS_AVX512
+TEST(CcmathExtTests, BatchKernels_Avx512)
+{
+	if (!cpu_supports("avx512")) { GTEST_SKIP() << "The CPU does not support AVX-512."; }
+	check_table(ccm::ext::kernels::avx512::table);
+}
+#endif
+
+#ifdef CCM_CONFIG_KERNELS_HAS_NEON
+TEST(CcmathExtTests, BatchKernels_Neon)
+{
+	check_table(ccm::ext::kernels::neon::table);
+}
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/compensated.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Pairs of large values that cancel, hiding small integers whose sum is the exact result.
+	// Every rounding error is an integer, so double-double arithmetic recovers the sum exactly.
+	std::vector<double> cancelling_values(std::size_t pairs, std::mt19937_64 & rng, double & exact)
+	{
+		std::uniform_real_distribution<double> large(0x1.0p60, 0x1.0p61);
+		std::uniform_int_distribution<int> small(-1000, 1000);
+		std::vector<double> values;
+		exact = 0.0;
+		for (std::size_t i = 0; i < pairs; ++i)
+		{
+			const double v = large(rng);
+			const double s = small(rng);
+			values.push_back(v);
+			values.push_back(-v);
+			values.push_back(s);
+			exact += s;
+		}
+		std::shuffle(values.begin(), values.end(), rng);
+		return values;
+	}
+} // namespace
+
+TEST(CcmathExtTests, CompensatedSum)
+{
+	std::mt19937_64 rng(2024);
+	for (std::size_t pairs : {1, 2, 3, 5, 50, 333})
+	{
+		double exact	  = 0.0;
+		const auto values = cancelling_values(pairs, rng, exact);
+		EXPECT_EQ(ccm::ext::compensated_sum(values), exact) << pairs;
+	}
+
+	constexpr std::array<double, 5> values = {{0x1.0p60, 1.0, -0x1.0p60, 0.5, 0x1.0p-60}};
+	static_assert(ccm::ext::compensated_sum(values) == 1.5);
+
+	const std::vector<double> with_inf = {1.0, std::numeric_limits<double>::infinity(), 2.0, 3.0, 4.0};
+	EXPECT_EQ(ccm::ext::compensated_sum(with_inf), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::ext::compensated_sum(std::vector<double>{1.0, std::nan(""), 2.0})));
+	EXPECT_EQ(ccm::ext::compensated_sum(std::vector<double>{}), 0.0);
+}
+
+TEST(CcmathExtTests, CompensatedDot)
+{
+	std::mt19937_64 rng(77);
+	std::uniform_int_distribution<int> mantissa(-(1 << 25), 1 << 25);
+	std::uniform_int_distribution<int> small(-1000, 1000);
+	for (std::size_t n : {1, 4, 7, 64, 1001})
+	{
+		// x * y and -x * y cancel exactly; the small products survive.
+		std::vector<double> x;
+		std::vector<double> y;
+		double exact = 0.0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const double a = std::ldexp(mantissa(rng), 10);
+			const double b = std::ldexp(mantissa(rng), 10);
+			const double s = small(rng);
+			x.insert(x.end(), {a, a, s});
+			y.insert(y.end(), {b, -b, 3.0});
+			exact += 3.0 * s;
+		}
+		EXPECT_EQ(ccm::ext::compensated_dot(x, y), exact) << n;
+	}
+
+	// The rounding error of each product has to be kept: (1 + 2^-30)(1 - 2^-30) = 1 - 2^-60.
+	std::vector<double> x(9, 1.0 + 0x1.0p-30);
+	std::vector<double> y(9, 1.0 - 0x1.0p-30);
+	x.push_back(-9.0);
+	y.push_back(1.0);
+	EXPECT_EQ(ccm::ext::compensated_dot(x, y), -9 * 0x1.0p-60);
+}
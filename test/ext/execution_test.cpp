@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/basic.hpp"
+#include "ccmath/ext/execution.hpp"
+#include "ccmath/ext/expo.hpp"
+#include "ccmath/ext/expr.hpp"
+#include "ccmath/ext/reduce.hpp"
+#include "ccmath/ext/special.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST(CcmathExtTests, Execution_BlocksCoverRangeOnce)
+{
+	constexpr std::size_t n = 100003;
+	std::vector<double> out(n);
+	std::vector<std::atomic<int>> hits(n);
+
+	const ccm::ext::execution::parallel_policy policy{4, 1024};
+	ccm::ext::execution::for_each_block(policy, out.data(), n,
+										[&](std::size_t begin, std::size_t end)
+										{
+											// Every block except the first starts on a cache line of the output.
+											if (begin != 0) { EXPECT_EQ(reinterpret_cast<std::uintptr_t>(out.data() + begin) % 64, 0U); }
+											for (std::size_t i = begin; i < end; ++i) { ++hits[i]; }
+										});
+
+	for (std::size_t i = 0; i < n; ++i) { EXPECT_EQ(hits[i].load(), 1); }
+}
+
+TEST(CcmathExtTests, Execution_SmallRangeRunsOnce)
+{
+	std::vector<float> out(10);
+	int calls = 0;
+
+	ccm::ext::execution::for_each_block(ccm::ext::execution::par, out.data(), out.size(),
+										[&](std::size_t begin, std::size_t end)
+										{
+											++calls;
+											EXPECT_EQ(begin, 0U);
+											EXPECT_EQ(end, 10U);
+										});
+
+	EXPECT_EQ(calls, 1);
+}
+
+TEST(CcmathExtTests, Execution_ThrowingBlockJoinsAndRethrows)
+{
+	constexpr std::size_t n = 100003;
+	std::vector<double> out(n);
+	std::vector<std::atomic<int>> hits(n);
+
+	// First the last block, on a worker, throws and then the first, on the calling thread. The other blocks still run.
+	const ccm::ext::execution::parallel_policy policy{4, 1024};
+	const auto run = [&](std::size_t thrower)
+	{
+		ccm::ext::execution::for_each_block(policy, out.data(), n,
+											[&](std::size_t begin, std::size_t end)
+											{
+												for (std::size_t i = begin; i < end; ++i) { ++hits[i]; }
+												if (begin <= thrower && thrower < end) { throw std::runtime_error("block"); }
+											});
+	};
+	EXPECT_THROW(run(n - 1), std::runtime_error);
+	EXPECT_THROW(run(0), std::runtime_error);
+
+	for (std::size_t i = 0; i < n; ++i) { EXPECT_EQ(hits[i].load(), 2); }
+}
+
+TEST(CcmathExtTests, Execution_ParallelExprMatchesSequential)
+{
+	constexpr std::size_t n = 50001;
+	std::vector<double> x(n);
+	for (std::size_t i = 0; i < n; ++i) { x[i] = static_cast<double>(i) * 1e-3; }
+
+	std::vector<double> seq_out(n);
+	std::vector<double> par_out(n);
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::evaluate(ccm::ext::execution::seq, ccm::ext::expr::sqrt(vx) * 2.0 + vx, seq_out);
+	ccm::ext::expr::evaluate(ccm::ext::execution::parallel_policy{3, 256}, ccm::ext::expr::sqrt(vx) * 2.0 + vx, par_out);
+
+	for (std::size_t i = 0; i < n; ++i) { EXPECT_EQ(par_out[i], seq_out[i]); }
+	EXPECT_EQ(par_out[n - 1], std::sqrt(x[n - 1]) * 2.0 + x[n - 1]);
+}
+
+TEST(CcmathExtTests, Execution_ArrayFormsMatchSequential)
+{
+	constexpr std::size_t n = 10007;
+	std::vector<double> x(n);
+	std::vector<float> y(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = std::sin(static_cast<double>(i)) * 30.0;
+		y[i] = static_cast<float>(x[i]);
+	}
+
+	// Element-wise forms do not depend on where the blocks start.
+	const ccm::ext::execution::parallel_policy policy{3, 256};
+	std::vector<double> expected(n);
+	std::vector<double> out(n);
+	const auto check = [&](auto && sequential, auto && parallel)
+	{
+		sequential(expected.data());
+		parallel(out.data());
+		for (std::size_t i = 0; i < n; ++i) { EXPECT_EQ(std::memcmp(&out[i], &expected[i], sizeof(double)), 0) << "x = " << x[i]; }
+	};
+	check([&](double * o) { ccm::ext::exp(x.data(), n, o); }, [&](double * o) { ccm::ext::exp(policy, x.data(), n, o); });
+	check([&](double * o) { ccm::ext::log(x.data(), n, o); }, [&](double * o) { ccm::ext::log(policy, x.data(), n, o); });
+	check([&](double * o) { ccm::ext::fmax(x.data(), 1.0, n, o); }, [&](double * o) { ccm::ext::fmax(policy, x.data(), 1.0, n, o); });
+	check([&](double * o) { ccm::ext::fma(x.data(), x.data(), x.data(), n, o); }, [&](double * o) { ccm::ext::fma(policy, x.data(), x.data(), x.data(), n, o); });
+	check([&](double * o) { ccm::ext::tgamma(x.data(), n, o); }, [&](double * o) { ccm::ext::tgamma(policy, x.data(), n, o); });
+	check([&](double * o) { ccm::ext::legendre(7, x.data(), n, o); }, [&](double * o) { ccm::ext::legendre(ccm::ext::execution::seq, 7, x.data(), n, o); });
+	check([&](double * o) { ccm::ext::cyl_bessel_j(2.5, x.data(), n, o); }, [&](double * o) { ccm::ext::cyl_bessel_j(policy, 2.5, x.data(), n, o); });
+
+	std::vector<float> expected_float(n);
+	std::vector<float> out_float(n);
+	ccm::ext::erf(y.data(), n, expected_float.data());
+	ccm::ext::erf(policy, y.data(), n, out_float.data());
+	for (std::size_t i = 0; i < n; ++i) { EXPECT_EQ(out_float[i], expected_float[i]) << "x = " << y[i]; }
+}
+
+TEST(CcmathExtTests, Execution_ReductionsAddBlocksInOrder)
+{
+	constexpr std::size_t n = 100003;
+	std::vector<double> x(n);
+	for (std::size_t i = 0; i < n; ++i) { x[i] = std::sin(static_cast<double>(i)) * std::ldexp(1.0, static_cast<int>(i % 40) - 20); }
+
+	const ccm::ext::execution::parallel_policy policy{4, 1024};
+	using ccm::ext::summation;
+
+	// The compensated modes are as accurate as twice the working precision, so splitting the array changes nothing.
+	EXPECT_EQ(ccm::ext::sum<summation::eNeumaier>(policy, x.data(), n), ccm::ext::sum<summation::eNeumaier>(x.data(), n));
+	EXPECT_EQ(ccm::ext::dot<summation::eDoubleDouble>(policy, x.data(), x.data(), n), ccm::ext::dot<summation::eDoubleDouble>(x.data(), x.data(), n));
+
+	const double pairwise = ccm::ext::sum(x.data(), n);
+	EXPECT_NEAR(ccm::ext::sum(policy, x.data(), n), pairwise, 1e-12 * ccm::ext::sum<summation::eNeumaier>(x.data(), n) + 1e-9);
+	EXPECT_NEAR(ccm::ext::norm2(policy, x.data(), n), ccm::ext::norm2(x.data(), n), 1e-12 * ccm::ext::norm2(x.data(), n));
+
+	// The largest magnitude, and with it the scale, comes from the last block here.
+	x[n - 1] = 1e300;
+	EXPECT_EQ(ccm::ext::hypot_n<summation::eNeumaier>(policy, x.data(), n), ccm::ext::hypot_n<summation::eNeumaier>(x.data(), n));
+	x[n / 2] = -std::numeric_limits<double>::infinity();
+	EXPECT_EQ(ccm::ext::hypot_n(policy, x.data(), n), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::ext::sum<summation::eNeumaier>(policy, x.data(), n), -std::numeric_limits<double>::infinity());
+}
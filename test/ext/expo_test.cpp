@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/expo.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> expo_input(std::size_t n, double lo, double hi)
+	{
+		std::mt19937_64 rng(29);
+		std::uniform_real_distribution<double> dist(lo, hi);
+		std::vector<T> values(n);
+		for (auto & v : values) { v = static_cast<T>(dist(rng)); }
+		return values;
+	}
+
+	template <typename T>
+	std::vector<T> special_values()
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		return {T(0), -T(0), T(1), T(-2), inf, -inf, std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(),
+				std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), T(-1000), T(1000), T(88.5), T(-100)};
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	// Within Ulps units in the last place of the reference, with NaN, infinities and zeros matching exactly.
+	template <typename T, typename Array, typename Reference>
+	void check_accuracy(std::vector<T> const & x, int ulps, Array && array, Reference && reference)
+	{
+		std::vector<T> out(x.size());
+		array(x.data(), x.size(), out.data());
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			const T r = static_cast<T>(reference(static_cast<long double>(x[i])));
+			if (std::isnan(r) || std::isinf(r) || r == T(0)) { EXPECT_TRUE(same_value(out[i], r)) << "x = " << x[i]; }
+			else
+			{
+				const T ulp = std::nextafter(std::fabs(r), std::numeric_limits<T>::infinity()) - std::fabs(r);
+				EXPECT_LE(std::fabs(out[i] - r), static_cast<T>(ulps) * ulp) << "x = " << x[i];
+			}
+		}
+	}
+
+	// A special element sends its block down the masked path, which must not change the other elements of the block.
+	template <typename T, typename Array>
+	void check_paths_agree(std::vector<T> const & x, Array && array)
+	{
+		std::vector<T> lean(x.size());
+		array(x.data(), x.size(), lean.data());
+
+		for (const T special : special_values<T>())
+		{
+			std::vector<T> y = x;
+			for (std::size_t i = 0; i < y.size(); i += 37) { y[i] = special; }
+			std::vector<T> careful(y.size());
+			array(y.data(), y.size(), careful.data());
+			for (std::size_t i = 0; i < y.size(); ++i)
+			{
+				if (i % 37 != 0) { EXPECT_TRUE(same_value(careful[i], lean[i])) << "x = " << x[i] << " next to " << special; }
+			}
+		}
+	}
+
+	template <typename T>
+	void check_expo_arrays()
+	{
+		auto x = expo_input<T>(1001, -80.0, 80.0);
+		auto l = expo_input<T>(1001, 1e-30, 1e30);
+		for (const T special : special_values<T>())
+		{
+			x.push_back(special);
+			l.push_back(special);
+		}
+
+		check_accuracy(x, 1, [](T const * p, std::size_t n, T * o) { ccm::ext::exp(p, n, o); }, [](long double v) { return std::exp(v); });
+		check_accuracy(x, 1, [](T const * p, std::size_t n, T * o) { ccm::ext::exp2(p, n, o); }, [](long double v) { return std::exp2(v); });
+		check_accuracy(l, 1, [](T const * p, std::size_t n, T * o) { ccm::ext::log(p, n, o); }, [](long double v) { return std::log(v); });
+
+		check_paths_agree(expo_input<T>(1001, -80.0, 80.0), [](T const * p, std::size_t n, T * o) { ccm::ext::exp(p, n, o); });
+		check_paths_agree(expo_input<T>(1001, -120.0, 120.0), [](T const * p, std::size_t n, T * o) { ccm::ext::exp2(p, n, o); });
+		check_paths_agree(expo_input<T>(1001, 1e-30, 1e30), [](T const * p, std::size_t n, T * o) { ccm::ext::log(p, n, o); });
+	}
+} // namespace
+
+TEST(CcmathExtTests, Expo_Float)
+{
+	check_expo_arrays<float>();
+}
+
+TEST(CcmathExtTests, Expo_Double)
+{
+	check_expo_arrays<double>();
+}
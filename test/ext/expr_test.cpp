@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/basic.hpp"
+#include "ccmath/ext/expo.hpp"
+#include "ccmath/ext/expr.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> make_input(std::size_t n)
+	{
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i) { values[i] = static_cast<T>(0.25) * static_cast<T>(i) - static_cast<T>(3); }
+		return values;
+	}
+} // namespace
+
+TEST(CcmathExtTests, Expr_Arithmetic_Double)
+{
+	// 37 elements exercises both the vector body and the scalar tail.
+	const auto x = make_input<double>(37);
+	const auto y = make_input<double>(37);
+	std::vector<double> out(37);
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::array_view vy{y};
+	ccm::ext::expr::evaluate(2.0 * vx * vy - vx / 4.0 + 1.0, out);
+
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], 2.0 * x[i] * y[i] - x[i] / 4.0 + 1.0); }
+}
+
+TEST(CcmathExtTests, Expr_Functions_Float)
+{
+	const auto x = make_input<float>(29);
+	std::vector<float> out(29);
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::evaluate(ccm::ext::expr::exp(-0.5F * vx * vx) + ccm::ext::expr::sqrt(ccm::ext::expr::fabs(vx)), out);
+
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_FLOAT_EQ(out[i], std::exp(-0.5F * x[i] * x[i]) + std::sqrt(std::fabs(x[i]))); }
+}
+
+TEST(CcmathExtTests, Expr_Binary_Functions)
+{
+	const std::array<double, 6> x{-2.0, -0.5, 0.0, 1.0, 3.0, 9.0};
+	const std::array<double, 6> y{1.0, -1.0, 2.0, 0.5, 3.0, -4.0};
+	std::array<double, 6> out{};
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::array_view vy{y};
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::fmax(vx, vy), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], std::fmax(x[i], y[i])); }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::fma(vx, vy, 1.0), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], std::fma(x[i], y[i], 1.0)); }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::pow(ccm::ext::expr::fabs(vx), 2.0), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_DOUBLE_EQ(out[i], std::pow(std::fabs(x[i]), 2.0)); }
+
+	// cbrt and hypot have vector kernels that match the scalar functions exactly.
+	ccm::ext::expr::evaluate(ccm::ext::expr::hypot(vx, vy), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], ccm::hypot(x[i], y[i])); }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::cbrt(vx * vy), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], ccm::cbrt(x[i] * y[i])); }
+}
+
+TEST(CcmathExtTests, Expr_Kernels_MatchArrayForms)
+{
+	// exp, exp2, log, fabs, fmin and fmax run the vector kernels of the array forms, the tail in a padded block.
+	const auto x = make_input<double>(37);
+	const auto y = make_input<double>(37);
+	std::vector<double> out(37);
+	std::vector<double> expected(37);
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::array_view vy{y};
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::exp(vx), out);
+	ccm::ext::exp(x.data(), x.size(), expected.data());
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], expected[i]) << "x = " << x[i]; }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::exp2(vx), out);
+	ccm::ext::exp2(x.data(), x.size(), expected.data());
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], expected[i]) << "x = " << x[i]; }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::log(ccm::ext::expr::fabs(vx)), out);
+	ccm::ext::fabs(x.data(), x.size(), expected.data());
+	ccm::ext::log(expected.data(), expected.size(), expected.data());
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], expected[i]) << "x = " << x[i]; }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::fmin(vx, 0.5 - vy), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], ccm::fmin(x[i], 0.5 - y[i])) << "x = " << x[i]; }
+
+	ccm::ext::expr::evaluate(ccm::ext::expr::fmax(vx, 0.5 - vy), out);
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(out[i], ccm::fmax(x[i], 0.5 - y[i])) << "x = " << x[i]; }
+}
+
+TEST(CcmathExtTests, Expr_InPlace)
+{
+	auto x				 = make_input<double>(19);
+	const auto reference = x;
+
+	ccm::ext::expr::array_view vx{x};
+	ccm::ext::expr::evaluate(-vx * vx, x.data());
+
+	for (std::size_t i = 0; i < x.size(); ++i) { EXPECT_EQ(x[i], -reference[i] * reference[i]); }
+}
+
+TEST(CcmathExtTests, Expr_IsLazy)
+{
+	const std::array<double, 4> x{1.0, 2.0, 3.0, 4.0};
+	ccm::ext::expr::array_view vx{x};
+
+	constexpr auto is_expr = ccm::ext::expr::is_expression_v<decltype(vx * vx + 1.0)>;
+	EXPECT_TRUE(is_expr);
+	EXPECT_EQ((vx * vx + 1.0).size(), x.size());
+	EXPECT_EQ((vx * vx + 1.0).eval(2), 10.0);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/fmanip.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Random bit patterns, a share of them subnormal, followed by the special values.
+	template <typename T, typename Bits>
+	std::vector<T> fmanip_input(std::size_t n)
+	{
+		std::mt19937_64 rng(17);
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			auto bits = static_cast<Bits>(rng());
+			if (i % 4 == 0) { bits &= static_cast<Bits>(~Bits(0) >> 12U); }
+			std::memcpy(&values[i], &bits, sizeof(T));
+		}
+		values.insert(values.end(), {T(0), -T(0), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max()});
+		return values;
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	template <typename T, typename Bits>
+	void check_fmanip_arrays()
+	{
+		const auto x	 = fmanip_input<T, Bits>(1003);
+		const auto count = x.size();
+
+		std::vector<T> mantissa(count);
+		std::vector<int> exp(count);
+		ccm::ext::frexp(x.data(), count, mantissa.data(), exp.data());
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			int expected_exp	  = 0;
+			const T expected_frac = std::frexp(x[i], &expected_exp);
+			EXPECT_TRUE(same_value(mantissa[i], expected_frac)) << "x = " << x[i];
+			if (std::isfinite(x[i])) { EXPECT_EQ(exp[i], expected_exp) << "x = " << x[i]; }
+		}
+
+		std::mt19937 rng(3);
+		std::uniform_int_distribution<int> wide(-2500, 2500);
+		std::uniform_int_distribution<int> narrow(-150, 150);
+		std::vector<int> powers(count);
+		for (std::size_t i = 0; i < count; ++i) { powers[i] = i % 8 == 0 ? wide(rng) : narrow(rng); }
+
+		std::vector<T> out(count);
+		ccm::ext::ldexp(x.data(), powers.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], std::ldexp(x[i], powers[i]))) << x[i] << " * 2^" << powers[i]; }
+
+		ccm::ext::scalbn(x.data(), count, -37, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], std::scalbn(x[i], -37))) << "x = " << x[i]; }
+
+		ccm::ext::logb(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], std::logb(x[i]))) << "x = " << x[i]; }
+
+		std::vector<int> ilogb(count);
+		ccm::ext::ilogb(x.data(), count, ilogb.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_EQ(ilogb[i], std::ilogb(x[i])) << "x = " << x[i]; }
+	}
+} // namespace
+
+TEST(CcmathExtTests, Fmanip_Arrays_Float)
+{
+	check_fmanip_arrays<float, std::uint32_t>();
+}
+
+TEST(CcmathExtTests, Fmanip_Arrays_Double)
+{
+	check_fmanip_arrays<double, std::uint64_t>();
+}
+
+TEST(CcmathExtTests, Fmanip_Arrays_InPlace)
+{
+	std::vector<double> values{0.75, 3.0, -1e-310, 1e300, 5.0};
+	std::vector<int> exp(values.size());
+	ccm::ext::frexp(values.data(), values.size(), values.data(), exp.data());
+	ccm::ext::ldexp(values.data(), exp.data(), values.size(), values.data());
+	EXPECT_EQ(values, (std::vector<double>{0.75, 3.0, -1e-310, 1e300, 5.0}));
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/clamp.hpp"
+#include "ccmath/ext/fract.hpp"
+#include "ccmath/ext/lerp.hpp"
+#include "ccmath/ext/lerp_smooth.hpp"
+#include "ccmath/ext/mix.hpp"
+#include "ccmath/ext/ping_pong.hpp"
+#include "ccmath/ext/smoothstep.hpp"
+#include "ccmath/math/misc/lerp.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Values around the unit interval, halves, large integral values and the special values.
+	template <typename T>
+	std::vector<T> interp_input(std::size_t n, unsigned seed)
+	{
+		std::mt19937_64 rng(seed);
+		std::uniform_real_distribution<double> dist(-2.0, 3.0);
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const double v = dist(rng);
+			values[i]	   = static_cast<T>(i % 7 == 0 ? std::round(v * 8.0) / 4.0 : (i % 11 == 0 ? v * 1.0e9 : v));
+		}
+		values.insert(values.end(), {T(0), -T(0), T(1), T(-0.5), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max()});
+		return values;
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	template <typename T>
+	void check_interp_arrays()
+	{
+		const auto x	 = interp_input<T>(1003, 5);
+		const auto y	 = interp_input<T>(1003, 6);
+		const auto a	 = interp_input<T>(1003, 7);
+		const auto count = x.size();
+		std::vector<T> out(count);
+
+		ccm::ext::mix(x.data(), y.data(), T(0.25), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::mix(x[i], y[i], T(0.25)))) << "x = " << x[i]; }
+		ccm::ext::mix(x.data(), y.data(), a.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::mix(x[i], y[i], a[i]))) << "a = " << a[i]; }
+		ccm::ext::lerp(x.data(), y.data(), T(0.75), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::lerp(x[i], y[i], T(0.75)))) << "x = " << x[i]; }
+		ccm::ext::lerp(x.data(), y.data(), a.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::lerp(x[i], y[i], a[i]))) << "t = " << a[i]; }
+		ccm::ext::clamp(x.data(), T(-1), T(2), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::clamp(x[i], T(-1), T(2)))) << "x = " << x[i]; }
+		ccm::ext::smoothstep(T(-0.5), T(1.5), x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::smoothstep(T(-0.5), T(1.5), x[i]))) << "x = " << x[i]; }
+		ccm::ext::fract(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::fract(x[i]))) << "x = " << x[i]; }
+		ccm::ext::ping_pong(x.data(), T(0.75), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::ping_pong(x[i], T(0.75)))) << "x = " << x[i]; }
+		ccm::ext::lerp_smooth(x.data(), y.data(), T(0.016), T(0.1), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::lerp_smooth(x[i], y[i], T(0.016), T(0.1)))) << "x = " << x[i]; }
+
+		// In place.
+		std::vector<T> z = x;
+		ccm::ext::mix(z.data(), y.data(), a.data(), count, z.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(z[i], ccm::ext::mix(x[i], y[i], a[i]))) << "x = " << x[i]; }
+	}
+
+	template <typename T>
+	void check_interp_lanes()
+	{
+		using simd_type				= ccm::intrin::native_simd<T>;
+		constexpr std::size_t width = simd_type::size();
+
+		const auto x = interp_input<T>(8 * width, 8);
+		const auto y = interp_input<T>(8 * width, 9);
+		const auto t = interp_input<T>(8 * width, 10);
+		T lanes[width];
+		for (std::size_t i = 0; i + width <= x.size(); i += width)
+		{
+			const simd_type vx(x.data() + i, ccm::intrin::element_aligned_tag());
+			const simd_type vy(y.data() + i, ccm::intrin::element_aligned_tag());
+			const simd_type vt(t.data() + i, ccm::intrin::element_aligned_tag());
+
+			ccm::lerp(vx, vy, vt).copy_to(lanes, ccm::intrin::element_aligned_tag());
+			for (std::size_t j = 0; j < width; ++j) { EXPECT_TRUE(same_value(lanes[j], ccm::lerp(x[i + j], y[i + j], t[i + j]))) << "t = " << t[i + j]; }
+
+			// intrin::exp2 may be a bit off ccm::exp2, the decay of lerp_smooth stays within a few ulp.
+			const T h = T(0.25);
+			ccm::ext::lerp_smooth(vx, vy, ccm::ext::clamp(vt, simd_type(T(0)), simd_type(T(4))), simd_type(h)).copy_to(lanes, ccm::intrin::element_aligned_tag());
+			for (std::size_t j = 0; j < width; ++j)
+			{
+				const T dt		 = ccm::ext::clamp(t[i + j], T(0), T(4));
+				const T expected = ccm::ext::lerp_smooth(x[i + j], y[i + j], dt, h);
+				if (std::isnan(expected) || std::isinf(expected)) { EXPECT_TRUE(same_value(lanes[j], expected)) << "x = " << x[i + j]; }
+				else
+				{
+					const T scale = std::fabs(x[i + j]) + std::fabs(y[i + j]);
+					EXPECT_LE(std::fabs(lanes[j] - expected), T(4) * std::numeric_limits<T>::epsilon() * scale) << "x = " << x[i + j] << " t = " << dt;
+				}
+			}
+		}
+	}
+} // namespace
+
+TEST(CcmathExtTests, Interp_Double_MatchesScalar)
+{
+	check_interp_arrays<double>();
+	check_interp_lanes<double>();
+}
+
+TEST(CcmathExtTests, Interp_Float_MatchesScalar)
+{
+	check_interp_arrays<float>();
+	check_interp_lanes<float>();
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/polyfit.hpp"
+#include "ccmath/math/expo/exp.hpp"
+#include "ccmath/math/expo/log.hpp"
+
+#include <cmath>
+
+namespace
+{
+	constexpr auto exp_func = [](double x) { return ccm::exp(x); };
+	constexpr auto log_func = [](double x) { return ccm::log(x); };
+
+	constexpr std::size_t exp_degree = ccm::ext::minimax_degree<16>(exp_func, -10.0, 0.0, 1e-6, ccm::ext::fit_error::eRelative);
+	constexpr auto exp_minimax		 = ccm::ext::minimax<exp_degree>(exp_func, -10.0, 0.0, ccm::ext::fit_error::eRelative);
+	constexpr auto log_minimax		 = ccm::ext::minimax<8>(log_func, 1.0, 2.0);
+	constexpr auto log_chebyshev	 = ccm::ext::chebyshev_fit<8>(log_func, 1.0, 2.0);
+} // namespace
+
+TEST(CcmathExtTests, Polyfit_MinimaxDegree)
+{
+	static_assert(exp_degree > 0 && exp_degree <= 16);
+	static_assert(exp_minimax.max_error <= 1e-6);
+	static_assert(ccm::ext::minimax<exp_degree - 1>(exp_func, -10.0, 0.0, ccm::ext::fit_error::eRelative).max_error > 1e-6);
+
+	// The reported error comes from a grid; a much denser one must agree with it.
+	double error = 0;
+	for (int i = 0; i <= 100000; ++i)
+	{
+		const double x = -10.0 + 1e-4 * i;
+		error		   = std::fmax(error, std::fabs(exp_minimax(x) - std::exp(x)) / std::exp(x));
+	}
+	EXPECT_LT(error, 1e-6);
+	EXPECT_LT(error, 1.01 * exp_minimax.max_error);
+}
+
+TEST(CcmathExtTests, Polyfit_MinimaxBeatsChebyshev)
+{
+	static_assert(log_minimax.max_error < log_chebyshev.max_error);
+
+	double minimax_error   = 0;
+	double chebyshev_error = 0;
+	for (int i = 0; i <= 100000; ++i)
+	{
+		const double x	= 1.0 + 1e-5 * i;
+		minimax_error	= std::fmax(minimax_error, std::fabs(log_minimax(x) - std::log(x)));
+		chebyshev_error = std::fmax(chebyshev_error, std::fabs(log_chebyshev(x) - std::log(x)));
+	}
+	EXPECT_LT(minimax_error, chebyshev_error);
+	EXPECT_LT(minimax_error, 1e-7);
+}
+
+TEST(CcmathExtTests, Polyfit_ReproducesPolynomials)
+{
+	// A cubic is its own minimax cubic; only rounding is left.
+	constexpr auto cubic = ccm::ext::minimax<3>([](double x) { return 1.0 + x * (2.0 - x * (3.0 + 0.5 * x)); }, -2.0, 5.0);
+	static_assert(cubic.max_error < 1e-12);
+	for (double x : {-2.0, -0.5, 0.0, 1.25, 5.0}) { EXPECT_NEAR(cubic(x), 1.0 + x * (2.0 - x * (3.0 + 0.5 * x)), 1e-12); }
+}
+
+TEST(CcmathExtTests, Polyfit_Float)
+{
+	constexpr auto expf_minimax = ccm::ext::minimax<5>([](float x) { return ccm::exp(x); }, -1.0F, 1.0F, ccm::ext::fit_error::eRelative);
+	static_assert(std::is_same_v<decltype(expf_minimax)::value_type, float>);
+	static_assert(expf_minimax.max_error < 1e-4F);
+	EXPECT_NEAR(expf_minimax(0.5F), std::exp(0.5F), 1e-4F * std::exp(0.5F));
+}
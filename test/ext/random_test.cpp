@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/random.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> random_input(std::size_t n, double lo, double hi)
+	{
+		std::mt19937_64 rng(37);
+		std::uniform_real_distribution<double> dist(lo, hi);
+		std::vector<T> values(n);
+		for (auto & v : values) { v = static_cast<T>(dist(rng)); }
+		return values;
+	}
+
+	template <typename T>
+	void check_box_muller()
+	{
+		auto u1 = random_input<T>(1001, 0.0, 1.0);
+		auto u2 = random_input<T>(1001, 0.0, 1.0);
+		// Quarter turns give exact sines and cosines.
+		u1.insert(u1.end(), {T(1), T(0.25), T(0.5), T(1), T(1)});
+		u2.insert(u2.end(), {T(0), T(0.25), T(0.5), T(0.75), T(1)});
+		for (auto & u : u1) { u = u > T(0) ? u : T(1); }
+
+		std::vector<T> z0(u1.size());
+		std::vector<T> z1(u1.size());
+		ccm::ext::box_muller(u1.data(), u2.data(), u1.size(), z0.data(), z1.data());
+
+		const T eps = std::numeric_limits<T>::epsilon();
+		for (std::size_t i = 0; i < u1.size(); ++i)
+		{
+			const long double r = std::sqrt(-2 * std::log(static_cast<long double>(u1[i])));
+			const long double a = 2 * 3.141592653589793238462643383279502884L * static_cast<long double>(u2[i]);
+			EXPECT_LE(std::fabs(z0[i] - r * std::cos(a)), 4 * eps * r) << "u1 = " << u1[i] << " u2 = " << u2[i];
+			EXPECT_LE(std::fabs(z1[i] - r * std::sin(a)), 4 * eps * r) << "u1 = " << u1[i] << " u2 = " << u2[i];
+		}
+
+		const std::size_t last = u1.size() - 1;
+		EXPECT_EQ(z0[last - 4], T(0));
+		EXPECT_EQ(z1[last - 4], T(0));
+		EXPECT_EQ(z0[last - 3], T(0));
+		EXPECT_LT(z0[last - 2], T(0));
+		EXPECT_EQ(z1[last - 2], T(0));
+		EXPECT_EQ(z0[last], T(0));
+	}
+
+	template <typename T>
+	void check_normal_inv_cdf()
+	{
+		auto u = random_input<T>(1001, 0.0, 1.0);
+		const auto tail = random_input<double>(200, -300.0, -1.0);
+		for (double e : tail) { u.push_back(static_cast<T>(std::pow(10.0, e / (std::is_same_v<T, float> ? 8 : 1)))); }
+		u.insert(u.end(), {T(0.5), T(0.075), T(0.925), std::numeric_limits<T>::min()});
+
+		std::vector<T> x(u.size());
+		ccm::ext::normal_inv_cdf(u.data(), u.size(), x.data());
+
+		// An error of k ulps in x moves Phi(x) by about k x^2 ulps of u.
+		const T eps = std::numeric_limits<T>::epsilon();
+		for (std::size_t i = 0; i < u.size(); ++i)
+		{
+			if (u[i] == T(0)) { continue; }
+			const long double xi  = x[i];
+			const long double phi = std::erfc(-xi / std::sqrt(2.0L)) / 2;
+			EXPECT_LE(std::fabs(phi - u[i]), 8 * eps * std::fmax(1.0L, xi * xi) * u[i] + std::numeric_limits<T>::min() * 8) << "u = " << u[i];
+		}
+
+		std::vector<T> special{T(0), T(1), T(-0.5), T(1.5), std::numeric_limits<T>::quiet_NaN(), T(0.5)};
+		ccm::ext::normal_inv_cdf(special.data(), special.size(), special.data());
+		EXPECT_EQ(special[0], -std::numeric_limits<T>::infinity());
+		EXPECT_EQ(special[1], std::numeric_limits<T>::infinity());
+		EXPECT_TRUE(std::isnan(special[2]));
+		EXPECT_TRUE(std::isnan(special[3]));
+		EXPECT_TRUE(std::isnan(special[4]));
+		EXPECT_EQ(special[5], T(0));
+	}
+
+	template <typename T>
+	void check_moments(std::vector<T> const & x, double mean, double variance)
+	{
+		long double sum = 0;
+		long double sq	= 0;
+		for (T v : x)
+		{
+			ASSERT_TRUE(std::isfinite(v));
+			sum += v;
+			sq += static_cast<long double>(v) * v;
+		}
+		const long double m = sum / static_cast<long double>(x.size());
+		const long double v = sq / static_cast<long double>(x.size()) - m * m;
+		// About five standard errors for 2^17 samples.
+		EXPECT_LE(std::fabs(m - mean), 0.015 * std::sqrt(variance));
+		EXPECT_LE(std::fabs(v - variance), 0.03 * variance);
+	}
+
+	template <typename T>
+	void check_generated_variates()
+	{
+		constexpr std::size_t n = 1U << 17U;
+		std::vector<T> x(n);
+
+		ccm::ext::philox4x32 gen(2024);
+		ccm::ext::uniform(gen, n, x.data());
+		for (T v : x)
+		{
+			EXPECT_LT(T(0), v);
+			EXPECT_LE(v, T(1));
+		}
+		check_moments(x, 0.5, 1.0 / 12);
+
+		ccm::ext::normal(gen, n, x.data(), T(3), T(2));
+		check_moments(x, 3.0, 4.0);
+
+		ccm::ext::exponential(gen, n, x.data(), T(4));
+		for (T v : x) { EXPECT_LE(T(0), v); }
+		check_moments(x, 0.25, 0.0625);
+
+		ccm::ext::lognormal(gen, n, x.data(), T(0), T(0.25));
+		check_moments(x, std::exp(0.03125), (std::exp(0.0625) - 1) * std::exp(0.0625));
+
+		// Sizes that do not fill a chunk or a SIMD block go through the buffers.
+		for (std::size_t size : {1, 3, 17, 255, 257, 1000})
+		{
+			std::vector<T> y(size + 1, T(-7));
+			ccm::ext::normal(gen, size, y.data());
+			for (std::size_t i = 0; i < size; ++i) { EXPECT_TRUE(std::isfinite(y[i])); }
+			EXPECT_EQ(y[size], T(-7));
+		}
+	}
+} // namespace
+
+TEST(CcmathExtTests, Philox_KnownAnswers)
+{
+	// The known-answer vectors of Random123 for philox4x32_10.
+	using block_t = std::array<std::uint32_t, 4>;
+	EXPECT_EQ(ccm::ext::philox4x32(0, 0).block(0), (block_t{0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U}));
+	EXPECT_EQ(ccm::ext::philox4x32(~std::uint64_t{0}, ~std::uint64_t{0}).block(~std::uint64_t{0}),
+			  (block_t{0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU}));
+	EXPECT_EQ(ccm::ext::philox4x32(0x299f31d0a4093822U, 0x0370734413198a2eU).block(0x85a308d3243f6a88U),
+			  (block_t{0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}));
+
+	static_assert(ccm::ext::philox4x32(0, 0).block(0)[0] == 0x6627e8d5U, "philox4x32 is usable in constant expressions");
+}
+
+TEST(CcmathExtTests, Philox_Generate)
+{
+	ccm::ext::philox4x32 reference(7, 3);
+	std::vector<std::uint32_t> expected(1000);
+	for (auto & w : expected) { w = reference(); }
+
+	// Bulk generation continues wherever the single draws left off.
+	ccm::ext::philox4x32 gen(7, 3);
+	std::vector<std::uint32_t> words(1000);
+	words[0] = gen();
+	gen.generate(words.data() + 1, 2);
+	gen.generate(words.data() + 3, 300);
+	gen.generate(words.data() + 303, 697);
+	EXPECT_EQ(words, expected);
+
+	ccm::ext::philox4x32 skip(7, 3);
+	skip.discard(5);
+	EXPECT_EQ(skip(), expected[5]);
+	skip.discard(2);
+	EXPECT_EQ(skip(), expected[8]);
+	skip.discard(501);
+	EXPECT_EQ(skip(), expected[510]);
+	skip.seek(100);
+	EXPECT_EQ(skip(), expected[400]);
+
+	// Streams of the same seed are different sequences.
+	ccm::ext::philox4x32 other(7, 4);
+	EXPECT_NE(other(), expected[0]);
+
+	std::normal_distribution<double> dist;
+	EXPECT_TRUE(std::isfinite(dist(gen)));
+}
+
+TEST(CcmathExtTests, Random_BoxMuller)
+{
+	check_box_muller<float>();
+	check_box_muller<double>();
+}
+
+TEST(CcmathExtTests, Random_NormalInvCdf)
+{
+	check_normal_inv_cdf<float>();
+	check_normal_inv_cdf<double>();
+}
+
+TEST(CcmathExtTests, Random_Variates)
+{
+	check_generated_variates<float>();
+	check_generated_variates<double>();
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/rcp.hpp"
+#include "ccmath/ext/rsqrt.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Mantissas in [1, 2) across exponents that keep 1/x normal for float.
+	template <typename T>
+	std::vector<T> rcp_input(std::size_t n)
+	{
+		std::mt19937_64 rng(23);
+		std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+		std::uniform_int_distribution<int> exponent(-120, 120);
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const T v = static_cast<T>(std::ldexp(mantissa(rng), exponent(rng)));
+			values[i] = i % 2 == 0 ? v : -v;
+		}
+		return values;
+	}
+
+	long double rcp_error(long double r, long double x)
+	{
+		return std::fabs(r * x - 1.0L);
+	}
+
+	long double rsqrt_error(long double r, long double x)
+	{
+		return std::fabs(r * std::sqrt(x) - 1.0L);
+	}
+
+	template <int Steps, typename T>
+	void check_bounds(long double rcp_bound, long double rsqrt_bound)
+	{
+		const auto x	 = rcp_input<T>(4099);
+		const auto count = x.size();
+		std::vector<T> rcp_out(count);
+		std::vector<T> rsqrt_out(count);
+		std::vector<T> ax(count);
+		for (std::size_t i = 0; i < count; ++i) { ax[i] = std::fabs(x[i]); }
+
+		ccm::ext::rcp_approx<Steps>(x.data(), count, rcp_out.data());
+		ccm::ext::rsqrt_approx<Steps>(ax.data(), count, rsqrt_out.data());
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			EXPECT_LE(rcp_error(ccm::ext::rcp_approx<Steps>(x[i]), x[i]), rcp_bound) << "x = " << x[i];
+			EXPECT_LE(rcp_error(rcp_out[i], x[i]), rcp_bound) << "x = " << x[i];
+			EXPECT_LE(rsqrt_error(ccm::ext::rsqrt_approx<Steps>(ax[i]), ax[i]), rsqrt_bound) << "x = " << ax[i];
+			EXPECT_LE(rsqrt_error(rsqrt_out[i], ax[i]), rsqrt_bound) << "x = " << ax[i];
+		}
+	}
+
+	template <typename T>
+	void check_special_values()
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		const std::vector<T> x{T(0), -T(0), inf, -inf, std::numeric_limits<T>::quiet_NaN(), T(-4), std::numeric_limits<T>::denorm_min(),
+							   std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+		std::vector<T> rcp_out(x.size());
+		std::vector<T> rsqrt_out(x.size());
+		ccm::ext::rcp_approx(x.data(), x.size(), rcp_out.data());
+		ccm::ext::rsqrt_approx(x.data(), x.size(), rsqrt_out.data());
+
+		for (const auto & r : {rcp_out, std::vector<T>{ccm::ext::rcp_approx(x[0]), ccm::ext::rcp_approx(x[1]), ccm::ext::rcp_approx(x[2]),
+													   ccm::ext::rcp_approx(x[3])}})
+		{
+			EXPECT_EQ(r[0], inf);
+			EXPECT_EQ(r[1], -inf);
+			EXPECT_EQ(r[2], T(0));
+			EXPECT_TRUE(std::signbit(r[3]));
+		}
+		EXPECT_TRUE(std::isnan(rcp_out[4]));
+		EXPECT_LE(rcp_error(rcp_out[8], x[8]), 0x1.0p-21L);
+
+		EXPECT_EQ(rsqrt_out[0], inf);
+		EXPECT_EQ(rsqrt_out[1], -inf);
+		EXPECT_EQ(rsqrt_out[2], T(0));
+		EXPECT_TRUE(std::isnan(rsqrt_out[3]));
+		EXPECT_TRUE(std::isnan(rsqrt_out[4]));
+		EXPECT_TRUE(std::isnan(rsqrt_out[5]));
+		for (std::size_t i = 6; i < x.size(); ++i)
+		{
+			EXPECT_LE(rsqrt_error(rsqrt_out[i], x[i]), 0x1.0p-21L) << "x = " << x[i];
+			EXPECT_LE(rsqrt_error(ccm::ext::rsqrt_approx(x[i]), x[i]), 0x1.0p-21L) << "x = " << x[i];
+		}
+	}
+} // namespace
+
+TEST(CcmathExtTests, Rcp_StaticAssert)
+{
+	static_assert(ccm::ext::rcp(4.0L) == 0.25L, "rcp has failed testing that it is static_assert-able!");
+	static_assert(ccm::ext::rcp_approx<2>(4.0) == 0.25, "rcp_approx has failed testing that it is static_assert-able!");
+	static_assert(ccm::ext::rsqrt_approx<2>(4.0F) == 0.5F, "rsqrt_approx has failed testing that it is static_assert-able!");
+}
+
+TEST(CcmathExtTests, Rcp_Exact)
+{
+	// The plain rcp is the correctly rounded division for every type, long double included.
+	const auto x = rcp_input<double>(257);
+	for (const double v : x)
+	{
+		EXPECT_EQ(ccm::ext::rcp(static_cast<float>(v)), 1.0F / static_cast<float>(v)) << "x = " << v;
+		EXPECT_EQ(ccm::ext::rcp(v), 1.0 / v) << "x = " << v;
+		EXPECT_EQ(ccm::ext::rcp(static_cast<long double>(v)), 1.0L / static_cast<long double>(v)) << "x = " << v;
+	}
+}
+
+TEST(CcmathExtTests, Rcp_Float_Bounds)
+{
+	check_bounds<0, float>(0x1.8p-12L, 0x1.8p-12L);
+	check_bounds<1, float>(0x1.0p-21L, 0x1.0p-21L);
+	check_bounds<2, float>(0x1.0p-22L, 0x1.0p-22L);
+}
+
+TEST(CcmathExtTests, Rcp_Double_Bounds)
+{
+	check_bounds<0, double>(0x1.8p-12L, 0x1.8p-12L);
+	check_bounds<1, double>(0x1.0p-22L, 0x1.0p-22L);
+	check_bounds<2, double>(0x1.0p-43L, 0x1.0p-42L);
+}
+
+TEST(CcmathExtTests, Rcp_SpecialValues)
+{
+	check_special_values<float>();
+	check_special_values<double>();
+}
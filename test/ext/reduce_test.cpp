@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/reduce.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using ccm::ext::summation;
+
+	// Large values that cancel in pairs, hiding small integers whose sum is the exact result.
+	template <typename T>
+	std::vector<T> cancelling_values(std::size_t pairs, std::mt19937_64 & rng, T & exact)
+	{
+		std::uniform_real_distribution<T> large(T(0x1.0p40), T(0x1.0p41));
+		std::uniform_int_distribution<int> small(-100, 100);
+		std::vector<T> values;
+		exact = 0;
+		for (std::size_t i = 0; i < pairs; ++i)
+		{
+			const T v = large(rng);
+			const T s = static_cast<T>(small(rng));
+			values.insert(values.end(), {v, -v, s});
+			exact += s;
+		}
+		std::shuffle(values.begin(), values.end(), rng);
+		return values;
+	}
+
+	template <summation Mode, typename T>
+	void expect_exact_sum()
+	{
+		std::mt19937_64 rng(static_cast<std::uint64_t>(Mode));
+		for (std::size_t pairs : {1, 3, 17, 100, 1000})
+		{
+			T exact			  = 0;
+			const auto values = cancelling_values<T>(pairs, rng, exact);
+			EXPECT_EQ(ccm::ext::sum<Mode>(values), exact) << pairs;
+		}
+	}
+} // namespace
+
+TEST(CcmathExtTests, ReduceCompensatedSumIsExact)
+{
+	expect_exact_sum<summation::eNeumaier, double>();
+	expect_exact_sum<summation::eDoubleDouble, double>();
+	expect_exact_sum<summation::eNeumaier, float>();
+	expect_exact_sum<summation::eDoubleDouble, float>();
+}
+
+TEST(CcmathExtTests, ReduceSumModes)
+{
+	// 0.1 is not representable, so the plain running sum drifts while the pairwise and compensated ones do not.
+	const std::vector<float> tenths(1 << 20, 0.1F);
+	const double exact = static_cast<double>(0.1F) * static_cast<double>(tenths.size());
+
+	const auto error = [&](float value) { return std::fabs(static_cast<double>(value) - exact) / exact; };
+	EXPECT_LT(error(ccm::ext::sum<summation::ePairwise>(tenths)), 1e-6);
+	EXPECT_LT(error(ccm::ext::sum<summation::eKahan>(tenths)), 1e-7);
+	// Neumaier's error term is itself a plain float sum, which shows at a million elements.
+	EXPECT_LT(error(ccm::ext::sum<summation::eNeumaier>(tenths)), 1e-6);
+	EXPECT_LT(error(ccm::ext::sum<summation::eDoubleDouble>(tenths)), 1e-7);
+	EXPECT_LT(error(ccm::ext::sum<summation::eNaive>(tenths)), 1e-3);
+
+	// Every mode agrees on integers, at all lengths around the block and pairwise split sizes.
+	for (std::size_t n : {0, 1, 5, 31, 32, 33, 255, 256, 257, 1000, 4099})
+	{
+		std::vector<double> values(n);
+		for (std::size_t i = 0; i < n; ++i) { values[i] = static_cast<double>(i % 7) - 3.0; }
+		const double expected = std::accumulate(values.begin(), values.end(), 0.0);
+		EXPECT_EQ(ccm::ext::sum<summation::eNaive>(values), expected) << n;
+		EXPECT_EQ(ccm::ext::sum<summation::ePairwise>(values), expected) << n;
+		EXPECT_EQ(ccm::ext::sum<summation::eKahan>(values), expected) << n;
+		EXPECT_EQ(ccm::ext::sum<summation::eNeumaier>(values), expected) << n;
+		EXPECT_EQ(ccm::ext::sum<summation::eDoubleDouble>(values), expected) << n;
+	}
+
+	const std::vector<double> with_inf = {1.0, std::numeric_limits<double>::infinity(), 2.0};
+	EXPECT_EQ(ccm::ext::sum<summation::eNeumaier>(with_inf), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::ext::sum<summation::eDoubleDouble>(with_inf), std::numeric_limits<double>::infinity());
+
+	constexpr std::array<double, 4> values = {{0x1.0p60, 1.0, -0x1.0p60, 0.25}};
+	static_assert(ccm::ext::sum<summation::eNeumaier>(values) == 1.25);
+	// Kahan's correction is lost when the next term is larger than the running sum, which Neumaier's handles.
+	static_assert(ccm::ext::sum<summation::eKahan>(values) == 0.25);
+	static_assert(ccm::ext::sum(values) == 0.25);
+}
+
+TEST(CcmathExtTests, ReduceDot)
+{
+	// The rounding error of each product matters: (1 + 2^-30)(1 - 2^-30) = 1 - 2^-60.
+	std::vector<double> x(33, 1.0 + 0x1.0p-30);
+	std::vector<double> y(33, 1.0 - 0x1.0p-30);
+	x.push_back(-33.0);
+	y.push_back(1.0);
+	EXPECT_EQ(ccm::ext::dot<summation::eNeumaier>(x, y), -33 * 0x1.0p-60);
+	EXPECT_EQ(ccm::ext::dot<summation::eDoubleDouble>(x, y), -33 * 0x1.0p-60);
+
+	std::mt19937_64 rng(3);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::vector<double> a(1001);
+	std::vector<double> b(1001);
+	for (std::size_t i = 0; i < a.size(); ++i)
+	{
+		a[i] = dist(rng);
+		b[i] = dist(rng);
+	}
+	const double reference = ccm::ext::dot<summation::eDoubleDouble>(a, b);
+	EXPECT_NEAR(ccm::ext::dot<summation::eNaive>(a, b), reference, 1e-12);
+	EXPECT_NEAR(ccm::ext::dot<summation::ePairwise>(a, b), reference, 1e-13);
+	EXPECT_NEAR(ccm::ext::dot<summation::eKahan>(a, b), reference, 1e-14);
+	EXPECT_EQ(ccm::ext::dot<summation::eNeumaier>(a, b), reference);
+
+	constexpr std::array<float, 3> u = {{1.0F, 2.0F, 3.0F}};
+	constexpr std::array<float, 3> v = {{4.0F, -5.0F, 6.0F}};
+	static_assert(ccm::ext::dot(u, v) == 12.0F);
+	static_assert(ccm::ext::dot<summation::eDoubleDouble>(u, v) == 12.0F);
+}
+
+TEST(CcmathExtTests, ReduceNorm)
+{
+	const std::vector<double> v = {3.0, -4.0, 12.0};
+	EXPECT_EQ(ccm::ext::norm2(v), 13.0);
+	EXPECT_EQ(ccm::ext::hypot_n(v), 13.0);
+
+	// The squares overflow or underflow, the scaled ones do not.
+	std::vector<double> big(100, 0x1.0p1000);
+	std::vector<double> tiny(100, 0x1.0p-1070);
+	EXPECT_TRUE(std::isinf(ccm::ext::norm2(big)));
+	EXPECT_EQ(ccm::ext::hypot_n(big), 0x1.0p1000 * 10.0);
+	EXPECT_EQ(ccm::ext::norm2(tiny), 0.0);
+	EXPECT_EQ(ccm::ext::hypot_n<summation::eNeumaier>(tiny), 0x1.0p-1070 * 10.0);
+
+	std::vector<float> floats(64, 0x1.0p100F);
+	EXPECT_EQ(ccm::ext::hypot_n(floats), 0x1.0p103F);
+
+	const double inf = std::numeric_limits<double>::infinity();
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	EXPECT_EQ(ccm::ext::hypot_n(std::vector<double>{1.0, nan, -inf}), inf);
+	EXPECT_TRUE(std::isnan(ccm::ext::hypot_n(std::vector<double>{1.0, nan, 2.0})));
+	EXPECT_TRUE(std::isnan(ccm::ext::hypot_n(std::vector<double>{0.0, nan})));
+	EXPECT_EQ(ccm::ext::hypot_n(std::vector<double>{}), 0.0);
+	EXPECT_EQ(ccm::ext::hypot_n(std::vector<double>(9, 0.0)), 0.0);
+
+	constexpr std::array<double, 2> pair = {{5.0, 12.0}};
+	static_assert(ccm::ext::hypot_n(pair) == 13.0);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/softmax.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	std::vector<T> softmax_input(std::size_t n, double lo, double hi)
+	{
+		std::mt19937_64 rng(31);
+		std::uniform_real_distribution<double> dist(lo, hi);
+		std::vector<T> values(n);
+		for (auto & v : values) { v = static_cast<T>(dist(rng)); }
+		return values;
+	}
+
+	template <typename T>
+	long double reference_logsumexp(std::vector<T> const & x)
+	{
+		long double largest = -std::numeric_limits<long double>::infinity();
+		for (T v : x) { largest = std::fmax(largest, static_cast<long double>(v)); }
+		long double total = 0;
+		for (T v : x) { total += std::exp(static_cast<long double>(v) - largest); }
+		return largest + std::log(total);
+	}
+
+	template <typename T>
+	void check_softmax(std::size_t n, double lo, double hi)
+	{
+		const auto x		= softmax_input<T>(n, lo, hi);
+		const long double r = reference_logsumexp(x);
+		const T eps			= std::numeric_limits<T>::epsilon();
+		long double largest = -std::numeric_limits<long double>::infinity();
+		for (T v : x) { largest = std::fmax(largest, static_cast<long double>(v)); }
+
+		if (n > 0) { EXPECT_LE(std::fabs(ccm::ext::logsumexp(x) - r), 4 * eps * std::fmax(1.0L, std::fabs(r))) << "n = " << n; }
+
+		std::vector<T> out(n);
+		ccm::ext::softmax(x.data(), n, out.data());
+		long double total = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			// x - max is rounded before exp, which costs up to |x - max| / 2 ulps, and results below the normal range have
+			// fewer bits.
+			const long double expected = std::exp(static_cast<long double>(x[i]) - r);
+			const long double ulps	   = 8 + std::fabs(static_cast<long double>(x[i]) - largest) / 2;
+			EXPECT_LE(std::fabs(out[i] - expected), ulps * eps * expected + std::numeric_limits<T>::min()) << "x = " << x[i];
+			total += out[i];
+		}
+		if (n > 0) { EXPECT_LE(std::fabs(total - 1), 8 * eps); }
+	}
+
+	template <typename T>
+	void check_softmax_special_values()
+	{
+		constexpr T inf = std::numeric_limits<T>::infinity();
+
+		EXPECT_EQ(ccm::ext::logsumexp(std::vector<T>{}), -inf);
+		EXPECT_EQ(ccm::ext::logsumexp(std::vector<T>{-inf, -inf, -inf}), -inf);
+		EXPECT_EQ(ccm::ext::logsumexp(std::vector<T>{T(1), inf, T(-3)}), inf);
+		EXPECT_TRUE(std::isnan(ccm::ext::logsumexp(std::vector<T>{T(1), std::numeric_limits<T>::quiet_NaN(), T(2)})));
+
+		// Large enough for a naive exp to overflow.
+		std::vector<T> big{T(1000), T(1000), T(-inf), T(999)};
+		ccm::ext::softmax(big);
+		EXPECT_LE(std::fabs(big[0] - 1 / (2 + std::exp(-1.0L))), 4 * std::numeric_limits<T>::epsilon());
+		EXPECT_EQ(big[0], big[1]);
+		EXPECT_EQ(big[2], T(0));
+
+		// Infinite maxima give the limit of the elements growing together.
+		constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+		std::vector<T> one_inf{T(1), inf, T(-3), -inf};
+		ccm::ext::softmax(one_inf);
+		EXPECT_EQ(one_inf, (std::vector<T>{T(0), T(1), T(0), T(0)}));
+		std::vector<T> two_inf{inf, T(5), inf, T(1), T(2)};
+		ccm::ext::softmax(two_inf);
+		EXPECT_EQ(two_inf, (std::vector<T>{T(0.5), T(0), T(0.5), T(0), T(0)}));
+		std::vector<T> all_minus_inf{-inf, -inf, -inf, -inf};
+		ccm::ext::softmax(all_minus_inf);
+		EXPECT_EQ(all_minus_inf, (std::vector<T>{T(0.25), T(0.25), T(0.25), T(0.25)}));
+		EXPECT_TRUE(std::isnan(ccm::ext::logsumexp(std::vector<T>{inf, nan, T(2)})));
+		EXPECT_TRUE(std::isnan(ccm::ext::logsumexp(std::vector<T>{-inf, nan})));
+		for (std::vector<T> with_nan : {std::vector<T>{T(1), nan, T(2)}, std::vector<T>{inf, nan, T(2)}, std::vector<T>{-inf, nan}})
+		{
+			ccm::ext::softmax(with_nan);
+			for (T v : with_nan) { EXPECT_TRUE(std::isnan(v)); }
+		}
+	}
+
+	template <typename T>
+	void check_sigmoid()
+	{
+		auto x = softmax_input<T>(1001, -120.0, 120.0);
+		x.insert(x.end(), {T(0), -T(0), T(-1000), T(1000), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+						   std::numeric_limits<T>::quiet_NaN()});
+		std::vector<T> s(x.size());
+		std::vector<T> ls(x.size());
+		ccm::ext::sigmoid(x.data(), x.size(), s.data());
+		ccm::ext::log_sigmoid(x.data(), x.size(), ls.data());
+
+		const T eps = std::numeric_limits<T>::epsilon();
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			const long double v = x[i];
+			if (std::isnan(x[i]))
+			{
+				EXPECT_TRUE(std::isnan(s[i]));
+				EXPECT_TRUE(std::isnan(ls[i]));
+				continue;
+			}
+			if (std::isinf(x[i])) { continue; }
+			const long double sig	  = 1 / (1 + std::exp(-v));
+			const long double log_sig = std::fmin(v, 0.0L) - std::log1p(std::exp(-std::fabs(v)));
+			EXPECT_LE(std::fabs(s[i] - sig), 4 * eps * sig + std::numeric_limits<T>::denorm_min()) << "x = " << x[i];
+			EXPECT_LE(std::fabs(ls[i] - log_sig), 4 * eps * std::fabs(log_sig) + std::numeric_limits<T>::denorm_min()) << "x = " << x[i];
+		}
+		EXPECT_EQ(s[x.size() - 3], T(1));
+		EXPECT_EQ(s[x.size() - 2], T(0));
+		EXPECT_EQ(ls[x.size() - 3], -T(0));
+		EXPECT_EQ(ls[x.size() - 2], -std::numeric_limits<T>::infinity());
+	}
+} // namespace
+
+TEST(CcmathExtTests, Softmax_Float)
+{
+	for (std::size_t n : {0, 1, 3, 8, 17, 1000, 4099}) { check_softmax<float>(n, -30.0, 30.0); }
+	check_softmax<float>(1000, -200.0, 10.0);
+	check_softmax_special_values<float>();
+}
+
+TEST(CcmathExtTests, Softmax_Double)
+{
+	for (std::size_t n : {0, 1, 3, 8, 17, 1000, 4099}) { check_softmax<double>(n, -30.0, 30.0); }
+	check_softmax<double>(1000, -1000.0, 10.0);
+	check_softmax_special_values<double>();
+}
+
+TEST(CcmathExtTests, Sigmoid)
+{
+	check_sigmoid<float>();
+	check_sigmoid<double>();
+}
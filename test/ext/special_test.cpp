@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/ndtri.hpp"
+#include "ccmath/ext/special.hpp"
+#include "ccmath/math/misc/erf.hpp"
+#include "ccmath/math/misc/erfc.hpp"
+#include "ccmath/math/misc/erfcinv.hpp"
+#include "ccmath/math/misc/erfinv.hpp"
+#include "ccmath/math/misc/gamma.hpp"
+#include "ccmath/math/misc/lgamma.hpp"
+#include "ccmath/math/special/assoc_laguerre.hpp"
+#include "ccmath/math/special/assoc_legendre.hpp"
+#include "ccmath/math/special/cyl_bessel_i.hpp"
+#include "ccmath/math/special/cyl_bessel_j.hpp"
+#include "ccmath/math/special/cyl_bessel_k.hpp"
+#include "ccmath/math/special/cyl_neumann.hpp"
+#include "ccmath/math/special/hermite.hpp"
+#include "ccmath/math/special/laguerre.hpp"
+#include "ccmath/math/special/legendre.hpp"
+#include "ccmath/math/special/sph_bessel.hpp"
+#include "ccmath/math/special/sph_legendre.hpp"
+#include "ccmath/math/special/sph_neumann.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Values across every range of the piecewise approximations, followed by the special values.
+	template <typename T>
+	std::vector<T> special_input(std::size_t n)
+	{
+		std::mt19937_64 rng(17);
+		std::uniform_real_distribution<double> dist(-30.0, 180.0);
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i) { values[i] = static_cast<T>(i % 3 == 0 ? dist(rng) / 8.0 : dist(rng)); }
+		values.insert(values.end(), {T(0), -T(0), T(1), T(-2), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max()});
+		return values;
+	}
+
+	template <typename T>
+	bool same_value(T a, T b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	template <typename T>
+	void check_special_arrays()
+	{
+		const auto x	 = special_input<T>(1003);
+		const auto count = x.size();
+		std::vector<T> out(count);
+
+		ccm::ext::erf(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::erf(x[i]))) << "x = " << x[i]; }
+		ccm::ext::erfc(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::erfc(x[i]))) << "x = " << x[i]; }
+		ccm::ext::tgamma(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::tgamma(x[i]))) << "x = " << x[i]; }
+		ccm::ext::lgamma(x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::lgamma(x[i]))) << "x = " << x[i]; }
+
+		// In place.
+		std::vector<T> y = x;
+		ccm::ext::erf(y.data(), count, y.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(y[i], ccm::erf(x[i]))) << "x = " << x[i]; }
+	}
+
+	// Probabilities across the central range and both tails, then the edges of the domains and values outside them.
+	template <typename T>
+	std::vector<T> quantile_input(std::size_t n)
+	{
+		std::mt19937_64 rng(23);
+		std::uniform_real_distribution<double> dist(0.0, 1.0);
+		std::vector<T> values(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const double u = dist(rng);
+			values[i]	   = static_cast<T>(i % 3 == 0 ? std::ldexp(u, -static_cast<int>(i % 140)) : (i % 3 == 1 ? 1.0 - u * u : u));
+		}
+		values.insert(values.end(), {T(0), -T(0), T(0.5), T(1), T(2), T(-1), T(1.5), std::numeric_limits<T>::infinity(),
+									 std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min()});
+		return values;
+	}
+
+	template <typename T>
+	void check_quantile_arrays()
+	{
+		const auto p	 = quantile_input<T>(1003);
+		const auto count = p.size();
+		std::vector<T> out(count);
+
+		ccm::ext::ndtri(p.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::ext::ndtri(p[i]))) << "p = " << p[i]; }
+		ccm::ext::erfcinv(p.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::erfcinv(p[i]))) << "z = " << p[i]; }
+
+		std::vector<T> y(count);
+		for (std::size_t i = 0; i < count; ++i) { y[i] = i % 2 == 0 ? p[i] : -p[i]; }
+		ccm::ext::erfinv(y.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], ccm::erfinv(y[i]))) << "y = " << y[i]; }
+
+		// The simd overload.
+		using simd_t				= ccm::intrin::native_simd<T>;
+		constexpr std::size_t width = simd_t::size();
+		T lanes[width];
+		for (std::size_t i = 0; i + width <= count; i += width)
+		{
+			ccm::ext::ndtri(simd_t(p.data() + i, ccm::intrin::element_aligned_tag())).copy_to(lanes, ccm::intrin::element_aligned_tag());
+			for (std::size_t k = 0; k < width; ++k) { EXPECT_TRUE(same_value(lanes[k], ccm::ext::ndtri(p[i + k]))) << "p = " << p[i + k]; }
+		}
+	}
+
+	// Checks a single order array form against the scalar function, and the every-order form against the single one,
+	// bitwise unless a tolerance is given. That one is relative to the Bessel envelope min(1, 1 / x).
+	template <typename T, typename Single, typename All, typename Scalar>
+	void check_order_arrays(std::vector<T> const & x, unsigned n_max, Single && single, All && all, Scalar && scalar, T tolerance = 0)
+	{
+		const auto count = x.size();
+		std::vector<T> out(count);
+		std::vector<T> every((n_max + 1) * count);
+
+		all(n_max, x.data(), count, every.data());
+		for (unsigned n = 0; n <= n_max; n += 7)
+		{
+			single(n, x.data(), count, out.data());
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(same_value(out[i], scalar(n, x[i]))) << "n = " << n << ", x = " << x[i];
+				if (tolerance == 0 || std::isnan(out[i])) { EXPECT_TRUE(same_value(every[n * count + i], out[i])) << "n = " << n << ", x = " << x[i]; }
+				else
+				{
+					const T envelope = std::max(std::min(T(1), T(1) / std::fabs(x[i])), std::numeric_limits<T>::min());
+					EXPECT_LE(std::fabs(every[n * count + i] - out[i]), tolerance * envelope)
+						<< "n = " << n << ", x = " << x[i];
+				}
+			}
+		}
+	}
+
+	template <typename T>
+	void check_polynomial_arrays()
+	{
+		const auto x = special_input<T>(203);
+		std::vector<T> unit(x.size());
+		for (std::size_t i = 0; i < x.size(); ++i) { unit[i] = static_cast<T>(std::sin(static_cast<double>(x[i]))) * T(1.0625); }
+
+		check_order_arrays(
+			unit, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::legendre(n, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::legendre_all(n, v, c, o); }, [](unsigned n, T v) { return ccm::legendre(n, v); });
+		check_order_arrays(
+			unit, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::assoc_legendre(n, 3, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::assoc_legendre_all(n, 3, v, c, o); },
+			[](unsigned n, T v) { return ccm::assoc_legendre(n, 3, v); });
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_legendre(n, 2, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_legendre_all(n, 2, v, c, o); },
+			[](unsigned n, T v) { return ccm::sph_legendre(n, 2, v); });
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::laguerre(n, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::laguerre_all(n, v, c, o); }, [](unsigned n, T v) { return ccm::laguerre(n, v); });
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::assoc_laguerre(n, 4, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::assoc_laguerre_all(n, 4, v, c, o); },
+			[](unsigned n, T v) { return ccm::assoc_laguerre(n, 4, v); });
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::hermite(n, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::hermite_all(n, v, c, o); }, [](unsigned n, T v) { return ccm::hermite(n, v); });
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_bessel(n, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_bessel_all(n, v, c, o); }, [](unsigned n, T v) { return ccm::sph_bessel(n, v); },
+			std::numeric_limits<T>::epsilon() * 64);
+		// Blocks mixing arguments below and above the order run both recurrences, and each element still gets the same
+		// values as ccm::sph_bessel_all gives it.
+		std::vector<T> every(51 * x.size());
+		std::vector<T> orders(51);
+		ccm::ext::sph_bessel_all(50, x.data(), x.size(), every.data());
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			ccm::sph_bessel_all(50, x[i], orders.data());
+			for (unsigned k = 0; k <= 50; ++k) { EXPECT_TRUE(same_value(every[k * x.size() + i], orders[k])) << "n = " << k << ", x = " << x[i]; }
+		}
+		check_order_arrays(
+			x, 50, [](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_neumann(n, v, c, o); },
+			[](unsigned n, T const * v, std::size_t c, T * o) { ccm::ext::sph_neumann_all(n, v, c, o); },
+			[](unsigned n, T v) { return ccm::sph_neumann(n, v); });
+	}
+
+	// Checks a single order array form of a cylindrical Bessel function against the scalar function, and the form for
+	// the orders nu to nu + n_max against the scalar one, both bitwise.
+	template <typename T, typename Single, typename All, typename Scalar, typename ScalarAll>
+	void check_cyl_arrays(std::vector<T> const & x, T nu, unsigned n_max, Single && single, All && all, Scalar && scalar, ScalarAll && scalar_all)
+	{
+		const auto count = x.size();
+		std::vector<T> out(count);
+		std::vector<T> every((n_max + 1) * count);
+		std::vector<T> orders(n_max + 1);
+
+		single(nu, x.data(), count, out.data());
+		for (std::size_t i = 0; i < count; ++i) { EXPECT_TRUE(same_value(out[i], scalar(nu, x[i]))) << "nu = " << nu << ", x = " << x[i]; }
+		all(nu, n_max, x.data(), count, every.data());
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			scalar_all(nu, n_max, x[i], orders.data());
+			for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(every[k * count + i], orders[k])) << "nu = " << nu << " + " << k << ", x = " << x[i]; }
+		}
+	}
+
+	template <typename T>
+	void check_cyl_bessel_arrays()
+	{
+		// Blocks mix arguments below and above 2 and Hankel's limit, and past the range of I and K.
+		const auto x = special_input<T>(203);
+		for (const T nu : {T(0), T(2.5), T(17.25)})
+		{
+			check_cyl_arrays(
+				x, nu, 20, [](T n, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_j(n, v, c, o); },
+				[](T n, unsigned m, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_j_all(n, m, v, c, o); },
+				[](T n, T v) { return ccm::cyl_bessel_j(n, v); }, [](T n, unsigned m, T v, T * o) { ccm::cyl_bessel_j_all(n, m, v, o); });
+			check_cyl_arrays(
+				x, nu, 20, [](T n, T const * v, std::size_t c, T * o) { ccm::ext::cyl_neumann(n, v, c, o); },
+				[](T n, unsigned m, T const * v, std::size_t c, T * o) { ccm::ext::cyl_neumann_all(n, m, v, c, o); },
+				[](T n, T v) { return ccm::cyl_neumann(n, v); }, [](T n, unsigned m, T v, T * o) { ccm::cyl_neumann_all(n, m, v, o); });
+			check_cyl_arrays(
+				x, nu, 20, [](T n, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_i(n, v, c, o); },
+				[](T n, unsigned m, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_i_all(n, m, v, c, o); },
+				[](T n, T v) { return ccm::cyl_bessel_i(n, v); }, [](T n, unsigned m, T v, T * o) { ccm::cyl_bessel_i_all(n, m, v, o); });
+			check_cyl_arrays(
+				x, nu, 20, [](T n, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_k(n, v, c, o); },
+				[](T n, unsigned m, T const * v, std::size_t c, T * o) { ccm::ext::cyl_bessel_k_all(n, m, v, c, o); },
+				[](T n, T v) { return ccm::cyl_bessel_k(n, v); }, [](T n, unsigned m, T v, T * o) { ccm::cyl_bessel_k_all(n, m, v, o); });
+		}
+	}
+} // namespace
+
+TEST(CcmathExtTests, Special_Double_MatchesScalar)
+{
+	check_special_arrays<double>();
+}
+
+TEST(CcmathExtTests, Special_Float_MatchesScalar)
+{
+	check_special_arrays<float>();
+}
+
+TEST(CcmathExtTests, Quantile_Double_MatchesScalar)
+{
+	static_assert(ccm::ext::ndtri(0.5) == 0.0, "ccm::ext::ndtri is not a compile time constant!");
+	check_quantile_arrays<double>();
+}
+
+TEST(CcmathExtTests, Quantile_Float_MatchesScalar)
+{
+	check_quantile_arrays<float>();
+}
+
+TEST(CcmathExtTests, Polynomial_Double_MatchesScalar)
+{
+	check_polynomial_arrays<double>();
+}
+
+TEST(CcmathExtTests, Polynomial_Float_MatchesScalar)
+{
+	check_polynomial_arrays<float>();
+}
+
+TEST(CcmathExtTests, CylBessel_Double_MatchesScalar)
+{
+	check_cyl_bessel_arrays<double>();
+}
+
+TEST(CcmathExtTests, CylBessel_Float_MatchesScalar)
+{
+	check_cyl_bessel_arrays<float>();
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/table.hpp"
+#include "ccmath/math/expo/exp.hpp"
+#include "ccmath/math/expo/log.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	constexpr auto exp_table = ccm::ext::make_table<256>([](double x) { return ccm::exp(x); }, -4.0, 0.0);
+	constexpr auto log_chebyshev = ccm::ext::make_table<24, ccm::ext::table_grid::eChebyshev>([](double x) { return ccm::log(x); }, 1.0, 2.0);
+
+	std::vector<double> sample_inputs(double lo, double hi, std::size_t count)
+	{
+		std::vector<double> x(count);
+		for (std::size_t i = 0; i < count; ++i) { x[i] = lo + (hi - lo) * (static_cast<double>(i) + 0.37) / static_cast<double>(count); }
+		return x;
+	}
+} // namespace
+
+TEST(CcmathExtTests, Table_IsBuiltAtCompileTime)
+{
+	static_assert(exp_table.size() == 256);
+	static_assert(exp_table.values[0] == ccm::exp(-4.0));
+	static_assert(exp_table.values[255] == 1.0);
+	static_assert(log_chebyshev.nodes[0] == 1.0 && log_chebyshev.nodes[23] == 2.0);
+	static_assert(ccm::ext::table_interp(exp_table, 0.0) == 1.0);
+
+	constexpr auto expf_table = ccm::ext::make_table<&ccm::expf, 64>(-1.0F, 1.0F);
+	static_assert(expf_table.values[63] == ccm::expf(1.0F));
+}
+
+TEST(CcmathExtTests, Table_UniformAccuracy)
+{
+	double linear_error = 0;
+	double cubic_error	= 0;
+	for (double x : sample_inputs(-4.0, 0.0, 10000))
+	{
+		const double expected = std::exp(x);
+		linear_error		  = std::fmax(linear_error, std::fabs(ccm::ext::table_interp(exp_table, x) - expected) / expected);
+		cubic_error = std::fmax(cubic_error, std::fabs(ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(exp_table, x) - expected) / expected);
+	}
+
+	// h = 4 / 255: linear interpolation is accurate to h^2 / 8, Catmull-Rom to about h^3 / 16.
+	EXPECT_LT(linear_error, 4e-5);
+	EXPECT_LT(cubic_error, 1e-6);
+}
+
+TEST(CcmathExtTests, Table_ChebyshevAccuracy)
+{
+	for (double x : sample_inputs(1.0, 2.0, 1000)) { EXPECT_NEAR(ccm::ext::table_interp(log_chebyshev, x), std::log(x), 1e-13); }
+}
+
+TEST(CcmathExtTests, Table_OutOfRangeAndNaN)
+{
+	EXPECT_EQ(ccm::ext::table_interp(exp_table, -10.0), exp_table.values[0]);
+	EXPECT_EQ(ccm::ext::table_interp(exp_table, 3.0), 1.0);
+	EXPECT_EQ(ccm::ext::table_interp(log_chebyshev, 0.5), log_chebyshev.values[0]);
+	EXPECT_TRUE(std::isnan(ccm::ext::table_interp(exp_table, std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(exp_table, std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::ext::table_interp(log_chebyshev, std::numeric_limits<double>::quiet_NaN())));
+}
+
+TEST(CcmathExtTests, Table_ChebyshevNextToNode)
+{
+	// The middle node is exactly 0, so the distance to it is subnormal and w / d overflows.
+	constexpr auto cubic_chebyshev = ccm::ext::make_table<9, ccm::ext::table_grid::eChebyshev>([](double x) { return 2.0 + x * x * x; }, -1.0, 1.0);
+	static_assert(cubic_chebyshev.nodes[4] == 0.0);
+
+	std::vector<double> x(17);
+	for (std::size_t i = 0; i < x.size(); ++i) { x[i] = (i % 2 == 0 ? 1.0 : -1.0) * std::ldexp(1.0, -1000 - static_cast<int>(i) * 4); }
+	std::vector<double> batch(x.size());
+	ccm::ext::table_interp(cubic_chebyshev, x, batch);
+	for (std::size_t i = 0; i < x.size(); ++i)
+	{
+		EXPECT_EQ(ccm::ext::table_interp(cubic_chebyshev, x[i]), 2.0) << "x = " << x[i];
+		EXPECT_EQ(batch[i], 2.0) << "x = " << x[i];
+	}
+	EXPECT_EQ(ccm::ext::table_interp(cubic_chebyshev, 1e-310), 2.0);
+}
+
+TEST(CcmathExtTests, Table_BatchMatchesScalar)
+{
+	std::vector<double> x = sample_inputs(-5.0, 3.0, 1003);
+	x[5]				  = std::numeric_limits<double>::quiet_NaN();
+	x[6]				  = log_chebyshev.nodes[7];
+	x[7]				  = -4.0;
+
+	std::vector<double> linear(x.size());
+	std::vector<double> cubic(x.size());
+	std::vector<double> chebyshev(x.size());
+	ccm::ext::table_interp(exp_table, x, linear);
+	ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(exp_table, x, cubic);
+	ccm::ext::table_interp(log_chebyshev, x, chebyshev);
+
+	for (std::size_t i = 0; i < x.size(); ++i)
+	{
+		if (std::isnan(x[i]))
+		{
+			EXPECT_TRUE(std::isnan(linear[i]) && std::isnan(cubic[i]) && std::isnan(chebyshev[i]));
+			continue;
+		}
+		// The scalar path may contract to fma where the vector path does not.
+		EXPECT_NEAR(linear[i], ccm::ext::table_interp(exp_table, x[i]), 1e-15);
+		EXPECT_NEAR(cubic[i], ccm::ext::table_interp<ccm::ext::table_interpolation::eCubic>(exp_table, x[i]), 1e-15);
+		EXPECT_NEAR(chebyshev[i], ccm::ext::table_interp(log_chebyshev, x[i]), 1e-14);
+	}
+}
@@ -14,8 +14,51 @@
 #include <limits>
 #include "ccmath/ccmath.hpp"
 
+namespace
+{
+	template <typename T>
+	void expect_frexp_matches_std(T x)
+	{
+		int ccm_exp		 = 0;
+		int std_exp		 = 0;
+		const T ccm_frac = ccm::gen::frexp_gen(x, ccm_exp);
+		const T std_frac = std::frexp(x, &std_exp);
+		if (std::isnan(x))
+		{
+			EXPECT_TRUE(std::isnan(ccm_frac));
+			return;
+		}
+		EXPECT_EQ(ccm_frac, std_frac) << "x = " << x;
+		EXPECT_EQ(std::signbit(ccm_frac), std::signbit(std_frac)) << "x = " << x;
+		if (!std::isinf(x)) { EXPECT_EQ(ccm_exp, std_exp) << "x = " << x; }
+	}
+} // namespace
+
 TEST(CcmathFmanipTests, Frexp)
 {
+	static_assert([] { int e = 0; return ccm::frexp(48.0, e) == 0.75 && e == 6; }(), "frexp has failed testing that it is static_assert-able!");
+
+	int exp		= 0;
+	double frac = ccm::frexp(-0.0, exp);
+	EXPECT_EQ(frac, 0.0);
+	EXPECT_TRUE(std::signbit(frac));
+	EXPECT_EQ(exp, 0);
 
+	frac = ccm::frexp(1024, exp);
+	EXPECT_EQ(frac, 0.5);
+	EXPECT_EQ(exp, 11);
 }
 
+TEST(CcmathFmanipTests, Frexp_Generic_MatchesStd)
+{
+	for (double x : {1.0, -3.5, 0.1, 0.0, -0.0, 0x1.0p-1074, -0x1.fffffffffffffp-1023, std::numeric_limits<double>::max(),
+					 std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()})
+	{
+		expect_frexp_matches_std(x);
+	}
+	for (float x : {1.0F, -3.5F, 0.1F, 0x1.0p-149F, 0x1.8p-130F, std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity()})
+	{
+		expect_frexp_matches_std(x);
+	}
+	for (int e = -1080; e <= 1030; ++e) { expect_frexp_matches_std(std::ldexp(1.375, e)); }
+}
@@ -10,12 +10,41 @@
 
 #include <gtest/gtest.h>
 
+#include <climits>
 #include <cmath>
 #include <limits>
 #include "ccmath/ccmath.hpp"
 
 TEST(CcmathFmanipTests, ILogb)
 {
+	static_assert(ccm::ilogb(10.0) == 3, "ilogb has failed testing that it is static_assert-able!");
 
+	EXPECT_EQ(ccm::ilogb(1.0), std::ilogb(1.0));
+	EXPECT_EQ(ccm::ilogb(-0.75F), std::ilogb(-0.75F));
+	EXPECT_EQ(ccm::ilogb(1000), std::ilogb(1000));
+	EXPECT_EQ(ccm::ilogb(0.0), FP_ILOGB0);
+	EXPECT_EQ(ccm::ilogb(std::numeric_limits<double>::quiet_NaN()), FP_ILOGBNAN);
+	EXPECT_EQ(ccm::ilogb(-std::numeric_limits<double>::infinity()), INT_MAX);
 }
 
+TEST(CcmathFmanipTests, ILogb_Generic_MatchesStd)
+{
+	EXPECT_EQ(ccm::gen::ilogb_gen(0.0), FP_ILOGB0);
+	EXPECT_EQ(ccm::gen::ilogb_gen(-0.0F), FP_ILOGB0);
+	EXPECT_EQ(ccm::gen::ilogb_gen(std::numeric_limits<double>::quiet_NaN()), FP_ILOGBNAN);
+	EXPECT_EQ(ccm::gen::ilogb_gen(std::numeric_limits<float>::infinity()), INT_MAX);
+
+	for (int e = -1080; e <= 1030; ++e)
+	{
+		const double x = std::ldexp(1.75, e);
+		if (x == 0.0 || std::isinf(x)) { continue; }
+		EXPECT_EQ(ccm::gen::ilogb_gen(x), std::ilogb(x)) << "x = " << x;
+		EXPECT_EQ(ccm::gen::ilogb_gen(-x), std::ilogb(-x)) << "x = " << x;
+	}
+	for (int e = -155; e <= 130; ++e)
+	{
+		const float x = std::ldexp(1.75F, e);
+		if (x == 0.0F || std::isinf(x)) { continue; }
+		EXPECT_EQ(ccm::gen::ilogb_gen(x), std::ilogb(x)) << "x = " << x;
+	}
+}
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cerrno>
 #include <cmath>
 #include <limits>
 #include "ccmath/ccmath.hpp"
@@ -73,3 +74,18 @@ TEST(CcmathFmanipTests, Ldexp)
 	EXPECT_TRUE(isCcmNanSameAsStdNanIfEitherArgumentIsNanf);
 }
 
+
+TEST(CcmathFmanipTests, Ldexp_NoErrnoPolicy)
+{
+	static_assert(ccm::ldexp<ccm::policy::no_errno>(1.5, 3) == 12.0, "ldexp has failed testing that it is static_assert-able!");
+
+	EXPECT_EQ(ccm::ldexp<ccm::policy::no_errno>(3.0F, -4), std::ldexp(3.0F, -4));
+	EXPECT_EQ(ccm::ldexp<ccm::policy::no_errno>(1.0, -1074), std::ldexp(1.0, -1074));
+	EXPECT_EQ(ccm::ldexp<ccm::policy::default_errno>(1.0, 10), 1024.0);
+
+	errno = 0;
+	volatile int large = 5000;
+	EXPECT_EQ(ccm::ldexp<ccm::policy::no_errno>(1.0, large), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::ldexp<ccm::policy::no_errno>(-1.0, -large), -0.0);
+	EXPECT_EQ(errno, 0);
+}
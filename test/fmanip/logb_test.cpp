@@ -16,6 +16,32 @@
 
 TEST(CcmathFmanipTests, Logb)
 {
+	static_assert(ccm::logb(10.0) == 3.0, "logb has failed testing that it is static_assert-able!");
 
+	EXPECT_EQ(ccm::logb(1.0), std::logb(1.0));
+	EXPECT_EQ(ccm::logb(-0.75F), std::logb(-0.75F));
+	EXPECT_EQ(ccm::logb(1000), std::logb(1000));
+	EXPECT_EQ(ccm::logb(0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::logb(-std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::logb(std::numeric_limits<double>::quiet_NaN())));
 }
 
+TEST(CcmathFmanipTests, Logb_Generic_MatchesStd)
+{
+	EXPECT_EQ(ccm::gen::logb_gen(-0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::gen::logb_gen(-std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::gen::logb_gen(std::numeric_limits<float>::quiet_NaN())));
+
+	for (int e = -1080; e <= 1030; ++e)
+	{
+		const double x = std::ldexp(1.25, e);
+		if (x == 0.0 || std::isinf(x)) { continue; }
+		EXPECT_EQ(ccm::gen::logb_gen(x), std::logb(x)) << "x = " << x;
+	}
+	for (int e = -155; e <= 130; ++e)
+	{
+		const float x = std::ldexp(-1.25F, e);
+		if (x == 0.0F || std::isinf(x)) { continue; }
+		EXPECT_EQ(ccm::gen::logb_gen(x), std::logb(x)) << "x = " << x;
+	}
+}
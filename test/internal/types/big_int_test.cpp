@@ -10,14 +10,108 @@
 
 #include <gtest/gtest.h>
 
-TEST(CcmathInternalTypesTests, BigIntTest)
+#include "ccmath/internal/types/big_int.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+	template <typename BigIntT>
+	BigIntT random_big_int(std::mt19937_64 & rng, std::size_t words = BigIntT::WORD_COUNT)
+	{
+		BigIntT result;
+		for (std::size_t i = 0; i < words; ++i) { result[i] = static_cast<typename BigIntT::word_type>(rng()); }
+		return result;
+	}
+
+	// The column by column product every other multiplication has to agree with.
+	template <typename word, std::size_t N>
+	std::array<word, 2 * N> reference_product(const std::array<word, N> & lhs, const std::array<word, N> & rhs)
+	{
+		std::array<word, 2 * N> product{};
+		ccm::types::multiword::multiply_with_carry(product, lhs, rhs);
+		return product;
+	}
+} // namespace
+
+TEST(CcmathInternalTypesTests, BigIntMultiplyMatchesInt128)
 {
+	std::mt19937_64 rng(42);
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto a = ccm::types::UInt<128>(rng()) | (ccm::types::UInt<128>(rng()) << 64);
+		const auto b = ccm::types::UInt<128>(rng()) | (ccm::types::UInt<128>(rng()) << 64);
 
-	//ccm::BigInt<64, false> a;
-	//auto t1 = ccm::BigInt<64, false>::bits;
-	//auto t2 = ccm::BigInt<64, false>::is_signed;
+		const __uint128_t a128 = (static_cast<__uint128_t>(a[1]) << 64) | a[0];
+		const __uint128_t b128 = (static_cast<__uint128_t>(b[1]) << 64) | b[0];
+		const __uint128_t p128 = a128 * b128;
 
-	//EXPECT_EQ(t1, 64);
-	//EXPECT_EQ(t2, false);
+		const auto product = a * b;
+		EXPECT_EQ(product[0], static_cast<std::uint64_t>(p128));
+		EXPECT_EQ(product[1], static_cast<std::uint64_t>(p128 >> 64));
+		EXPECT_EQ(a.ful_mul(b).val, reference_product(a.val, b.val));
+	}
+
+	static_assert(ccm::types::UInt<128>(3) * ccm::types::UInt<128>(5) == ccm::types::UInt<128>(15));
 }
 
+TEST(CcmathInternalTypesTests, BigIntKaratsubaMatchesSchoolbook)
+{
+	std::mt19937_64 rng(7);
+	for (int i = 0; i < 50; ++i)
+	{
+		const auto a16 = random_big_int<ccm::types::UInt<1024>>(rng);
+		const auto b16 = random_big_int<ccm::types::UInt<1024>>(rng);
+		EXPECT_EQ(a16.ful_mul(b16).val, reference_product(a16.val, b16.val));
+
+		// An odd word count splits unevenly, and all-ones operands make both half sums carry.
+		const auto a17 = random_big_int<ccm::types::UInt<1088>>(rng);
+		const auto b17 = ~ccm::types::UInt<1088>();
+		EXPECT_EQ(a17.ful_mul(b17).val, reference_product(a17.val, b17.val));
+		EXPECT_EQ(b17.ful_mul(b17).val, reference_product(b17.val, b17.val));
+
+		const auto a64 = random_big_int<ccm::types::BigInt<2048, false, std::uint32_t>>(rng);
+		const auto b64 = random_big_int<ccm::types::BigInt<2048, false, std::uint32_t>>(rng);
+		EXPECT_EQ(a64.ful_mul(b64).val, reference_product(a64.val, b64.val));
+	}
+}
+
+TEST(CcmathInternalTypesTests, BigIntDivide)
+{
+	using ccm::types::UInt;
+	std::mt19937_64 rng(1234);
+	for (int i = 0; i < 2000; ++i)
+	{
+		// Mixed lengths exercise short division, m < n and the add back step of algorithm D.
+		const auto dividend = random_big_int<UInt<512>>(rng, 1 + rng() % 8);
+		auto divider		= random_big_int<UInt<512>>(rng, 1 + rng() % 8);
+		if (divider.is_zero()) { divider = UInt<512>(1); }
+
+		const UInt<512> quotient  = dividend / divider;
+		const UInt<512> remainder = dividend % divider;
+		const UInt<512> product	  = quotient * divider;
+		EXPECT_LT(remainder, divider);
+		EXPECT_EQ(product + remainder, dividend);
+	}
+
+	// The top word of the remainder equals the top word of the divider, which makes the first estimate overflow a word.
+	const UInt<256> divider	 = (UInt<256>(0x8000000000000000ULL) << 128) | UInt<256>(1);
+	const UInt<256> dividend = (UInt<256>(0x7fffffffffffffffULL) << 192) | (UInt<256>(0xffffffffffffffffULL) << 128);
+	const UInt<256> product	  = (dividend / divider) * divider;
+	const UInt<256> remainder = dividend % divider;
+	EXPECT_EQ(product + remainder, dividend);
+
+	static_assert(UInt<256>(1000) / UInt<256>(7) == UInt<256>(142));
+	static_assert(UInt<256>(1000) % UInt<256>(7) == UInt<256>(6));
+}
+
+TEST(CcmathInternalTypesTests, BigIntSignedDivide)
+{
+	using ccm::types::Int;
+	EXPECT_EQ(Int<128>(-7) / Int<128>(2), Int<128>(-3));
+	EXPECT_EQ(Int<128>(-7) % Int<128>(2), Int<128>(-1));
+	EXPECT_EQ(Int<128>(7) / Int<128>(-2), Int<128>(-3));
+	EXPECT_EQ(Int<128>(-6) * Int<128>(7), Int<128>(-42));
+}
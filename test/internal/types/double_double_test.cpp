@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace
+{
+	template <typename Simd>
+	void expect_lanes_match_scalar()
+	{
+		constexpr int lanes = Simd::size();
+		std::mt19937_64 rng(lanes);
+		std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+		std::uniform_int_distribution<int> exponent(-60, 60);
+		for (int i = 0; i < 1000; ++i)
+		{
+			std::array<double, lanes> a{};
+			std::array<double, lanes> b{};
+			for (int j = 0; j < lanes; ++j)
+			{
+				a[j] = std::ldexp(mantissa(rng), exponent(rng));
+				b[j] = std::ldexp(mantissa(rng), exponent(rng));
+			}
+
+			const Simd va(a.data(), ccm::intrin::element_aligned_tag());
+			const Simd vb(b.data(), ccm::intrin::element_aligned_tag());
+			const auto product = ccm::type::exact_mult(va, vb);
+			const auto sum	   = ccm::type::two_sum(va, vb);
+
+			std::array<double, lanes> product_hi{};
+			std::array<double, lanes> product_lo{};
+			std::array<double, lanes> sum_hi{};
+			std::array<double, lanes> sum_lo{};
+			product.hi.copy_to(product_hi.data(), ccm::intrin::element_aligned_tag());
+			product.lo.copy_to(product_lo.data(), ccm::intrin::element_aligned_tag());
+			sum.hi.copy_to(sum_hi.data(), ccm::intrin::element_aligned_tag());
+			sum.lo.copy_to(sum_lo.data(), ccm::intrin::element_aligned_tag());
+
+			for (int j = 0; j < lanes; ++j)
+			{
+				// Dekker's product and the FMA give the same exact error term.
+				EXPECT_EQ(product_hi[j], a[j] * b[j]);
+				EXPECT_EQ(product_lo[j], std::fma(a[j], b[j], -(a[j] * b[j])));
+
+				// TwoSum agrees with FastTwoSum once the operands are ordered by magnitude.
+				const auto ordered = std::fabs(a[j]) >= std::fabs(b[j]) ? ccm::type::exact_add(a[j], b[j]) : ccm::type::exact_add(b[j], a[j]);
+				EXPECT_EQ(sum_hi[j], ordered.hi);
+				EXPECT_EQ(sum_lo[j], ordered.lo);
+			}
+		}
+	}
+} // namespace
+
+TEST(CcmathInternalTypesTests, DoubleDoubleSimdLanes)
+{
+	expect_lanes_match_scalar<ccm::intrin::native_simd<double>>();
+	expect_lanes_match_scalar<ccm::intrin::simd<double, ccm::intrin::abi::scalar>>();
+
+	static_assert(ccm::type::two_sum(1.0, 0x1.0p-60).lo == 0x1.0p-60);
+	static_assert(ccm::type::two_sum(0x1.0p-60, 1.0).lo == 0x1.0p-60);
+	static_assert(ccm::type::exact_mult(1.0 + 0x1.0p-30, 1.0 - 0x1.0p-30).lo == -0x1.0p-60);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/types/dyadic_float.hpp"
+#include "ccmath/math/expo/impl/exp_correctly_rounded_impl.hpp"
+
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace
+{
+	template <std::size_t Bits>
+	void expect_fma_matches_double()
+	{
+		using Dyadic = ccm::types::DyadicFloat<Bits>;
+		std::mt19937_64 rng(Bits);
+		std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+		std::uniform_int_distribution<int> exponent(-40, 40);
+		for (int i = 0; i < 10000; ++i)
+		{
+			const double a = std::ldexp(mantissa(rng), exponent(rng));
+			const double b = std::ldexp(mantissa(rng), exponent(rng));
+			// Half of the addends cancel most of the product.
+			const double c = i % 2 == 0 ? std::ldexp(mantissa(rng), exponent(rng)) : -a * b * (1.0 + std::ldexp(mantissa(rng), -30));
+
+			// The product of two doubles is exact in the mantissa, so rounding the result once gives std::fma.
+			EXPECT_EQ(static_cast<double>(ccm::types::quick_fma(Dyadic(a), Dyadic(b), Dyadic(c))), std::fma(a, b, c)) << a << " * " << b << " + " << c;
+			EXPECT_EQ(static_cast<double>(ccm::types::quick_mul(Dyadic(a), Dyadic(b))), a * b);
+			EXPECT_EQ(static_cast<double>(ccm::types::quick_add(Dyadic(a), Dyadic(c))), a + c);
+		}
+	}
+} // namespace
+
+TEST(CcmathInternalTypesTests, DyadicFloatQuickFma)
+{
+	// Bits == 128 takes the __uint128_t path, 256 the generic one.
+	expect_fma_matches_double<128>();
+	expect_fma_matches_double<256>();
+
+	using Dyadic = ccm::types::DyadicFloat<128>;
+	EXPECT_EQ(static_cast<double>(ccm::types::quick_fma(Dyadic(0.0), Dyadic(3.0), Dyadic(-2.5))), -2.5);
+	EXPECT_EQ(static_cast<double>(ccm::types::quick_fma(Dyadic(2.0), Dyadic(3.0), Dyadic(0.0))), 6.0);
+	EXPECT_EQ(static_cast<double>(ccm::types::quick_fma(Dyadic(2.0), Dyadic(3.0), Dyadic(-6.0))), 0.0);
+	static_assert(static_cast<double>(ccm::types::quick_fma(Dyadic(1.5), Dyadic(-4.0), Dyadic(1.0))) == -5.0);
+}
+
+TEST(CcmathInternalTypesTests, DyadicFloatPolyeval)
+{
+	using Dyadic = ccm::types::DyadicFloat<128>;
+
+	// 1 + x + x^2/2 + x^3/6
+	const std::array<Dyadic, 4> coeffs = {{Dyadic(1.0), Dyadic(1.0), Dyadic(0.5), ccm::types::quick_mul(Dyadic(1.0 / 3.0), Dyadic(0.5))}};
+	const std::array<Dyadic, 3> xs	   = {{Dyadic(0.25), Dyadic(-0.5), Dyadic(0.0)}};
+
+	const auto batch = ccm::types::polyeval(xs, coeffs);
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		const auto x = static_cast<double>(xs[i]);
+		EXPECT_EQ(static_cast<double>(batch[i]), static_cast<double>(ccm::types::polyeval(xs[i], coeffs)));
+		EXPECT_NEAR(static_cast<double>(batch[i]), 1.0 + x + x * x / 2 + x * x * x / 6, 1e-15);
+	}
+
+	// exp_dyadic evaluates its Taylor polynomial with polyeval.
+	static_assert(static_cast<double>(ccm::internal::impl::exp_dyadic(ccm::internal::impl::exp_dyadic_t(0.5))) == 0x1.a61298e1e069cp+0);
+	EXPECT_EQ(static_cast<double>(ccm::internal::impl::exp_dyadic(ccm::internal::impl::exp_dyadic_t(-1.25))), 0x1.25618372a584fp-2);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/runtime/simd/func/erf.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace
+{
+	// Error of a in units of the last place of T, against a reference computed in long double.
+	template <typename T>
+	long double ulp_error(T a, long double expected)
+	{
+		const auto rounded = static_cast<T>(expected);
+		const T ulp		   = std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity()) - std::fabs(rounded);
+		return std::fabs(static_cast<long double>(a) - expected) / ulp;
+	}
+} // namespace
+
+TEST(CcmathMiscTests, Erf_StaticAssert)
+{
+	static_assert(ccm::erf(0.0) == 0.0, "ccm::erf is not a compile time constant!");
+	static_assert(ccm::erfc(0.0F) == 1.0F, "ccm::erfc is not a compile time constant!");
+}
+
+TEST(CcmathMiscTests, Erf_SpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	EXPECT_TRUE(std::signbit(ccm::erf(-0.0)));
+	EXPECT_EQ(ccm::erf(inf), 1.0);
+	EXPECT_EQ(ccm::erf(-inf), -1.0);
+	EXPECT_EQ(ccm::erfc(inf), 0.0);
+	EXPECT_EQ(ccm::erfc(-inf), 2.0);
+	EXPECT_EQ(ccm::erfc(30.0), 0.0);
+	EXPECT_TRUE(std::isnan(ccm::erf(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::erfc(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(ccm::erf(0), 0.0);
+}
+
+TEST(CcmathMiscTests, Erf_Double_Accuracy)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> dist(-7.0, 7.0);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double x = i % 8 == 0 ? std::ldexp(dist(rng), -(i % 1000)) : dist(rng);
+		EXPECT_LE(ulp_error(ccm::erf(x), std::erf(static_cast<long double>(x))), 1.0L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Erfc_Double_Accuracy)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> dist(-7.0, 27.0);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double x = dist(rng);
+		EXPECT_LE(ulp_error(ccm::erfc(x), std::erfc(static_cast<long double>(x))), 2.5L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Erf_Float_Accuracy)
+{
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> dist(-5.0F, 11.0F);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const float x = dist(rng);
+		EXPECT_LE(ulp_error(ccm::erf(x), std::erf(static_cast<long double>(x))), 0.5L) << "x = " << x;
+		EXPECT_LE(ulp_error(ccm::erfc(x), std::erfc(static_cast<long double>(x))), 0.5L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Erf_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(11);
+	std::uniform_real_distribution<double> dist(-8.0, 30.0);
+	const double specials[] = {0.0, -0.0, 0.5, 0.84375, -6.0, 6.0, 27.3, 28.0, std::numeric_limits<double>::infinity(),
+							   -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+	for (int round = 0; round < 2000; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = round % 4 == 0 ? specials[(round + i) % 11] : dist(rng); }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		double erf_lanes[width];
+		double erfc_lanes[width];
+		ccm::intrin::erf(v).copy_to(erf_lanes, ccm::intrin::element_aligned_tag());
+		ccm::intrin::erfc(v).copy_to(erfc_lanes, ccm::intrin::element_aligned_tag());
+
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			if (std::isnan(lanes[i]))
+			{
+				EXPECT_TRUE(std::isnan(erf_lanes[i]) && std::isnan(erfc_lanes[i]));
+				continue;
+			}
+			const double expected_erf  = ccm::gen::erf_gen(lanes[i]);
+			const double expected_erfc = ccm::gen::erfc_gen(lanes[i]);
+			EXPECT_EQ(std::memcmp(&erf_lanes[i], &expected_erf, sizeof(double)), 0) << "x = " << lanes[i];
+			EXPECT_EQ(std::memcmp(&erfc_lanes[i], &expected_erfc, sizeof(double)), 0) << "x = " << lanes[i];
+		}
+	}
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/runtime/simd/func/erfinv.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace
+{
+	// Error of a in units of the last place of T, against a reference computed in long double.
+	template <typename T>
+	long double ulp_error(T a, long double expected)
+	{
+		const auto rounded = static_cast<T>(expected);
+		const T ulp		   = std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity()) - std::fabs(rounded);
+		return std::fabs(static_cast<long double>(a) - expected) / ulp;
+	}
+
+	constexpr long double two_over_sqrt_pi = 1.128379167095512573896158903121545172L;
+
+	// erfcinv(z) for z in (0, 1], by Newton steps from the guess x in long double. Taking the small side of erfc keeps
+	// the residual free of cancellation.
+	long double reference_erfcinv(long double z, long double x)
+	{
+		for (int step = 0; step < 3; ++step) { x += (std::erfc(x) - z) / (two_over_sqrt_pi * std::exp(-x * x)); }
+		return x;
+	}
+
+	long double reference_erfinv(long double y, long double x)
+	{
+		if (std::fabs(y) < 0.5L)
+		{
+			for (int step = 0; step < 3; ++step) { x -= (std::erf(x) - y) / (two_over_sqrt_pi * std::exp(-x * x)); }
+			return x;
+		}
+		const long double magnitude = reference_erfcinv(1 - std::fabs(y), std::fabs(x));
+		return y < 0 ? -magnitude : magnitude;
+	}
+
+	// Uniform in (0, 1), with every third value spread over the exponents instead.
+	double spread_uniform(std::mt19937_64 & rng, int i)
+	{
+		std::uniform_real_distribution<double> dist(0.0, 1.0);
+		const double u = dist(rng);
+		return i % 3 == 0 ? std::ldexp(u, -(i % 1060)) : u;
+	}
+} // namespace
+
+TEST(CcmathMiscTests, Erfinv_StaticAssert)
+{
+	static_assert(ccm::erfinv(0.0) == 0.0, "ccm::erfinv is not a compile time constant!");
+	static_assert(ccm::erfcinv(1.0F) == 0.0F, "ccm::erfcinv is not a compile time constant!");
+}
+
+TEST(CcmathMiscTests, Erfinv_SpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	EXPECT_TRUE(std::signbit(ccm::erfinv(-0.0)));
+	EXPECT_EQ(ccm::erfinv(1.0), inf);
+	EXPECT_EQ(ccm::erfinv(-1.0), -inf);
+	EXPECT_TRUE(std::isnan(ccm::erfinv(1.5)));
+	EXPECT_TRUE(std::isnan(ccm::erfinv(-inf)));
+	EXPECT_TRUE(std::isnan(ccm::erfinv(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::erfcinv(0.0), inf);
+	EXPECT_EQ(ccm::erfcinv(2.0), -inf);
+	EXPECT_EQ(ccm::erfcinv(1.0), 0.0);
+	EXPECT_TRUE(std::isnan(ccm::erfcinv(-0.5)));
+	EXPECT_TRUE(std::isnan(ccm::erfcinv(2.5F)));
+	EXPECT_TRUE(std::isnan(ccm::erfcinv(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(ccm::erfinv(0), 0.0);
+
+	// The smallest arguments keep their bits.
+	const double tiny = std::numeric_limits<double>::denorm_min();
+	EXPECT_EQ(ccm::erfinv(tiny), tiny);
+	EXPECT_GT(ccm::erfcinv(tiny), 27.0);
+}
+
+TEST(CcmathMiscTests, Erfinv_Double_Accuracy)
+{
+	std::mt19937_64 rng(13);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double u = spread_uniform(rng, i);
+		const double y = i % 2 == 0 ? 1.0 - u : 2.0 * u - 1.0;
+		if (std::fabs(y) == 1.0) { continue; }
+		const double x = ccm::erfinv(y);
+		EXPECT_LE(ulp_error(x, reference_erfinv(y, x)), 7.0L) << "y = " << y;
+	}
+}
+
+TEST(CcmathMiscTests, Erfcinv_Double_Accuracy)
+{
+	std::mt19937_64 rng(13);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double z = spread_uniform(rng, i);
+		const double x = ccm::erfcinv(z);
+		EXPECT_LE(ulp_error(x, reference_erfcinv(z, x)), 7.0L) << "z = " << z;
+		// erfcinv(2 - z) = -erfcinv(z), with 2 - z rounded.
+		const double w = 2.0 - z;
+		if (w == 2.0) { continue; }
+		EXPECT_LE(ulp_error(ccm::erfcinv(w), -reference_erfcinv(2.0L - w, -ccm::erfcinv(w))), 7.0L) << "z = " << w;
+	}
+}
+
+TEST(CcmathMiscTests, Erfinv_Float_Accuracy)
+{
+	std::mt19937_64 rng(13);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const auto y = static_cast<float>(2.0 * spread_uniform(rng, i) - 1.0);
+		if (y == -1.0F) { continue; }
+		const float x = ccm::erfinv(y);
+		EXPECT_LE(ulp_error(x, reference_erfinv(y, x)), 0.5L) << "y = " << y;
+	}
+}
+
+TEST(CcmathMiscTests, Erfinv_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(19);
+	std::uniform_real_distribution<double> dist(-0.2, 2.2);
+	const double specials[] = {0.0, -0.0, 1.0, 2.0, 0.15, 1.85, 1e-300, 2.0 - 1e-16, std::numeric_limits<double>::infinity(),
+							   -1.0, std::numeric_limits<double>::quiet_NaN()};
+	for (int round = 0; round < 2000; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			lanes[i] = round % 4 == 0 ? specials[(round + i) % 11] : (round % 4 == 1 ? std::ldexp(dist(rng), -(round % 900)) : dist(rng));
+		}
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		double erfinv_lanes[width];
+		double erfcinv_lanes[width];
+		ccm::intrin::erfinv(v - 1.0).copy_to(erfinv_lanes, ccm::intrin::element_aligned_tag());
+		ccm::intrin::erfcinv(v).copy_to(erfcinv_lanes, ccm::intrin::element_aligned_tag());
+
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			const double expected_erfinv  = ccm::gen::erfinv_gen(lanes[i] - 1.0);
+			const double expected_erfcinv = ccm::gen::erfcinv_gen(lanes[i]);
+			if (std::isnan(expected_erfinv)) { EXPECT_TRUE(std::isnan(erfinv_lanes[i])) << "y = " << lanes[i] - 1.0; }
+			else { EXPECT_EQ(std::memcmp(&erfinv_lanes[i], &expected_erfinv, sizeof(double)), 0) << "y = " << lanes[i] - 1.0; }
+			if (std::isnan(expected_erfcinv)) { EXPECT_TRUE(std::isnan(erfcinv_lanes[i])) << "z = " << lanes[i]; }
+			else { EXPECT_EQ(std::memcmp(&erfcinv_lanes[i], &expected_erfcinv, sizeof(double)), 0) << "z = " << lanes[i]; }
+		}
+	}
+}
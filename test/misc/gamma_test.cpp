@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/runtime/simd/func/gamma.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace
+{
+	// Error of a in units of the last place of T, against a reference computed in long double.
+	template <typename T>
+	long double ulp_error(T a, long double expected)
+	{
+		const auto rounded = static_cast<T>(expected);
+		const T ulp		   = std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity()) - std::fabs(rounded);
+		return std::fabs(static_cast<long double>(a) - expected) / ulp;
+	}
+} // namespace
+
+TEST(CcmathMiscTests, Gamma_StaticAssert)
+{
+	static_assert(ccm::tgamma(5.0) == 24.0, "ccm::tgamma is not a compile time constant!");
+	static_assert(ccm::lgamma(2.0F) == 0.0F, "ccm::lgamma is not a compile time constant!");
+}
+
+TEST(CcmathMiscTests, Gamma_SpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	EXPECT_EQ(ccm::tgamma(0.0), inf);
+	EXPECT_EQ(ccm::tgamma(-0.0), -inf);
+	EXPECT_EQ(ccm::tgamma(inf), inf);
+	EXPECT_EQ(ccm::tgamma(172.0), inf);
+	EXPECT_TRUE(std::isnan(ccm::tgamma(-inf)));
+	EXPECT_TRUE(std::isnan(ccm::tgamma(-3.0)));
+	EXPECT_TRUE(std::isnan(ccm::tgamma(-0x1.0p60)));
+	EXPECT_TRUE(std::isnan(ccm::tgamma(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::tgamma(1.0), 1.0);
+	EXPECT_EQ(ccm::tgamma(10), 362880.0);
+	EXPECT_TRUE(std::signbit(ccm::tgamma(-190.5)));
+
+	EXPECT_EQ(ccm::lgamma(1.0), 0.0);
+	EXPECT_EQ(ccm::lgamma(0.0), inf);
+	EXPECT_EQ(ccm::lgamma(-2.0), inf);
+	EXPECT_EQ(ccm::lgamma(-0x1.0p60), inf);
+	EXPECT_EQ(ccm::lgamma(inf), inf);
+	EXPECT_EQ(ccm::lgamma(-inf), inf);
+	EXPECT_EQ(ccm::lgamma(1e306), inf);
+	EXPECT_TRUE(std::isnan(ccm::lgamma(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(CcmathMiscTests, Tgamma_Double_Accuracy)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> positive(0.0, 171.6);
+	std::uniform_real_distribution<double> negative(-184.0, 0.0);
+	for (int i = 0; i < 50000; ++i)
+	{
+		const double x = i % 4 == 0 ? std::ldexp(positive(rng), -(i % 64)) : positive(rng);
+		EXPECT_LE(ulp_error(ccm::tgamma(x), std::tgamma(static_cast<long double>(x))), 1.6L) << "x = " << x;
+
+		const double y = negative(rng);
+		if (y == std::floor(y)) { continue; }
+		EXPECT_LE(ulp_error(ccm::tgamma(y), std::tgamma(static_cast<long double>(y))), 2.0L) << "x = " << y;
+	}
+}
+
+TEST(CcmathMiscTests, Tgamma_Double_NegativeWorstCases)
+{
+	// Arguments where the reflection once lost up to 5.7 ulp, beyond tgamma_max and below it.
+	for (const double x : {-0x1.58000216e4604p+7, -0x1.49fa7a1b44cb6p+6, -0x1.57fffb95c6175p+7, -0x1.7bfffeb074a77p+7})
+	{
+		EXPECT_LE(ulp_error(ccm::tgamma(x), std::tgamma(static_cast<long double>(x))), 2.0L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Lgamma_Double_Accuracy)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> small(0.0, 12.0);
+	std::uniform_real_distribution<double> exponent(0.0, 700.0);
+	for (int i = 0; i < 50000; ++i)
+	{
+		const double x = small(rng);
+		EXPECT_LE(ulp_error(ccm::lgamma(x), std::lgamma(static_cast<long double>(x))), 2.0L) << "x = " << x;
+
+		const double y = std::exp(exponent(rng));
+		EXPECT_LE(ulp_error(ccm::lgamma(y), std::lgamma(static_cast<long double>(y))), 2.0L) << "x = " << y;
+	}
+}
+
+TEST(CcmathMiscTests, Lgamma_Double_Negative)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> negative(-40.0, 0.0);
+	for (int i = 0; i < 50000; ++i)
+	{
+		const double x = negative(rng);
+		if (x == std::floor(x)) { continue; }
+		EXPECT_LE(ulp_error(ccm::lgamma(x), std::lgamma(static_cast<long double>(x))), 3.0L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Lgamma_Double_NearZeros)
+{
+	// Doubles up to 2^40 ulp either side of some of the zeros below -2, where the reflection cancels.
+	const double zeros[] = {-0x1.3a7fc9600f86cp+1, -0x1.5fb410a1bd901p+1, -0x1.9260dbc9e59afp+1, -0x1.fa471547c2fe5p+1,
+							-0x1.0284e78599581p+2, -0x1.3f7577a6eeafdp+2, -0x1.4086a57f0b6d9p+2, -0x1.200005c7768fbp+3};
+	for (const double zero : zeros)
+	{
+		const double ulp = std::nextafter(zero, 0.0) - zero;
+		for (int bits = 0; bits <= 40; ++bits)
+		{
+			for (const double direction : {-1.0, 1.0})
+			{
+				const double x = zero + direction * std::ldexp(ulp, bits);
+				EXPECT_LE(ulp_error(ccm::lgamma(x), std::lgamma(static_cast<long double>(x))), 2.0L) << "x = " << x;
+			}
+		}
+	}
+}
+
+TEST(CcmathMiscTests, Gamma_Float_Accuracy)
+{
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> dist(0.0F, 35.0F);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const float x = dist(rng);
+		EXPECT_LE(ulp_error(ccm::tgamma(x), std::tgamma(static_cast<long double>(x))), 0.5L) << "x = " << x;
+		EXPECT_LE(ulp_error(ccm::lgamma(x), std::lgamma(static_cast<long double>(x))), 0.5L) << "x = " << x;
+	}
+}
+
+TEST(CcmathMiscTests, Gamma_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(11);
+	std::uniform_real_distribution<double> dist(-200.0, 200.0);
+	const double specials[] = {0.0,	   -0.0,  1.0,	 2.0,	  -3.0,	  -2.5,	  0x1.0p-60, 9.99, 10.0, 171.7, -171.7, -190.5, -0x1.58000216e4604p+7, -0x1.49fa7a1b44cb6p+6, -189.99, 1e306, -0x1.0p52,
+							   -0x1.3a7fc9600f86cp+1, -0x1.fa471547c2fe5p+1, 1e-300, -1e-300, 5e-324, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+							   std::numeric_limits<double>::quiet_NaN()};
+	constexpr std::size_t count = sizeof(specials) / sizeof(specials[0]);
+	for (int round = 0; round < 2000; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = round % 4 == 0 ? specials[(round + i) % count] : dist(rng); }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		double tgamma_lanes[width];
+		double lgamma_lanes[width];
+		ccm::intrin::tgamma(v).copy_to(tgamma_lanes, ccm::intrin::element_aligned_tag());
+		ccm::intrin::lgamma(v).copy_to(lgamma_lanes, ccm::intrin::element_aligned_tag());
+
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			const double expected_tgamma = ccm::gen::tgamma_gen(lanes[i]);
+			const double expected_lgamma = ccm::gen::lgamma_gen(lanes[i]);
+			if (std::isnan(expected_tgamma)) { EXPECT_TRUE(std::isnan(tgamma_lanes[i])) << "x = " << lanes[i]; }
+			else { EXPECT_EQ(std::memcmp(&tgamma_lanes[i], &expected_tgamma, sizeof(double)), 0) << "x = " << lanes[i]; }
+			if (std::isnan(expected_lgamma)) { EXPECT_TRUE(std::isnan(lgamma_lanes[i])) << "x = " << lanes[i]; }
+			else { EXPECT_EQ(std::memcmp(&lgamma_lanes[i], &expected_lgamma, sizeof(double)), 0) << "x = " << lanes[i]; }
+		}
+	}
+}
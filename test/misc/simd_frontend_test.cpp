@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	using simd_double = ccm::intrin::native_simd<double>;
+	using simd_float  = ccm::intrin::native_simd<float>;
+
+	static_assert(ccm::is_simd_v<simd_double>);
+	static_assert(ccm::is_simd_v<const simd_float>);
+	static_assert(!ccm::is_simd_v<double>);
+
+	// Generic code that is written once for scalars and lanes.
+	template <typename T>
+	constexpr T generic_kernel(T x)
+	{
+		return ccm::fma(ccm::sqrt(x), ccm::fabs(x), ccm::floor(x));
+	}
+
+	template <typename T>
+	bool close(T actual, T expected)
+	{
+		if (std::isnan(expected)) { return std::isnan(actual); }
+		if (std::isinf(expected) || expected == T(0)) { return actual == expected; }
+		return std::fabs(actual - expected) <= T(4) * std::numeric_limits<T>::epsilon() * std::fabs(expected);
+	}
+
+	template <typename T, typename Lanes, typename Scalar>
+	void check_unary(std::vector<T> const & x, Lanes && lanes, Scalar && scalar, char const * name)
+	{
+		using simd_type				= ccm::intrin::native_simd<T>;
+		constexpr std::size_t width = simd_type::size();
+
+		std::vector<T> padded = x;
+		padded.resize((x.size() + width - 1) / width * width, T(1));
+		T out[width];
+		for (std::size_t i = 0; i < padded.size(); i += width)
+		{
+			lanes(simd_type(padded.data() + i, ccm::intrin::element_aligned_tag())).copy_to(out, ccm::intrin::element_aligned_tag());
+			for (std::size_t j = 0; j < width; ++j) { EXPECT_TRUE(close(out[j], scalar(padded[i + j]))) << name << "(" << padded[i + j] << ") = " << out[j]; }
+		}
+	}
+
+	template <typename T>
+	void check_frontends()
+	{
+		using simd_type = ccm::intrin::native_simd<T>;
+		const std::vector<T> x{T(0.5), T(1), T(2.25), T(3), T(7.5), T(10), T(33.25), T(0.125), T(100), T(1.0e-3), T(4.75), T(12)};
+		const simd_type two(T(2));
+
+		check_unary<T>(x, [](simd_type v) { return generic_kernel(v); }, [](T v) { return generic_kernel(v); }, "generic_kernel");
+		check_unary<T>(x, [](simd_type v) { return ccm::exp(v); }, [](T v) { return ccm::exp(v); }, "exp");
+		check_unary<T>(x, [](simd_type v) { return ccm::exp2(v); }, [](T v) { return ccm::exp2(v); }, "exp2");
+		check_unary<T>(x, [](simd_type v) { return ccm::log(v); }, [](T v) { return ccm::log(v); }, "log");
+		check_unary<T>(x, [](simd_type v) { return ccm::log2(v); }, [](T v) { return ccm::log2(v); }, "log2");
+		check_unary<T>(x, [](simd_type v) { return ccm::cbrt(v); }, [](T v) { return ccm::cbrt(v); }, "cbrt");
+		check_unary<T>(x, [](simd_type v) { return ccm::erf(v); }, [](T v) { return ccm::erf(v); }, "erf");
+		check_unary<T>(x, [](simd_type v) { return ccm::erfc(v); }, [](T v) { return ccm::erfc(v); }, "erfc");
+		check_unary<T>(x, [](simd_type v) { return ccm::tgamma(v); }, [](T v) { return ccm::tgamma(v); }, "tgamma");
+		check_unary<T>(x, [](simd_type v) { return ccm::lgamma(v); }, [](T v) { return ccm::lgamma(v); }, "lgamma");
+		check_unary<T>(x, [](simd_type v) { return ccm::logb(v); }, [](T v) { return ccm::logb(v); }, "logb");
+		check_unary<T>(x, [](simd_type v) { return ccm::trunc(v); }, [](T v) { return ccm::trunc(v); }, "trunc");
+		check_unary<T>(x, [=](simd_type v) { return ccm::pow(v, two); }, [](T v) { return ccm::pow(v, T(2)); }, "pow");
+		check_unary<T>(x, [=](simd_type v) { return ccm::hypot(v, two); }, [](T v) { return ccm::hypot(v, T(2)); }, "hypot");
+		check_unary<T>(x, [=](simd_type v) { return ccm::hypot(v, two, v); }, [](T v) { return ccm::hypot(v, T(2), v); }, "hypot3");
+		check_unary<T>(x, [](simd_type v) { return ccm::ldexp(v, 3); }, [](T v) { return ccm::ldexp(v, 3); }, "ldexp");
+		check_unary<T>(x, [](simd_type v) { return ccm::scalbn(v, -2); }, [](T v) { return ccm::scalbn(v, -2); }, "scalbn");
+		check_unary<T>(x, [=](simd_type v) { return ccm::fdim(v, two); }, [](T v) { return ccm::fdim(v, T(2)); }, "fdim");
+		check_unary<T>(x, [=](simd_type v) { return ccm::fmod(v, two); }, [](T v) { return ccm::fmod(v, T(2)); }, "fmod");
+		check_unary<T>(x, [=](simd_type v) { return ccm::remainder(v, two); }, [](T v) { return ccm::remainder(v, T(2)); }, "remainder");
+		check_unary<T>(x, [=](simd_type v) { return ccm::fmax(v, two); }, [](T v) { return ccm::fmax(v, T(2)); }, "fmax");
+		check_unary<T>(x, [=](simd_type v) { return ccm::min(v, two); }, [](T v) { return ccm::min(v, T(2)); }, "min");
+		check_unary<T>(x, [=](simd_type v) { return ccm::copysign(v, -two); }, [](T v) { return ccm::copysign(v, T(-2)); }, "copysign");
+	}
+} // namespace
+
+TEST(CcmathMiscTests, SimdFrontend_StaticAssert)
+{
+	static_assert(generic_kernel(4.0) == 12.0, "generic_kernel has failed testing that it is static_assert-able!");
+}
+
+TEST(CcmathMiscTests, SimdFrontend_Double)
+{
+	check_frontends<double>();
+}
+
+TEST(CcmathMiscTests, SimdFrontend_Float)
+{
+	check_frontends<float>();
+}
+
+TEST(CcmathMiscTests, SimdFrontend_Classify)
+{
+	const double values[4] = {1.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), -0.0};
+	double lanes[simd_double::size()];
+	for (std::size_t i = 0; i < simd_double::size(); ++i) { lanes[i] = values[i % 4]; }
+	const simd_double v(lanes, ccm::intrin::element_aligned_tag());
+
+	const simd_double one(1.0);
+	const simd_double zero(0.0);
+	double nan_lanes[simd_double::size()];
+	double inf_lanes[simd_double::size()];
+	double finite_lanes[simd_double::size()];
+	ccm::intrin::choose(ccm::isnan(v), one, zero).copy_to(nan_lanes, ccm::intrin::element_aligned_tag());
+	ccm::intrin::choose(ccm::isinf(v), one, zero).copy_to(inf_lanes, ccm::intrin::element_aligned_tag());
+	ccm::intrin::choose(ccm::isfinite(v), one, zero).copy_to(finite_lanes, ccm::intrin::element_aligned_tag());
+	for (std::size_t i = 0; i < simd_double::size(); ++i)
+	{
+		EXPECT_EQ(nan_lanes[i] == 1.0, std::isnan(lanes[i])) << "x = " << lanes[i];
+		EXPECT_EQ(inf_lanes[i] == 1.0, std::isinf(lanes[i])) << "x = " << lanes[i];
+		EXPECT_EQ(finite_lanes[i] == 1.0, std::isfinite(lanes[i])) << "x = " << lanes[i];
+	}
+}
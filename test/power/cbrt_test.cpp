@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/runtime/simd/func/cbrt.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace
+{
+	// Error of a in units of the last place of T, against a reference computed in long double.
+	template <typename T>
+	long double ulp_error(T a, long double expected)
+	{
+		const auto rounded = static_cast<T>(expected);
+		const T ulp		   = std::nextafter(std::fabs(rounded), std::numeric_limits<T>::infinity()) - std::fabs(rounded);
+		return std::fabs(static_cast<long double>(a) - expected) / ulp;
+	}
+} // namespace
+
+TEST(CcmathPowerTests, Cbrt_StaticAssert)
+{
+	static_assert(ccm::cbrt(27.0) == 3.0, "ccm::cbrt is not a compile time constant!");
+	static_assert(ccm::cbrt(-64.0F) == -4.0F, "ccm::cbrt is not a compile time constant!");
+}
+
+TEST(CcmathPowerTests, Cbrt_SpecialValues)
+{
+	EXPECT_EQ(ccm::cbrt(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::cbrt(-0.0)));
+	EXPECT_EQ(ccm::cbrt(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::cbrt(-std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::cbrt(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::cbrt(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(ccm::cbrt(8), 2.0);
+}
+
+TEST(CcmathPowerTests, Cbrt_Double_Accuracy)
+{
+	std::mt19937_64 rng(7);
+	std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+	std::uniform_int_distribution<int> exponent(-1074, 1023);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double x = std::ldexp(mantissa(rng), exponent(rng)) * (i % 2 == 0 ? 1.0 : -1.0);
+		if (x == 0.0) { continue; }
+		EXPECT_LE(ulp_error(ccm::cbrt(x), std::cbrt(static_cast<long double>(x))), 1.0L) << "x = " << x;
+	}
+}
+
+TEST(CcmathPowerTests, Cbrt_Float_Accuracy)
+{
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> mantissa(1.0F, 2.0F);
+	std::uniform_int_distribution<int> exponent(-149, 127);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const float x = std::ldexp(mantissa(rng), exponent(rng)) * (i % 2 == 0 ? 1.0F : -1.0F);
+		if (x == 0.0F || std::isinf(x)) { continue; }
+		EXPECT_LE(ulp_error(ccm::cbrt(x), std::cbrt(static_cast<long double>(x))), 1.0L) << "x = " << x;
+	}
+}
+
+TEST(CcmathPowerTests, Cbrt_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	const double inputs[] = {0.0, -0.0, 1.0, -8.0, 0x1.0p-1074, -0x1.8p-1030, 1e300, 3.7, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+	for (double input : inputs)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = input; }
+		simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		ccm::intrin::cbrt(v).copy_to(lanes, ccm::intrin::element_aligned_tag());
+
+		const double expected = ccm::cbrt(input);
+		for (std::size_t i = 0; i < width; ++i) { EXPECT_EQ(std::memcmp(&lanes[i], &expected, sizeof(double)), 0) << "x = " << input; }
+	}
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "ccmath/internal/math/runtime/simd/func/hypot.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+
+TEST(CcmathPowerTests, Hypot_StaticAssert)
+{
+	static_assert(ccm::hypot(3.0, 4.0) == 5.0, "ccm::hypot is not a compile time constant!");
+	static_assert(ccm::hypot(2.0F, 3.0F, 6.0F) == 7.0F, "ccm::hypot is not a compile time constant!");
+}
+
+TEST(CcmathPowerTests, Hypot_SpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+	EXPECT_EQ(ccm::hypot(inf, nan), inf);
+	EXPECT_EQ(ccm::hypot(nan, -inf), inf);
+	EXPECT_EQ(ccm::hypot(1.0, nan, -inf), inf);
+	EXPECT_TRUE(std::isnan(ccm::hypot(nan, 1.0)));
+	EXPECT_TRUE(std::isnan(ccm::hypot(1.0, 2.0, nan)));
+	EXPECT_EQ(ccm::hypot(-0.0, 0.0), 0.0);
+	EXPECT_FALSE(std::signbit(ccm::hypot(-0.0, -0.0)));
+	EXPECT_EQ(ccm::hypot(-5.0, 0.0), 5.0);
+	EXPECT_EQ(ccm::hypot(3, 4), 5.0);
+}
+
+TEST(CcmathPowerTests, Hypot_NoOverflowOrUnderflow)
+{
+	EXPECT_EQ(ccm::hypot(3e300, 4e300), std::hypot(3e300, 4e300));
+	EXPECT_EQ(ccm::hypot(3e-320, 4e-320), std::hypot(3e-320, 4e-320));
+	EXPECT_EQ(ccm::hypot(0x1.0p-1074, 0.0), 0x1.0p-1074);
+	EXPECT_EQ(ccm::hypot(std::numeric_limits<double>::max(), 1.0), std::numeric_limits<double>::max());
+	EXPECT_EQ(ccm::hypot(std::numeric_limits<double>::max(), std::numeric_limits<double>::max()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::hypot(3e30F, 4e30F), 5e30F);
+	EXPECT_EQ(ccm::hypot(3e30F, 4e30F, 12e30F), 13e30F);
+	EXPECT_EQ(ccm::hypot(3e-40F, 4e-40F), std::hypot(3e-40F, 4e-40F));
+}
+
+TEST(CcmathPowerTests, Hypot_Double_Accuracy)
+{
+	std::mt19937_64 rng(11);
+	std::uniform_real_distribution<double> dist(-1e3, 1e3);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double x			   = dist(rng);
+		const double y			   = dist(rng);
+		const long double expected = std::hypot(static_cast<long double>(x), static_cast<long double>(y));
+		const double r			   = ccm::hypot(x, y);
+		const double ulp		   = std::nextafter(r, 1e300) - r;
+		EXPECT_LE(std::fabs(static_cast<long double>(r) - expected), ulp) << x << ", " << y;
+	}
+}
+
+TEST(CcmathPowerTests, Hypot_Float_CorrectlyRounded)
+{
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<float> dist(-1e3F, 1e3F);
+	for (int i = 0; i < 100000; ++i)
+	{
+		const float x	= dist(rng);
+		const float y	= dist(rng);
+		const float z	= dist(rng);
+		const double xd = x;
+		const double yd = y;
+		const double zd = z;
+		// The squares of floats are exact in double, so these round only at the square root and the final conversion.
+		EXPECT_EQ(ccm::hypot(x, y), static_cast<float>(std::sqrt(xd * xd + yd * yd))) << x << ", " << y;
+		EXPECT_FLOAT_EQ(ccm::hypot(x, y, z), static_cast<float>(std::sqrt(xd * xd + yd * yd + zd * zd))) << x << ", " << y << ", " << z;
+	}
+}
+
+TEST(CcmathPowerTests, Hypot_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<float>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937 rng(5);
+	std::uniform_int_distribution<std::uint32_t> bits;
+	for (int n = 0; n < 10000; ++n)
+	{
+		float xs[width];
+		float ys[width];
+		float zs[width];
+		float out2[width];
+		float out3[width];
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			const std::uint32_t bx = bits(rng);
+			const std::uint32_t by = bits(rng);
+			const std::uint32_t bz = bits(rng);
+			std::memcpy(&xs[i], &bx, sizeof(float));
+			std::memcpy(&ys[i], &by, sizeof(float));
+			std::memcpy(&zs[i], &bz, sizeof(float));
+		}
+		const simd_type x(xs, ccm::intrin::element_aligned_tag());
+		const simd_type y(ys, ccm::intrin::element_aligned_tag());
+		const simd_type z(zs, ccm::intrin::element_aligned_tag());
+		ccm::intrin::hypot(x, y).copy_to(out2, ccm::intrin::element_aligned_tag());
+		ccm::intrin::hypot(x, y, z).copy_to(out3, ccm::intrin::element_aligned_tag());
+
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			const float r2 = ccm::hypot(xs[i], ys[i]);
+			const float r3 = ccm::hypot(xs[i], ys[i], zs[i]);
+			if (std::isnan(r2)) { EXPECT_TRUE(std::isnan(out2[i])); }
+			else { EXPECT_EQ(out2[i], r2) << xs[i] << ", " << ys[i]; }
+			if (std::isnan(r3)) { EXPECT_TRUE(std::isnan(out3[i])); }
+			else { EXPECT_EQ(out3[i], r3) << xs[i] << ", " << ys[i] << ", " << zs[i]; }
+		}
+	}
+}
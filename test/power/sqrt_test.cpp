@@ -16,6 +16,7 @@
 
 #include "ccmath/ccmath.hpp"
 
+#include <cerrno>
 #include <cmath>
 #include <limits>
 
@@ -231,3 +232,20 @@ TEST(CcmathPowerTests, Sqrt_RT_LDouble_EdgeCases)
 }
 #endif // defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
 */
+
+TEST(CcmathPowerTests, Sqrt_NoErrnoPolicy)
+{
+	static_assert(ccm::sqrt<ccm::policy::no_errno>(4.0) == 2.0, "sqrt has failed testing that it is static_assert-able!");
+
+	EXPECT_EQ(ccm::sqrt<ccm::policy::no_errno>(2.0), std::sqrt(2.0));
+	EXPECT_EQ(ccm::sqrt<ccm::policy::no_errno>(0.3F), std::sqrt(0.3F));
+	EXPECT_EQ(ccm::sqrt<ccm::policy::no_errno>(-0.0), -0.0);
+	EXPECT_EQ(ccm::sqrt<ccm::policy::no_errno>(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sqrt<ccm::policy::default_errno>(9.0), 3.0);
+
+	errno = 0;
+	volatile double negative = -1.0;
+	EXPECT_TRUE(std::isnan(ccm::sqrt<ccm::policy::no_errno>(static_cast<double>(negative))));
+	EXPECT_TRUE(std::isnan(ccm::sqrt<ccm::policy::no_errno>(static_cast<float>(negative))));
+	EXPECT_EQ(errno, 0);
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr long double eps = std::numeric_limits<double>::epsilon();
+
+	bool same_value(double a, double b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	// Near their zeros J and Y are only accurate relative to sqrt(J^2 + Y^2), so their error is measured against that.
+	long double modulus_error(double value, long double expected, long double j, long double y)
+	{
+		return std::fabs(value - expected) / std::sqrt(j * j + y * y);
+	}
+
+	long double relative_error(double value, long double expected)
+	{
+		return std::fabs(value - expected) / std::fabs(expected);
+	}
+
+	struct reference
+	{
+		double nu;
+		double x;
+		long double j;
+		long double y;
+		long double i;
+		long double k;
+	};
+} // namespace
+
+TEST(CcmathSpecialTests, CylBessel_StaticAssert)
+{
+	static_assert(ccm::cyl_bessel_j(0.0, 0.0) == 1.0, "ccm::cyl_bessel_j is not a compile time constant!");
+	static_assert(ccm::cyl_bessel_j(1.5, 2.0) > 0.0, "ccm::cyl_bessel_j is not a compile time constant!");
+	static_assert(ccm::cyl_neumann(0.5F, 3.0F) > 0.0F, "ccm::cyl_neumann is not a compile time constant!");
+	static_assert(ccm::cyl_bessel_i(2.0, 1.0) > 0.0, "ccm::cyl_bessel_i is not a compile time constant!");
+	static_assert(ccm::cyl_bessel_k(0.25, 4.0) > 0.0, "ccm::cyl_bessel_k is not a compile time constant!");
+}
+
+TEST(CcmathSpecialTests, CylBessel_SpecialValues)
+{
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	for (const double nu : {0.0, 0.5, 1.0, 2.75, 40.0})
+	{
+		EXPECT_EQ(ccm::cyl_bessel_j(nu, 0.0), nu == 0 ? 1.0 : 0.0);
+		EXPECT_EQ(ccm::cyl_bessel_j(nu, inf), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_j(nu, nan)));
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_j(nu, -1.0)));
+		EXPECT_EQ(ccm::cyl_neumann(nu, 0.0), -inf);
+		EXPECT_EQ(ccm::cyl_neumann(nu, inf), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::cyl_neumann(nu, nan)));
+		EXPECT_TRUE(std::isnan(ccm::cyl_neumann(nu, -1.0)));
+		EXPECT_EQ(ccm::cyl_bessel_i(nu, 0.0), nu == 0 ? 1.0 : 0.0);
+		EXPECT_EQ(ccm::cyl_bessel_i(nu, inf), inf);
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_i(nu, nan)));
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_i(nu, -1.0)));
+		EXPECT_EQ(ccm::cyl_bessel_k(nu, 0.0), inf);
+		EXPECT_EQ(ccm::cyl_bessel_k(nu, inf), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_k(nu, nan)));
+		EXPECT_TRUE(std::isnan(ccm::cyl_bessel_k(nu, -1.0)));
+	}
+	EXPECT_TRUE(std::isnan(ccm::cyl_bessel_j(-0.5, 1.0)));
+	EXPECT_TRUE(std::isnan(ccm::cyl_neumann(nan, 1.0)));
+	EXPECT_TRUE(std::isnan(ccm::cyl_bessel_k(-2.0, 1.0)));
+
+	// Past the range of double.
+	EXPECT_EQ(ccm::cyl_neumann(200.0, 1.0), -inf);
+	EXPECT_EQ(ccm::cyl_bessel_j(300.0, 1.0), 0.0);
+	EXPECT_EQ(ccm::cyl_bessel_i(1.0, 1000.0), inf);
+	EXPECT_EQ(ccm::cyl_bessel_i(300.0, 1.0), 0.0);
+	EXPECT_EQ(ccm::cyl_bessel_k(1.0, 1000.0), 0.0);
+	EXPECT_EQ(ccm::cyl_bessel_k(200.0, 1.0), inf);
+
+	EXPECT_EQ(ccm::cyl_bessel_jf(0.0F, 0.0F), 1.0F);
+	EXPECT_EQ(ccm::cyl_bessel_kl(1.0L, 0.0L), std::numeric_limits<long double>::infinity());
+	EXPECT_EQ(ccm::cyl_neumann(2, 0), -inf);
+}
+
+TEST(CcmathSpecialTests, CylBessel_Reference)
+{
+	// Reference values from mpmath at 50 digits.
+	const reference refs[] = {
+		{0.0, 2.5, -0.048383776468197996L, 0.49807035961523189L, 3.289839144050123L, 0.062347553200366186L},
+		{0.5, 0.01, 0.07978712627933422L, -7.97844666907276L, 0.079789785894536928L, 12.40843453284693L},
+		{1.0, 1e-5, 4.9999999999375004e-6L, -63661.97727536548L, 5.0000000000625004e-6L, 99999.999939355707L},
+		{2.25, 7.5, -0.27877071865694806L, -0.10456865573674393L, 187.04466961916167L, 0.00034175747388019611L},
+		{10.0, 3.0, 1.2928351645715884e-5L, -2582.6071294842997L, 1.9464393470612969e-5L, 2459.6204220569468L},
+		{30.5, 35.0, 0.14502585921687657L, 0.12359731607874013L, 315432643.07544046L, 3.4142707765700883e-11L},
+		{0.0, 40.0, 0.0073668905842372896L, 0.12593641705826093L, 14894774793419900.0L, 8.392861100099567e-19L},
+		{100.0, 250.0, 0.040899589806540916L, -0.033251235344535556L, 2.4228705607967021e+98L, 7.6642733967268703e-102L},
+		{3.75, 0.75, 0.0014790385295927762L, -58.683013560085502L, 0.0015692591865064066L, 83.207568280823643L},
+		{60.0, 20.0, 2.2809263887335596e-23L, -2.4670257583513079e+20L, 6.0629297550856557e-22L, 1.3039253298517453e+19L},
+		{7.5, 1000.0, 0.013600100212583395L, 0.021252643897897824L, std::numeric_limits<long double>::infinity(), 0.0L},
+	};
+	const auto tol = 64 * eps;
+	for (auto const & r : refs)
+	{
+		EXPECT_LE(modulus_error(ccm::cyl_bessel_j(r.nu, r.x), r.j, r.j, r.y), tol) << "nu = " << r.nu << ", x = " << r.x;
+		EXPECT_LE(modulus_error(ccm::cyl_neumann(r.nu, r.x), r.y, r.j, r.y), tol) << "nu = " << r.nu << ", x = " << r.x;
+		// I_7.5(1000) and K_7.5(1000) are past the range of double.
+		if (std::isinf(r.i)) { EXPECT_EQ(ccm::cyl_bessel_i(r.nu, r.x), std::numeric_limits<double>::infinity()); }
+		else { EXPECT_LE(relative_error(ccm::cyl_bessel_i(r.nu, r.x), r.i), tol) << "nu = " << r.nu << ", x = " << r.x; }
+		if (r.k == 0) { EXPECT_EQ(ccm::cyl_bessel_k(r.nu, r.x), 0.0); }
+		else { EXPECT_LE(relative_error(ccm::cyl_bessel_k(r.nu, r.x), r.k), tol) << "nu = " << r.nu << ", x = " << r.x; }
+	}
+}
+
+// libc++ has no std special math functions.
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+TEST(CcmathSpecialTests, CylBessel_MatchesStd)
+{
+	std::mt19937_64 rng(61);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	for (int i = 0; i < 4000; ++i)
+	{
+		const double nu = i % 4 == 0 ? std::floor(dist(rng) * 20) : dist(rng) * 40;
+		// Small, near the turning point x ~ nu and past it.
+		const double u = dist(rng);
+		const double x = i % 3 == 0 ? u * 2 + 1e-3 : (i % 3 == 1 ? (0.5 + u) * (nu + 1) : u * 100 + 1e-3);
+		const auto tol = 256 * eps;
+		const long double j = std::cyl_bessel_j(static_cast<long double>(nu), static_cast<long double>(x));
+		const long double y = std::cyl_neumann(static_cast<long double>(nu), static_cast<long double>(x));
+		EXPECT_LE(modulus_error(ccm::cyl_bessel_j(nu, x), j, j, y), tol) << "nu = " << nu << ", x = " << x;
+		if (std::fabs(y) < std::numeric_limits<double>::max()) { EXPECT_LE(modulus_error(ccm::cyl_neumann(nu, x), y, j, y), tol) << "nu = " << nu << ", x = " << x; }
+		const long double bi = std::cyl_bessel_i(static_cast<long double>(nu), static_cast<long double>(x));
+		const long double bk = std::cyl_bessel_k(static_cast<long double>(nu), static_cast<long double>(x));
+		if (std::fabs(bi) > std::numeric_limits<double>::min()) { EXPECT_LE(relative_error(ccm::cyl_bessel_i(nu, x), bi), tol) << "nu = " << nu << ", x = " << x; }
+		if (std::fabs(bk) < std::numeric_limits<double>::max()) { EXPECT_LE(relative_error(ccm::cyl_bessel_k(nu, x), bk), tol) << "nu = " << nu << ", x = " << x; }
+	}
+}
+#endif
+
+TEST(CcmathSpecialTests, CylBessel_All_MatchesSingle)
+{
+	constexpr unsigned n_max = 60;
+	std::vector<double> v(n_max + 1);
+	for (const double nu : {0.0, 0.25, 0.5, 3.75, 41.0})
+	{
+		for (const double x : {0.0, 1e-300, 1e-9, 0.5, 1.99, 2.0, 3.0, 42.0, 149.5, 600.0, 2000.0, 1e7, -1.0, std::numeric_limits<double>::infinity(),
+							   std::numeric_limits<double>::quiet_NaN()})
+		{
+			// The downward recurrence for J and I starts from nu + n_max rather than from each order.
+			ccm::cyl_bessel_j_all(nu, n_max, x, v.data());
+			for (unsigned k = 0; k <= n_max; ++k)
+			{
+				const double single = ccm::cyl_bessel_j(nu + k, x);
+				if (std::isnan(single)) { EXPECT_TRUE(std::isnan(v[k])) << "nu = " << nu + k << ", x = " << x; }
+				else
+				{
+					const double envelope = std::max(std::min(1.0, 1.0 / std::sqrt(x)), std::fabs(single));
+					EXPECT_LE(std::fabs(v[k] - single), 64 * eps * envelope) << "nu = " << nu + k << ", x = " << x;
+				}
+			}
+			ccm::cyl_bessel_i_all(nu, n_max, x, v.data());
+			for (unsigned k = 0; k <= n_max; ++k)
+			{
+				const double single = ccm::cyl_bessel_i(nu + k, x);
+				if (std::isnan(single) || std::isinf(single) || single == 0) { EXPECT_TRUE(same_value(v[k], single)) << "nu = " << nu + k << ", x = " << x; }
+				else { EXPECT_LE(std::fabs(v[k] - single), 64 * eps * std::fabs(single)) << "nu = " << nu + k << ", x = " << x; }
+			}
+			ccm::cyl_neumann_all(nu, n_max, x, v.data());
+			for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(v[k], ccm::cyl_neumann(nu + k, x))) << "nu = " << nu + k << ", x = " << x; }
+			ccm::cyl_bessel_k_all(nu, n_max, x, v.data());
+			for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(v[k], ccm::cyl_bessel_k(nu + k, x))) << "nu = " << nu + k << ", x = " << x; }
+		}
+	}
+}
+
+TEST(CcmathSpecialTests, CylBessel_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(67);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	for (int round = 0; round < 400; ++round)
+	{
+		const double nu = round % 3 == 0 ? static_cast<double>(round % 50) : dist(rng) * 80;
+		// Lanes on either side of 2 and of Hankel's limit take different paths in the same block.
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = i % 2 == 0 ? dist(rng) * 4 : dist(rng) * (nu * nu / 4 + 60); }
+		if (round % 5 == 0) { lanes[0] = round % 2 == 0 ? 1e-9 : std::numeric_limits<double>::quiet_NaN(); }
+		if (round % 11 == 0) { lanes[width - 1] = round % 2 == 0 ? std::numeric_limits<double>::infinity() : -3.0; }
+		if (round % 13 == 0) { lanes[width / 2] = round % 2 == 0 ? 0.0 : 3000.0; }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+
+		double j[width];
+		double y[width];
+		double bi[width];
+		double bk[width];
+		ccm::cyl_bessel_j(nu, v).copy_to(j, ccm::intrin::element_aligned_tag());
+		ccm::cyl_neumann(nu, v).copy_to(y, ccm::intrin::element_aligned_tag());
+		ccm::cyl_bessel_i(nu, v).copy_to(bi, ccm::intrin::element_aligned_tag());
+		ccm::cyl_bessel_k(nu, v).copy_to(bk, ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			EXPECT_TRUE(same_value(j[i], ccm::cyl_bessel_j(nu, lanes[i]))) << "nu = " << nu << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(y[i], ccm::cyl_neumann(nu, lanes[i]))) << "nu = " << nu << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(bi[i], ccm::cyl_bessel_i(nu, lanes[i]))) << "nu = " << nu << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(bk[i], ccm::cyl_bessel_k(nu, lanes[i]))) << "nu = " << nu << ", x = " << lanes[i];
+		}
+	}
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr long double eps = std::numeric_limits<double>::epsilon();
+
+	bool same_value(double a, double b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	// Bound of |H_n(x)| up to a small factor, e^(x^2 / 2) sqrt(2^n n!).
+	long double hermite_scale(unsigned n, double x)
+	{
+		const auto ln = static_cast<long double>(n);
+		const auto lx = static_cast<long double>(x);
+		return std::exp(lx * lx / 2 + (ln * std::log(2.0L) + std::lgamma(ln + 1)) / 2);
+	}
+} // namespace
+
+TEST(CcmathSpecialTests, Hermite_StaticAssert)
+{
+	static_assert(ccm::hermite(3, 1.0) == -4.0, "ccm::hermite is not a compile time constant!");
+	static_assert(ccm::hermite(2, 0.5F) == -1.0F, "ccm::hermite is not a compile time constant!");
+}
+
+TEST(CcmathSpecialTests, Hermite_SpecialValues)
+{
+	EXPECT_TRUE(std::isnan(ccm::hermite(0, std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::hermite(5, std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::hermite(0, std::numeric_limits<double>::infinity()), 1.0);
+	EXPECT_EQ(ccm::hermite(4, 0), 12.0);
+	EXPECT_EQ(ccm::hermite(5, -0.0), 0.0);
+	EXPECT_EQ(ccm::hermitef(1, 1.5F), 3.0F);
+	EXPECT_EQ(ccm::hermitel(2, 1.0L), 2.0L);
+}
+
+TEST(CcmathSpecialTests, Hermite_Overflow)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	// Past the range of double the values are the infinity of their sign, H_1000(0.5) being about -3.5e1433.
+	EXPECT_EQ(ccm::hermite(300, 30.0), inf);
+	EXPECT_EQ(ccm::hermite(300, -30.0), inf);
+	EXPECT_EQ(ccm::hermite(301, -30.0), -inf);
+	EXPECT_EQ(ccm::hermite(999, 0.5), inf);
+	EXPECT_EQ(ccm::hermite(1000, 0.5), -inf);
+	EXPECT_EQ(ccm::hermite(1001, 0.5), -inf);
+	EXPECT_EQ(ccm::hermite(1002, 0.5), inf);
+	EXPECT_EQ(ccm::hermite(3, 1e200), inf);
+	EXPECT_EQ(ccm::hermitef(40, 100.0F), std::numeric_limits<float>::infinity());
+	for (unsigned n = 1; n < 12; ++n)
+	{
+		EXPECT_EQ(ccm::hermite(n, inf), inf) << "n = " << n;
+		EXPECT_EQ(ccm::hermite(n, -inf), n % 2 == 0 ? inf : -inf) << "n = " << n;
+	}
+
+	std::vector<double> h(1101);
+	ccm::hermite_all(1100, 0.5, h.data());
+	for (unsigned k = 0; k <= 1100; ++k) { EXPECT_TRUE(same_value(h[k], ccm::hermite(k, 0.5))) << "n = " << k; }
+	EXPECT_EQ(h[1000], -inf);
+}
+
+TEST(CcmathSpecialTests, Hermite_Reference)
+{
+	// Reference values from mpmath at 40 digits.
+	EXPECT_LE(std::fabs(ccm::hermite(6, 0.7) - 125.081536L), 2 * eps * 7 * hermite_scale(6, 0.7));
+	EXPECT_LE(std::fabs(ccm::hermite(25, -2.5) - 2.0876329380809686e+17L), 2 * eps * 26 * hermite_scale(25, -2.5));
+	EXPECT_LE(std::fabs(ccm::hermite(60, 4.25) - -1.9770752244390473e+51L), 2 * eps * 61 * hermite_scale(60, 4.25));
+}
+
+// libc++ has no std special math functions.
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+TEST(CcmathSpecialTests, Hermite_MatchesStd)
+{
+	std::mt19937_64 rng(43);
+	std::uniform_real_distribution<double> dist(-8.0, 8.0);
+	for (int i = 0; i < 20000; ++i)
+	{
+		const auto n   = static_cast<unsigned>(rng() % 100);
+		const double x = dist(rng);
+		EXPECT_LE(std::fabs(ccm::hermite(n, x) - std::hermite(n, static_cast<long double>(x))), 2 * eps * static_cast<long double>(n + 1) * hermite_scale(n, x))
+			<< "n = " << n << ", x = " << x;
+	}
+}
+#endif
+
+TEST(CcmathSpecialTests, Hermite_All_MatchesSingle)
+{
+	constexpr unsigned n_max = 120;
+	std::vector<double> h(n_max + 1);
+	for (const double x : {-7.5, -1.0, 0.0, 0.3, 2.0, 25.0, std::numeric_limits<double>::quiet_NaN()})
+	{
+		ccm::hermite_all(n_max, x, h.data());
+		for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(h[k], ccm::hermite(k, x))) << "n = " << k << ", x = " << x; }
+	}
+}
+
+TEST(CcmathSpecialTests, Hermite_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(47);
+	std::uniform_real_distribution<double> dist(-10.0, 10.0);
+	for (int round = 0; round < 500; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = round % 7 == 0 && i == 0 ? std::numeric_limits<double>::quiet_NaN() : dist(rng); }
+		if (round % 11 == 0) { lanes[width - 1] = round % 2 == 0 ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity(); }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		// Degrees from 400 on overflow in some lanes and not in others.
+		const auto n = static_cast<unsigned>(round % 5 == 0 ? 400 + round : round % 90);
+
+		double h[width];
+		ccm::hermite(n, v).copy_to(h, ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < width; ++i) { EXPECT_TRUE(same_value(h[i], ccm::hermite(n, lanes[i]))) << "n = " << n << ", x = " << lanes[i]; }
+	}
+}
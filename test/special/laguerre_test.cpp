@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr long double eps = std::numeric_limits<double>::epsilon();
+
+	bool same_value(double a, double b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	// Bound of |L_n^m(x)| up to a small factor, e^(x / 2) (n + m)! / (n! m!).
+	long double assoc_laguerre_scale(unsigned n, unsigned m, double x)
+	{
+		const auto ln = static_cast<long double>(n);
+		const auto lm = static_cast<long double>(m);
+		return std::exp(static_cast<long double>(x) / 2 + std::lgamma(ln + lm + 1) - std::lgamma(ln + 1) - std::lgamma(lm + 1));
+	}
+} // namespace
+
+TEST(CcmathSpecialTests, Laguerre_StaticAssert)
+{
+	static_assert(ccm::laguerre(2, 1.0) == -0.5, "ccm::laguerre is not a compile time constant!");
+	static_assert(ccm::assoc_laguerre(1, 3, 0.5F) == 3.5F, "ccm::assoc_laguerre is not a compile time constant!");
+}
+
+TEST(CcmathSpecialTests, Laguerre_SpecialValues)
+{
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	for (unsigned n = 0; n < 40; ++n)
+	{
+		EXPECT_EQ(ccm::laguerre(n, 0.0), 1.0);
+		EXPECT_TRUE(std::isnan(ccm::laguerre(n, -0.5)));
+		EXPECT_TRUE(std::isnan(ccm::laguerre(n, nan)));
+		EXPECT_TRUE(std::isnan(ccm::assoc_laguerre(n, 3, -std::numeric_limits<double>::infinity())));
+		EXPECT_TRUE(std::isnan(ccm::assoc_laguerre(n, 2, nan)));
+	}
+	// L_n^m(0) is the binomial coefficient (n + m choose n).
+	EXPECT_EQ(ccm::assoc_laguerre(3, 2, 0.0), 10.0);
+	EXPECT_EQ(ccm::laguerre(0, std::numeric_limits<double>::infinity()), 1.0);
+	EXPECT_EQ(ccm::laguerre(1, 2), -1.0);
+	EXPECT_EQ(ccm::laguerref(1, 0.25F), 0.75F);
+	EXPECT_EQ(ccm::assoc_laguerrel(1, 1, 0.5L), 1.5L);
+}
+
+TEST(CcmathSpecialTests, Laguerre_Overflow)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	// L_n^m(x) behaves like (-x)^n / n! for large x.
+	EXPECT_EQ(ccm::laguerre(50, 1e300), inf);
+	EXPECT_EQ(ccm::laguerre(51, 1e300), -inf);
+	EXPECT_EQ(ccm::assoc_laguerre(2, 5, 1e200), inf);
+	EXPECT_EQ(ccm::laguerref(30, 1e6F), std::numeric_limits<float>::infinity());
+	for (unsigned n = 1; n < 12; ++n)
+	{
+		EXPECT_EQ(ccm::laguerre(n, inf), n % 2 == 0 ? inf : -inf) << "n = " << n;
+		EXPECT_EQ(ccm::assoc_laguerre(n, 3, inf), n % 2 == 0 ? inf : -inf) << "n = " << n;
+	}
+
+	std::vector<double> l(121);
+	ccm::laguerre_all(120, 1e100, l.data());
+	for (unsigned k = 0; k <= 120; ++k) { EXPECT_TRUE(same_value(l[k], ccm::laguerre(k, 1e100))) << "n = " << k; }
+	EXPECT_EQ(l[120], inf);
+}
+
+TEST(CcmathSpecialTests, Laguerre_Reference)
+{
+	// Reference values from mpmath at 40 digits.
+	EXPECT_LE(std::fabs(ccm::laguerre(4, 1.5) - -0.2890625L), 16 * eps * 5 * assoc_laguerre_scale(4, 0, 1.5));
+	EXPECT_LE(std::fabs(ccm::laguerre(30, 12.0) - 34.78047802431294L), 16 * eps * 31 * assoc_laguerre_scale(30, 0, 12.0));
+	EXPECT_LE(std::fabs(ccm::assoc_laguerre(12, 5, 3.25) - 50.392423794073295L), 16 * eps * 13 * assoc_laguerre_scale(12, 5, 3.25));
+	EXPECT_LE(std::fabs(ccm::assoc_laguerre(80, 3, 40.0) - 109070142.6959318L), 16 * eps * 81 * assoc_laguerre_scale(80, 3, 40.0));
+}
+
+// libc++ has no std special math functions.
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+TEST(CcmathSpecialTests, Laguerre_MatchesStd)
+{
+	std::mt19937_64 rng(37);
+	std::uniform_real_distribution<double> dist(0.0, 40.0);
+	for (int i = 0; i < 20000; ++i)
+	{
+		const auto n   = static_cast<unsigned>(rng() % 100);
+		const auto m   = static_cast<unsigned>(rng() % 12);
+		const double x = i % 4 == 0 ? dist(rng) / 64 : dist(rng);
+		EXPECT_LE(std::fabs(ccm::assoc_laguerre(n, m, x) - std::assoc_laguerre(n, m, static_cast<long double>(x))),
+				  16 * eps * static_cast<long double>(n + 1) * assoc_laguerre_scale(n, m, x))
+			<< "n = " << n << ", m = " << m << ", x = " << x;
+		EXPECT_LE(std::fabs(ccm::laguerre(n, x) - std::laguerre(n, static_cast<long double>(x))),
+				  16 * eps * static_cast<long double>(n + 1) * assoc_laguerre_scale(n, 0, x))
+			<< "n = " << n << ", x = " << x;
+	}
+}
+#endif
+
+TEST(CcmathSpecialTests, Laguerre_All_MatchesSingle)
+{
+	constexpr unsigned n_max = 80;
+	std::vector<double> l(n_max + 1);
+	for (const double x : {0.0, 0.125, 1.0, 7.5, 33.0, 120.0, -1.0, std::numeric_limits<double>::quiet_NaN()})
+	{
+		for (const unsigned m : {0U, 1U, 6U})
+		{
+			ccm::assoc_laguerre_all(n_max, m, x, l.data());
+			for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(l[k], ccm::assoc_laguerre(k, m, x))) << "n = " << k << ", m = " << m << ", x = " << x; }
+		}
+		ccm::laguerre_all(n_max, x, l.data());
+		for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(l[k], ccm::laguerre(k, x))) << "n = " << k << ", x = " << x; }
+	}
+}
+
+TEST(CcmathSpecialTests, Laguerre_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(41);
+	std::uniform_real_distribution<double> dist(-2.0, 50.0);
+	for (int round = 0; round < 500; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = round % 7 == 0 && i == 0 ? std::numeric_limits<double>::quiet_NaN() : dist(rng); }
+		// Large arguments overflow from degree 40 or so, and +inf in every degree from 1.
+		if (round % 5 == 0) { lanes[width - 1] = round % 2 == 0 ? std::numeric_limits<double>::infinity() : 1e20 * round; }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		const auto n = static_cast<unsigned>(round % 60);
+		const auto m = static_cast<unsigned>(round % 9);
+
+		double l[width];
+		double lm[width];
+		ccm::laguerre(n, v).copy_to(l, ccm::intrin::element_aligned_tag());
+		ccm::assoc_laguerre(n, m, v).copy_to(lm, ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			EXPECT_TRUE(same_value(l[i], ccm::laguerre(n, lanes[i]))) << "n = " << n << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(lm[i], ccm::assoc_laguerre(n, m, lanes[i]))) << "n = " << n << ", m = " << m << ", x = " << lanes[i];
+		}
+	}
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr long double eps = std::numeric_limits<double>::epsilon();
+
+	bool same_value(double a, double b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	// Bound of |P_n^m| on [-1, 1] up to a small factor, sqrt((n + m)! / (n - m)!).
+	long double assoc_legendre_scale(unsigned n, unsigned m)
+	{
+		return std::sqrt(std::exp(std::lgamma(static_cast<long double>(n + m + 1)) - std::lgamma(static_cast<long double>(n - m + 1))));
+	}
+} // namespace
+
+TEST(CcmathSpecialTests, Legendre_StaticAssert)
+{
+	static_assert(ccm::legendre(3, 0.5) == -0.4375, "ccm::legendre is not a compile time constant!");
+	static_assert(ccm::assoc_legendre(2, 2, 0.5F) == 2.25F, "ccm::assoc_legendre is not a compile time constant!");
+	static_assert(ccm::sph_legendre(3, 4, 1.0) == 0.0, "ccm::sph_legendre is not a compile time constant!");
+	static_assert(ccm::sph_legendre(0, 0, 0.25) > 0.28, "ccm::sph_legendre is not a compile time constant!");
+}
+
+TEST(CcmathSpecialTests, Legendre_SpecialValues)
+{
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	for (unsigned n = 0; n < 40; ++n)
+	{
+		EXPECT_EQ(ccm::legendre(n, 1.0), 1.0);
+		EXPECT_EQ(ccm::legendre(n, -1.0), n % 2 == 0 ? 1.0 : -1.0);
+		EXPECT_TRUE(std::isnan(ccm::legendre(n, 1.5)));
+		EXPECT_TRUE(std::isnan(ccm::legendre(n, nan)));
+		EXPECT_TRUE(std::isnan(ccm::assoc_legendre(n, 2, -1.5)));
+		EXPECT_TRUE(std::isnan(ccm::assoc_legendre(n, n + 1, nan)));
+		EXPECT_EQ(ccm::assoc_legendre(n, n + 1, 0.5), 0.0);
+		EXPECT_EQ(ccm::sph_legendre(n, n + 1, 0.5), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::sph_legendre(n, 1, std::numeric_limits<double>::infinity())));
+		EXPECT_TRUE(std::isnan(ccm::sph_legendre(n, 0, nan)));
+	}
+	EXPECT_EQ(ccm::legendre(2, 0), -0.5);
+	EXPECT_EQ(ccm::legendref(2, 0.5F), -0.125F);
+	EXPECT_EQ(ccm::legendrel(1, 0.25L), 0.25L);
+}
+
+TEST(CcmathSpecialTests, Legendre_Overflow)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	// P_m^m = (2m - 1)!! (1 - x^2)^(m / 2) passes the range of double from m = 150 or so, P_160^150(0.5) being about
+	// 1.9e312.
+	EXPECT_EQ(ccm::assoc_legendre(160, 150, 0.5), inf);
+	EXPECT_EQ(ccm::assoc_legendre(200, 150, 0.5), inf);
+	EXPECT_EQ(ccm::assoc_legendre(300, 300, 0.0), inf);
+	EXPECT_EQ(ccm::assoc_legendre(301, 300, -0.5), -inf);
+	EXPECT_EQ(ccm::assoc_legendre(300, 300, 1.0), 0.0);
+
+	std::vector<double> p(301);
+	ccm::assoc_legendre_all(300, 150, 0.5, p.data());
+	for (unsigned l = 0; l <= 300; ++l) { EXPECT_TRUE(same_value(p[l], ccm::assoc_legendre(l, 150, 0.5))) << "l = " << l; }
+	EXPECT_TRUE(std::isfinite(p[150]));
+	EXPECT_EQ(p[160], inf);
+}
+
+TEST(CcmathSpecialTests, Legendre_Reference)
+{
+	// Reference values from mpmath at 40 digits, assoc_legendre without the Condon-Shortley phase.
+	const auto tol = [](unsigned n, long double scale) { return 8 * eps * static_cast<long double>(n + 1) * scale; };
+	EXPECT_LE(std::fabs(ccm::legendre(5, 0.3) - 0.34538625L), tol(5, 1));
+	EXPECT_LE(std::fabs(ccm::legendre(17, -0.71) - -0.21610063006308303L), tol(17, 1));
+	EXPECT_LE(std::fabs(ccm::legendre(50, 0.999) - 0.07802336402245927L), tol(50, 1));
+	EXPECT_LE(std::fabs(ccm::legendre(99, 0.125) - 0.007704765505485767L), tol(99, 1));
+	EXPECT_LE(std::fabs(ccm::assoc_legendre(5, 2, 0.3) - -10.462725L), tol(5, assoc_legendre_scale(5, 2)));
+	EXPECT_LE(std::fabs(ccm::assoc_legendre(20, 7, -0.6) - 80207192.76979776L), tol(20, assoc_legendre_scale(20, 7)));
+	EXPECT_LE(std::fabs(ccm::assoc_legendre(60, 11, 0.9) - 1.970522310408299e+18L), tol(60, assoc_legendre_scale(60, 11)));
+	EXPECT_LE(std::fabs(ccm::sph_legendre(4, 2, 0.5) - 0.3376275256105923L), tol(4, 5));
+	EXPECT_LE(std::fabs(ccm::sph_legendre(30, 5, 2.0) - 0.11142073319421801L), tol(30, 31));
+	EXPECT_LE(std::fabs(ccm::sph_legendre(75, 10, 1.1) - -0.20514343915409441L), tol(75, 76));
+}
+
+// libc++ has no std special math functions.
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+TEST(CcmathSpecialTests, Legendre_MatchesStd)
+{
+	std::mt19937_64 rng(29);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	std::uniform_real_distribution<double> angle(-1.0, 7.0);
+	for (int i = 0; i < 20000; ++i)
+	{
+		const auto n	 = static_cast<unsigned>(rng() % 100);
+		const auto m	 = static_cast<unsigned>(rng() % 12);
+		const double x	 = dist(rng);
+		const double th	 = angle(rng);
+		const auto scale = eps * static_cast<long double>(n + 1);
+		EXPECT_LE(std::fabs(ccm::legendre(n, x) - std::legendre(n, static_cast<long double>(x))), 8 * scale) << "n = " << n << ", x = " << x;
+		if (m <= n)
+		{
+			EXPECT_LE(std::fabs(ccm::assoc_legendre(n, m, x) - std::assoc_legendre(n, m, static_cast<long double>(x))), 4 * scale * assoc_legendre_scale(n, m))
+				<< "n = " << n << ", m = " << m << ", x = " << x;
+		}
+		// The values are bounded by sqrt((2l + 1) / (4 pi)), and cos(theta) is rounded before the recurrence sees it.
+		EXPECT_LE(std::fabs(ccm::sph_legendre(n, m, th) - std::sph_legendre(n, m, static_cast<long double>(th))), 4 * scale * (n + 1))
+			<< "l = " << n << ", m = " << m << ", theta = " << th;
+	}
+}
+#endif
+
+TEST(CcmathSpecialTests, Legendre_All_MatchesSingle)
+{
+	constexpr unsigned n_max = 80;
+	std::vector<double> p(n_max + 1);
+	std::vector<float> pf(n_max + 1);
+	for (const double x : {-1.0, -0.75, -0.1, 0.0, 0.3, 0.99, 1.0, 1.25, std::numeric_limits<double>::quiet_NaN()})
+	{
+		for (const unsigned m : {0U, 1U, 5U, 90U})
+		{
+			ccm::assoc_legendre_all(n_max, m, x, p.data());
+			for (unsigned l = 0; l <= n_max; ++l) { EXPECT_TRUE(same_value(p[l], ccm::assoc_legendre(l, m, x))) << "l = " << l << ", m = " << m << ", x = " << x; }
+			ccm::sph_legendre_all(n_max, m, 3 * x, p.data());
+			for (unsigned l = 0; l <= n_max; ++l) { EXPECT_TRUE(same_value(p[l], ccm::sph_legendre(l, m, 3 * x))) << "l = " << l << ", m = " << m << ", x = " << x; }
+		}
+		ccm::legendre_all(n_max, x, p.data());
+		for (unsigned l = 0; l <= n_max; ++l) { EXPECT_TRUE(same_value(p[l], ccm::legendre(l, x))) << "l = " << l << ", x = " << x; }
+		ccm::legendre_all(n_max, static_cast<float>(x), pf.data());
+		for (unsigned l = 0; l <= n_max; ++l) { EXPECT_TRUE(same_value(pf[l], ccm::legendref(l, static_cast<float>(x)))) << "l = " << l << ", x = " << x; }
+	}
+}
+
+TEST(CcmathSpecialTests, Legendre_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(31);
+	std::uniform_real_distribution<double> dist(-1.1, 1.1);
+	for (int round = 0; round < 500; ++round)
+	{
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = round % 7 == 0 && i == 0 ? std::numeric_limits<double>::quiet_NaN() : dist(rng); }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+		// Orders from 150 on overflow for some of the lanes.
+		const auto m = static_cast<unsigned>(round % 10 == 0 ? 140 + round / 10 : round % 9);
+		const auto n = m + static_cast<unsigned>(round % 60);
+
+		double p[width];
+		double pm[width];
+		double y[width];
+		ccm::legendre(n, v).copy_to(p, ccm::intrin::element_aligned_tag());
+		ccm::assoc_legendre(n, m, v).copy_to(pm, ccm::intrin::element_aligned_tag());
+		ccm::sph_legendre(n, m, v * 3.0).copy_to(y, ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			EXPECT_TRUE(same_value(p[i], ccm::legendre(n, lanes[i]))) << "n = " << n << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(pm[i], ccm::assoc_legendre(n, m, lanes[i]))) << "n = " << n << ", m = " << m << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(y[i], ccm::sph_legendre(n, m, lanes[i] * 3.0))) << "l = " << n << ", m = " << m << ", theta = " << lanes[i] * 3.0;
+		}
+	}
+}
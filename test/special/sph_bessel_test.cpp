@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr long double eps = std::numeric_limits<double>::epsilon();
+
+	bool same_value(double a, double b)
+	{
+		return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	// Near their zeros j_n and y_n are only accurate relative to their envelope, which is about 1 / x past the turning
+	// point, so the error is measured against the larger of the two.
+	long double relative_error(double value, long double expected, double x)
+	{
+		const long double envelope = std::max(std::fabs(expected), 1 / static_cast<long double>(x));
+		return std::fabs(value - expected) / envelope;
+	}
+} // namespace
+
+TEST(CcmathSpecialTests, SphBessel_StaticAssert)
+{
+	static_assert(ccm::sph_bessel(0, 0.0) == 1.0, "ccm::sph_bessel is not a compile time constant!");
+	static_assert(ccm::sph_bessel(3, 0.0F) == 0.0F, "ccm::sph_bessel is not a compile time constant!");
+	static_assert(ccm::sph_bessel(20, 1.0) > 0.0, "ccm::sph_bessel is not a compile time constant!");
+	static_assert(ccm::sph_neumann(1, 2.0) < 0.0, "ccm::sph_neumann is not a compile time constant!");
+}
+
+TEST(CcmathSpecialTests, SphBessel_SpecialValues)
+{
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	for (unsigned n = 0; n < 40; ++n)
+	{
+		EXPECT_EQ(ccm::sph_bessel(n, 0.0), n == 0 ? 1.0 : 0.0);
+		EXPECT_EQ(ccm::sph_bessel(n, inf), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::sph_bessel(n, nan)));
+		EXPECT_TRUE(std::isnan(ccm::sph_bessel(n, -1.0)));
+		EXPECT_EQ(ccm::sph_neumann(n, 0.0), -inf);
+		EXPECT_EQ(ccm::sph_neumann(n, inf), 0.0);
+		EXPECT_TRUE(std::isnan(ccm::sph_neumann(n, nan)));
+		EXPECT_TRUE(std::isnan(ccm::sph_neumann(n, -1.0)));
+	}
+	EXPECT_EQ(ccm::sph_neumann(200, 1.0), -inf);
+	EXPECT_EQ(ccm::sph_besself(0, 0.0F), 1.0F);
+	EXPECT_EQ(ccm::sph_bessell(1, 0.0L), 0.0L);
+	EXPECT_EQ(ccm::sph_neumann(2, 0), -inf);
+}
+
+TEST(CcmathSpecialTests, SphBessel_Underflow)
+{
+	// j_500(5) is about 3e-937, and j_206(5) about 1e-308 is just under the normal range.
+	EXPECT_EQ(ccm::sph_bessel(500, 5.0), 0.0);
+	EXPECT_EQ(ccm::sph_bessel(2000, 1.0), 0.0);
+	EXPECT_EQ(ccm::sph_besself(100, 1.0F), 0.0F);
+	EXPECT_GT(ccm::sph_bessel(206, 5.0), 1.0e-308);
+	EXPECT_LT(ccm::sph_bessel(206, 5.0), 1.1e-308);
+
+	constexpr unsigned n_max = 600;
+	std::vector<double> j(n_max + 1);
+	for (const double x : {0.5, 5.0, 40.0})
+	{
+		ccm::sph_bessel_all(n_max, x, j.data());
+		// Every order where the bound (e x / (2n + 1))^n / (2n + 1) of j_n(x) is below 2^-1080 rounds to 0.
+		for (unsigned k = 0; k <= n_max; ++k)
+		{
+			const double log2_bound = (k * std::log(2.718281828459045 * x / (2 * k + 1)) - std::log(2.0 * k + 1)) / std::log(2.0);
+			if (log2_bound > -1080) { continue; }
+			EXPECT_EQ(j[k], 0.0) << "n = " << k << ", x = " << x;
+			EXPECT_EQ(ccm::sph_bessel(k, x), 0.0) << "n = " << k << ", x = " << x;
+		}
+	}
+}
+
+TEST(CcmathSpecialTests, SphBessel_Reference)
+{
+	// Reference values from mpmath at 40 digits.
+	const auto tol = [](unsigned n) { return 8 * eps * static_cast<long double>(n + 1); };
+	EXPECT_LE(relative_error(ccm::sph_bessel(0, 2.5), 0.2393888576415826L, 2.5), tol(0));
+	EXPECT_LE(relative_error(ccm::sph_bessel(3, 0.01), 9.523756613876865e-09L, 0.01), tol(3));
+	EXPECT_LE(relative_error(ccm::sph_bessel(10, 7.5), 0.01125983091529159L, 7.5), tol(10));
+	EXPECT_LE(relative_error(ccm::sph_bessel(40, 35.0), 0.002366595429158108L, 35.0), tol(40));
+	EXPECT_LE(relative_error(ccm::sph_bessel(100, 250.0), 0.0012715566036526336L, 250.0), tol(100));
+	EXPECT_LE(relative_error(ccm::sph_neumann(0, 2.5), 0.3204574462187735L, 2.5), tol(0));
+	EXPECT_LE(relative_error(ccm::sph_neumann(3, 0.5), -246.13004692361645L, 0.5), tol(3));
+	EXPECT_LE(relative_error(ccm::sph_neumann(10, 7.5), -0.8264624471084493L, 7.5), tol(10));
+	EXPECT_LE(relative_error(ccm::sph_neumann(40, 45.0), 0.016475886822079375L, 45.0), tol(40));
+	EXPECT_LE(relative_error(ccm::sph_neumann(100, 250.0), -0.0039821061005128515L, 250.0), tol(100));
+}
+
+// libc++ has no std special math functions.
+#if defined(__cpp_lib_math_special_functions) || defined(__STDCPP_MATH_SPEC_FUNCS__)
+TEST(CcmathSpecialTests, SphBessel_MatchesStd)
+{
+	std::mt19937_64 rng(53);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	for (int i = 0; i < 20000; ++i)
+	{
+		const auto n = static_cast<unsigned>(rng() % 120);
+		// Small, near the turning point x ~ n and far past it.
+		const double u = dist(rng);
+		const double x = i % 3 == 0 ? u * 2 : (i % 3 == 1 ? (0.5 + u) * (n + 1) : u * 400);
+		if (x == 0) { continue; }
+		const auto tol = 8 * eps * static_cast<long double>(n + 1);
+		EXPECT_LE(relative_error(ccm::sph_bessel(n, x), std::sph_bessel(n, static_cast<long double>(x)), x), tol) << "n = " << n << ", x = " << x;
+		const long double y = std::sph_neumann(n, static_cast<long double>(x));
+		if (std::fabs(y) < std::numeric_limits<double>::max())
+		{
+			EXPECT_LE(relative_error(ccm::sph_neumann(n, x), y, x), tol) << "n = " << n << ", x = " << x;
+		}
+	}
+}
+#endif
+
+TEST(CcmathSpecialTests, SphBessel_All_MatchesSingle)
+{
+	constexpr unsigned n_max = 150;
+	std::vector<double> j(n_max + 1);
+	for (const double x : {0.0, 1e-300, 1e-8, 0.5, 3.0, 42.0, 149.5, 151.0, 1000.0, 1e7, -1.0, std::numeric_limits<double>::infinity(),
+						   std::numeric_limits<double>::quiet_NaN()})
+	{
+		// Below n_max the downward recurrence starts from a higher order than it does for the single value.
+		ccm::sph_bessel_all(n_max, x, j.data());
+		for (unsigned k = 0; k <= n_max; ++k)
+		{
+			const double single = ccm::sph_bessel(k, x);
+			if (x > n_max || std::isnan(single)) { EXPECT_TRUE(same_value(j[k], single)) << "n = " << k << ", x = " << x; }
+			else { EXPECT_LE(std::fabs(j[k] - single), 8 * eps * (k + 1) * std::max(std::fabs(single), std::numeric_limits<double>::min())) << "n = " << k << ", x = " << x; }
+		}
+		ccm::sph_neumann_all(n_max, x, j.data());
+		for (unsigned k = 0; k <= n_max; ++k) { EXPECT_TRUE(same_value(j[k], ccm::sph_neumann(k, x))) << "n = " << k << ", x = " << x; }
+	}
+}
+
+TEST(CcmathSpecialTests, SphBessel_Simd_MatchesScalar)
+{
+	using simd_type				= ccm::intrin::native_simd<double>;
+	constexpr std::size_t width = simd_type::size();
+
+	std::mt19937_64 rng(59);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	for (int round = 0; round < 600; ++round)
+	{
+		const auto n = static_cast<unsigned>(round % 7 == 0 ? 300 + round : round % 80);
+		// Lanes below and above the order take Miller's algorithm and the upward recurrence in the same block.
+		double lanes[width];
+		for (std::size_t i = 0; i < width; ++i) { lanes[i] = dist(rng) * 2.5 * (n + 1); }
+		if (round % 5 == 0) { lanes[0] = round % 2 == 0 ? 1e-9 : std::numeric_limits<double>::quiet_NaN(); }
+		if (round % 11 == 0) { lanes[width - 1] = round % 2 == 0 ? std::numeric_limits<double>::infinity() : -3.0; }
+		if (round % 13 == 0) { lanes[width / 2] = 0.0; }
+		const simd_type v(lanes, ccm::intrin::element_aligned_tag());
+
+		double j[width];
+		double y[width];
+		ccm::sph_bessel(n, v).copy_to(j, ccm::intrin::element_aligned_tag());
+		ccm::sph_neumann(n, v).copy_to(y, ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < width; ++i)
+		{
+			EXPECT_TRUE(same_value(j[i], ccm::sph_bessel(n, lanes[i]))) << "n = " << n << ", x = " << lanes[i];
+			EXPECT_TRUE(same_value(y[i], ccm::sph_neumann(n, lanes[i]))) << "n = " << n << ", x = " << lanes[i];
+		}
+	}
+}